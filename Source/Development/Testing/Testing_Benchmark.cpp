@@ -0,0 +1,16 @@
+#include "Testing_Benchmark.h"
+
+// Runs an action repeatedly, measuring its average run time.
+double Testing::Benchmark::averageMicroseconds
+(const int repetitions, const std::function<void(const int)> action)
+{
+    jassert(repetitions > 0);
+    const double startTime = juce::Time::getMillisecondCounterHiRes();
+    for (int i = 0; i < repetitions; i++)
+    {
+        action(i);
+    }
+    const double elapsedMS = juce::Time::getMillisecondCounterHiRes()
+            - startTime;
+    return elapsedMS * 1000.0 / repetitions;
+}
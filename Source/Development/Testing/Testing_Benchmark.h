@@ -0,0 +1,34 @@
+#pragma once
+#include "JuceHeader.h"
+
+/**
+ * @file  Testing_Benchmark.h
+ *
+ * @brief  Measures how long tests take to repeat an action.
+ */
+namespace Testing { class Benchmark; }
+
+/**
+ * @brief  Provides the static timing functions used by tests that compare the
+ *         performance of different implementations.
+ */
+class Testing::Benchmark
+{
+public:
+    /**
+     * @brief  Runs an action repeatedly, measuring its average run time.
+     *
+     *  Test checks should not be made within the action, so the time spent
+     * recording results isn't included in the measurement.
+     *
+     * @param repetitions  The number of times to run the action.
+     *
+     * @param action       The action to measure. It will be passed the number
+     *                     of times it already ran.
+     *
+     * @return             The average number of microseconds needed to run
+     *                     the action once.
+     */
+    static double averageMicroseconds(const int repetitions,
+            const std::function<void(const int)> action);
+};
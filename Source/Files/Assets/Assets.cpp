@@ -1,5 +1,6 @@
 #include "Assets.h"
 #include "Assets_XPMLoader.h"
+#include "Assets_SVGLoader.h"
 
 #ifdef JUCE_DEBUG
 // Print namespace before all debug output:
@@ -9,6 +10,9 @@ static const constexpr char* dbgPrefix = "Assets::";
 // TODO: Select this using XDGDirectories:
 static const constexpr char* assetFolder = "/usr/share/pocket-home/";
 
+// Width and height used when loading SVG files as images:
+static const constexpr int defaultSVGSize = 128;
+
 
 /**
  * @brief  Locates a file from an absolute or local path.
@@ -54,25 +58,8 @@ juce::Image Assets::loadImageAsset
     using juce::Image;
     if (assetName.endsWith(".svg"))
     {
-        Image image;
-        std::unique_ptr<juce::Drawable> svgDrawable
-                (loadSVGDrawable(assetName, lookOutsideAssets));
-        if (svgDrawable != nullptr)
-        {
-            image = Image(Image::ARGB, 128, 128, true);
-            juce::Graphics g(image);
-            juce::Rectangle<float> imgBounds(0, 0, image.getWidth(),
-                    image.getHeight());
-            juce::Rectangle<float> svgBounds = ((juce::DrawableComposite*)
-                    svgDrawable.get())->getContentArea();
-            juce::RectanglePlacement svgPlacement(
-                    juce::RectanglePlacement::centred);
-            juce::AffineTransform svgTransform = svgPlacement.getTransformToFit(
-                    svgBounds, imgBounds);
-            svgDrawable->draw(g, 1.f, svgTransform);
-        }
-        return image;
-
+        return loadSVGImage(assetName, defaultSVGSize, defaultSVGSize,
+                lookOutsideAssets);
     }
     juce::File imageFile = findAssetFile(assetName, lookOutsideAssets);
     if (assetName.endsWith(".xpm"))
@@ -84,26 +71,22 @@ juce::Image Assets::loadImageAsset
 }
 
 
+// Draws a SVG asset file into a new Image object.
+juce::Image Assets::loadSVGImage(const juce::String& assetName,
+        const int width, const int height, bool lookOutsideAssets)
+{
+    const SVGLoader svgLoader;
+    return svgLoader.loadImage(findAssetFile(assetName, lookOutsideAssets),
+            width, height);
+}
+
+
 // Creates a Drawable object from an svg asset file.
 std::unique_ptr<juce::Drawable> Assets::loadSVGDrawable
 (const juce::String& assetName, bool lookOutsideAssets)
 {
-    juce::File svgFile = findAssetFile(assetName, lookOutsideAssets);
-    if (!svgFile.existsAsFile() || svgFile.getFileExtension() != ".svg")
-    {
-        DBG(dbgPrefix << __func__ << ": File \"" << svgFile.getFileName()
-                << "\" not found.");
-        return nullptr;
-    }
-    std::unique_ptr<juce::XmlElement> svgElement
-            (juce::XmlDocument::parse(svgFile));
-    if (svgElement == nullptr)
-    {
-        DBG(dbgPrefix << __func__ << ": File \"" << svgFile.getFileName()
-                << "\" is not a valid svg file.");
-        return nullptr;
-    }
-    return juce::Drawable::createFromSVG(*svgElement);
+    const SVGLoader svgLoader;
+    return svgLoader.loadDrawable(findAssetFile(assetName, lookOutsideAssets));
 }
 
 
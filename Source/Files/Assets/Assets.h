@@ -44,6 +44,34 @@ namespace Assets
     juce::Image loadImageAsset(const juce::String& assetName,
             bool lookOutsideAssets = true);
 
+    /**
+     * @brief  Draws a SVG asset file into a new Image object.
+     *
+     *  SVG images are drawn into offscreen components, so this may safely be
+     * called from any thread without locking the message thread.
+     *
+     *  SVG files are only parsed again if they change, and drawn images are
+     * cached by size, so loading the same SVG image again is fast.
+     *
+     * @param assetName          The name of a .svg file in the asset folder.
+     *
+     * @param width              The width in pixels of the new image.
+     *
+     * @param height             The height in pixels of the new image.
+     *
+     * @param lookOutsideAssets  If the .svg isn't found in the asset folder,
+     *                           and this value is set to true, findAssetFile
+     *                           will attempt to treat assetName as a path, and
+     *                           load the .svg from elsewhere in the file
+     *                           system.
+     *
+     * @return                   The SVG drawn centered within the image
+     *                           bounds, or Image() if no valid .svg file was
+     *                           found.
+     */
+    juce::Image loadSVGImage(const juce::String& assetName, const int width,
+            const int height, bool lookOutsideAssets = true);
+
     /**
      * @brief  Creates a Drawable object from a SVG asset file.
      *
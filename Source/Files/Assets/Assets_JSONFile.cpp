@@ -66,24 +66,41 @@ Assets::JSONFile::~JSONFile()
 }
 
 
+// Checks if any JSON data changed since it was last written to the file.
+bool Assets::JSONFile::hasUnwrittenChanges() const
+{
+    return unwrittenChanges && !jsonData.isVoid();
+}
+
+
+// Marks all current JSON data as matching the file's contents, so that it won't
+// be written back to the file.
+void Assets::JSONFile::markChangesSaved()
+{
+    unwrittenChanges = false;
+}
+
+
 // Re-writes all data back to the config file, as long as there are changes to
 // write.
 void Assets::JSONFile::writeChanges()
 {
     using namespace juce;
-    if (!unwrittenChanges || jsonData.isVoid())
+    if (!hasUnwrittenChanges())
     {
         return;
     }
     String jsonText = JSON::toString(jsonData, false, decimalPlacesSaved);
     File jsonFile = Assets::findAssetFile(filePath);
-    if (!jsonFile.replaceWithText(jsonText))
+    TemporaryFile tempFile(jsonFile);
+    if (!tempFile.getFile().replaceWithText(jsonText)
+            || !tempFile.overwriteTargetFileWithTemporary())
     {
         throw FileException(filePath, "Writing changes failed.");
     }
     else
     {
-    jsonFile.setLastModificationTime(Time::getCurrentTime());
+        jsonFile.setLastModificationTime(Time::getCurrentTime());
         unwrittenChanges = false;
     }
 }
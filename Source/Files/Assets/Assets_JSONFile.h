@@ -156,10 +156,30 @@ public:
                 (jsonData.getProperty(key, var()));
     }
 
+    /**
+     * @brief  Checks if any JSON data changed since it was last written to the
+     *         file.
+     *
+     * @return  Whether writeChanges would rewrite the file.
+     */
+    bool hasUnwrittenChanges() const;
+
+    /**
+     * @brief  Marks all current JSON data as matching the file's contents, so
+     *         that it won't be written back to the file.
+     *
+     *  This should only be used after copying data that was just read from
+     * the file itself.
+     */
+    void markChangesSaved();
+
     /**
      * @brief  Rewrites all data back to the config file, as long as there are
      *         changes to write.
      *
+     *  Data is written to a temporary file which then replaces the JSON file,
+     * so the JSON file is never left partially written.
+     *
      * @throws FileException  If changes could not be written to the file.
      */
     void writeChanges();
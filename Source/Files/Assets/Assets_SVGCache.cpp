@@ -0,0 +1,128 @@
+#include "Assets_SVGCache.h"
+
+// SharedResource object key:
+const juce::Identifier Assets::SVGCache::resourceKey = "Assets::SVGCache";
+
+// Maximum number of parsed SVG files to keep:
+static const constexpr size_t maxParsedFiles = 64;
+
+// Maximum total size in bytes of all cached SVG images:
+static const constexpr size_t rasterByteBudget = 4 * 1024 * 1024;
+
+Assets::SVGCache::SVGCache() : SharedResource::Resource(resourceKey),
+rasterCache(rasterByteBudget) { }
+
+
+// Sorts keys by path, then by modification time, size, and colour
+// substitutions.
+bool Assets::SVGCache::RasterKey::operator<(const RasterKey& rhs) const
+{
+    if (path != rhs.path)
+    {
+        return path < rhs.path;
+    }
+    if (modTime != rhs.modTime)
+    {
+        return modTime < rhs.modTime;
+    }
+    if (width != rhs.width)
+    {
+        return width < rhs.width;
+    }
+    if (height != rhs.height)
+    {
+        return height < rhs.height;
+    }
+    return colours < rhs.colours;
+}
+
+
+// Gets a string that uniquely represents this key.
+juce::String Assets::SVGCache::RasterKey::toString() const
+{
+    return path + ":" + juce::String(modTime) + ":" + juce::String(width)
+            + "x" + juce::String(height) + ":" + colours;
+}
+
+
+// Creates a copy of a cached Drawable parsed from an SVG file, marking it as
+// the most recently used Drawable.
+std::unique_ptr<juce::Drawable> Assets::SVGCache::copyDrawable
+(const juce::String& path, const juce::int64 modTime)
+{
+    auto parsedIter = parsedFiles.find(path);
+    if (parsedIter == parsedFiles.end())
+    {
+        return nullptr;
+    }
+    if (parsedIter->second.modTime != modTime)
+    {
+        // Discard the outdated SVG:
+        parsedOrder.erase(parsedIter->second.usagePosition);
+        parsedFiles.erase(parsedIter);
+        return nullptr;
+    }
+    parsedOrder.splice(parsedOrder.begin(), parsedOrder,
+            parsedIter->second.usagePosition);
+    return parsedIter->second.drawable->createCopy();
+}
+
+
+// Adds a Drawable parsed from an SVG file to the cache, removing the least
+// recently used Drawable if the cache is full.
+std::unique_ptr<juce::Drawable> Assets::SVGCache::addDrawable
+(const juce::String& path, const juce::int64 modTime,
+ std::unique_ptr<juce::Drawable> drawable)
+{
+    jassert(drawable != nullptr);
+    auto parsedIter = parsedFiles.find(path);
+    if (parsedIter != parsedFiles.end())
+    {
+        // Another thread may have parsed the same file while this one was:
+        parsedOrder.erase(parsedIter->second.usagePosition);
+        parsedFiles.erase(parsedIter);
+    }
+    else if (parsedFiles.size() >= maxParsedFiles)
+    {
+        parsedFiles.erase(parsedOrder.back());
+        parsedOrder.pop_back();
+    }
+    parsedOrder.push_front(path);
+    ParsedSVG& parsedSVG = parsedFiles[path];
+    parsedSVG.modTime = modTime;
+    parsedSVG.usagePosition = parsedOrder.begin();
+    parsedSVG.drawable = std::move(drawable);
+    return parsedSVG.drawable->createCopy();
+}
+
+
+// Finds a cached SVG image, marking it as the most recently used image.
+juce::Image Assets::SVGCache::findRaster(const RasterKey& key)
+{
+    return rasterCache.findImage(key);
+}
+
+
+// Adds a drawn SVG image to the cache, removing the least recently used images
+// if necessary to stay within the cache's byte budget.
+void Assets::SVGCache::addRaster
+(const RasterKey& key, const juce::Image& raster)
+{
+    rasterCache.addImage(key, raster);
+}
+
+
+// Checks if drawn SVG images should also be saved to and loaded from the
+// user's cache directory.
+bool Assets::SVGCache::isDiskCacheEnabled() const
+{
+    return diskCacheEnabled;
+}
+
+
+// Sets if drawn SVG images should also be saved to and loaded from the user's
+// cache directory.
+void Assets::SVGCache::setDiskCacheEnabled(const bool useDiskCache)
+{
+    diskCacheEnabled = useDiskCache;
+}
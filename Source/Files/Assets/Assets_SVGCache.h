@@ -0,0 +1,172 @@
+#pragma once
+/**
+ * @file  Assets_SVGCache.h
+ *
+ * @brief  Stores parsed SVG files and the images drawn from them.
+ */
+
+#include "SharedResource_Resource.h"
+#include "Util_ImageLRUCache.h"
+#include "JuceHeader.h"
+#include <list>
+#include <map>
+#include <memory>
+
+namespace Assets { class SVGCache; }
+
+/**
+ * @brief  Caches SVG Drawable objects and SVG images drawn at specific sizes.
+ *
+ *  Each SVG file is parsed into a Drawable object once, and parsed again only
+ * if the file's modification time changes. SVG files are parsed by handlers
+ * before they are added, so the cache is never locked while parsing. Handlers
+ * receive copies of the parsed Drawable, so they can draw or recolour it
+ * without locking the cache.
+ *
+ *  Drawn SVG images are cached by file path, file modification time, image
+ * size, and colour substitutions. The least recently used images are discarded
+ * whenever the total size of all cached images exceeds a byte budget.
+ *
+ *  The SVGCache should only be accessed through Assets::SVGLoader objects.
+ */
+class Assets::SVGCache : public SharedResource::Resource
+{
+public:
+    // SharedResource object key:
+    static const juce::Identifier resourceKey;
+
+    SVGCache();
+
+    virtual ~SVGCache() { }
+
+    /**
+     * @brief  Identifies a cached SVG image.
+     */
+    struct RasterKey
+    {
+        // Full path of the SVG file:
+        juce::String path;
+        // SVG file modification time, in milliseconds since the epoch:
+        juce::int64 modTime;
+        // Image width, in pixels:
+        int width;
+        // Image height, in pixels:
+        int height;
+        // Colour substitutions applied to the SVG, stored as a string:
+        juce::String colours;
+
+        /**
+         * @brief  Sorts keys by path, then by modification time, size, and
+         *         colour substitutions.
+         *
+         * @param rhs  Another cache key.
+         *
+         * @return     Whether this key comes before rhs.
+         */
+        bool operator<(const RasterKey& rhs) const;
+
+        /**
+         * @brief  Gets a string that uniquely represents this key.
+         *
+         * @return  The key string, used when naming disk cache files.
+         */
+        juce::String toString() const;
+    };
+
+    /**
+     * @brief  Creates a copy of a cached Drawable parsed from an SVG file,
+     *         marking it as the most recently used Drawable.
+     *
+     * @param path     The SVG file's full path.
+     *
+     * @param modTime  The SVG file's current modification time, in
+     *                 milliseconds since the epoch.
+     *
+     * @return         A new copy of the parsed Drawable, or nullptr if the file
+     *                 isn't cached or has changed since it was parsed.
+     */
+    std::unique_ptr<juce::Drawable> copyDrawable(const juce::String& path,
+            const juce::int64 modTime);
+
+    /**
+     * @brief  Adds a Drawable parsed from an SVG file to the cache, removing
+     *         the least recently used Drawable if the cache is full.
+     *
+     * @param path      The SVG file's full path.
+     *
+     * @param modTime   The SVG file's modification time when it was parsed.
+     *
+     * @param drawable  The Drawable parsed from the SVG file.
+     *
+     * @return          A new copy of the parsed Drawable.
+     */
+    std::unique_ptr<juce::Drawable> addDrawable(const juce::String& path,
+            const juce::int64 modTime,
+            std::unique_ptr<juce::Drawable> drawable);
+
+    /**
+     * @brief  Finds a cached SVG image, marking it as the most recently used
+     *         image.
+     *
+     * @param key  The image's cache key.
+     *
+     * @return     The cached image, or a null image if no image with that key
+     *             is cached.
+     */
+    juce::Image findRaster(const RasterKey& key);
+
+    /**
+     * @brief  Adds a drawn SVG image to the cache, removing the least
+     *         recently used images if necessary to stay within the cache's
+     *         byte budget.
+     *
+     * @param key     The image's cache key.
+     *
+     * @param raster  A valid image drawn from the key's SVG file.
+     */
+    void addRaster(const RasterKey& key, const juce::Image& raster);
+
+    /**
+     * @brief  Checks if drawn SVG images should also be saved to and loaded
+     *         from the user's cache directory.
+     *
+     * @return  Whether the disk cache is enabled.
+     */
+    bool isDiskCacheEnabled() const;
+
+    /**
+     * @brief  Sets if drawn SVG images should also be saved to and loaded
+     *         from the user's cache directory.
+     *
+     * @param useDiskCache  Whether the disk cache should be used.
+     */
+    void setDiskCacheEnabled(const bool useDiskCache);
+
+private:
+    /**
+     * @brief  Holds a parsed SVG file.
+     */
+    struct ParsedSVG
+    {
+        // SVG file modification time when it was parsed:
+        juce::int64 modTime;
+        // The SVG file's position in the parsed file usage order:
+        std::list<juce::String>::iterator usagePosition;
+        // The parsed SVG:
+        std::unique_ptr<juce::Drawable> drawable;
+    };
+
+    // Parsed SVG files, mapped by full file path:
+    std::map<juce::String, ParsedSVG> parsedFiles;
+
+    // Parsed file paths, ordered from most to least recently used:
+    std::list<juce::String> parsedOrder;
+
+    // Cached SVG images:
+    Util::ImageLRUCache<RasterKey> rasterCache;
+
+    // Sets if images should be saved in the user's cache directory:
+    bool diskCacheEnabled = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SVGCache)
+};
@@ -0,0 +1,249 @@
+#include "Assets_SVGLoader.h"
+#include "Assets_SVGCache.h"
+#include "Assets_XDGDirectories.h"
+
+#ifdef JUCE_DEBUG
+// Print the full class name before all debug output:
+static const constexpr char* dbgPrefix = "Assets::SVGLoader::";
+#endif
+
+// Directory within the user's cache directory where SVG images are saved:
+static const constexpr char* diskCacheDir = "/pocket-home/svg-images/";
+
+Assets::SVGLoader::SVGLoader() { }
+
+
+/**
+ * @brief  Gets the file where an SVG image is saved in the disk cache.
+ *
+ * @param key  The SVG image's cache key.
+ *
+ * @return     The image's cache file, which may or may not exist.
+ */
+static juce::File getDiskCacheFile(const Assets::SVGCache::RasterKey& key)
+{
+    return juce::File(Assets::XDGDirectories::getUserCachePath()
+            + diskCacheDir
+            + juce::String::toHexString(key.toString().hashCode64())
+            + ".png");
+}
+
+
+/**
+ * @brief  Loads an SVG image saved in the disk cache.
+ *
+ * @param key  The SVG image's cache key.
+ *
+ * @return     The saved image, or Image() if no valid image with the key's
+ *             size was saved.
+ */
+static juce::Image readDiskCache(const Assets::SVGCache::RasterKey& key)
+{
+    const juce::File cacheFile = getDiskCacheFile(key);
+    if (!cacheFile.existsAsFile())
+    {
+        return juce::Image();
+    }
+    juce::Image raster = juce::ImageFileFormat::loadFrom(cacheFile);
+    if (raster.getWidth() != key.width || raster.getHeight() != key.height)
+    {
+        return juce::Image();
+    }
+    return raster;
+}
+
+
+/**
+ * @brief  Saves an SVG image to the disk cache.
+ *
+ *  The image is written to a temporary file that then replaces the cache file,
+ * so other threads will never read a partially written image.
+ *
+ * @param key     The SVG image's cache key.
+ *
+ * @param raster  The SVG image to save.
+ */
+static void writeDiskCache
+(const Assets::SVGCache::RasterKey& key, const juce::Image& raster)
+{
+    const juce::File cacheFile = getDiskCacheFile(key);
+    if (!cacheFile.getParentDirectory().createDirectory())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to create cache directory "
+                << cacheFile.getParentDirectory().getFullPathName());
+        return;
+    }
+    juce::TemporaryFile tempFile(cacheFile);
+    bool written = false;
+    {
+        juce::FileOutputStream outStream(tempFile.getFile());
+        written = outStream.openedOk()
+                && juce::PNGImageFormat().writeImageToStream(raster,
+                    outStream);
+    }
+    if (!written || !tempFile.overwriteTargetFileWithTemporary())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to write cache file "
+                << cacheFile.getFullPathName());
+    }
+}
+
+
+/**
+ * @brief  Parses an SVG file into a new Drawable object.
+ *
+ * @param svgFile  An existing .svg file.
+ *
+ * @return         The parsed Drawable, or nullptr if the file wasn't a valid
+ *                 SVG file.
+ */
+static std::unique_ptr<juce::Drawable> parseSVG(const juce::File& svgFile)
+{
+    std::unique_ptr<juce::XmlElement> svgElement
+            (juce::XmlDocument::parse(svgFile));
+    if (svgElement == nullptr)
+    {
+        return nullptr;
+    }
+    return juce::Drawable::createFromSVG(*svgElement);
+}
+
+
+/**
+ * @brief  Draws a Drawable into a new image.
+ *
+ * @param drawable  A Drawable created from an SVG file.
+ *
+ * @param width     The width in pixels of the new image.
+ *
+ * @param height    The height in pixels of the new image.
+ *
+ * @return          The Drawable drawn centered within the image bounds.
+ */
+static juce::Image drawRaster
+(juce::Drawable& drawable, const int width, const int height)
+{
+    using juce::Image;
+    Image raster(Image::ARGB, width, height, true);
+    juce::Graphics g(raster);
+    juce::Rectangle<float> imageBounds(0, 0, width, height);
+    juce::Rectangle<float> svgBounds
+            = ((juce::DrawableComposite&) drawable).getContentArea();
+    juce::RectanglePlacement svgPlacement(juce::RectanglePlacement::centred);
+    drawable.draw(g, 1.f, svgPlacement.getTransformToFit(svgBounds,
+                imageBounds));
+    return raster;
+}
+
+
+// Gets an image drawn from an SVG file, using a cached image if one was
+// already drawn with the same file, size, and colours.
+juce::Image Assets::SVGLoader::loadImage(const juce::File& svgFile,
+        const int width, const int height,
+        const ColourSubstitutions& colours) const
+{
+    if (width <= 0 || height <= 0 || !svgFile.existsAsFile()
+            || svgFile.getFileExtension() != ".svg")
+    {
+        return juce::Image();
+    }
+    SVGCache::RasterKey key =
+    {
+        svgFile.getFullPathName(),
+        svgFile.getLastModificationTime().toMilliseconds(),
+        width,
+        height,
+        juce::String()
+    };
+    for (const auto& colourPair : colours)
+    {
+        key.colours += colourPair.first.toString() + ">"
+                + colourPair.second.toString() + ";";
+    }
+
+    bool useDiskCache = false;
+    {
+        SharedResource::LockedPtr<SVGCache> svgCache
+                = getWriteLockedResource();
+        const juce::Image cachedRaster = svgCache->findRaster(key);
+        if (cachedRaster.isValid())
+        {
+            return cachedRaster;
+        }
+        useDiskCache = svgCache->isDiskCacheEnabled();
+    }
+
+    juce::Image raster = useDiskCache ? readDiskCache(key) : juce::Image();
+    if (!raster.isValid())
+    {
+        // The cache is unlocked while drawing, so other threads may draw
+        // SVG images at the same time:
+        std::unique_ptr<juce::Drawable> drawable = loadDrawable(svgFile);
+        if (drawable == nullptr)
+        {
+            return juce::Image();
+        }
+        for (const auto& colourPair : colours)
+        {
+            drawable->replaceColour(colourPair.first, colourPair.second);
+        }
+        raster = drawRaster(*drawable, width, height);
+        if (useDiskCache)
+        {
+            writeDiskCache(key, raster);
+        }
+    }
+    if (raster.isValid())
+    {
+        SharedResource::LockedPtr<SVGCache> svgCache
+                = getWriteLockedResource();
+        svgCache->addRaster(key, raster);
+    }
+    return raster;
+}
+
+
+// Creates a Drawable object from an SVG file.
+std::unique_ptr<juce::Drawable> Assets::SVGLoader::loadDrawable
+(const juce::File& svgFile) const
+{
+    if (!svgFile.existsAsFile() || svgFile.getFileExtension() != ".svg")
+    {
+        DBG(dbgPrefix << __func__ << ": File \"" << svgFile.getFileName()
+                << "\" not found.");
+        return nullptr;
+    }
+    const juce::String path = svgFile.getFullPathName();
+    const juce::int64 modTime
+            = svgFile.getLastModificationTime().toMilliseconds();
+    {
+        SharedResource::LockedPtr<SVGCache> svgCache
+                = getWriteLockedResource();
+        std::unique_ptr<juce::Drawable> drawable
+                = svgCache->copyDrawable(path, modTime);
+        if (drawable != nullptr)
+        {
+            return drawable;
+        }
+    }
+    // The cache is unlocked while parsing, so other threads may use the cache
+    // at the same time:
+    std::unique_ptr<juce::Drawable> drawable = parseSVG(svgFile);
+    if (drawable == nullptr)
+    {
+        DBG(dbgPrefix << __func__ << ": File \"" << svgFile.getFileName()
+                << "\" is not a valid svg file.");
+        return nullptr;
+    }
+    SharedResource::LockedPtr<SVGCache> svgCache = getWriteLockedResource();
+    return svgCache->addDrawable(path, modTime, std::move(drawable));
+}
+
+
+// Sets if SVG images should also be saved to and loaded from the user's cache
+// directory.
+void Assets::SVGLoader::setDiskCacheEnabled(const bool useDiskCache)
+{
+    SharedResource::LockedPtr<SVGCache> svgCache = getWriteLockedResource();
+    svgCache->setDiskCacheEnabled(useDiskCache);
+}
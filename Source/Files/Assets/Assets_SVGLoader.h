@@ -0,0 +1,81 @@
+#pragma once
+/**
+ * @file  Assets_SVGLoader.h
+ *
+ * @brief  Loads SVG files as Drawable objects or as images, using the shared
+ *         SVGCache.
+ */
+
+#include "SharedResource_Handler.h"
+#include "JuceHeader.h"
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Assets { class SVGLoader; }
+namespace Assets { class SVGCache; }
+
+/**
+ * @brief  Accesses the shared SVGCache to load SVG files without parsing them
+ *         again each time they're used.
+ *
+ *  SVG images are drawn at the exact size requested, so they don't need to be
+ * rescaled before use. SVGLoader objects may be used from any thread. Images
+ * are drawn without holding the cache's lock, so several threads may draw SVG
+ * images at once.
+ */
+class Assets::SVGLoader : public SharedResource::Handler<SVGCache>
+{
+public:
+    /**
+     * @brief  Lists colours to replace when drawing an SVG image, as pairs of
+     *         original and replacement colours.
+     */
+    typedef std::vector<std::pair<juce::Colour, juce::Colour>>
+            ColourSubstitutions;
+
+    SVGLoader();
+
+    virtual ~SVGLoader() { }
+
+    /**
+     * @brief  Gets an image drawn from an SVG file, using a cached image if one
+     *         was already drawn with the same file, size, and colours.
+     *
+     * @param svgFile  A .svg file.
+     *
+     * @param width    The width in pixels of the image.
+     *
+     * @param height   The height in pixels of the image.
+     *
+     * @param colours  Colours to replace within the SVG, applied in order.
+     *
+     * @return         The SVG drawn centered within the image bounds, or
+     *                 Image() if the file wasn't a valid SVG file.
+     */
+    juce::Image loadImage(const juce::File& svgFile, const int width,
+            const int height,
+            const ColourSubstitutions& colours = ColourSubstitutions()) const;
+
+    /**
+     * @brief  Creates a Drawable object from an SVG file.
+     *
+     * @param svgFile  A .svg file.
+     *
+     * @return         A new Drawable if the file was valid, nullptr otherwise.
+     */
+    std::unique_ptr<juce::Drawable> loadDrawable(const juce::File& svgFile)
+        const;
+
+    /**
+     * @brief  Sets if SVG images should also be saved to and loaded from the
+     *         user's cache directory.
+     *
+     *  The disk cache is disabled by default. When enabled, SVG images that
+     * aren't found in memory are loaded from PNG files saved the first time
+     * those images were drawn.
+     *
+     * @param useDiskCache  Whether the disk cache should be used.
+     */
+    void setDiskCacheEnabled(const bool useDiskCache);
+};
@@ -0,0 +1,32 @@
+#pragma once
+/**
+ * @file  Assets_X11Colours.h
+ *
+ * @brief  Looks up the RGB values of X11 colour names.
+ */
+
+#include "JuceHeader.h"
+
+namespace Assets
+{
+    namespace X11Colours
+    {
+        /**
+         * @brief  Finds the RGB value of a named X11 colour.
+         *
+         *  Colour names are matched the same way the X server matches them:
+         * letter case and spaces are ignored, and "grey" may be used in place
+         * of "gray". The colour table is built into the application, so no
+         * X display connection is needed, and this may safely be called from
+         * any thread.
+         *
+         * @param colourName  A colour name from the X11 rgb.txt colour list.
+         *
+         * @param rgb         If the colour name is found, its RGB value will
+         *                    be copied here, in 0xRRGGBB format.
+         *
+         * @return            Whether the colour name was found.
+         */
+        bool findColour(const juce::String& colourName, juce::uint32& rgb);
+    }
+}
@@ -1,85 +1,310 @@
 #include "Assets_XPMLoader.h"
+#include "Assets_X11Colours.h"
 #include "JuceHeader.h"
-#include <X11/xpm.h>
+#include <unordered_map>
+#include <vector>
 
 #ifdef JUCE_DEBUG
 // Print the full namespace name before all debug output:
 static const constexpr char* dbgPrefix = "Assets::XPMLoader::";
 #endif
 
+// Largest number of characters per pixel that may be used in a XPM file:
+static const constexpr int maxCharsPerPixel = 8;
+
+/**
+ * @brief  Marks the position of a single quoted string within XPM file data.
+ */
+struct XPMString
+{
+    // The first character after the opening quote:
+    const char* start;
+    // The number of characters before the closing quote:
+    int length;
+};
+
+
+/**
+ * @brief  Finds all quoted strings in XPM file data, skipping comments.
+ *
+ * @param data     The start of the XPM file data.
+ *
+ * @param dataEnd  The end of the XPM file data.
+ *
+ * @return         All quoted strings found in the data, in order.
+ */
+static std::vector<XPMString> findStrings
+(const char* data, const char* dataEnd)
+{
+    std::vector<XPMString> strings;
+    const char* readPos = data;
+    while (readPos < dataEnd)
+    {
+        if (*readPos == '/' && (readPos + 1) < dataEnd
+                && readPos[1] == '*')
+        {
+            readPos += 2;
+            while ((readPos + 1) < dataEnd
+                    && !(readPos[0] == '*' && readPos[1] == '/'))
+            {
+                readPos++;
+            }
+            readPos += 2;
+        }
+        else if (*readPos == '"')
+        {
+            const char* stringStart = ++readPos;
+            while (readPos < dataEnd && *readPos != '"')
+            {
+                // Skip escaped characters:
+                readPos += (*readPos == '\\') ? 2 : 1;
+            }
+            if (readPos >= dataEnd)
+            {
+                break;
+            }
+            strings.push_back({ stringStart, (int) (readPos - stringStart) });
+            readPos++;
+        }
+        else
+        {
+            readPos++;
+        }
+    }
+    return strings;
+}
+
+
+/**
+ * @brief  Reads the pixel key of a single pixel from XPM pixel or colour data.
+ *
+ * @param chars          The first character of the pixel key.
+ *
+ * @param charsPerPixel  The number of characters used to identify each pixel.
+ *
+ * @return               The pixel key, with all key characters packed into a
+ *                       single value.
+ */
+static inline juce::uint64 readPixelKey
+(const char* chars, const int charsPerPixel)
+{
+    juce::uint64 key = 0;
+    for (int i = 0; i < charsPerPixel; i++)
+    {
+        key = (key << 8) | (juce::uint8) chars[i];
+    }
+    return key;
+}
+
+
+/**
+ * @brief  Selects the colour value to use from a XPM colour definition.
+ *
+ *  Colour definitions may provide separate values for colour, greyscale, and
+ * monochrome displays. The colour value is preferred, followed by greyscale,
+ * then monochrome values. Symbolic names are ignored.
+ *
+ * @param definition  The colour definition, not including its pixel key.
+ *
+ * @return            The selected colour value, or the empty string if the
+ *                    definition has no usable colour value.
+ */
+static juce::String selectColourValue(const juce::String& definition)
+{
+    using juce::String;
+    // Colour value types, from least to most preferred:
+    static const juce::StringArray valueTypes = { "s", "m", "g4", "g", "c" };
+    juce::StringArray tokens;
+    tokens.addTokens(definition, " \t", "");
+    tokens.removeEmptyStrings();
+
+    String selectedValue;
+    int selectedPriority = 0;
+    int valuePriority = -1;
+    String value;
+    // Colour names may contain spaces, so values continue until the next
+    // value type token:
+    for (int i = 0; i <= tokens.size(); i++)
+    {
+        const int typeIndex = (i < tokens.size())
+                ? valueTypes.indexOf(tokens[i]) : 0;
+        if (i < tokens.size() && typeIndex < 0)
+        {
+            value += value.isEmpty() ? tokens[i] : (" " + tokens[i]);
+            continue;
+        }
+        if (valuePriority > selectedPriority && value.isNotEmpty())
+        {
+            selectedValue = value;
+            selectedPriority = valuePriority;
+        }
+        valuePriority = typeIndex;
+        value = String();
+    }
+    return selectedValue;
+}
+
+
+/**
+ * @brief  Converts a XPM colour value to a pixel colour.
+ *
+ * @param colourValue  A hexadecimal colour value, an X11 colour name, or
+ *                     "None".
+ *
+ * @param pixel        If the colour value is valid, its colour will be copied
+ *                     here.
+ *
+ * @return             Whether the colour value was valid.
+ */
+static bool parseColourValue
+(const juce::String& colourValue, juce::PixelARGB& pixel)
+{
+    using juce::uint8;
+    if (colourValue.equalsIgnoreCase("none"))
+    {
+        pixel = juce::PixelARGB(0, 0, 0, 0);
+        return true;
+    }
+    if (colourValue.startsWithChar('#'))
+    {
+        const juce::String hexDigits = colourValue.substring(1);
+        const int digitCount = hexDigits.length();
+        if (digitCount == 0 || digitCount % 3 != 0 || digitCount > 12
+                || !hexDigits.containsOnly("0123456789abcdefABCDEF"))
+        {
+            return false;
+        }
+        const int componentDigits = digitCount / 3;
+        uint8 components[3];
+        for (int i = 0; i < 3; i++)
+        {
+            const juce::String component = hexDigits.substring(
+                    i * componentDigits, (i + 1) * componentDigits);
+            // Use the two most significant digits of each component, or
+            // repeat the digit if each component only has one digit:
+            components[i] = (componentDigits == 1)
+                    ? (uint8) (component.getHexValue32() * 17)
+                    : (uint8) component.substring(0, 2).getHexValue32();
+        }
+        pixel = juce::PixelARGB(255, components[0], components[1],
+                components[2]);
+        return true;
+    }
+    juce::uint32 rgb;
+    if (Assets::X11Colours::findColour(colourValue, rgb))
+    {
+        pixel = juce::PixelARGB(255, (uint8) (rgb >> 16), (uint8) (rgb >> 8),
+                (uint8) rgb);
+        return true;
+    }
+    return false;
+}
+
 
 // Loads a juce Image object from a xpm image file.
 juce::Image Assets::XPMLoader::loadXPMImage(const juce::File xpmFile)
 {
     using juce::Image;
-    Image juceImage;
+    using juce::PixelARGB;
     if (!xpmFile.existsAsFile())
     {
-        return juceImage;
+        return Image();
     }
-
-    // Read file to xpm image data:
-    XpmImage imageData;
-    int result = XpmReadFileToXpmImage(xpmFile.getFullPathName().toRawUTF8(),
-            &imageData, nullptr);
-    if (result != XpmSuccess)
+    juce::MemoryBlock fileData;
+    if (!xpmFile.loadFileAsData(fileData))
     {
-        DBG(dbgPrefix << __func__ << ": Error loading \""
-                << xpmFile.getFullPathName());
-        DBG(dbgPrefix << __func__ << ": Error=" << XpmGetErrorString(result));
-        return juceImage;
+        DBG(dbgPrefix << __func__ << ": Error reading \""
+                << xpmFile.getFullPathName() << "\"");
+        return Image();
     }
-    juceImage = Image(Image::PixelFormat::RGB, imageData.width,
-            imageData.height, true);
+    const char* data = static_cast<const char*>(fileData.getData());
+    const std::vector<XPMString> strings
+            = findStrings(data, data + fileData.getSize());
 
-    // Load X11 color names:
-    juce::Array<juce::Colour> imageColours;
-    Display * display = XOpenDisplay(nullptr);
-    if (display != nullptr)
+    // Read image values:
+    int width = 0, height = 0, colourCount = 0, charsPerPixel = 0;
+    if (!strings.empty())
     {
-        for (int i = 0; i < imageData.ncolors; i++)
+        juce::StringArray values;
+        values.addTokens(juce::String(strings[0].start, strings[0].length),
+                " \t", "");
+        values.removeEmptyStrings();
+        if (values.size() >= 4)
         {
-            char* c_color = imageData.colorTable[i].c_color;
-            if (c_color == nullptr)
-            {
-                imageColours.add(juce::Colours::transparentBlack);
-                continue;
-            }
-            XColor colorValue;
-            Colormap colorMap = XDefaultColormap(display, 0);
-            Status searchResult = XParseColor(display, colorMap, c_color,
-                    &colorValue);
-            if (searchResult == 0)
-            {
-                imageColours.add(juce::Colours::transparentBlack);
-                continue;
-            }
-            //Divide color values by 256 to convert to uint8:
-            imageColours.add(juce::Colour(
-                        juce::uint8(colorValue.red / 256),
-                        juce::uint8(colorValue.green / 256),
-                        juce::uint8(colorValue.blue / 256)));
+            width = values[0].getIntValue();
+            height = values[1].getIntValue();
+            colourCount = values[2].getIntValue();
+            charsPerPixel = values[3].getIntValue();
         }
-        XCloseDisplay(display);
-        display = nullptr;
     }
-    else
+    if (width <= 0 || height <= 0 || colourCount <= 0 || charsPerPixel <= 0
+            || charsPerPixel > maxCharsPerPixel
+            || (int) strings.size() < 1 + colourCount + height)
     {
-        DBG(dbgPrefix << __func__ << ": Failed to load X11 color values");
-        return juceImage;
+        DBG(dbgPrefix << __func__ << ": Invalid xpm file \""
+                << xpmFile.getFullPathName() << "\"");
+        return Image();
     }
 
-    // Copy image data into juce::Image:
-    for (int y = 0; y < imageData.height; y++)
+    // Read image colours:
+    std::unordered_map<juce::uint64, PixelARGB> colourMap;
+    colourMap.reserve(colourCount);
+    bool hasTransparency = false;
+    for (int i = 1; i <= colourCount; i++)
     {
-        for (int x = 0; x < imageData.width; x++)
+        const XPMString& colourString = strings[i];
+        if (colourString.length < charsPerPixel)
         {
-            const int dataIndex = x + y * imageData.width;
-            const int colourIndex = imageData.data[dataIndex];
-            juceImage.setPixelAt(x, y, imageColours[colourIndex]);
+            DBG(dbgPrefix << __func__ << ": Invalid colour in \""
+                    << xpmFile.getFullPathName() << "\"");
+            return Image();
         }
+        const juce::String colourValue = selectColourValue(juce::String(
+                    colourString.start + charsPerPixel,
+                    colourString.length - charsPerPixel));
+        PixelARGB pixel(0, 0, 0, 0);
+        if (!parseColourValue(colourValue, pixel))
+        {
+            DBG(dbgPrefix << __func__ << ": Unknown colour \"" << colourValue
+                    << "\", using transparent pixels instead.");
+        }
+        hasTransparency = hasTransparency || pixel.getAlpha() < 255;
+        colourMap[readPixelKey(colourString.start, charsPerPixel)] = pixel;
     }
 
-    XpmFreeXpmImage(&imageData);
-    return juceImage;
+    // Copy pixel data directly into the image:
+    Image xpmImage(hasTransparency ? Image::ARGB : Image::RGB, width, height,
+            true);
+    Image::BitmapData bitmap(xpmImage, Image::BitmapData::writeOnly);
+    const PixelARGB transparent(0, 0, 0, 0);
+    for (int y = 0; y < height; y++)
+    {
+        const XPMString& row = strings[1 + colourCount + y];
+        if (row.length < width * charsPerPixel)
+        {
+            DBG(dbgPrefix << __func__ << ": Missing pixel data in \""
+                    << xpmFile.getFullPathName() << "\"");
+            return Image();
+        }
+        juce::uint8* linePtr = bitmap.getLinePointer(y);
+        const char* pixelChars = row.start;
+        for (int x = 0; x < width; x++)
+        {
+            auto colourIter = colourMap.find(readPixelKey(pixelChars,
+                        charsPerPixel));
+            const PixelARGB& pixel = (colourIter != colourMap.end())
+                    ? colourIter->second : transparent;
+            if (hasTransparency)
+            {
+                reinterpret_cast<PixelARGB*>(linePtr)->set(pixel);
+            }
+            else
+            {
+                reinterpret_cast<juce::PixelRGB*>(linePtr)->set(pixel);
+            }
+            linePtr += bitmap.pixelStride;
+            pixelChars += charsPerPixel;
+        }
+    }
+    return xpmImage;
 }
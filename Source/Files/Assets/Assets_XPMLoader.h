@@ -18,10 +18,17 @@ namespace Assets
         /**
          * @brief  Loads a juce Image object from a xpm image file.
          *
+         *  XPM files are parsed directly, and X11 colour names are found using
+         * a built-in colour table, so no X display connection is needed. This
+         * may safely be called from any thread. Pixels with the colour "None"
+         * are fully transparent.
+         *
          * @param xpmFile  A xpm file object.
          *
          * @return         An image loaded from the file, or a null image if
-         *                 the file was not a valid xpm file.
+         *                 the file was not a valid xpm file. The image will
+         *                 use the ARGB format if any of its pixels are
+         *                 transparent, and the RGB format otherwise.
          */
         juce::Image loadXPMImage(const juce::File xpmFile);
     }
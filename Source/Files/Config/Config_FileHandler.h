@@ -84,4 +84,17 @@ public:
             = SharedResource::Handler<ResourceType>::getWriteLockedResource();
         return jsonPtr->template setConfigValue<ValueType>(key, newValue);
     }
+
+    /**
+     * @brief  Gets statistics describing how often the FileResource has
+     *         written to its JSON file.
+     *
+     * @return  The FileResource's current write statistics.
+     */
+    typename ResourceType::WriteStatistics getWriteStatistics() const
+    {
+        SharedResource::LockedPtr<const ResourceType> jsonPtr
+            = SharedResource::Handler<ResourceType>::getReadLockedResource();
+        return jsonPtr->getWriteStatistics();
+    }
 };
@@ -1,5 +1,7 @@
 #include "Config_FileResource.h"
+#include "Config_FileWatcher.h"
 #include "Assets_XDGDirectories.h"
+#include "SharedResource_Thread_ScopedReadLock.h"
 
 #ifdef JUCE_DEBUG
 // Print the full class name before all debug output:
@@ -13,6 +15,10 @@ static const constexpr char* appDirectory = "pocket-home";
 // The pocket-home asset folder subdirectory containing default config files.
 static const constexpr char* defaultAssetPath = "configuration/";
 
+// Default number of milliseconds to wait after the last config value change
+// before writing changes to the file:
+static const constexpr int defaultWriteDelay = 1000;
+
 /**
  * @brief  Gets the full path where a configuration file should be saved.
  *
@@ -32,16 +38,39 @@ static juce::String getFullConfigPath(const juce::String configFilename)
 Config::FileResource::FileResource(
         const juce::Identifier& resourceKey,
         const juce::String& configFilename) :
-SharedResource::Resource(resourceKey),
+SharedResource::Thread::Resource(resourceKey, configFilename),
 filename(configFilename),
 configJson(getFullConfigPath(configFilename)),
-defaultJson(defaultAssetPath + filename) { }
+defaultJson(defaultAssetPath + filename),
+writeDelay(defaultWriteDelay),
+pendingChanges(0),
+lastWrittenHash(0),
+firstChangeTime(0),
+lastChangeTime(0) { }
 
 
 // Writes any pending changes to the file before destruction.
 Config::FileResource::~FileResource()
 {
+    fileWatcher.reset(nullptr);
     writeChanges();
+#ifdef JUCE_DEBUG
+    const WriteStatistics statistics = getWriteStatistics();
+    DBG(dbgPrefix << __func__ << ": " << filename << " saved "
+            << statistics.changesSaved << " change(s) in "
+            << statistics.fileWrites << " write(s), avoiding "
+            << statistics.writesAvoided << " write(s). Maximum save delay: "
+            << juce::String(statistics.maxFlushLatency, 1) << "ms");
+#endif
+}
+
+
+// Gets statistics describing the FileResource's file writes.
+Config::FileResource::WriteStatistics
+Config::FileResource::getWriteStatistics() const
+{
+    const juce::ScopedLock statLock(statisticsLock);
+    return writeStatistics;
 }
 
 
@@ -49,14 +78,11 @@ Config::FileResource::~FileResource()
 void Config::FileResource::restoreDefaultValue(const juce::Identifier& key)
 {
     // Check key validity, find expected data type:
-    const std::vector<DataKey>& keys = getConfigKeys();
-    for (const DataKey& configKey : keys)
+    const int tableIndex = valueTable.findIndex(key);
+    if (tableIndex >= 0)
     {
-        if (configKey.key == key)
-        {
-            restoreDefaultValue(configKey);
-            return;
-        }
+        restoreDefaultValue(getConfigKeys()[tableIndex]);
+        return;
     }
     DBG(dbgPrefix << __func__ << ": Key \"" << key.toString()
                 << "\" is not expected in " << filename);
@@ -80,23 +106,26 @@ void Config::FileResource::restoreDefaultValues()
 void Config::FileResource::loadJSONData()
 {
     const std::vector<DataKey>& keys = getConfigKeys();
-    for (const DataKey& key : keys)
+    valueTable.initKeys(keys);
+    for (int i = 0; i < (int) keys.size(); i++)
     {
+        const DataKey& key = keys[i];
         try
         {
             switch(key.dataType)
             {
                 case DataKey::stringType:
-                    initProperty<juce::String>(key);
+                    valueTable.setValue<juce::String>(i,
+                            initProperty<juce::String>(key));
                     break;
                 case DataKey::intType:
-                    initProperty<int>(key);
+                    valueTable.setValue<int>(i, initProperty<int>(key));
                     break;
                 case DataKey::boolType:
-                    initProperty<bool>(key);
+                    valueTable.setValue<bool>(i, initProperty<bool>(key));
                     break;
                 case DataKey::doubleType:
-                    initProperty<double>(key);
+                    valueTable.setValue<double>(i, initProperty<double>(key));
                     break;
                 default:
                     DBG(dbgPrefix << __func__ << ": Unexpected type for key \""
@@ -115,21 +144,14 @@ void Config::FileResource::loadJSONData()
         }
     }
     writeChanges();
+    startWatchingFile();
 }
 
 
 // Checks if a key string is valid for this FileResource.
 bool Config::FileResource::isValidKey(const juce::Identifier& key) const
 {
-    const std::vector<DataKey>& keys = getConfigKeys();
-    for (const DataKey& configKey : keys)
-    {
-        if (configKey.key == key)
-        {
-            return true;
-        }
-    }
-    return false;
+    return valueTable.findIndex(key) >= 0;
 }
 
 
@@ -138,6 +160,60 @@ bool Config::FileResource::isValidKey(const juce::Identifier& key) const
 void Config::FileResource::writeChanges()
 {
     writeDataToJSON();
+    writeJSONChanges();
+}
+
+
+// Sets how long the FileResource waits after a value changes before writing
+// changes to the file.
+void Config::FileResource::setWriteDelay(const int delayMS)
+{
+    writeDelay = juce::jmax(0, delayMS);
+}
+
+
+// Marks the config file as having unwritten changes, writing the changes
+// immediately or scheduling them to be written once no values have changed
+// for the write delay period.
+void Config::FileResource::scheduleWrite(const juce::Identifier& changedKey)
+{
+    unwrittenKeys.addIfNotAlreadyThere(changedKey);
+    const double changeTime = juce::Time::getMillisecondCounterHiRes();
+    if (pendingChanges++ == 0)
+    {
+        firstChangeTime = changeTime;
+    }
+    lastChangeTime = changeTime;
+    if (writeDelay == 0)
+    {
+        writeJSONChanges();
+    }
+    else if (!isThreadRunning())
+    {
+        startResourceThread();
+    }
+    else if (threadShouldExit())
+    {
+        // The thread is already stopping, and might not see this change:
+        writeJSONChanges();
+    }
+    else
+    {
+        notify();
+    }
+}
+
+
+// Writes all JSON data changes to the file and updates write statistics.
+void Config::FileResource::writeJSONChanges()
+{
+    if (!configJson.hasUnwrittenChanges())
+    {
+        pendingChanges = 0;
+        unwrittenKeys.clear();
+        return;
+    }
+    const double writeStart = juce::Time::getMillisecondCounterHiRes();
     try
     {
         configJson.writeChanges();
@@ -145,14 +221,187 @@ void Config::FileResource::writeChanges()
     catch(Assets::JSONFile::FileException e)
     {
         DBG(dbgPrefix << __func__ << ": Caught FileException:" << e.what());
+        return;
     }
     catch(Assets::JSONFile::TypeException e)
     {
         DBG(dbgPrefix << __func__ << ": Caught TypeException:" << e.what());
+        return;
+    }
+    const double writeEnd = juce::Time::getMillisecondCounterHiRes();
+    // Remember what was written, so the FileWatcher event this write causes
+    // can be ignored:
+    lastWrittenHash = juce::File(getFullConfigPath(filename))
+            .loadFileAsString().hashCode64();
+    unwrittenKeys.clear();
+    const int changesSaved = pendingChanges.exchange(0);
+    const juce::ScopedLock statLock(statisticsLock);
+    writeStatistics.fileWrites++;
+    writeStatistics.lastWriteDuration = writeEnd - writeStart;
+    if (changesSaved > 0)
+    {
+        writeStatistics.changesSaved += changesSaved;
+        writeStatistics.writesAvoided += changesSaved - 1;
+        writeStatistics.lastFlushLatency = writeEnd - firstChangeTime;
+        writeStatistics.maxFlushLatency = juce::jmax(
+                writeStatistics.maxFlushLatency,
+                writeStatistics.lastFlushLatency);
     }
 }
 
 
+// Waits until no values have changed for the write delay period, then writes
+// all pending changes.
+void Config::FileResource::runLoop(SharedResource::Thread::Lock& lock)
+{
+    int waitTime;
+    {
+        const SharedResource::Thread::ScopedReadLock readLock(lock);
+        if (pendingChanges == 0)
+        {
+            signalThreadShouldExit();
+            return;
+        }
+        waitTime = writeDelay - (int) (juce::Time::getMillisecondCounterHiRes()
+                - lastChangeTime);
+        if (waitTime <= 0)
+        {
+            writeJSONChanges();
+            return;
+        }
+    }
+    wait(waitTime);
+}
+
+
+// Writes any remaining changes before the thread stops.
+void Config::FileResource::cleanup(SharedResource::Thread::Lock& lock)
+{
+    const SharedResource::Thread::ScopedReadLock readLock(lock);
+    if (pendingChanges > 0)
+    {
+        writeJSONChanges();
+    }
+}
+
+
+// Starts watching the JSON file for changes made outside of the application.
+void Config::FileResource::startWatchingFile()
+{
+    if (fileWatcher != nullptr)
+    {
+        return;
+    }
+    const juce::File configFile(getFullConfigPath(filename));
+    fileWatcher.reset(new FileWatcher(configFile, [this]()
+    {
+        juce::MessageManager::callAsync(buildAsyncFunction(
+                    SharedResource::LockType::write, [this]
+        {
+            reloadFile();
+        }));
+    }));
+    if (!fileWatcher->startWatching())
+    {
+        DBG(dbgPrefix << __func__ << ": Unable to watch " << filename
+                << ", external changes will be ignored.");
+    }
+}
+
+
+// Reloads all basic config values from the JSON file after it changes,
+// notifying listeners of all values that changed.
+void Config::FileResource::reloadFile()
+{
+    const juce::File configFile(getFullConfigPath(filename));
+    const juce::String fileText = configFile.loadFileAsString();
+    if (fileText.hashCode64() == lastWrittenHash)
+    {
+        DBG(dbgPrefix << __func__ << ": Ignoring changes written to "
+                << filename << " by this application.");
+        return;
+    }
+    juce::var fileData;
+    const juce::Result parseResult = juce::JSON::parse(fileText, fileData);
+    if (parseResult.failed() || !fileData.isObject())
+    {
+        DBG(dbgPrefix << __func__ << ": Ignoring invalid JSON data in "
+                << filename << ": " << parseResult.getErrorMessage());
+        return;
+    }
+    const bool localChangesPending = configJson.hasUnwrittenChanges();
+    juce::Array<juce::Identifier> changedKeys;
+    const std::vector<DataKey>& keys = getConfigKeys();
+    for (int i = 0; i < (int) keys.size(); i++)
+    {
+        const DataKey& key = keys[i];
+        // Unwritten values will replace the file's values when they're saved,
+        // so the file's values are discarded:
+        if (unwrittenKeys.contains(key.key))
+        {
+            continue;
+        }
+        juce::var newValue = fileData.getProperty(key.key, juce::var());
+        if (key.dataType == DataKey::doubleType && newValue.isInt())
+        {
+            newValue = (double) newValue;
+        }
+        // Values with the wrong type are rejected by the value table:
+        if (valueTable.setValue<juce::var>(i, newValue))
+        {
+            updateProperty<juce::var>(key, newValue);
+            changedKeys.add(key.key);
+        }
+    }
+    // Values copied from the file don't need to be written back to it, but
+    // pending changes will save them along with the unwritten values:
+    if (!localChangesPending)
+    {
+        configJson.markChangesSaved();
+    }
+    DBG(dbgPrefix << __func__ << ": Reloaded " << filename << ", "
+            << changedKeys.size() << " value(s) changed.");
+    if (!changedKeys.isEmpty())
+    {
+        notifyListeners(changedKeys);
+    }
+}
+
+
+// Updates derived data, then notifies all listeners tracking any of a list of
+// changed keys.
+void Config::FileResource::notifyListeners
+(const juce::Array<juce::Identifier>& changedKeys)
+{
+    configValuesChanged(changedKeys);
+    int nListeners = 0;
+    int nTracked = 0;
+    foreachHandler<ListenerInterface>(
+        [&changedKeys, &nListeners, &nTracked]
+    (ListenerInterface* listener)
+    {
+        nListeners++;
+        bool tracked = false;
+        for (const juce::Identifier& key : changedKeys)
+        {
+            if (listener->isKeyTracked(key))
+            {
+                tracked = true;
+                listener->configValueChanged(key);
+            }
+        }
+        if (tracked)
+        {
+            nTracked++;
+        }
+    });
+    DBG(dbgPrefix << __func__ << ": " << changedKeys.size()
+            << " value(s) changed in file \"" << filename << "\". Found "
+            << nListeners << " listener(s), and notified " << nTracked
+            << " listener(s) tracking those keys.");
+}
+
+
 // Sets a configuration data value back to its default setting, notifying
 // listeners if the value changes.
 void Config::FileResource::restoreDefaultValue(const DataKey& key)
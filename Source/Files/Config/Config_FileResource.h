@@ -6,16 +6,20 @@
  */
 
 #include "Config_ListenerInterface.h"
-#include "SharedResource_Resource.h"
+#include "Config_ValueTable.h"
+#include "SharedResource_Thread_Resource.h"
 #include "SharedResource_Handler.h"
 #include "Config_DataKey.h"
 #include "Assets_JSONFile.h"
 #include "JuceHeader.h"
+#include <atomic>
 #include <iostream>
 #include <map>
+#include <memory>
 
 namespace Config { class FileResource; }
 namespace Config { struct DataKey; }
+namespace Config { class FileWatcher; }
 
 /**
  * @brief  Provides an abstract base for classes that read and write JSON
@@ -37,11 +41,21 @@ namespace Config { struct DataKey; }
  * invalid parameters in config files will be replaced with values from the
  * default file.
  *
- *  FileResource reads from each JSON file only once per program instance, so
- * any external changes to the file that occur while the program is running
- * will most likely be ignored and may be overwritten.
+ *  FileResource watches its JSON file for changes made outside of the
+ * application. When the file changes, basic config values are reloaded on the
+ * message thread, and only listeners tracking values that actually changed
+ * are notified. Changes that the FileResource writes itself are recognized and
+ * ignored. Custom object and array data is only read once per program
+ * instance, so external changes to that data will be ignored and may be
+ * overwritten.
+ *
+ *  Changes to basic config values are not written to the file immediately.
+ * Instead, the FileResource thread waits until no values have changed for a
+ * short delay, and then writes all changes at once. Any unwritten changes are
+ * also saved when the application shuts down, or when the FileResource is
+ * destroyed.
  */
-class Config::FileResource : public SharedResource::Resource
+class Config::FileResource : public SharedResource::Thread::Resource
 {
 protected:
     /**
@@ -64,6 +78,35 @@ public:
      */
     virtual ~FileResource();
 
+    /**
+     * @brief  Describes how often the FileResource has written to its JSON
+     *         file.
+     */
+    struct WriteStatistics
+    {
+        // Number of value changes that were saved to the file:
+        juce::int64 changesSaved = 0;
+        // Number of times the file was written:
+        juce::int64 fileWrites = 0;
+        // Number of file writes avoided by saving several changes at once:
+        juce::int64 writesAvoided = 0;
+        // Milliseconds between the oldest saved change and the most recent
+        // file write:
+        double lastFlushLatency = 0;
+        // Largest number of milliseconds between a change and the file write
+        // that saved it:
+        double maxFlushLatency = 0;
+        // Milliseconds spent on the most recent file write:
+        double lastWriteDuration = 0;
+    };
+
+    /**
+     * @brief  Gets statistics describing the FileResource's file writes.
+     *
+     * @return  The current write statistics.
+     */
+    WriteStatistics getWriteStatistics() const;
+
     /**
      * @brief  Gets one of the values stored in the JSON configuration file.
      *
@@ -77,6 +120,11 @@ public:
     template<typename ValueType >
     ValueType getConfigValue(const juce::Identifier& key) const
     {
+        const int tableIndex = valueTable.findIndex(key);
+        if (tableIndex >= 0 && valueTable.holdsType<ValueType>(tableIndex))
+        {
+            return valueTable.getValue<ValueType>(tableIndex);
+        }
         if (!isValidKey(key))
         {
             DBG("Config::FileResource::" << __func__
@@ -123,7 +171,8 @@ public:
     template<typename ValueType>
     bool setConfigValue(const juce::Identifier& key, ValueType newValue)
     {
-        if (!isValidKey(key))
+        const int tableIndex = valueTable.findIndex(key);
+        if (tableIndex < 0 && !isValidKey(key))
         {
             DBG("Config::FileResource::" << __func__
                     << ": Attempted changing invalid key \""
@@ -131,27 +180,15 @@ public:
             jassertfalse;
             return false;
         }
+        if (tableIndex >= 0 && valueTable.holdsType<ValueType>(tableIndex)
+                && !valueTable.setValue<ValueType>(tableIndex, newValue))
+        {
+            return false;
+        }
         if (updateProperty<ValueType>(key, newValue))
         {
-            configJson.writeChanges();
-            int nListeners = 0;
-            int nTracked = 0;
-            foreachHandler<ListenerInterface>(
-                [this, &key, &nListeners, & nTracked]
-            (ListenerInterface* listener)
-            {
-                nListeners++;
-                if (listener->isKeyTracked(key))
-                {
-                    nTracked++;
-                    listener->configValueChanged(key);
-                }
-            });
-            DBG("Config::FileResource::" << __func__ << ": Value with key \""
-                    << key.toString() << "\" changed in file \"" << filename
-                    << "\". Found " << nListeners
-                    << " listener(s), and notified " << nTracked
-                    << " listener(s) tracking that key.");
+            scheduleWrite(key);
+            notifyListeners({ key });
             return true;
         }
         return false;
@@ -180,9 +217,10 @@ protected:
      * @brief  Loads all initial configuration data from the JSON config file.
      *
      *  This checks for all expected data keys, and replaces any missing or
-     * invalid values with ones from the default config file. FileResource
-     * subclasses should call this once, after they load any custom object or
-     * array data.
+     * invalid values with ones from the default config file. All basic values
+     * are then copied into the FileResource's value table, where they can be
+     * read without accessing the JSON data. FileResource subclasses should
+     * call this once, after they load any custom object or array data.
      */
     void loadJSONData();
 
@@ -301,7 +339,92 @@ protected:
      */
     void writeChanges();
 
+    /**
+     * @brief  Sets how long the FileResource waits after a value changes
+     *         before writing changes to the file.
+     *
+     * @param delayMS  The number of milliseconds to wait after the last
+     *                 change, or zero to write each change immediately.
+     */
+    void setWriteDelay(const int delayMS);
+
+    /**
+     * @brief  Runs whenever basic config values change, before listeners are
+     *         notified.
+     *
+     *  FileResource subclasses may override this to update any data derived
+     * from config values. The resource will be locked for writing while this
+     * runs. By default, this takes no action.
+     *
+     * @param changedKeys  The keys of all values that just changed.
+     */
+    virtual void configValuesChanged
+    (const juce::Array<juce::Identifier>& changedKeys) { }
+
 private:
+    /**
+     * @brief  Marks the config file as having unwritten changes, writing the
+     *         changes immediately or scheduling them to be written once no
+     *         values have changed for the write delay period.
+     *
+     * @param changedKey  The key of the value that changed.
+     */
+    void scheduleWrite(const juce::Identifier& changedKey);
+
+    /**
+     * @brief  Writes all JSON data changes to the file and updates write
+     *         statistics.
+     *
+     *  This does not write custom object or array data. The resource must be
+     * locked for reading or writing while this runs.
+     */
+    void writeJSONChanges();
+
+    /**
+     * @brief  Waits until no values have changed for the write delay period,
+     *         then writes all pending changes. The thread will stop once no
+     *         changes are pending.
+     *
+     * @param lock  The FileResource's thread lock.
+     */
+    virtual void runLoop(SharedResource::Thread::Lock& lock) override;
+
+    /**
+     * @brief  Writes any remaining changes before the thread stops.
+     *
+     * @param lock  The FileResource's thread lock.
+     */
+    virtual void cleanup(SharedResource::Thread::Lock& lock) override;
+
+    /**
+     * @brief  Starts watching the JSON file for changes made outside of the
+     *         application.
+     */
+    void startWatchingFile();
+
+    /**
+     * @brief  Reloads all basic config values from the JSON file after it
+     *         changes, notifying listeners of all values that changed.
+     *
+     *  Invalid values and custom object or array data in the changed file are
+     * ignored. Changes the FileResource wrote itself are also ignored. Values
+     * that changed within the application but haven't been written yet keep
+     * their unwritten values, and will replace the file's values when they are
+     * written.
+     *
+     *  Values loaded from the file are already saved, so they will not cause
+     * the file to be written again.
+     */
+    void reloadFile();
+
+    /**
+     * @brief  Updates derived data, then notifies all listeners tracking any
+     *         of a list of changed keys.
+     *
+     * @param changedKeys  The keys of all values that just changed.
+     */
+    void notifyListeners(const juce::Array<juce::Identifier>& changedKeys);
+
     /**
      * @brief  Sets a configuration data value back to its default setting,
      *         notifying listeners if the value changes.
@@ -331,5 +454,38 @@ private:
     // Default config file values:
     Assets::JSONFile defaultJson;
 
+    // Typed copies of all basic config values, used for fast value access:
+    ValueTable valueTable;
+
+    // Detects changes to the JSON file made outside of the application:
+    std::unique_ptr<FileWatcher> fileWatcher;
+
+    // Milliseconds to wait after the last change before writing changes:
+    int writeDelay;
+
+    // Number of value changes not yet written to the file:
+    std::atomic<int> pendingChanges;
+
+    // Keys of all values changed since the file was last written, protected
+    // by the resource lock:
+    juce::Array<juce::Identifier> unwrittenKeys;
+
+    // Hash value of the file's contents after it was last written, used to
+    // recognize file change events caused by the FileResource itself:
+    std::atomic<juce::int64> lastWrittenHash;
+
+    // Time in milliseconds when the oldest unwritten change occurred:
+    std::atomic<double> firstChangeTime;
+
+    // Time in milliseconds when the most recent unwritten change occurred:
+    std::atomic<double> lastChangeTime;
+
+    // File write statistics:
+    WriteStatistics writeStatistics;
+
+    // Protects write statistics, which may update while the resource is only
+    // locked for reading:
+    mutable juce::CriticalSection statisticsLock;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FileResource)
 };
@@ -13,6 +13,21 @@ int Config::MainFile::getWifiScanFrequency() const
 }
 
 
+// Gets how long Wifi access point changes should be collected before they are
+// sent to access point list listeners.
+int Config::MainFile::getWifiUpdateInterval() const
+{
+    return getConfigValue<int>(MainKeys::wifiUpdateInterval);
+}
+
+
+// Gets the maximum amount of memory to use for caching loaded icon images.
+int Config::MainFile::getIconCacheSize() const
+{
+    return getConfigValue<int>(MainKeys::iconCacheSize);
+}
+
+
 // Gets the prefix to place before system commands when they should be launched
 // within a new terminal window.
 juce::String Config::MainFile::getTermLaunchPrefix() const
@@ -78,6 +93,13 @@ bool Config::MainFile::getIPLabelPrintsPublic() const
 }
 
 
+// Checks if desktop entry files should be parsed in parallel.
+bool Config::MainFile::getParallelEntryLoading() const
+{
+    return getConfigValue<bool>(MainKeys::parallelEntryLoading);
+}
+
+
 // Sets if the mouse cursor is shown or hidden.
 void Config::MainFile::setShowCursor(const bool showCursor)
 {
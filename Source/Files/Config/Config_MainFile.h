@@ -30,6 +30,22 @@ public:
      */
     int getWifiScanFrequency() const;
 
+    /**
+     * @brief  Gets how long Wifi access point changes should be collected
+     *         before they are sent to access point list listeners.
+     *
+     * @return  The update interval, in milliseconds.
+     */
+    int getWifiUpdateInterval() const;
+
+    /**
+     * @brief  Gets the maximum amount of memory to use for caching loaded icon
+     *         images.
+     *
+     * @return  The icon cache size limit, in kilobytes.
+     */
+    int getIconCacheSize() const;
+
     /**
      * @brief  Gets the HomePage background image or colour.
      *
@@ -108,6 +124,14 @@ public:
      */
     bool getIPLabelPrintsPublic() const;
 
+    /**
+     * @brief  Checks if desktop entry files should be parsed in parallel.
+     *
+     * @return  Whether the DesktopEntry module should parse entry files on
+     *          multiple threads.
+     */
+    bool getParallelEntryLoading() const;
+
     /**
      * @brief  Sets if the mouse cursor is shown or hidden.
      *
@@ -16,6 +16,14 @@ namespace Config
         // points while the Wifi page is open.
         static const DataKey wifiScanFreq
             ("Wifi AP scan frequency", DataKey::intType);
+        // Sets how long, in milliseconds, Wifi access point changes are
+        // collected before they are sent to listeners.
+        static const DataKey wifiUpdateInterval
+            ("Wifi AP update interval", DataKey::intType);
+        // Sets the maximum amount of memory, in kilobytes, used to cache
+        // loaded icon images.
+        static const DataKey iconCacheSize
+            ("Icon cache size", DataKey::intType);
 
         //####################### String value keys: ##########################
         // Sets the name of the wifi interface
@@ -45,10 +53,15 @@ namespace Config
             ("IP label prints local IP", DataKey::boolType);
         static const DataKey printPublicIP
             ("IP label prints public IP", DataKey::boolType);
+        // Sets if desktop entry files should be parsed on multiple threads
+        static const DataKey parallelEntryLoading
+            ("Parallel desktop entry loading", DataKey::boolType);
 
         static const std::vector<DataKey> allKeys
         {
             wifiScanFreq,
+            wifiUpdateInterval,
+            iconCacheSize,
             wifiInterface,
             termLaunchCommand,
             showCursor,
@@ -57,7 +70,8 @@ namespace Config
             showIPOnHome,
             showIPOnSettings,
             printLocalIP,
-            printPublicIP
+            printPublicIP,
+            parallelEntryLoading
         };
     }
 }
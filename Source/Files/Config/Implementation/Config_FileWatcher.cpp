@@ -0,0 +1,143 @@
+#include "Config_FileWatcher.h"
+#include <sys/inotify.h>
+
+#ifdef JUCE_DEBUG
+// Print the full class name before all debug output:
+static const constexpr char* dbgPrefix = "Config::FileWatcher::";
+#endif
+
+// Watcher thread name prefix:
+static const constexpr char* threadNamePrefix = "Config_FileWatcher_";
+
+// Events that may indicate a change to the watched file:
+static const constexpr juce::uint32 watchMask = IN_CLOSE_WRITE | IN_MOVED_TO
+        | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+
+// Milliseconds without new events before a change is sent:
+static const constexpr juce::uint32 quietPeriod = 200;
+
+// Milliseconds to wait for events before checking if the thread should exit:
+static const constexpr int idlePollTimeout = 250;
+
+// Creates the watcher without starting it.
+Config::FileWatcher::FileWatcher
+(const juce::File watchedFile, const std::function<void()> onChange) :
+juce::Thread(threadNamePrefix + watchedFile.getFileName()),
+watchedFile(watchedFile),
+onChange(onChange) { }
+
+
+// Stops the watcher thread and closes the inotify watch.
+Config::FileWatcher::~FileWatcher()
+{
+    stopWatching();
+}
+
+
+// Adds a watch to the file's directory and starts the watcher thread.
+bool Config::FileWatcher::startWatching()
+{
+    if (isThreadRunning())
+    {
+        return true;
+    }
+    if (!inotify.init())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to initialize inotify.");
+        return false;
+    }
+    const juce::File directory = watchedFile.getParentDirectory();
+    watchDescriptor = inotify.addWatch(directory.getFullPathName(),
+            watchMask);
+    if (watchDescriptor < 0)
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to watch "
+                << directory.getFullPathName());
+        inotify.close();
+        return false;
+    }
+    startThread();
+    return true;
+}
+
+
+// Stops the watcher thread, waiting for it to exit.
+void Config::FileWatcher::stopWatching()
+{
+    stopThread(idlePollTimeout * 4);
+    inotify.close();
+    watchDescriptor = -1;
+}
+
+
+// Reads inotify events and sends debounced change notifications until the
+// thread is signalled to exit.
+void Config::FileWatcher::run()
+{
+    bool changePending = false;
+    juce::uint32 lastEventTime = 0;
+    while (!threadShouldExit() && watchDescriptor >= 0)
+    {
+        int pollTimeout = idlePollTimeout;
+        if (changePending)
+        {
+            const juce::uint32 now = juce::Time::getMillisecondCounter();
+            const juce::uint32 sendTime = lastEventTime + quietPeriod;
+            pollTimeout = (sendTime > now) ? (int) (sendTime - now) : 0;
+        }
+
+        typedef Util::InotifyWatcher::WaitResult WaitResult;
+        const WaitResult waitResult = inotify.waitForEvents(pollTimeout);
+        if (waitResult == WaitResult::eventsReady)
+        {
+            if (readEvents())
+            {
+                changePending = true;
+                lastEventTime = juce::Time::getMillisecondCounter();
+            }
+        }
+        else if (waitResult == WaitResult::timedOut && changePending)
+        {
+            DBG(dbgPrefix << __func__ << ": "
+                    << watchedFile.getFileName() << " changed.");
+            changePending = false;
+            if (onChange)
+            {
+                onChange();
+            }
+        }
+        else if (waitResult == WaitResult::failed)
+        {
+            DBG(dbgPrefix << __func__ << ": Polling failed, stopping watcher.");
+            return;
+        }
+    }
+}
+
+
+// Reads all available inotify events.
+bool Config::FileWatcher::readEvents()
+{
+    bool fileChanged = false;
+    const juce::String fileName = watchedFile.getFileName();
+    inotify.readEvents([this, &fileChanged, &fileName]
+            (const Util::InotifyWatcher::Event& event)
+    {
+        if (event.mask & IN_Q_OVERFLOW)
+        {
+            // The file may or may not have changed, check it anyway:
+            fileChanged = true;
+        }
+        else if (event.mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF))
+        {
+            DBG(dbgPrefix << "readEvents: Config directory removed, "
+                    << "no longer watching " << fileName);
+            watchDescriptor = -1;
+        }
+        else if (event.name == fileName)
+        {
+            fileChanged = true;
+        }
+    });
+    return fileChanged;
+}
@@ -0,0 +1,89 @@
+#pragma once
+/**
+ * @file  Config_FileWatcher.h
+ *
+ * @brief  Watches a single configuration file for changes made outside of the
+ *         application.
+ */
+
+#include "Util_InotifyWatcher.h"
+#include "JuceHeader.h"
+#include <functional>
+
+namespace Config { class FileWatcher; }
+
+/**
+ * @brief  Uses inotify to detect when a JSON configuration file is written.
+ *
+ *  The FileWatcher watches the directory containing its file instead of the
+ * file itself, so that it keeps working when the file is replaced by renaming
+ * another file over it. This is how FileResource writes changes, and how most
+ * text editors save files.
+ *
+ *  Editors may write or replace a file several times while saving, so change
+ * notifications are debounced. The change callback only runs once no new
+ * events have arrived for a short quiet period.
+ *
+ *  The change callback runs on the FileWatcher's thread.
+ */
+class Config::FileWatcher : private juce::Thread
+{
+public:
+    /**
+     * @brief  Creates the watcher without starting it.
+     *
+     * @param watchedFile  The configuration file to watch.
+     *
+     * @param onChange     The function to call after the file changes.
+     */
+    FileWatcher(const juce::File watchedFile,
+            const std::function<void()> onChange);
+
+    /**
+     * @brief  Stops the watcher thread and closes the inotify watch.
+     */
+    virtual ~FileWatcher();
+
+    /**
+     * @brief  Adds a watch to the file's directory and starts the watcher
+     *         thread.
+     *
+     * @return  Whether the watcher is now running. This will be false if
+     *          inotify could not be initialized, or if the file's directory
+     *          could not be watched.
+     */
+    bool startWatching();
+
+    /**
+     * @brief  Stops the watcher thread, waiting for it to exit.
+     */
+    void stopWatching();
+
+private:
+    /**
+     * @brief  Reads inotify events and sends debounced change notifications
+     *         until the thread is signalled to exit.
+     */
+    virtual void run() override;
+
+    /**
+     * @brief  Reads all available inotify events.
+     *
+     * @return  Whether any events were for the watched file.
+     */
+    bool readEvents();
+
+    // The configuration file being watched:
+    const juce::File watchedFile;
+
+    // Handles each file change:
+    const std::function<void()> onChange;
+
+    // Watches the file's directory:
+    Util::InotifyWatcher inotify;
+
+    // The watch descriptor of the file's directory, or -1 if not watching:
+    int watchDescriptor = -1;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FileWatcher)
+};
@@ -0,0 +1,168 @@
+#include "Config_ValueTable.h"
+
+// Creates a slot for each key, replacing any existing slots.
+void Config::ValueTable::initKeys(const std::vector<DataKey>& keys)
+{
+    slots.clear();
+    keyIndices.clear();
+    slots.reserve(keys.size());
+    keyIndices.reserve(keys.size());
+    for (const DataKey& key : keys)
+    {
+        jassert(keyIndices.count(key.key) == 0);
+        keyIndices[key.key] = (int) slots.size();
+        Slot newSlot;
+        newSlot.dataType = key.dataType;
+        slots.push_back(newSlot);
+    }
+}
+
+
+// Finds the slot index assigned to a data key.
+int Config::ValueTable::findIndex(const juce::Identifier& key) const
+{
+    auto indexIter = keyIndices.find(key);
+    if (indexIter == keyIndices.end())
+    {
+        return -1;
+    }
+    return indexIter->second;
+}
+
+
+namespace Config
+{
+    template<> bool ValueTable::holdsType<juce::String>(const int index) const
+    {
+        return slots[index].dataType == DataKey::stringType;
+    }
+
+    template<> bool ValueTable::holdsType<int>(const int index) const
+    {
+        return slots[index].dataType == DataKey::intType;
+    }
+
+    template<> bool ValueTable::holdsType<bool>(const int index) const
+    {
+        return slots[index].dataType == DataKey::boolType;
+    }
+
+    template<> bool ValueTable::holdsType<double>(const int index) const
+    {
+        return slots[index].dataType == DataKey::doubleType;
+    }
+
+    template<> bool ValueTable::holdsType<juce::var>(const int index) const
+    {
+        return true;
+    }
+
+    template<> juce::String ValueTable::getValue<juce::String>
+    (const int index) const
+    {
+        jassert(holdsType<juce::String>(index));
+        return slots[index].stringValue;
+    }
+
+    template<> int ValueTable::getValue<int>(const int index) const
+    {
+        jassert(holdsType<int>(index));
+        return slots[index].intValue;
+    }
+
+    template<> bool ValueTable::getValue<bool>(const int index) const
+    {
+        jassert(holdsType<bool>(index));
+        return slots[index].boolValue;
+    }
+
+    template<> double ValueTable::getValue<double>(const int index) const
+    {
+        jassert(holdsType<double>(index));
+        return slots[index].doubleValue;
+    }
+
+    template<> juce::var ValueTable::getValue<juce::var>(const int index) const
+    {
+        const Slot& slot = slots[index];
+        switch (slot.dataType)
+        {
+            case DataKey::stringType:
+                return slot.stringValue;
+            case DataKey::intType:
+                return slot.intValue;
+            case DataKey::boolType:
+                return slot.boolValue;
+            case DataKey::doubleType:
+                return slot.doubleValue;
+        }
+        return juce::var();
+    }
+
+    template<> bool ValueTable::setValue<juce::String>
+    (const int index, const juce::String& newValue)
+    {
+        jassert(holdsType<juce::String>(index));
+        if (slots[index].stringValue == newValue)
+        {
+            return false;
+        }
+        slots[index].stringValue = newValue;
+        return true;
+    }
+
+    template<> bool ValueTable::setValue<int>
+    (const int index, const int& newValue)
+    {
+        jassert(holdsType<int>(index));
+        if (slots[index].intValue == newValue)
+        {
+            return false;
+        }
+        slots[index].intValue = newValue;
+        return true;
+    }
+
+    template<> bool ValueTable::setValue<bool>
+    (const int index, const bool& newValue)
+    {
+        jassert(holdsType<bool>(index));
+        if (slots[index].boolValue == newValue)
+        {
+            return false;
+        }
+        slots[index].boolValue = newValue;
+        return true;
+    }
+
+    template<> bool ValueTable::setValue<double>
+    (const int index, const double& newValue)
+    {
+        jassert(holdsType<double>(index));
+        if (slots[index].doubleValue == newValue)
+        {
+            return false;
+        }
+        slots[index].doubleValue = newValue;
+        return true;
+    }
+
+    template<> bool ValueTable::setValue<juce::var>
+    (const int index, const juce::var& newValue)
+    {
+        switch (slots[index].dataType)
+        {
+            case DataKey::stringType:
+                return newValue.isString()
+                        && setValue<juce::String>(index, newValue);
+            case DataKey::intType:
+                return newValue.isInt() && setValue<int>(index, newValue);
+            case DataKey::boolType:
+                return newValue.isBool() && setValue<bool>(index, newValue);
+            case DataKey::doubleType:
+                return newValue.isDouble()
+                        && setValue<double>(index, newValue);
+        }
+        return false;
+    }
+}
@@ -0,0 +1,153 @@
+#pragma once
+/**
+ * @file  Config_ValueTable.h
+ *
+ * @brief  Stores a configuration file's basic data values in typed,
+ *         index-addressed slots.
+ */
+
+#include "Config_DataKey.h"
+#include "JuceHeader.h"
+#include <unordered_map>
+#include <vector>
+
+namespace Config { class ValueTable; }
+
+/**
+ * @brief  Holds copies of all basic(non-array, non-object) values defined in a
+ *         FileResource's JSON file.
+ *
+ *  The ValueTable assigns each DataKey a slot index once, when the table is
+ * initialized. Values are stored in each slot with their native type, so they
+ * can be read without searching through JSON data or converting juce::var
+ * objects.
+ *
+ *  ValueTable objects are not threadsafe, and must be protected by their
+ * FileResource's lock.
+ */
+class Config::ValueTable
+{
+public:
+    ValueTable() { }
+
+    virtual ~ValueTable() { }
+
+    /**
+     * @brief  Creates a slot for each key, replacing any existing slots.
+     *
+     * @param keys  All basic data keys tracked by the table's FileResource.
+     */
+    void initKeys(const std::vector<DataKey>& keys);
+
+    /**
+     * @brief  Finds the slot index assigned to a data key.
+     *
+     * @param key  The key of a basic data value.
+     *
+     * @return     The key's slot index, or -1 if the table has no slot for
+     *             the key.
+     */
+    int findIndex(const juce::Identifier& key) const;
+
+    /**
+     * @brief  Checks if values of a specific type may be read from and
+     *         written to a table slot.
+     *
+     * @param index  A valid slot index.
+     *
+     * @tparam T     The type of value to check.
+     *
+     * @return       Whether type T matches the slot's data type. Type
+     *               juce::var matches all slots.
+     */
+    template<typename T> bool holdsType(const int index) const;
+
+    /**
+     * @brief  Gets the value stored in a table slot.
+     *
+     * @param index  A valid index of a slot that holds type T.
+     *
+     * @tparam T     The slot value's type.
+     *
+     * @return       The stored value.
+     */
+    template<typename T> T getValue(const int index) const;
+
+    /**
+     * @brief  Changes the value stored in a table slot.
+     *
+     *  Values set as juce::var are only stored if the var holds the slot's
+     * data type.
+     *
+     * @param index     A valid index of a slot that holds type T.
+     *
+     * @param newValue  The new value to store.
+     *
+     * @tparam T        The slot value's type.
+     *
+     * @return          Whether the stored value changed.
+     */
+    template<typename T> bool setValue(const int index, const T& newValue);
+
+private:
+    /**
+     * @brief  Holds a single basic data value.
+     */
+    struct Slot
+    {
+        DataKey::DataType dataType;
+        juce::String stringValue;
+        int intValue = 0;
+        bool boolValue = false;
+        double doubleValue = 0;
+    };
+
+    /**
+     * @brief  Hashes Identifier keys by their pooled string address.
+     */
+    struct KeyHash
+    {
+        size_t operator()(const juce::Identifier& key) const
+        {
+            return std::hash<const void*>()(key.getCharPointer().getAddress());
+        }
+    };
+
+    // All value slots, in the same order as the keys used to initialize them:
+    std::vector<Slot> slots;
+
+    // Maps each value's key to its slot index:
+    std::unordered_map<juce::Identifier, int, KeyHash> keyIndices;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ValueTable)
+};
+
+
+// holdsType, getValue, and setValue template specializations:
+namespace Config {
+
+template<> bool ValueTable::holdsType<juce::String>(const int index) const;
+template<> bool ValueTable::holdsType<int>(const int index) const;
+template<> bool ValueTable::holdsType<bool>(const int index) const;
+template<> bool ValueTable::holdsType<double>(const int index) const;
+template<> bool ValueTable::holdsType<juce::var>(const int index) const;
+
+template<> juce::String ValueTable::getValue<juce::String>(const int index)
+        const;
+template<> int ValueTable::getValue<int>(const int index) const;
+template<> bool ValueTable::getValue<bool>(const int index) const;
+template<> double ValueTable::getValue<double>(const int index) const;
+template<> juce::var ValueTable::getValue<juce::var>(const int index) const;
+
+template<> bool ValueTable::setValue<juce::String>
+(const int index, const juce::String& newValue);
+template<> bool ValueTable::setValue<int>
+(const int index, const int& newValue);
+template<> bool ValueTable::setValue<bool>
+(const int index, const bool& newValue);
+template<> bool ValueTable::setValue<double>
+(const int index, const double& newValue);
+template<> bool ValueTable::setValue<juce::var>
+(const int index, const juce::var& newValue);
+
+}
@@ -0,0 +1,205 @@
+#include "DesktopEntry_CategoryIndex.h"
+#include "DesktopEntry_EntryFile.h"
+#include <algorithm>
+#include <iterator>
+
+// Creates an index of a list of desktop entries.
+DesktopEntry::CategoryIndex::CategoryIndex
+(const juce::Array<EntryFile>& entries)
+{
+    entryIDs.reserve((size_t) entries.size());
+    entryCategories.reserve((size_t) entries.size());
+    for (int i = 0; i < entries.size(); i++)
+    {
+        const juce::String entryID = entries.getReference(i).getDesktopFileID();
+        entryCategories.emplace_back();
+        if (!entryNumbers.emplace(entryID, i).second)
+        {
+            // Only the first entry with each desktop file ID is indexed:
+            entryIDs.push_back(juce::String());
+            freeNumbers.push_back(i);
+            continue;
+        }
+        entryIDs.push_back(entryID);
+        addToCategories(i, entries.getReference(i).getCategories());
+    }
+}
+
+
+// Adds an entry to the index, or replaces the categories of an entry already in
+// the index.
+int DesktopEntry::CategoryIndex::addEntry(const juce::String& entryID,
+        const juce::StringArray& categories)
+{
+    int entryNumber = getEntryNumber(entryID);
+    if (entryNumber >= 0)
+    {
+        removeFromCategories(entryNumber);
+    }
+    else if (!freeNumbers.empty())
+    {
+        entryNumber = freeNumbers.back();
+        freeNumbers.pop_back();
+        entryIDs[(size_t) entryNumber] = entryID;
+        entryNumbers[entryID] = entryNumber;
+    }
+    else
+    {
+        entryNumber = (int) entryIDs.size();
+        entryIDs.push_back(entryID);
+        entryCategories.emplace_back();
+        entryNumbers[entryID] = entryNumber;
+    }
+    addToCategories(entryNumber, categories);
+    return entryNumber;
+}
+
+
+// Removes an entry from the index.
+void DesktopEntry::CategoryIndex::removeEntry(const juce::String& entryID)
+{
+    auto searchIter = entryNumbers.find(entryID);
+    if (searchIter == entryNumbers.end())
+    {
+        return;
+    }
+    const int entryNumber = searchIter->second;
+    removeFromCategories(entryNumber);
+    entryIDs[(size_t) entryNumber] = juce::String();
+    freeNumbers.push_back(entryNumber);
+    entryNumbers.erase(searchIter);
+}
+
+
+// Removes all entries and categories from the index.
+void DesktopEntry::CategoryIndex::clear()
+{
+    entryNumbers.clear();
+    entryIDs.clear();
+    entryCategories.clear();
+    freeNumbers.clear();
+    categoryNumbers.clear();
+    categoryEntries.clear();
+}
+
+
+// Gets the number assigned to an entry in the index.
+int DesktopEntry::CategoryIndex::getEntryNumber(const juce::String& entryID)
+    const
+{
+    auto searchIter = entryNumbers.find(entryID);
+    return (searchIter == entryNumbers.end()) ? -1 : searchIter->second;
+}
+
+
+// Gets the desktop file ID of an indexed entry.
+juce::String DesktopEntry::CategoryIndex::getEntryID(const int entryNumber)
+    const
+{
+    if (entryNumber < 0 || entryNumber >= (int) entryIDs.size())
+    {
+        return juce::String();
+    }
+    return entryIDs[(size_t) entryNumber];
+}
+
+
+// Gets all entries within a single category.
+std::vector<int> DesktopEntry::CategoryIndex::getCategoryEntries
+(const juce::String& category) const
+{
+    const std::vector<int>* entryList = findCategory(category);
+    return (entryList == nullptr) ? std::vector<int>() : *entryList;
+}
+
+
+// Gets all entries that belong to at least one category in a list.
+std::vector<int> DesktopEntry::CategoryIndex::findEntriesInAny
+(const juce::StringArray& categories) const
+{
+    std::vector<int> matchingEntries;
+    for (const juce::String& category : categories)
+    {
+        const std::vector<int>* entryList = findCategory(category);
+        if (entryList == nullptr)
+        {
+            continue;
+        }
+        if (matchingEntries.empty())
+        {
+            matchingEntries = *entryList;
+            continue;
+        }
+        std::vector<int> merged;
+        merged.reserve(matchingEntries.size() + entryList->size());
+        std::set_union(matchingEntries.begin(), matchingEntries.end(),
+                entryList->begin(), entryList->end(),
+                std::back_inserter(merged));
+        matchingEntries.swap(merged);
+    }
+    return matchingEntries;
+}
+
+
+// Finds the sorted entry list of a category.
+const std::vector<int>* DesktopEntry::CategoryIndex::findCategory
+(const juce::String& category) const
+{
+    auto searchIter = categoryNumbers.find(category);
+    if (searchIter == categoryNumbers.end())
+    {
+        return nullptr;
+    }
+    const std::vector<int>& entryList
+            = categoryEntries[(size_t) searchIter->second];
+    return entryList.empty() ? nullptr : &entryList;
+}
+
+
+// Adds an entry number to the sorted entry lists of a list of categories.
+void DesktopEntry::CategoryIndex::addToCategories(const int entryNumber,
+        const juce::StringArray& categories)
+{
+    std::vector<int>& entryCategoryList = entryCategories[(size_t) entryNumber];
+    for (const juce::String& category : categories)
+    {
+        auto categoryIter = categoryNumbers.find(category);
+        int categoryNumber;
+        if (categoryIter == categoryNumbers.end())
+        {
+            categoryNumber = (int) categoryEntries.size();
+            categoryNumbers[category] = categoryNumber;
+            categoryEntries.emplace_back();
+        }
+        else
+        {
+            categoryNumber = categoryIter->second;
+        }
+        std::vector<int>& entryList = categoryEntries[(size_t) categoryNumber];
+        auto insertPos = std::lower_bound(entryList.begin(), entryList.end(),
+                entryNumber);
+        if (insertPos == entryList.end() || *insertPos != entryNumber)
+        {
+            entryList.insert(insertPos, entryNumber);
+            entryCategoryList.push_back(categoryNumber);
+        }
+    }
+}
+
+
+// Removes an entry number from the entry lists of all of its categories.
+void DesktopEntry::CategoryIndex::removeFromCategories(const int entryNumber)
+{
+    std::vector<int>& entryCategoryList = entryCategories[(size_t) entryNumber];
+    for (const int categoryNumber : entryCategoryList)
+    {
+        std::vector<int>& entryList = categoryEntries[(size_t) categoryNumber];
+        auto searchPos = std::lower_bound(entryList.begin(), entryList.end(),
+                entryNumber);
+        if (searchPos != entryList.end() && *searchPos == entryNumber)
+        {
+            entryList.erase(searchPos);
+        }
+    }
+    entryCategoryList.clear();
+}
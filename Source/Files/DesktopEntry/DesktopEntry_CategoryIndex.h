@@ -0,0 +1,166 @@
+#pragma once
+/**
+ * @file  DesktopEntry_CategoryIndex.h
+ *
+ * @brief  Indexes desktop entries by application category for fast category
+ *         queries.
+ */
+
+#include "JuceHeader.h"
+#include <map>
+#include <vector>
+
+namespace DesktopEntry { class CategoryIndex; }
+namespace DesktopEntry { class EntryFile; }
+
+/**
+ * @brief  Maps application categories to sorted lists of integer entry
+ *         numbers.
+ *
+ *  Each desktop file ID added to the CategoryIndex is assigned a small,
+ * dense entry number. Category names are also stored as numbers, and each
+ * category keeps a sorted list of the entry numbers within that category.
+ * Queries for several categories at once are handled by merging these sorted
+ * lists, so their cost depends only on the size of the matching categories,
+ * not on the total number of entries or categories.
+ *
+ *  Entry numbers of removed entries are reused by later entries, so entry
+ * numbers should only be used until the index is next changed.
+ */
+class DesktopEntry::CategoryIndex
+{
+public:
+    /**
+     * @brief  Creates an empty category index.
+     */
+    CategoryIndex() { }
+
+    /**
+     * @brief  Creates an index of a list of desktop entries.
+     *
+     * @param entries  A list of desktop entries. Each entry's number in the
+     *                 index will be equal to its index in this list. If more
+     *                 than one entry has the same desktop file ID, only the
+     *                 first of those entries is indexed.
+     */
+    CategoryIndex(const juce::Array<EntryFile>& entries);
+
+    virtual ~CategoryIndex() { }
+
+    /**
+     * @brief  Adds an entry to the index, or replaces the categories of an
+     *         entry already in the index.
+     *
+     * @param entryID     A desktop file ID.
+     *
+     * @param categories  All categories that entry belongs to.
+     *
+     * @return            The entry's number in the index.
+     */
+    int addEntry(const juce::String& entryID,
+            const juce::StringArray& categories);
+
+    /**
+     * @brief  Removes an entry from the index.
+     *
+     * @param entryID  The desktop file ID of the entry to remove.
+     */
+    void removeEntry(const juce::String& entryID);
+
+    /**
+     * @brief  Removes all entries and categories from the index.
+     */
+    void clear();
+
+    /**
+     * @brief  Gets the number assigned to an entry in the index.
+     *
+     * @param entryID  A desktop file ID.
+     *
+     * @return         The entry's number, or -1 if the entry isn't indexed.
+     */
+    int getEntryNumber(const juce::String& entryID) const;
+
+    /**
+     * @brief  Gets the desktop file ID of an indexed entry.
+     *
+     * @param entryNumber  An entry number returned by the index.
+     *
+     * @return             The matching desktop file ID, or the empty string if
+     *                     no entry has that number.
+     */
+    juce::String getEntryID(const int entryNumber) const;
+
+    /**
+     * @brief  Gets all entries within a single category.
+     *
+     * @param category  An application category name.
+     *
+     * @return          The sorted numbers of all entries in that category.
+     */
+    std::vector<int> getCategoryEntries(const juce::String& category) const;
+
+    /**
+     * @brief  Gets all entries that belong to at least one category in a
+     *         list.
+     *
+     * @param categories  A list of application category names.
+     *
+     * @return            The sorted union of all entry numbers in those
+     *                    categories.
+     */
+    std::vector<int> findEntriesInAny(const juce::StringArray& categories)
+        const;
+
+private:
+    /**
+     * @brief  Finds the sorted entry list of a category.
+     *
+     * @param category  An application category name.
+     *
+     * @return          The category's entry list, or nullptr if no entries
+     *                  have that category.
+     */
+    const std::vector<int>* findCategory(const juce::String& category) const;
+
+    /**
+     * @brief  Adds an entry number to the sorted entry lists of a list of
+     *         categories.
+     *
+     * @param entryNumber  An entry number assigned by the index.
+     *
+     * @param categories   The categories where the entry should be added.
+     */
+    void addToCategories(const int entryNumber,
+            const juce::StringArray& categories);
+
+    /**
+     * @brief  Removes an entry number from the entry lists of all of its
+     *         categories.
+     *
+     * @param entryNumber  An entry number assigned by the index.
+     */
+    void removeFromCategories(const int entryNumber);
+
+    // Maps desktop file IDs to entry numbers:
+    std::map<juce::String, int> entryNumbers;
+
+    // Desktop file IDs stored at their entry numbers, empty for unused
+    // numbers:
+    std::vector<juce::String> entryIDs;
+
+    // Category numbers of each entry, stored at their entry numbers:
+    std::vector<std::vector<int>> entryCategories;
+
+    // Unused entry numbers that may be assigned to new entries:
+    std::vector<int> freeNumbers;
+
+    // Maps category names to category numbers:
+    std::map<juce::String, int> categoryNumbers;
+
+    // Sorted entry numbers within each category, stored at their category
+    // numbers:
+    std::vector<std::vector<int>> categoryEntries;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CategoryIndex)
+};
@@ -0,0 +1,362 @@
+#define DESKTOP_ENTRY_IMPLEMENTATION
+#include "DesktopEntry_DirectoryWatcher.h"
+#include "Assets_XDGDirectories.h"
+#include <sys/inotify.h>
+
+#ifdef JUCE_DEBUG
+// Print the full class name before all debug output:
+static const constexpr char* dbgPrefix = "DesktopEntry::DirectoryWatcher::";
+#endif
+
+// Watcher thread name:
+static const constexpr char* threadName = "DesktopEntry_DirectoryWatcher";
+
+// The desktop entry subdirectory within the data directory:
+static const constexpr char* entryDirectory = "/applications/";
+
+// Desktop entry file extension:
+static const constexpr char* fileExtension = ".desktop";
+
+// Events that may indicate a change to a watched file or directory:
+static const constexpr juce::uint32 watchMask = IN_CREATE | IN_DELETE
+        | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_ATTRIB
+        | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+
+// Events that may indicate that a missing desktop entry directory or one of its
+// parent directories was created. The mask is added to any existing watch
+// mask, in case the parent directory is already watched:
+static const constexpr juce::uint32 parentWatchMask = IN_CREATE | IN_MOVED_TO
+        | IN_ONLYDIR | IN_MASK_ADD;
+
+// Milliseconds without new events before a pending batch is sent:
+static const constexpr juce::uint32 quietPeriod = 300;
+
+// Maximum milliseconds a batch may wait before it is sent:
+static const constexpr juce::uint32 maxBatchDelay = 2000;
+
+// Milliseconds to wait for events before checking if the thread should exit:
+static const constexpr int idlePollTimeout = 250;
+
+// Creates the watcher without starting it.
+DesktopEntry::DirectoryWatcher::DirectoryWatcher(const ChangeCallback onChange)
+: juce::Thread(threadName), onChange(onChange) { }
+
+
+// Stops the watcher thread and closes all inotify watches.
+DesktopEntry::DirectoryWatcher::~DirectoryWatcher()
+{
+    stopWatching();
+}
+
+
+// Adds watches to all desktop entry directories and starts the watcher thread.
+bool DesktopEntry::DirectoryWatcher::startWatching()
+{
+    if (isThreadRunning())
+    {
+        return true;
+    }
+    if (!inotify.init())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to initialize inotify.");
+        return false;
+    }
+    const juce::StringArray dirs = Assets::XDGDirectories::getDataSearchPaths();
+    for (const juce::String& dir : dirs)
+    {
+        watchEntryDirectory(juce::File(dir + entryDirectory));
+    }
+    if (watchedDirs.empty() && parentWatches.empty())
+    {
+        DBG(dbgPrefix << __func__ << ": No desktop entry directories found.");
+        inotify.close();
+        return false;
+    }
+    DBG(dbgPrefix << __func__ << ": Watching " << (int) watchedDirs.size()
+            << " desktop entry directories, and "
+            << (int) parentWatches.size()
+            << " parents of missing entry directories.");
+    startThread();
+    return true;
+}
+
+
+// Stops the watcher thread, waiting for it to exit.
+void DesktopEntry::DirectoryWatcher::stopWatching()
+{
+    stopThread(idlePollTimeout * 4);
+    inotify.close();
+    watchedDirs.clear();
+    parentWatches.clear();
+    pendingIDs.clear();
+    rescanPending = false;
+}
+
+
+// Checks if the watcher is currently tracking file changes.
+bool DesktopEntry::DirectoryWatcher::isWatching() const
+{
+    return isThreadRunning();
+}
+
+
+// Reads inotify events and sends debounced change batches until the thread is
+// signalled to exit.
+void DesktopEntry::DirectoryWatcher::run()
+{
+    while (!threadShouldExit())
+    {
+        const bool batchPending = rescanPending || !pendingIDs.isEmpty();
+        int pollTimeout = idlePollTimeout;
+        if (batchPending)
+        {
+            const juce::uint32 now = juce::Time::getMillisecondCounter();
+            const juce::uint32 quietEnd = lastEventTime + quietPeriod;
+            const juce::uint32 delayEnd = firstEventTime + maxBatchDelay;
+            const juce::uint32 sendTime = juce::jmin(quietEnd, delayEnd);
+            pollTimeout = (sendTime > now) ? (int) (sendTime - now) : 0;
+        }
+
+        typedef Util::InotifyWatcher::WaitResult WaitResult;
+        const WaitResult waitResult = inotify.waitForEvents(pollTimeout);
+        if (waitResult == WaitResult::eventsReady)
+        {
+            if (readEvents())
+            {
+                const juce::uint32 now = juce::Time::getMillisecondCounter();
+                if (!batchPending)
+                {
+                    firstEventTime = now;
+                }
+                lastEventTime = now;
+            }
+        }
+        else if (waitResult == WaitResult::timedOut && batchPending)
+        {
+            sendPendingChanges();
+        }
+        else if (waitResult == WaitResult::failed)
+        {
+            DBG(dbgPrefix << __func__ << ": Polling failed, stopping watcher.");
+            return;
+        }
+    }
+}
+
+
+// Adds a watch to a directory and all of its subdirectories.
+bool DesktopEntry::DirectoryWatcher::addWatch
+(const juce::File& directory, const juce::File& entryDir)
+{
+    const int watchDescriptor = inotify.addWatch(directory.getFullPathName(),
+            watchMask);
+    if (watchDescriptor < 0)
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to watch "
+                << directory.getFullPathName());
+        return false;
+    }
+    watchedDirs[watchDescriptor] = std::make_pair(directory, entryDir);
+    juce::Array<juce::File> subDirs = directory.findChildFiles
+            (juce::File::findDirectories, false);
+    for (const juce::File& subDir : subDirs)
+    {
+        addWatch(subDir, entryDir);
+    }
+    return true;
+}
+
+
+// Watches a desktop entry directory if it exists, or watches its nearest
+// existing parent directory until it is created.
+bool DesktopEntry::DirectoryWatcher::watchEntryDirectory
+(const juce::File& entryDir)
+{
+    if (entryDir.isDirectory())
+    {
+        return addWatch(entryDir, entryDir);
+    }
+    juce::File parentDir = entryDir.getParentDirectory();
+    while (!parentDir.isDirectory() && !parentDir.isRoot())
+    {
+        parentDir = parentDir.getParentDirectory();
+    }
+    const int watchDescriptor = inotify.addWatch(
+            parentDir.getFullPathName(), parentWatchMask);
+    if (watchDescriptor < 0)
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to watch "
+                << parentDir.getFullPathName());
+        return false;
+    }
+    parentWatches[watchDescriptor].first = parentDir;
+    parentWatches[watchDescriptor].second.addIfNotAlreadyThere(entryDir);
+    return false;
+}
+
+
+// Reads all available inotify events, adding their changes to the pending
+// batch.
+bool DesktopEntry::DirectoryWatcher::readEvents()
+{
+    bool changesFound = false;
+    inotify.readEvents([this, &changesFound]
+            (const Util::InotifyWatcher::Event& event)
+    {
+        if (handleEvent(event))
+        {
+            changesFound = true;
+        }
+    });
+    return changesFound;
+}
+
+
+// Adds the changes described by a single inotify event to the pending batch.
+bool DesktopEntry::DirectoryWatcher::handleEvent
+(const Util::InotifyWatcher::Event& event)
+{
+    if (event.mask & IN_Q_OVERFLOW)
+    {
+        DBG(dbgPrefix << __func__ << ": Event queue overflowed.");
+        rescanPending = true;
+        return true;
+    }
+    const bool entryDirCreated = handleParentEvent(event);
+    auto watchIter = watchedDirs.find(event.watchDescriptor);
+    if (watchIter == watchedDirs.end())
+    {
+        return entryDirCreated;
+    }
+    if (event.mask & IN_IGNORED)
+    {
+        watchedDirs.erase(watchIter);
+        return false;
+    }
+    const juce::File watchedDir = watchIter->second.first;
+    const juce::File entryDir = watchIter->second.second;
+    if (event.mask & (IN_DELETE_SELF | IN_MOVE_SELF))
+    {
+        // Entries within the directory are no longer valid, but their IDs are
+        // unknown:
+        rescanPending = true;
+        return true;
+    }
+    if (event.name.isEmpty())
+    {
+        return false;
+    }
+    const juce::File changedFile = watchedDir.getChildFile(event.name);
+    if (event.mask & IN_ISDIR)
+    {
+        if (event.mask & (IN_CREATE | IN_MOVED_TO))
+        {
+            // Watch new subdirectories, and treat any entry files they already
+            // contain as changed:
+            addWatch(changedFile, entryDir);
+            juce::Array<juce::File> newFiles = changedFile.findChildFiles(
+                    juce::File::findFiles, true,
+                    juce::String("*") + fileExtension);
+            for (const juce::File& newFile : newFiles)
+            {
+                pendingIDs.addIfNotAlreadyThere(
+                        newFile.getRelativePathFrom(entryDir));
+            }
+        }
+        else if (event.mask & IN_MOVED_FROM)
+        {
+            rescanPending = true;
+        }
+        return true;
+    }
+    if (changedFile.getFileName().endsWith(fileExtension))
+    {
+        pendingIDs.addIfNotAlreadyThere(
+                changedFile.getRelativePathFrom(entryDir));
+        return true;
+    }
+    return false;
+}
+
+
+// Watches missing desktop entry directories when they or their parent
+// directories are created.
+bool DesktopEntry::DirectoryWatcher::handleParentEvent
+(const Util::InotifyWatcher::Event& event)
+{
+    auto parentIter = parentWatches.find(event.watchDescriptor);
+    if (parentIter == parentWatches.end())
+    {
+        return false;
+    }
+    if (event.mask & IN_IGNORED)
+    {
+        parentWatches.erase(parentIter);
+        return false;
+    }
+    if (!(event.mask & IN_ISDIR) || !(event.mask & (IN_CREATE | IN_MOVED_TO))
+            || event.name.isEmpty())
+    {
+        return false;
+    }
+    const juce::File newDir = parentIter->second.first.getChildFile(event.name);
+    juce::Array<juce::File>& missingDirs = parentIter->second.second;
+    juce::Array<juce::File> foundDirs;
+    for (int i = missingDirs.size() - 1; i >= 0; i--)
+    {
+        if (missingDirs[i] == newDir || missingDirs[i].isAChildOf(newDir))
+        {
+            foundDirs.add(missingDirs[i]);
+            missingDirs.remove(i);
+        }
+    }
+    if (foundDirs.isEmpty())
+    {
+        return false;
+    }
+    if (missingDirs.isEmpty())
+    {
+        if (watchedDirs.count(event.watchDescriptor) == 0)
+        {
+            inotify.removeWatch(event.watchDescriptor);
+        }
+        parentWatches.erase(parentIter);
+    }
+    bool entryDirCreated = false;
+    for (const juce::File& entryDir : foundDirs)
+    {
+        // Parent directories are often created just before their children,
+        // so the entry directory may still be missing:
+        if (watchEntryDirectory(entryDir))
+        {
+            DBG(dbgPrefix << __func__ << ": Watching new entry directory "
+                    << entryDir.getFullPathName());
+            juce::Array<juce::File> newFiles = entryDir.findChildFiles(
+                    juce::File::findFiles, true,
+                    juce::String("*") + fileExtension);
+            for (const juce::File& newFile : newFiles)
+            {
+                pendingIDs.addIfNotAlreadyThere(
+                        newFile.getRelativePathFrom(entryDir));
+            }
+            entryDirCreated = true;
+        }
+    }
+    return entryDirCreated;
+}
+
+
+// Sends the pending batch of changes to the change callback, then clears the
+// batch.
+void DesktopEntry::DirectoryWatcher::sendPendingChanges()
+{
+    DBG(dbgPrefix << __func__ << ": Sending " << pendingIDs.size()
+            << " changed entry IDs"
+            << (rescanPending ? ", requesting full scan." : "."));
+    if (onChange)
+    {
+        onChange(pendingIDs, rescanPending);
+    }
+    pendingIDs.clear();
+    rescanPending = false;
+}
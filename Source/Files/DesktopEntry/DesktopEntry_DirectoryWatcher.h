@@ -0,0 +1,183 @@
+#ifndef DESKTOP_ENTRY_IMPLEMENTATION
+    #error File included directly outside of DesktopEntry implementation.
+#endif
+#pragma once
+/**
+ * @file  DesktopEntry_DirectoryWatcher.h
+ *
+ * @brief  Watches desktop entry directories for changes to .desktop files.
+ */
+
+#include "Util_InotifyWatcher.h"
+#include "JuceHeader.h"
+#include <functional>
+#include <map>
+
+namespace DesktopEntry { class DirectoryWatcher; }
+
+/**
+ * @brief  Uses inotify to track changes to desktop entry files, reporting
+ *         changed desktop file IDs in batches.
+ *
+ *  The DirectoryWatcher adds inotify watches to every application directory
+ * within the XDG data search paths, along with all of their subdirectories.
+ * Application directories that don't exist yet are tracked by watching their
+ * nearest existing parent directory, so they can be watched as soon as they
+ * are created.
+ * Whenever a .desktop file is created, changed, moved, or removed, its desktop
+ * file ID is saved in a pending batch of changes.
+ *
+ *  Package managers and application installers often change many files in
+ * quick succession, so change batches are debounced. A batch is only sent to
+ * the change callback once no new events have arrived for a short quiet
+ * period, or once the batch has waited for a maximum delay.
+ *
+ *  Some events can't be mapped to individual desktop file IDs, such as removed
+ * subdirectories or inotify event queue overflows. When these occur, the batch
+ * will request a complete directory scan instead.
+ *
+ *  The change callback runs on the DirectoryWatcher's thread.
+ */
+class DesktopEntry::DirectoryWatcher : private juce::Thread
+{
+public:
+    /**
+     * @brief  The type of function used to handle changes.
+     *
+     *  The first parameter holds the desktop file IDs of all changed files. The
+     * second parameter is true if a complete scan of all desktop entry
+     * directories is needed.
+     */
+    typedef std::function<void(const juce::StringArray&, const bool)>
+            ChangeCallback;
+
+    /**
+     * @brief  Creates the watcher without starting it.
+     *
+     * @param onChange  The callback function used to handle each batch of
+     *                  desktop entry file changes.
+     */
+    DirectoryWatcher(const ChangeCallback onChange);
+
+    /**
+     * @brief  Stops the watcher thread and closes all inotify watches.
+     */
+    virtual ~DirectoryWatcher();
+
+    /**
+     * @brief  Adds watches to all desktop entry directories and starts the
+     *         watcher thread.
+     *
+     * @return  Whether the watcher is now running. This will be false if
+     *          inotify could not be initialized, or if no desktop entry
+     *          directories could be watched.
+     */
+    bool startWatching();
+
+    /**
+     * @brief  Stops the watcher thread, waiting for it to exit.
+     */
+    void stopWatching();
+
+    /**
+     * @brief  Checks if the watcher is currently tracking file changes.
+     *
+     * @return  Whether the watcher thread is running.
+     */
+    bool isWatching() const;
+
+private:
+    /**
+     * @brief  Reads inotify events and sends debounced change batches until
+     *         the thread is signalled to exit.
+     */
+    virtual void run() override;
+
+    /**
+     * @brief  Adds a watch to a directory and all of its subdirectories.
+     *
+     * @param directory  A desktop entry directory or one of its
+     *                   subdirectories.
+     *
+     * @param entryDir   The desktop entry directory containing directory.
+     *
+     * @return           Whether the directory watch was added.
+     */
+    bool addWatch(const juce::File& directory, const juce::File& entryDir);
+
+    /**
+     * @brief  Watches a desktop entry directory if it exists, or watches its
+     *         nearest existing parent directory until it is created.
+     *
+     * @param entryDir  A desktop entry directory.
+     *
+     * @return          Whether the desktop entry directory itself is now
+     *                  watched.
+     */
+    bool watchEntryDirectory(const juce::File& entryDir);
+
+    /**
+     * @brief  Reads all available inotify events, adding their changes to the
+     *         pending batch.
+     *
+     * @return  Whether any relevant events were read.
+     */
+    bool readEvents();
+
+    /**
+     * @brief  Adds the changes described by a single inotify event to the
+     *         pending batch.
+     *
+     * @param event  An event read from the inotify watcher.
+     *
+     * @return       Whether the event was relevant to any desktop entries.
+     */
+    bool handleEvent(const Util::InotifyWatcher::Event& event);
+
+    /**
+     * @brief  Watches missing desktop entry directories when they or their
+     *         parent directories are created.
+     *
+     *  When a missing desktop entry directory is created, all entry files
+     * within it are added to the pending batch.
+     *
+     * @param event  An event read from the inotify watcher.
+     *
+     * @return       Whether the event created any desktop entry directories.
+     */
+    bool handleParentEvent(const Util::InotifyWatcher::Event& event);
+
+    /**
+     * @brief  Sends the pending batch of changes to the change callback, then
+     *         clears the batch.
+     */
+    void sendPendingChanges();
+
+    // Handles each batch of changes:
+    const ChangeCallback onChange;
+
+    // Watches all desktop entry directories:
+    Util::InotifyWatcher inotify;
+
+    // Maps watch descriptors to watched directories and the desktop entry
+    // directories that contain them:
+    std::map<int, std::pair<juce::File, juce::File>> watchedDirs;
+
+    // Maps watch descriptors to watched parent directories and the missing
+    // desktop entry directories within them:
+    std::map<int, std::pair<juce::File, juce::Array<juce::File>>>
+            parentWatches;
+
+    // Desktop file IDs of all changes in the pending batch:
+    juce::StringArray pendingIDs;
+
+    // Whether the pending batch requires a complete directory scan:
+    bool rescanPending = false;
+
+    // Millisecond counter times of the first and last events in the pending
+    // batch:
+    juce::uint32 firstEventTime = 0;
+    juce::uint32 lastEventTime = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DirectoryWatcher)
+};
@@ -3,10 +3,13 @@
 #include "DesktopEntry_FileError.h"
 #include "DesktopEntry_FormatError.h"
 #include "DesktopEntry_FileUtils.h"
+#include "DesktopEntry_Tokenizer.h"
 #include "Assets_XDGDirectories.h"
 #include "Config_MainFile.h"
 #include "Config_MainKeys.h"
 #include "Locale.h"
+#include <cstring>
+#include <vector>
 
 #ifdef JUCE_DEBUG
 // Print the full class name before all debug output:
@@ -16,6 +19,12 @@ static const constexpr char* dbgPrefix = "DesktopEntry::EntryFile::";
 // Directory where desktop entries are stored within $XDG_DATA_DIRS
 static const juce::String entryDirectory = "/applications/";
 
+// Group header title identifying the main section of desktop entry data:
+static const constexpr char* mainGroupHeader = "Desktop Entry";
+
+// Text at the start of action group header titles:
+static const constexpr char* actionGroupPrefix = "Desktop Action ";
+
 /**
  * @brief  Creates a DataConverter that gets and sets typical string values.
  *
@@ -134,7 +143,7 @@ DesktopEntry::EntryFile::keyGuide
                     throw FileError(thisEntry->file,
                         errorMessage);
                 }
-                return searchIter->second;
+                thisEntry->type = searchIter->second;
             },
             .getValue = []
             (DesktopEntry::EntryFile* thisEntry)->juce::String
@@ -221,6 +230,85 @@ file(sourceFile), desktopFileID(desktopFileID)
 }
 
 
+/**
+ * @brief  Writes a list of strings to a binary output stream.
+ *
+ * @param cacheStream  The stream where the list will be written.
+ *
+ * @param list         The list of strings to write.
+ */
+static void writeList(juce::OutputStream& cacheStream,
+        const juce::StringArray& list)
+{
+    cacheStream.writeCompressedInt(list.size());
+    for (const juce::String& listItem : list)
+    {
+        cacheStream.writeString(listItem);
+    }
+}
+
+/**
+ * @brief  Reads a list of strings written to a binary stream by writeList.
+ *
+ * @param cacheStream  The stream where the list will be read.
+ *
+ * @return             The list of strings read from the stream.
+ */
+static juce::StringArray readList(juce::InputStream& cacheStream)
+{
+    juce::StringArray list;
+    const int listSize = cacheStream.readCompressedInt();
+    for (int i = 0; i < listSize && !cacheStream.isExhausted(); i++)
+    {
+        list.add(cacheStream.readString());
+    }
+    return list;
+}
+
+
+// Loads desktop entry data previously saved with writeToStream.
+DesktopEntry::EntryFile::EntryFile(juce::InputStream& cacheStream)
+{
+    file = juce::File(cacheStream.readString());
+    desktopFileID = cacheStream.readString();
+    type = (cacheStream.readByte() == (char) Type::link)
+            ? Type::link : Type::application;
+    name = cacheStream.readString();
+    genericName = cacheStream.readString();
+    noDisplay = cacheStream.readBool();
+    comment = cacheStream.readString();
+    icon = cacheStream.readString();
+    onlyShowIn = readList(cacheStream);
+    notShowIn = readList(cacheStream);
+    dBusActivatable = cacheStream.readBool();
+    tryExec = cacheStream.readString();
+    exec = cacheStream.readString();
+    path = cacheStream.readString();
+    terminal = cacheStream.readBool();
+    actionTypes = readList(cacheStream);
+    const int actionCount = cacheStream.readCompressedInt();
+    for (int i = 0; i < actionCount && !cacheStream.isExhausted(); i++)
+    {
+        Action& action = actions[cacheStream.readString()];
+        action.title = cacheStream.readString();
+        action.icon = cacheStream.readString();
+        action.exec = cacheStream.readString();
+    }
+    mimeTypes = readList(cacheStream);
+    categories = readList(cacheStream);
+    implements = readList(cacheStream);
+    keywords = readList(cacheStream);
+    startupNotify = cacheStream.readBool();
+    startupWMClass = cacheStream.readString();
+    url = cacheStream.readString();
+    if (desktopFileID.isEmpty())
+    {
+        const juce::String errorMessage("Cached entry data was invalid.");
+        throw FileError(file, errorMessage);
+    }
+}
+
+
 // Creates a desktop entry object without an existing file.
 DesktopEntry::EntryFile::EntryFile(
         const juce::String& name,
@@ -311,6 +399,13 @@ juce::String DesktopEntry::EntryFile::getDesktopFileID() const
 }
 
 
+// Gets the .desktop file that holds this entry's data.
+juce::File DesktopEntry::EntryFile::getFile() const
+{
+    return file;
+}
+
+
 // Gets the desktop entry's name.
 juce::String DesktopEntry::EntryFile::getName() const
 {
@@ -630,6 +725,45 @@ void DesktopEntry::EntryFile::writeFile()
 }
 
 
+// Saves all parsed desktop entry data to a binary output stream, so that it can
+// be restored without reading the .desktop file.
+void DesktopEntry::EntryFile::writeToStream(juce::OutputStream& cacheStream)
+    const
+{
+    cacheStream.writeString(file.getFullPathName());
+    cacheStream.writeString(desktopFileID);
+    cacheStream.writeByte((char) type);
+    cacheStream.writeString(name);
+    cacheStream.writeString(genericName);
+    cacheStream.writeBool(noDisplay);
+    cacheStream.writeString(comment);
+    cacheStream.writeString(icon);
+    writeList(cacheStream, onlyShowIn);
+    writeList(cacheStream, notShowIn);
+    cacheStream.writeBool(dBusActivatable);
+    cacheStream.writeString(tryExec);
+    cacheStream.writeString(exec);
+    cacheStream.writeString(path);
+    cacheStream.writeBool(terminal);
+    writeList(cacheStream, actionTypes);
+    cacheStream.writeCompressedInt((int) actions.size());
+    for (const auto& actionIter : actions)
+    {
+        cacheStream.writeString(actionIter.first);
+        cacheStream.writeString(actionIter.second.title);
+        cacheStream.writeString(actionIter.second.icon);
+        cacheStream.writeString(actionIter.second.exec);
+    }
+    writeList(cacheStream, mimeTypes);
+    writeList(cacheStream, categories);
+    writeList(cacheStream, implements);
+    writeList(cacheStream, keywords);
+    cacheStream.writeBool(startupNotify);
+    cacheStream.writeString(startupWMClass);
+    cacheStream.writeString(url);
+}
+
+
 // Given a standard desktop entry data key, get the value mapped to that key.
 juce::String DesktopEntry::EntryFile::getValue(const juce::Identifier& key)
 {
@@ -645,41 +779,56 @@ juce::String DesktopEntry::EntryFile::getValue(const juce::Identifier& key)
 // Loads all desktop entry data from the desktop entry's file.
 void DesktopEntry::EntryFile::readEntryFile()
 {
-    using juce::StringArray;
     using juce::String;
-    StringArray lines;
     if (!file.existsAsFile())
     {
         String errorMessage("File does not exist.");
         throw FileError(file, errorMessage);
     }
-    file.readLines(lines);
-    String locale = Locale::getLocaleName();
-    // Last group header read:
-    String groupHeader;
+    const juce::MemoryMappedFile mappedFile(file,
+            juce::MemoryMappedFile::readOnly);
+    if (mappedFile.getData() == nullptr && file.getSize() > 0)
+    {
+        String errorMessage("Failed to read file.");
+        throw FileError(file, errorMessage);
+    }
+    Tokenizer tokenizer(static_cast<const char*>(mappedFile.getData()),
+            mappedFile.getSize());
+    const String locale = Locale::getLocaleName();
+    const char* localeText = locale.toRawUTF8();
+    const size_t localeLength = locale.getNumBytesAsUTF8();
+    // Whether the current group is the main desktop entry group:
+    bool inMainGroup = false;
     // Action ID, if the current header defines an action:
-    String actionId;
+    String actionID;
     //If true, the current group is a custom one that should be skipped:
     bool skipCurrentGroup = false;
-    for (const String& line : lines)
+    Tokenizer::Line line;
+    while (tokenizer.nextLine(line))
     {
-        if (line.isEmpty() || line.startsWithChar('#'))
-        {
-            continue; //skip comments and empty lines
-        }
-        else if (FileUtils::isHeaderLine(line))
+        if (line.type == Tokenizer::LineType::header)
         {
+            inMainGroup = line.header.equals(mainGroupHeader,
+                    std::strlen(mainGroupHeader));
+            actionID = String();
             skipCurrentGroup = false;
-            groupHeader = FileUtils::extractHeader(line);
-            if (FileUtils::isValidActionHeader(groupHeader))
+            if (!inMainGroup)
             {
-                groupHeader = FileUtils::extractActionID(groupHeader);
-            }
-            else if (!FileUtils::isMainDataHeader(groupHeader))
-            {
-                DBG(dbgPrefix << __func__ << ": Ignoring nonstandard group "
-                        << groupHeader);
-                skipCurrentGroup = true;
+                const size_t prefixLength = std::strlen(actionGroupPrefix);
+                if (line.header.length > prefixLength
+                        && line.header.startsWith(actionGroupPrefix))
+                {
+                    Tokenizer::TextRange actionRange = line.header;
+                    actionRange.start += prefixLength;
+                    actionRange.length -= prefixLength;
+                    actionID = actionRange.toString();
+                }
+                else
+                {
+                    DBG(dbgPrefix << __func__ << ": Ignoring nonstandard group "
+                            << line.header.toString());
+                    skipCurrentGroup = true;
+                }
             }
             continue;
         }
@@ -687,33 +836,23 @@ void DesktopEntry::EntryFile::readEntryFile()
         {
             continue;
         }
-        String lineLocale = FileUtils::parseLocale(line);
-        if (lineLocale.isEmpty() || lineLocale == locale)
+        if (line.type == Tokenizer::LineType::invalid)
         {
-            try
-            {
-                const juce::Identifier& key = FileUtils::parseKey(line);
-                String value = FileUtils::parseValue(line);
-                if (FileUtils::isMainDataHeader(groupHeader))
-                {
-                    saveLineData(key, value);
-                }
-                else if (groupHeader.isNotEmpty())
-                {
-                    saveActionLineData(groupHeader, key, value);
-                }
-            }
-            catch(FormatError e)
-            {
-                if (e.getBadValue() != line)
-                {
-                    continue;
-                }
-                else
-                {
-                    throw e;
-                }
-            }
+            throw FormatError(line.text.toString());
+        }
+        if (line.keyIndex < 0 || !(line.locale.isEmpty()
+                    || line.locale.equals(localeText, localeLength)))
+        {
+            continue; // Skip nonstandard keys and other locales
+        }
+        if (inMainGroup)
+        {
+            saveLineData(line.keyIndex, line.value.toString());
+        }
+        else if (actionID.isNotEmpty())
+        {
+            saveActionLineData(actionID, line.key.toString(),
+                    line.value.toString());
         }
     }
 }
@@ -721,39 +860,52 @@ void DesktopEntry::EntryFile::readEntryFile()
 
 // Saves data from a desktop entry line to the appropriate EntryFile fields.
 void DesktopEntry::EntryFile::saveLineData
-(const juce::Identifier& key, const juce::String& value)
+(const int keyIndex, const juce::String& value)
 {
-    auto searchIter = keyGuide.find(key);
-    if (searchIter == keyGuide.end())
+    // Converters are found once, so that lines can be handled without creating
+    // Identifiers or searching the key guide.
+    static const std::vector<const DataConverter*> keyConverters = []()
     {
-        throw FormatError(key.toString());
+        std::vector<const DataConverter*> converters;
+        for (int i = 0; i < Tokenizer::getKeyCount(); i++)
+        {
+            auto searchIter = keyGuide.find(
+                    juce::Identifier(Tokenizer::getKeyName(i)));
+            converters.push_back((searchIter == keyGuide.end())
+                    ? nullptr : &searchIter->second);
+        }
+        return converters;
+    }();
+    if (keyIndex < 0 || keyIndex >= (int) keyConverters.size()
+            || keyConverters[(size_t) keyIndex] == nullptr)
+    {
+        throw FormatError(juce::String(Tokenizer::getKeyName(keyIndex)));
     }
-    searchIter->second.readValue(this, value);
+    keyConverters[(size_t) keyIndex]->readValue(this, value);
 }
 
 
 // Saves data from a desktop entry line to the most recently created desktop
 // action.
 void DesktopEntry::EntryFile::saveActionLineData(const juce::String actionID,
-        const juce::Identifier& key, const juce::String& value)
+        const juce::String& key, const juce::String& value)
 {
-    using juce::StringRef;
-    if (key == StringRef("Name"))
+    if (key == "Name")
     {
         actions[actionID].title = value;
     }
-    else if (key == StringRef("Icon"))
+    else if (key == "Icon")
     {
         actions[actionID].icon = value;
     }
-    else if (key == StringRef("Exec"))
+    else if (key == "Exec")
     {
         actions[actionID].exec = value;
     }
     else
     {
         DBG(dbgPrefix << __func__ << ": Skipping unexpected action data "
-                << key.toString() << " = " << value);
+                << key << " = " << value);
     }
 }
 
@@ -64,6 +64,16 @@ public:
     EntryFile(const juce::String& name, const juce::String& desktopFileID,
             const Type type);
 
+    /**
+     * @brief  Loads desktop entry data previously saved with writeToStream.
+     *
+     * @param cacheStream  A stream positioned at the start of saved desktop
+     *                     entry data.
+     *
+     * @throws FileError   If the stream did not contain valid entry data.
+     */
+    EntryFile(juce::InputStream& cacheStream);
+
     /**
      * @brief  Creates an empty desktop entry object with no data.
      */
@@ -113,6 +123,13 @@ public:
      */
     juce::String getDesktopFileID() const;
 
+    /**
+     * @brief  Gets the .desktop file that holds this entry's data.
+     *
+     * @return  The entry's source file, or the file where it will be written.
+     */
+    juce::File getFile() const;
+
     /**
      * @brief  Gets the desktop entry's name.
      *
@@ -342,6 +359,14 @@ public:
      */
     void writeFile();
 
+    /**
+     * @brief  Saves all parsed desktop entry data to a binary output stream,
+     *         so that it can be restored without reading the .desktop file.
+     *
+     * @param cacheStream  The stream where entry data will be written.
+     */
+    void writeToStream(juce::OutputStream& cacheStream) const;
+
 private:
     /**
      * @brief  Given a standard desktop entry data key, get the value mapped to
@@ -357,7 +382,13 @@ private:
     /**
      * @brief  Loads all desktop entry data from the desktop entry's file.
      *
-     * @throws FileError  If the file doesn't exist or contains invalid data.
+     *  The file is memory-mapped and read in a single pass by a Tokenizer, so
+     * only values of recognized keys are copied into new strings.
+     *
+     * @throws FileError    If the file doesn't exist or contains invalid data.
+     *
+     * @throws FormatError  If the file contains a line that is neither a group
+     *                      header nor a key/value pair.
      */
     void readEntryFile();
 
@@ -365,13 +396,16 @@ private:
      * @brief  Saves data from a desktop entry key/value pair to the
      *         appropriate EntryFile fields.
      *
-     * @param key         The key read from the desktop entry line.
+     * @param keyIndex      The index of the line's key in the Tokenizer's
+     *                      standard key list.
+     *
+     * @param value         The value read from the desktop entry line.
      *
-     * @param value       The value read from the desktop entry line.
+     * @throws FileError    If the value was invalid.
      *
-     * @throws FileError  If the key or value were invalid.
+     * @throws FormatError  If the key index was not a valid standard key.
      */
-    void saveLineData(const juce::Identifier& key, const juce::String& value);
+    void saveLineData(const int keyIndex, const juce::String& value);
 
     /**
      * @brief  Saves data from a desktop entry line to the most recently
@@ -384,7 +418,7 @@ private:
      * @param value     The value read from the desktop entry line.
      */
     void saveActionLineData(const juce::String actionID,
-            const juce::Identifier& key, const juce::String& value);
+            const juce::String& key, const juce::String& value);
 
     /**
      * @brief  Expands all field codes in a command string, removing them and
@@ -495,7 +529,7 @@ private:
 
     // Whether the entry's application is known to support startup
     // notifications:
-    bool startupNotify;
+    bool startupNotify = false;
 
     // If specified, it is known that the entry's application will map to a
     // window with this string as its WM class or name hint.
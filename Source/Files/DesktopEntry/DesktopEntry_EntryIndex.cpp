@@ -0,0 +1,304 @@
+#define DESKTOP_ENTRY_IMPLEMENTATION
+#include "DesktopEntry_EntryIndex.h"
+#include "DesktopEntry_FileError.h"
+#include "Assets_XDGDirectories.h"
+#include "Locale.h"
+#include <sys/stat.h>
+
+#ifdef JUCE_DEBUG
+// Print the full class name before all debug output:
+static const constexpr char* dbgPrefix = "DesktopEntry::EntryIndex::";
+#endif
+
+// Index file path, relative to the user cache directory:
+static const constexpr char* indexPath = "/pocket-home/desktopEntries.index";
+
+// Value written at the start of every index file:
+static const constexpr juce::int32 indexMagic = 0x49444850; // "PHDI"
+
+// Index format version, to be incremented whenever the format changes:
+static const constexpr juce::int32 indexVersion = 2;
+
+// Reads the current stamp values of a file.
+DesktopEntry::EntryIndex::FileStamp
+DesktopEntry::EntryIndex::FileStamp::fromFile(const juce::File& file)
+{
+    FileStamp stamp;
+    struct stat fileStats;
+    if (stat(file.getFullPathName().toRawUTF8(), &fileStats) == 0)
+    {
+        stamp.modTime = (juce::int64) fileStats.st_mtim.tv_sec * 1000000000
+                + (juce::int64) fileStats.st_mtim.tv_nsec;
+        stamp.inode = (juce::int64) fileStats.st_ino;
+        stamp.size = (juce::int64) fileStats.st_size;
+    }
+    return stamp;
+}
+
+
+// Checks if the stamp was read from an existing file.
+bool DesktopEntry::EntryIndex::FileStamp::isValid() const
+{
+    return inode != 0;
+}
+
+
+// Checks if two stamps represent the same file version.
+bool DesktopEntry::EntryIndex::FileStamp::operator==(const FileStamp& rhs)
+    const
+{
+    return isValid() && modTime == rhs.modTime && inode == rhs.inode
+            && size == rhs.size;
+}
+
+
+// Creates an empty index without loading the index file.
+DesktopEntry::EntryIndex::EntryIndex() :
+indexFile(Assets::XDGDirectories::getUserCachePath() + indexPath) { }
+
+
+// Creates an empty index that uses a specific index file, without loading that
+// file.
+DesktopEntry::EntryIndex::EntryIndex(const juce::File& indexFile) :
+indexFile(indexFile) { }
+
+
+// Maps the index file and reads all record headers, replacing any entries
+// currently held in the index.
+bool DesktopEntry::EntryIndex::loadIndex()
+{
+    records.clear();
+    mappedIndex.reset();
+    unsavedChanges = false;
+    if (!indexFile.existsAsFile())
+    {
+        return false;
+    }
+    mappedIndex.reset(new juce::MemoryMappedFile(indexFile,
+                juce::MemoryMappedFile::readOnly));
+    if (mappedIndex->getData() == nullptr)
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to map index file "
+                << indexFile.getFullPathName());
+        mappedIndex.reset();
+        unsavedChanges = true;
+        return false;
+    }
+    const char* indexData = static_cast<const char*>(mappedIndex->getData());
+    const juce::int64 indexSize = (juce::int64) mappedIndex->getSize();
+    juce::MemoryInputStream indexStream(indexData, (size_t) indexSize, false);
+    if (indexStream.readInt() != indexMagic
+            || indexStream.readInt() != indexVersion
+            || indexStream.readString() != Locale::getLocaleName())
+    {
+        DBG(dbgPrefix << __func__ << ": Discarding outdated index file.");
+        mappedIndex.reset();
+        unsavedChanges = true;
+        return false;
+    }
+    const int recordCount = indexStream.readCompressedInt();
+    for (int i = 0; i < recordCount; i++)
+    {
+        const juce::String entryID = indexStream.readString();
+        Record record;
+        record.stamp.modTime = indexStream.readInt64();
+        record.stamp.inode = indexStream.readInt64();
+        record.stamp.size = indexStream.readInt64();
+        record.file = juce::File(indexStream.readString());
+        record.displayed = indexStream.readBool();
+        const int entrySize = indexStream.readInt();
+        const juce::int64 entryStart = indexStream.getPosition();
+        if (indexStream.isExhausted() || entryID.isEmpty() || entrySize <= 0
+                || entryStart + entrySize > indexSize)
+        {
+            DBG(dbgPrefix << __func__ << ": Index file is truncated.");
+            unsavedChanges = true;
+            break;
+        }
+        record.savedData = indexData + entryStart;
+        record.savedSize = (size_t) entrySize;
+        records[entryID] = record;
+        indexStream.skipNextBytes(entrySize);
+    }
+    DBG(dbgPrefix << __func__ << ": Loaded " << (int) records.size()
+            << " indexed desktop entries.");
+    return !records.empty();
+}
+
+
+// Saves all indexed entries to the index file, if the index was changed since
+// it was last loaded or saved.
+bool DesktopEntry::EntryIndex::saveIndex()
+{
+    if (!unsavedChanges)
+    {
+        return false;
+    }
+    if (!indexFile.getParentDirectory().createDirectory())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to create index directory.");
+        return false;
+    }
+    juce::TemporaryFile tempFile(indexFile);
+    {
+        juce::FileOutputStream indexStream(tempFile.getFile());
+        if (indexStream.failedToOpen())
+        {
+            DBG(dbgPrefix << __func__ << ": Failed to open temporary file.");
+            return false;
+        }
+        indexStream.writeInt(indexMagic);
+        indexStream.writeInt(indexVersion);
+        indexStream.writeString(Locale::getLocaleName());
+        indexStream.writeCompressedInt((int) records.size());
+        for (const auto& recordIter : records)
+        {
+            const Record& record = recordIter.second;
+            indexStream.writeString(recordIter.first);
+            indexStream.writeInt64(record.stamp.modTime);
+            indexStream.writeInt64(record.stamp.inode);
+            indexStream.writeInt64(record.stamp.size);
+            indexStream.writeString(record.file.getFullPathName());
+            indexStream.writeBool(record.displayed);
+            // Unchanged entries are copied directly from the mapped file:
+            if (record.savedData != nullptr)
+            {
+                indexStream.writeInt((int) record.savedSize);
+                indexStream.write(record.savedData, record.savedSize);
+            }
+            else
+            {
+                juce::MemoryOutputStream entryStream;
+                record.entry.writeToStream(entryStream);
+                indexStream.writeInt((int) entryStream.getDataSize());
+                indexStream.write(entryStream.getData(),
+                        entryStream.getDataSize());
+            }
+        }
+        indexStream.flush();
+        if (indexStream.getStatus().failed())
+        {
+            DBG(dbgPrefix << __func__ << ": Failed to write index: "
+                    << indexStream.getStatus().getErrorMessage());
+            return false;
+        }
+    }
+    // The old index file stays mapped after it is replaced, so unchanged
+    // records may still use its data:
+    if (!tempFile.overwriteTargetFileWithTemporary())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to replace index file.");
+        return false;
+    }
+    unsavedChanges = false;
+    DBG(dbgPrefix << __func__ << ": Saved " << (int) records.size()
+            << " indexed desktop entries.");
+    return true;
+}
+
+
+// Checks if the index holds an up to date entry for a desktop entry file.
+bool DesktopEntry::EntryIndex::isEntryCurrent(const juce::String& entryID,
+        const juce::File& entryFile) const
+{
+    auto searchIter = records.find(entryID);
+    if (searchIter == records.end() || searchIter->second.file != entryFile)
+    {
+        return false;
+    }
+    return searchIter->second.stamp == FileStamp::fromFile(entryFile);
+}
+
+
+// Gets an indexed desktop entry.
+DesktopEntry::EntryFile DesktopEntry::EntryIndex::getEntry
+(const juce::String& entryID) const
+{
+    auto searchIter = records.find(entryID);
+    if (searchIter == records.end())
+    {
+        return EntryFile();
+    }
+    return readRecordEntry(searchIter->second);
+}
+
+
+// Gets the .desktop files of all indexed entries.
+std::map<juce::String, juce::File> DesktopEntry::EntryIndex::getIndexedFiles()
+    const
+{
+    std::map<juce::String, juce::File> indexedFiles;
+    for (const auto& recordIter : records)
+    {
+        indexedFiles[recordIter.first] = recordIter.second.file;
+    }
+    return indexedFiles;
+}
+
+
+// Gets all indexed entries that should be shown in application menus.
+juce::Array<DesktopEntry::EntryFile>
+DesktopEntry::EntryIndex::getDisplayedEntries() const
+{
+    juce::Array<EntryFile> displayedEntries;
+    for (const auto& recordIter : records)
+    {
+        if (recordIter.second.displayed)
+        {
+            const EntryFile entry = readRecordEntry(recordIter.second);
+            if (entry.getDesktopFileID().isNotEmpty())
+            {
+                displayedEntries.add(entry);
+            }
+        }
+    }
+    return displayedEntries;
+}
+
+
+// Adds or updates an indexed entry.
+void DesktopEntry::EntryIndex::updateEntry(const juce::String& entryID,
+        const juce::File& entryFile, const EntryFile& entry)
+{
+    Record& record = records[entryID];
+    record.stamp = FileStamp::fromFile(entryFile);
+    record.file = entryFile;
+    record.displayed = entry.shouldBeDisplayed();
+    record.savedData = nullptr;
+    record.savedSize = 0;
+    record.entry = entry;
+    unsavedChanges = true;
+}
+
+
+// Removes an entry from the index.
+void DesktopEntry::EntryIndex::removeEntry(const juce::String& entryID)
+{
+    if (records.erase(entryID) > 0)
+    {
+        unsavedChanges = true;
+    }
+}
+
+
+// Gets the entry data held by an index record.
+DesktopEntry::EntryFile DesktopEntry::EntryIndex::readRecordEntry
+(const Record& record)
+{
+    if (record.savedData == nullptr)
+    {
+        return record.entry;
+    }
+    juce::MemoryInputStream entryStream(record.savedData, record.savedSize,
+            false);
+    try
+    {
+        return EntryFile(entryStream);
+    }
+    catch(FileError e)
+    {
+        DBG(dbgPrefix << __func__ << ": Invalid saved entry "
+                << record.file.getFullPathName() << ": " << e.what());
+    }
+    return EntryFile();
+}
@@ -0,0 +1,215 @@
+#ifndef DESKTOP_ENTRY_IMPLEMENTATION
+    #error File included directly outside of DesktopEntry implementation.
+#endif
+#pragma once
+/**
+ * @file  DesktopEntry_EntryIndex.h
+ *
+ * @brief  Saves parsed desktop entry data to a binary cache file, so that
+ *         unchanged entry files don't need to be parsed again.
+ */
+
+#include "DesktopEntry_EntryFile.h"
+#include <map>
+#include <memory>
+
+namespace DesktopEntry { class EntryIndex; }
+
+/**
+ * @brief  Stores parsed EntryFile data in a persistent index file within the
+ *         user's cache directory.
+ *
+ *  Each indexed entry is saved with its desktop file ID, and with the
+ * modification time, inode number, and size of its .desktop file. When the
+ * index is loaded, those file stamps are used to find entry files that were
+ * not changed since they were indexed, and may be used without parsing them
+ * again.
+ *
+ *  The index file is memory-mapped when loaded, and only each record's header
+ * is read. Each header holds the entry's ID, file stamp, file path, and
+ * whether it should be displayed, so unchanged entries can be found without
+ * reading their saved entry data. Saved entry data is only read from the
+ * mapped file when getEntry or getDisplayedEntries needs it. The index file is
+ * replaced atomically whenever it is saved. Index data is discarded if it was
+ * saved by a different index format version or using a different locale.
+ */
+class DesktopEntry::EntryIndex
+{
+public:
+    /**
+     * @brief  Identifies a specific version of a desktop entry file.
+     */
+    struct FileStamp
+    {
+        // File modification time, in nanoseconds since the epoch:
+        juce::int64 modTime = 0;
+        // File inode number:
+        juce::int64 inode = 0;
+        // File size in bytes:
+        juce::int64 size = 0;
+
+        /**
+         * @brief  Reads the current stamp values of a file.
+         *
+         * @param file  Any file.
+         *
+         * @return      The file's stamp, or an invalid stamp if the file could
+         *              not be read.
+         */
+        static FileStamp fromFile(const juce::File& file);
+
+        /**
+         * @brief  Checks if the stamp was read from an existing file.
+         *
+         * @return  Whether the stamp holds valid file data.
+         */
+        bool isValid() const;
+
+        /**
+         * @brief  Checks if two stamps represent the same file version.
+         *
+         * @param rhs  Another stamp to compare with this one.
+         *
+         * @return     Whether both stamps are valid and identical.
+         */
+        bool operator==(const FileStamp& rhs) const;
+    };
+
+    /**
+     * @brief  Creates an empty index without loading the index file.
+     */
+    EntryIndex();
+
+    /**
+     * @brief  Creates an empty index that uses a specific index file, without
+     *         loading that file.
+     *
+     * @param indexFile  The file where index data will be loaded and saved.
+     */
+    EntryIndex(const juce::File& indexFile);
+
+    virtual ~EntryIndex() { }
+
+    /**
+     * @brief  Maps the index file and reads all record headers, replacing any
+     *         entries currently held in the index.
+     *
+     *  Saved entry data isn't read until it is needed, so this doesn't parse
+     * any entries. If the index file is truncated, all complete records
+     * before the end of the file are still loaded.
+     *
+     * @return  Whether any indexed entries were loaded.
+     */
+    bool loadIndex();
+
+    /**
+     * @brief  Saves all indexed entries to the index file, if the index was
+     *         changed since it was last loaded or saved.
+     *
+     * @return  Whether the index file was written.
+     */
+    bool saveIndex();
+
+    /**
+     * @brief  Checks if the index holds an up to date entry for a desktop
+     *         entry file.
+     *
+     * @param entryID    The desktop file ID of an entry file.
+     *
+     * @param entryFile  The .desktop file that should be checked.
+     *
+     * @return           Whether the indexed data for that file ID was read
+     *                   from the current version of that file.
+     */
+    bool isEntryCurrent(const juce::String& entryID,
+            const juce::File& entryFile) const;
+
+    /**
+     * @brief  Gets an indexed desktop entry, reading its saved data if it
+     *         hasn't changed since the index was loaded.
+     *
+     * @param entryID  The desktop file ID of an indexed entry.
+     *
+     * @return         The indexed entry, or an empty EntryFile if the index
+     *                 has no valid entry with that ID.
+     */
+    EntryFile getEntry(const juce::String& entryID) const;
+
+    /**
+     * @brief  Gets the .desktop files of all indexed entries.
+     *
+     * @return  A map of desktop file IDs to the files used to create each
+     *          indexed entry.
+     */
+    std::map<juce::String, juce::File> getIndexedFiles() const;
+
+    /**
+     * @brief  Gets all indexed entries that should be shown in application
+     *         menus.
+     *
+     * @return  All displayable indexed entries.
+     */
+    juce::Array<EntryFile> getDisplayedEntries() const;
+
+    /**
+     * @brief  Adds or updates an indexed entry.
+     *
+     * @param entryID    The desktop file ID of a parsed entry file.
+     *
+     * @param entryFile  The .desktop file that was parsed.
+     *
+     * @param entry      The entry data parsed from that file.
+     */
+    void updateEntry(const juce::String& entryID, const juce::File& entryFile,
+            const EntryFile& entry);
+
+    /**
+     * @brief  Removes an entry from the index.
+     *
+     * @param entryID  The desktop file ID of the entry to remove.
+     */
+    void removeEntry(const juce::String& entryID);
+
+private:
+    // Stores a single indexed entry:
+    struct Record
+    {
+        // The entry file's stamp when it was parsed:
+        FileStamp stamp;
+        // The .desktop file that was parsed:
+        juce::File file;
+        // Whether the entry should be shown in application menus:
+        bool displayed = false;
+        // The entry's saved data within the mapped index file, or nullptr if
+        // the entry was updated after the index was loaded:
+        const char* savedData = nullptr;
+        // The size in bytes of the entry's saved data:
+        size_t savedSize = 0;
+        // Entry data updated after the index was loaded:
+        EntryFile entry;
+    };
+
+    /**
+     * @brief  Gets the entry data held by an index record.
+     *
+     * @param record  Any indexed entry record.
+     *
+     * @return        The record's entry, or an empty EntryFile if its saved
+     *                data was invalid.
+     */
+    static EntryFile readRecordEntry(const Record& record);
+
+    // Maps desktop file IDs to indexed entry records:
+    std::map<juce::String, Record> records;
+
+    // The mapped index file holding saved entry data for unchanged records:
+    std::unique_ptr<juce::MemoryMappedFile> mappedIndex;
+
+    // The file where index data is saved:
+    const juce::File indexFile;
+
+    // Whether records changed since the index was last loaded or saved:
+    bool unsavedChanges = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EntryIndex)
+};
@@ -30,6 +30,17 @@ DesktopEntry::Loader::getAllEntries() const
 }
 
 
+// Gets all displayable EntryFile objects saved in the desktop entry index,
+// without waiting for desktop entry files to finish loading.
+juce::Array<DesktopEntry::EntryFile>
+DesktopEntry::Loader::getIndexedEntries() const
+{
+    SharedResource::LockedPtr<const LoadingThread> loadingThread
+            = getReadLockedResource();
+    return loadingThread->getIndexedEntries();
+}
+
+
 // Gets all EntryFile objects in a single category.
 juce::Array<DesktopEntry::EntryFile> DesktopEntry::Loader::getCategoryEntries
 (const juce::String& category) const
@@ -60,7 +71,8 @@ void DesktopEntry::Loader::scanForChanges()
     {
         loadingThread->startResourceThread();
     }
-    else //if (loadingThread->isFinishedLoading())
+    else if (!loadingThread->isWatchingFiles()
+            || loadingThread->hasWatchedChanges())
     {
         loadingThread->notify();
     }
@@ -91,6 +103,26 @@ DesktopEntry::CallbackID DesktopEntry::Loader::waitUntilLoaded
 }
 
 
+// Schedules an action to run once the desktop entry index has been loaded.
+DesktopEntry::CallbackID DesktopEntry::Loader::waitUntilIndexLoaded
+(std::function<void()> onIndexLoaded)
+{
+    SharedResource::LockedPtr<LoadingThread> loadingThread
+            = getWriteLockedResource();
+    if (loadingThread->isIndexLoaded())
+    {
+        onIndexLoaded();
+        return 0;
+    }
+    CallbackID callbackID = loadingThread->addIndexCallback(onIndexLoaded);
+    if (!loadingThread->isThreadRunning())
+    {
+        loadingThread->startResourceThread();
+    }
+    return callbackID;
+}
+
+
 // Removes an onFinish callback functions that is set to run when the thread
 // finishes loading.
 void DesktopEntry::Loader::clearCallback(CallbackID callbackID)
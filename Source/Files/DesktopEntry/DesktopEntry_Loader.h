@@ -43,6 +43,20 @@ public:
      */
     juce::Array<EntryFile> getAllEntries() const;
 
+    /**
+     * @brief  Gets all displayable EntryFile objects saved in the desktop entry
+     *         index, without waiting for desktop entry files to finish
+     *         loading.
+     *
+     *  The index is loaded on the desktop entry thread. Use
+     * waitUntilIndexLoaded to find out when indexed entries are available.
+     *
+     * @return  All indexed EntryFile objects, or an empty list if the index
+     *          isn't loaded yet. Some of these objects may be outdated, or may
+     *          no longer exist.
+     */
+    juce::Array<EntryFile> getIndexedEntries() const;
+
     /**
      * @brief  Gets all EntryFile objects in a single category.
      *
@@ -67,6 +81,10 @@ public:
     /**
      * @brief  Scans all desktop entry files for any changes made since the
      *         last time the LoadingThread read the entry files.
+     *
+     *  If the LoadingThread is watching desktop entry directories for changes,
+     * directories will not be scanned again. Instead, the LoadingThread will
+     * only be woken if it has watched changes waiting to be loaded.
      */
     void scanForChanges();
 
@@ -84,6 +102,21 @@ public:
      */
     CallbackID waitUntilLoaded(std::function<void()> onFinish);
 
+    /**
+     * @brief  Schedules an action to run once the desktop entry index has
+     *         been loaded.
+     *
+     * @param onIndexLoaded  A callback function to run when indexed entries
+     *                       are available through getIndexedEntries. If the
+     *                       index was already loaded, the callback will run
+     *                       immediately. Otherwise, it will run on the JUCE
+     *                       message thread as soon as the index is loaded.
+     *
+     * @return               A callback ID that may later be used to cancel the
+     *                       callback function, if it is still pending.
+     */
+    CallbackID waitUntilIndexLoaded(std::function<void()> onIndexLoaded);
+
     /**
      * @brief  Removes an onFinish callback functions that is set to run when
      *         the thread finishes loading.
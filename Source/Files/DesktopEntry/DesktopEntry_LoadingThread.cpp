@@ -3,8 +3,10 @@
 #include "DesktopEntry_FileError.h"
 #include "DesktopEntry_FormatError.h"
 #include "DesktopEntry_UpdateInterface.h"
+#include "DesktopEntry_ParsingPool.h"
 #include "SharedResource_Thread_ScopedWriteLock.h"
 #include "Assets_XDGDirectories.h"
+#include "Config_MainFile.h"
 
 #ifdef JUCE_DEBUG
 // Print the full class name before all debug output:
@@ -27,17 +29,29 @@ static const constexpr char* everyEntryCategory = "All";
 // Name of the desktop entry category holding uncategorized entries:
 static const constexpr char* miscEntryCategory = "Other";
 
-// Desktop entry file extension:
-static const constexpr char* fileExtension = ".desktop";
-
 // Creates and starts the thread resource.
 DesktopEntry::LoadingThread::LoadingThread() :
-SharedResource::Thread::Resource(resourceKey, ::threadName)
+SharedResource::Thread::Resource(resourceKey, ::threadName),
+directoryWatcher([this](const juce::StringArray& changedIDs,
+            const bool rescanAll)
+{
+    queueWatchedChanges(changedIDs, rescanAll);
+})
 {
+    // Start watching before the first scan, so that no changes are missed:
+    directoryWatcher.startWatching();
     startResourceThread();
 }
 
 
+// Stops watching desktop entry directories before the thread resource is
+// destroyed.
+DesktopEntry::LoadingThread::~LoadingThread()
+{
+    directoryWatcher.stopWatching();
+}
+
+
 // Finds a desktop entry from its desktop file ID.
 DesktopEntry::EntryFile DesktopEntry::LoadingThread::getDesktopEntry
     (const juce::String entryFileID) const
@@ -71,27 +85,7 @@ juce::Array<DesktopEntry::EntryFile>
 DesktopEntry::LoadingThread::getCategoryEntries
 (const juce::String category) const
 {
-    try
-    {
-        juce::Array<EntryFile> entryList;
-        for (const juce::String& entryID : categories.at(category))
-        {
-            try
-            {
-                entryList.add(entries.at(entryID));
-            }
-            catch(std::out_of_range e)
-            {
-                DBG(dbgPrefix << __func__ << ": Failed to find entry with ID "
-                        << entryID);
-            }
-        }
-        return entryList;
-    }
-    catch(std::out_of_range e)
-    {
-        return juce::Array<EntryFile>();
-    }
+    return getCategoryEntries(juce::StringArray(category));
 }
 
 
@@ -100,32 +94,35 @@ juce::Array<DesktopEntry::EntryFile>
 DesktopEntry::LoadingThread::getCategoryEntries
 (const juce::StringArray categoryList) const
 {
-    juce::StringArray entryIDs;
-    for (const juce::String& category : categoryList)
-    {
-        if (categories.count(category))
-        {
-            entryIDs.addArray(categories.at(category));
-        }
-    }
-    entryIDs.removeDuplicates(false);
+    const std::vector<int> entryNumbers
+            = categoryIndex.findEntriesInAny(categoryList);
     juce::Array<EntryFile> entryList;
-    for (const juce::String& entryID : entryIDs)
+    entryList.ensureStorageAllocated((int) entryNumbers.size());
+    for (const int entryNumber : entryNumbers)
     {
-        try
+        auto searchIter = entries.find(categoryIndex.getEntryID(entryNumber));
+        if (searchIter != entries.end())
         {
-            entryList.add(entries.at(entryID));
+            entryList.add(searchIter->second);
         }
-        catch(std::out_of_range e)
+        else
         {
             DBG(dbgPrefix << __func__ << ": Failed to find entry with ID "
-                    << entryID);
+                    << categoryIndex.getEntryID(entryNumber));
         }
     }
     return entryList;
 }
 
 
+// Gets all displayable desktop entries saved in the desktop entry index.
+juce::Array<DesktopEntry::EntryFile>
+DesktopEntry::LoadingThread::getIndexedEntries() const
+{
+    return entryIndex.getDisplayedEntries();
+}
+
+
 // Adds a callback function to run once when the thread finishes loading or
 // updating desktop entries.
 DesktopEntry::CallbackID DesktopEntry::LoadingThread::addLoadingCallback
@@ -146,10 +143,27 @@ DesktopEntry::CallbackID DesktopEntry::LoadingThread::addLoadingCallback
 }
 
 
+// Adds a callback function to run once when the thread finishes loading the
+// desktop entry index.
+DesktopEntry::CallbackID DesktopEntry::LoadingThread::addIndexCallback
+(const std::function<void()> indexCallback)
+{
+    if (indexCallback) // Ignore invalid callback functions
+    {
+        const CallbackID callbackID = generateCallbackID();
+        onIndexLoaded[callbackID] = indexCallback;
+        return callbackID;
+    }
+    DBG(dbgPrefix << __func__ << ": Attempted to add invalid index callback");
+    return 0;
+}
+
+
 // Cancels a pending callback ID.
 void DesktopEntry::LoadingThread::cancelCallback(const CallbackID toCancel)
 {
     onFinish.erase(toCancel);
+    onIndexLoaded.erase(toCancel);
 }
 
 
@@ -161,6 +175,12 @@ void DesktopEntry::LoadingThread::findUpdatedFiles()
     using juce::File;
     juce::StringArray dirs = Assets::XDGDirectories::getDataSearchPaths();
     std::map<String, File> oldFiles = entryFiles;
+    // Before entries are first loaded, treat all indexed entries as previously
+    // loaded entries:
+    if (oldFiles.empty())
+    {
+        oldFiles = entryIndex.getIndexedFiles();
+    }
     entryFiles.clear();
     for (const String& dir : dirs)
     {
@@ -176,13 +196,26 @@ void DesktopEntry::LoadingThread::findUpdatedFiles()
                         && pendingFiles.count(desktopID) == 0)
                 {
                     entryFiles[desktopID] = file;
+                    auto oldFileIter = oldFiles.find(desktopID);
+                    const bool isNewFile = (oldFileIter == oldFiles.end());
+                    // Load unloaded files from the index if their indexed data
+                    // is still current:
+                    if (entries.count(desktopID) == 0
+                            && entryIndex.isEntryCurrent(desktopID, file))
+                    {
+                        indexedFiles[desktopID] = file;
+                        if (isNewFile)
+                        {
+                            lastAddedIDs.add(desktopID);
+                        }
+                    }
                     // Skip updates to files that have not changed since the
                     // last scan:
-                    if (file.getLastModificationTime() > lastScanTime
-                            || file != oldFiles[desktopID])
+                    else if (file.getLastModificationTime() > lastScanTime
+                            || isNewFile || file != oldFileIter->second)
                     {
                         pendingFiles[desktopID] = file;
-                        if (!oldFiles.count(desktopID))
+                        if (isNewFile)
                         {
                             lastAddedIDs.add(desktopID);
                         }
@@ -211,7 +244,8 @@ void DesktopEntry::LoadingThread::findUpdatedFiles()
             << " unique desktop entry files in " << dirs.size()
             << " data directories.");
     DBG(dbgPrefix << __func__ << ": Reloading "
-            << ((int) pendingFiles.size()) << " entry files.");
+            << ((int) pendingFiles.size()) << " entry files, loading "
+            << ((int) indexedFiles.size()) << " from the entry index.");
 }
 
 
@@ -223,6 +257,29 @@ bool DesktopEntry::LoadingThread::isFinishedLoading()
 }
 
 
+// Checks if the thread has loaded the desktop entry index.
+bool DesktopEntry::LoadingThread::isIndexLoaded() const
+{
+    return indexLoaded;
+}
+
+
+// Checks if desktop entry directories are being watched for changes.
+bool DesktopEntry::LoadingThread::isWatchingFiles() const
+{
+    return directoryWatcher.isWatching();
+}
+
+
+// Checks if the DirectoryWatcher reported changes that the thread hasn't loaded
+// yet.
+bool DesktopEntry::LoadingThread::hasWatchedChanges() const
+{
+    const juce::ScopedLock changeLock(watchedChangeLock);
+    return watchedRescan || !watchedChangeIDs.isEmpty();
+}
+
+
 // Finds all unloaded or updated desktop entry files within the application
 // data directories, ignoring files with duplicate desktop file IDs.
 void DesktopEntry::LoadingThread::init
@@ -232,15 +289,172 @@ void DesktopEntry::LoadingThread::init
     lastAddedIDs.clear();
     lastChangedIDs.clear();
     lastRemovedIDs.clear();
-    findUpdatedFiles();
+    phaseTimes = PhaseTimes();
+    Config::MainFile config;
+    parallelLoading = config.getParallelEntryLoading();
+    if (!indexLoaded)
+    {
+        loadEntryIndex(threadLock);
+    }
+    findChanges(threadLock);
+}
+
+
+// Finds new, changed, and removed desktop entry files, using watched changes if
+// possible, or scanning all desktop entry directories if necessary.
+void DesktopEntry::LoadingThread::findChanges
+(SharedResource::Thread::Lock& threadLock)
+{
+    const double scanStart = juce::Time::getMillisecondCounterHiRes();
+    if (!findWatchedChanges(threadLock))
+    {
+        findUpdatedFiles();
+        loadIndexedEntries(threadLock);
+    }
+    phaseTimes.scan += juce::Time::getMillisecondCounterHiRes() - scanStart;
+}
+
+
+// Loads the desktop entry index file, then runs all index callback functions
+// on the message thread.
+void DesktopEntry::LoadingThread::loadEntryIndex
+(SharedResource::Thread::Lock& threadLock)
+{
+    const SharedResource::Thread::ScopedWriteLock writeLock(threadLock);
+    entryIndex.loadIndex();
+    indexLoaded = true;
+    juce::MessageManager::callAsync(buildAsyncFunction(
+                SharedResource::LockType::write, [this]
+    {
+        std::map<CallbackID, std::function<void()>> callbacks;
+        callbacks.swap(onIndexLoaded);
+        for (const auto& callback : callbacks)
+        {
+            callback.second();
+        }
+    }));
+}
+
+
+// Prepares to update all desktop entries reported as changed by the
+// DirectoryWatcher, and removes entries with deleted files.
+bool DesktopEntry::LoadingThread::findWatchedChanges
+(SharedResource::Thread::Lock& threadLock)
+{
+    juce::StringArray changedIDs;
+    {
+        const juce::ScopedLock changeLock(watchedChangeLock);
+        const bool rescanNeeded = watchedRescan || watchedChangeIDs.isEmpty()
+                || entryFiles.empty();
+        // A full scan also finds all watched changes, so they may be
+        // discarded:
+        changedIDs.swapWith(watchedChangeIDs);
+        watchedRescan = false;
+        if (rescanNeeded)
+        {
+            return false;
+        }
+    }
+
+    const SharedResource::Thread::ScopedWriteLock writeLock(threadLock);
+    for (const juce::String& entryID : changedIDs)
+    {
+        const juce::File entryFile = findEntryFile(entryID);
+        const bool isNewFile = (entryFiles.count(entryID) == 0);
+        if (entryFile.existsAsFile())
+        {
+            entryFiles[entryID] = entryFile;
+            pendingFiles[entryID] = entryFile;
+            if (isNewFile)
+            {
+                lastAddedIDs.addIfNotAlreadyThere(entryID);
+            }
+            else if (!lastAddedIDs.contains(entryID))
+            {
+                lastChangedIDs.addIfNotAlreadyThere(entryID);
+            }
+        }
+        else if (!isNewFile)
+        {
+            entryFiles.erase(entryID);
+            removeLoadedEntry(entryID);
+            entryIndex.removeEntry(entryID);
+            lastAddedIDs.removeString(entryID);
+            lastChangedIDs.removeString(entryID);
+            lastRemovedIDs.addIfNotAlreadyThere(entryID);
+        }
+    }
+    DBG(dbgPrefix << __func__ << ": Reloading " << ((int) pendingFiles.size())
+            << " entry files from " << changedIDs.size()
+            << " watched changes.");
+    return true;
 }
 
 
-// Loads or updates a single desktop entry file in the list of pending files.
+// Saves a batch of changes reported by the DirectoryWatcher, and wakes the
+// thread to load them.
+void DesktopEntry::LoadingThread::queueWatchedChanges
+(const juce::StringArray& changedIDs, const bool rescanAll)
+{
+    {
+        const juce::ScopedLock changeLock(watchedChangeLock);
+        for (const juce::String& entryID : changedIDs)
+        {
+            watchedChangeIDs.addIfNotAlreadyThere(entryID);
+        }
+        watchedRescan = watchedRescan || rescanAll;
+    }
+    // If the thread is still loading, threadShouldWait will keep it running
+    // until the queued changes are found:
+    notify();
+}
+
+
+// Saves all entries with up to date data in the desktop entry index without
+// parsing their files, and removes deleted entries from the index.
+void DesktopEntry::LoadingThread::loadIndexedEntries
+(SharedResource::Thread::Lock& threadLock)
+{
+    const SharedResource::Thread::ScopedWriteLock writeLock(threadLock);
+    for (const auto& fileIter : indexedFiles)
+    {
+        saveParsedEntry(fileIter.first, entryIndex.getEntry(fileIter.first));
+    }
+    indexedFiles.clear();
+    for (const juce::String& removedID : lastRemovedIDs)
+    {
+        removeLoadedEntry(removedID);
+        entryIndex.removeEntry(removedID);
+    }
+}
+
+
+// Loads or updates pending desktop entry files.
 void DesktopEntry::LoadingThread::runLoop
 (SharedResource::Thread::Lock& threadLock)
+{
+    if (pendingFiles.empty() && hasWatchedChanges())
+    {
+        findChanges(threadLock);
+    }
+    if (parallelLoading)
+    {
+        loadPendingFilesInParallel(threadLock);
+    }
+    else
+    {
+        loadNextPendingFile(threadLock);
+    }
+}
+
+
+// Loads or updates a single desktop entry file in the list of pending files,
+// holding the thread's write lock while the file is parsed.
+void DesktopEntry::LoadingThread::loadNextPendingFile
+(SharedResource::Thread::Lock& threadLock)
 {
     using juce::String;
+    const double loadStart = juce::Time::getMillisecondCounterHiRes();
     const SharedResource::Thread::ScopedWriteLock writeLock(threadLock);
     if (!pendingFiles.empty())
     {
@@ -250,46 +464,111 @@ void DesktopEntry::LoadingThread::runLoop
         try
         {
             EntryFile entry(entryFile, entryID);
-            if (entry.shouldBeDisplayed())
+            entryIndex.updateEntry(entryID, entryFile, entry);
+            saveParsedEntry(entryID, entry);
+        }
+        catch(FileError e)
+        {
+            DBG(dbgPrefix << __func__ << ": File error: " << e.what());
+            entryIndex.removeEntry(entryID);
+        }
+        catch(FormatError e)
+        {
+            DBG(dbgPrefix << __func__ << ": Format error: " << e.what());
+            entryIndex.removeEntry(entryID);
+        }
+    }
+    phaseTimes.parse += juce::Time::getMillisecondCounterHiRes() - loadStart;
+}
+
+
+// Parses all pending desktop entry files on the ParsingPool without holding the
+// thread's lock, then saves all parsed entries while holding the write lock.
+void DesktopEntry::LoadingThread::loadPendingFilesInParallel
+(SharedResource::Thread::Lock& threadLock)
+{
+    std::map<juce::String, juce::File> filesToParse;
+    {
+        const SharedResource::Thread::ScopedWriteLock writeLock(threadLock);
+        filesToParse.swap(pendingFiles);
+    }
+    if (filesToParse.empty())
+    {
+        return;
+    }
+
+    const double parseStart = juce::Time::getMillisecondCounterHiRes();
+    std::vector<ParsingPool::Result> results
+            = parsingPool.parseFiles(filesToParse);
+    const double commitStart = juce::Time::getMillisecondCounterHiRes();
+    phaseTimes.parse += commitStart - parseStart;
+
+    {
+        const SharedResource::Thread::ScopedWriteLock writeLock(threadLock);
+        for (const ParsingPool::Result& result : results)
+        {
+            if (result.parsed)
             {
-                juce::StringArray entryCategories = entry.getCategories();
-                if (entryCategories.isEmpty())
-                {
-                    // Categorize as "Other"
-                    entryCategories.add(miscEntryCategory);
-                }
-                // Add to list of all entries
-                entryCategories.add(everyEntryCategory);
-                for (const String& category : entryCategories)
-                {
-                    categories[category].add(entryID);
-                }
-                entries[entryID] = entry;
+                entryIndex.updateEntry(result.entryID,
+                        filesToParse[result.entryID], result.entry);
+                saveParsedEntry(result.entryID, result.entry);
             }
-            // If an updated entry is hidden, mark it as removed in the change
-            // list. If a new entry was hidden, don't mention in in the change
-            // list at all.
             else
             {
-                if (entries.count(entryID) > 0)
-                {
-                    lastChangedIDs.removeString(entryID);
-                    lastRemovedIDs.add(entryID);
-                    entries.erase(entryID);
-                }
-                else
-                {
-                    lastAddedIDs.removeString(entryID);
-                }
+                entryIndex.removeEntry(result.entryID);
             }
         }
-        catch(FileError e)
+    }
+    phaseTimes.commit += juce::Time::getMillisecondCounterHiRes()
+            - commitStart;
+    DBG(dbgPrefix << __func__ << ": Parsed " << (int) results.size()
+            << " files using "
+            << parsingPool.getThreadCount((int) results.size())
+            << " thread(s).");
+}
+
+
+// Removes an entry from the loaded entries and the category index.
+void DesktopEntry::LoadingThread::removeLoadedEntry(const juce::String& entryID)
+{
+    entries.erase(entryID);
+    categoryIndex.removeEntry(entryID);
+}
+
+
+// Saves a newly parsed desktop entry, or removes an existing entry that should
+// no longer be displayed.
+void DesktopEntry::LoadingThread::saveParsedEntry
+(const juce::String& entryID, const EntryFile& entry)
+{
+    using juce::String;
+    if (entry.shouldBeDisplayed())
+    {
+        juce::StringArray entryCategories = entry.getCategories();
+        if (entryCategories.isEmpty())
         {
-            DBG(dbgPrefix << __func__ << ": File error: " << e.what());
+            // Categorize as "Other"
+            entryCategories.add(miscEntryCategory);
         }
-        catch(FormatError e)
+        // Add to list of all entries
+        entryCategories.add(everyEntryCategory);
+        categoryIndex.addEntry(entryID, entryCategories);
+        entries[entryID] = entry;
+    }
+    // If an updated entry is hidden, mark it as removed in the change
+    // list. If a new entry was hidden, don't mention in in the change
+    // list at all.
+    else
+    {
+        if (entries.count(entryID) > 0 || lastChangedIDs.contains(entryID))
         {
-            DBG(dbgPrefix << __func__ << ": Format error: " << e.what());
+            lastChangedIDs.removeString(entryID);
+            lastRemovedIDs.add(entryID);
+            removeLoadedEntry(entryID);
+        }
+        else
+        {
+            lastAddedIDs.removeString(entryID);
         }
     }
 }
@@ -300,12 +579,19 @@ void DesktopEntry::LoadingThread::runLoop
 void DesktopEntry::LoadingThread::cleanup
 (SharedResource::Thread::Lock& threadLock)
 {
+    // Only this thread changes the index, so it may be saved without holding
+    // the write lock:
+    entryIndex.saveIndex();
     const SharedResource::Thread::ScopedWriteLock writeLock(threadLock);
     finishedLoading = true;
     DBG(dbgPrefix << __func__ << ": "
             << lastAddedIDs.size() << " added, "
             << lastChangedIDs.size() << " updated, "
             << lastRemovedIDs.size() << " removed.");
+    DBG(dbgPrefix << __func__ << ": Scan: " << phaseTimes.scan
+            << "ms, parse: " << phaseTimes.parse << "ms, commit: "
+            << phaseTimes.commit << "ms ("
+            << (parallelLoading ? "parallel" : "serial") << " loading).");
     juce::MessageManager::callAsync(buildAsyncFunction(
                 SharedResource::LockType::read, [this]
     {
@@ -338,7 +624,7 @@ void DesktopEntry::LoadingThread::cleanup
 // Makes the thread sleep after loading or updating all desktop files.
 bool DesktopEntry::LoadingThread::threadShouldWait()
 {
-    return pendingFiles.empty();
+    return pendingFiles.empty() && !hasWatchedChanges();
 }
 
 
@@ -360,13 +646,13 @@ DesktopEntry::CallbackID DesktopEntry::LoadingThread::generateCallbackID()
 
 // Finds a desktop entry file using its desktop file ID.
 juce::File DesktopEntry::LoadingThread::findEntryFile
-(const juce::String entryFileID)
+(const juce::String entryFileID) const
 {
     juce::StringArray dirs = Assets::XDGDirectories::getDataSearchPaths();
     for (const juce::String& dir : dirs)
     {
-        juce::File entryFile(dir + entryDirectory + entryFileID
-                + fileExtension);
+        // Desktop file IDs already include the .desktop extension:
+        juce::File entryFile(dir + entryDirectory + entryFileID);
         if (entryFile.existsAsFile())
         {
             return entryFile;
@@ -10,6 +10,10 @@
 
 #include "SharedResource_Thread_Resource.h"
 #include "DesktopEntry_EntryFile.h"
+#include "DesktopEntry_EntryIndex.h"
+#include "DesktopEntry_CategoryIndex.h"
+#include "DesktopEntry_DirectoryWatcher.h"
+#include "DesktopEntry_ParsingPool.h"
 #include "DesktopEntry_CallbackID.h"
 #include <map>
 
@@ -31,6 +35,11 @@ namespace DesktopEntry { class LoadingThread; }
  * first loaded, the LoadingThread may be used to update the data, scanning all
  * desktop entry file directories for changes, and sharing these changes with
  * all DesktopEntry::UpdateListener objects.
+ *
+ *  While the LoadingThread exists, a DirectoryWatcher tracks changes to
+ * desktop entry directories. Each batch of watched changes wakes the thread,
+ * which only reloads the desktop file IDs that changed instead of scanning
+ * every directory again.
  */
 class DesktopEntry::LoadingThread : public SharedResource::Thread::Resource
 {
@@ -43,7 +52,11 @@ public:
      */
     LoadingThread();
 
-    virtual ~LoadingThread() { }
+    /**
+     * @brief  Stops watching desktop entry directories before the thread
+     *         resource is destroyed.
+     */
+    virtual ~LoadingThread();
 
     /**
      * @brief  Finds a desktop entry from its desktop file ID.
@@ -86,6 +99,33 @@ public:
     juce::Array<EntryFile> getCategoryEntries
         (const juce::StringArray categoryList) const;
 
+    /**
+     * @brief  Gets all displayable desktop entries saved in the desktop entry
+     *         index.
+     *
+     *  Indexed entries may be used to populate menus before the thread has
+     * finished checking entry files for changes. Indexed entries that are no
+     * longer valid will be reported to UpdateListeners as changed or removed
+     * once the thread finishes loading. Saved entry data is read from the
+     * mapped index file, but no desktop entry files are read.
+     *
+     * @return  All displayable entries saved in the index file, or an empty
+     *          list if the thread hasn't loaded the index file yet.
+     */
+    juce::Array<EntryFile> getIndexedEntries() const;
+
+    /**
+     * @brief  Adds a callback function to run once when the thread finishes
+     *         loading the desktop entry index.
+     *
+     * @param indexCallback  The callback function to run on the message
+     *                       thread once the index is loaded.
+     *
+     * @return               An ID that can be used to cancel the callback
+     *                       function, or zero if the callback was invalid.
+     */
+    CallbackID addIndexCallback(const std::function<void()> indexCallback);
+
     /**
      * @brief  Adds a callback function to run once when the thread finishes
      *         loading or updating desktop entries. This will only be added if
@@ -104,7 +144,7 @@ public:
      * @brief  Cancels a pending callback ID.
      *
      * @param toCancel  The ID of a callback to find and remove from the
-     *                  loading or update callback list.
+     *                  loading, update, or index callback lists.
      */
     void cancelCallback(const CallbackID toCancel);
 
@@ -123,6 +163,30 @@ public:
      */
     bool isFinishedLoading();
 
+    /**
+     * @brief  Checks if the thread has loaded the desktop entry index.
+     *
+     * @return  Whether getIndexedEntries may return indexed entries.
+     */
+    bool isIndexLoaded() const;
+
+    /**
+     * @brief  Checks if desktop entry directories are being watched for
+     *         changes.
+     *
+     * @return  Whether changes to desktop entry files are automatically
+     *          detected, making complete directory scans unnecessary.
+     */
+    bool isWatchingFiles() const;
+
+    /**
+     * @brief  Checks if the DirectoryWatcher reported changes that the thread
+     *         hasn't loaded yet.
+     *
+     * @return  Whether watched changes are waiting to be loaded.
+     */
+    bool hasWatchedChanges() const;
+
 private:
     /**
      * @brief  Scans for new and updated desktop entry files for the thread to
@@ -137,17 +201,118 @@ private:
     virtual void init(SharedResource::Thread::Lock& threadLock) override;
 
     /**
-     * @brief  Loads or updates a single desktop entry file in the list of
-     *         pending files.
+     * @brief  Loads or updates pending desktop entry files.
      *
      *  This function will be called repeatedly on the desktop entry thread
-     * until all entry files have been loaded or updated.
+     * until all entry files have been loaded or updated. When parallel loading
+     * is enabled, all pending files are loaded in a single call. Otherwise,
+     * only a single file is loaded each time this function runs.
      *
      * @param threadLock  An object used to access the desktop entry thread's
      *                    SharedResource lock.
      */
     virtual void runLoop(SharedResource::Thread::Lock& threadLock) override;
 
+    /**
+     * @brief  Finds new, changed, and removed desktop entry files, using
+     *         watched changes if possible, or scanning all desktop entry
+     *         directories if necessary.
+     *
+     * @param threadLock  An object used to access the desktop entry thread's
+     *                    SharedResource lock.
+     */
+    void findChanges(SharedResource::Thread::Lock& threadLock);
+
+    /**
+     * @brief  Loads the desktop entry index file, then runs all index
+     *         callback functions on the message thread.
+     *
+     *  This function runs within the thread's first init call, so the message
+     * thread never waits for the index file to load.
+     *
+     * @param threadLock  An object used to access the desktop entry thread's
+     *                    SharedResource lock.
+     */
+    void loadEntryIndex(SharedResource::Thread::Lock& threadLock);
+
+    /**
+     * @brief  Prepares to update all desktop entries reported as changed by
+     *         the DirectoryWatcher, and removes entries with deleted files.
+     *
+     * @param threadLock  An object used to access the desktop entry thread's
+     *                    SharedResource lock.
+     *
+     * @return            False if a complete directory scan is needed instead,
+     *                    either because the watcher requested it or because
+     *                    entries haven't been loaded yet.
+     */
+    bool findWatchedChanges(SharedResource::Thread::Lock& threadLock);
+
+    /**
+     * @brief  Saves a batch of changes reported by the DirectoryWatcher, and
+     *         wakes the thread to load them.
+     *
+     *  This function runs on the DirectoryWatcher's thread.
+     *
+     * @param changedIDs  The desktop file IDs of all changed entry files.
+     *
+     * @param rescanAll   Whether all desktop entry directories should be
+     *                    scanned for changes.
+     */
+    void queueWatchedChanges(const juce::StringArray& changedIDs,
+            const bool rescanAll);
+
+    /**
+     * @brief  Saves all entries with up to date data in the desktop entry index
+     *         without parsing their files, and removes deleted entries from
+     *         the index.
+     *
+     * @param threadLock  An object used to access the desktop entry thread's
+     *                    SharedResource lock.
+     */
+    void loadIndexedEntries(SharedResource::Thread::Lock& threadLock);
+
+    /**
+     * @brief  Loads or updates a single desktop entry file in the list of
+     *         pending files, holding the thread's write lock while the file is
+     *         parsed.
+     *
+     * @param threadLock  An object used to access the desktop entry thread's
+     *                    SharedResource lock.
+     */
+    void loadNextPendingFile(SharedResource::Thread::Lock& threadLock);
+
+    /**
+     * @brief  Parses all pending desktop entry files on the ParsingPool
+     *         without holding the thread's lock, then saves all parsed entries
+     *         while holding the write lock.
+     *
+     * @param threadLock  An object used to access the desktop entry thread's
+     *                    SharedResource lock.
+     */
+    void loadPendingFilesInParallel(SharedResource::Thread::Lock& threadLock);
+
+    /**
+     * @brief  Removes an entry from the loaded entries and the category index.
+     *
+     *  The thread's write lock must be held when this function is called.
+     *
+     * @param entryID  The desktop file ID of the entry to remove.
+     */
+    void removeLoadedEntry(const juce::String& entryID);
+
+    /**
+     * @brief  Saves a newly parsed desktop entry, or removes an existing entry
+     *         that should no longer be displayed.
+     *
+     *  The thread's write lock must be held when this function is called.
+     *
+     * @param entryID  The parsed entry's desktop file ID.
+     *
+     * @param entry    The parsed desktop entry.
+     */
+    void saveParsedEntry(const juce::String& entryID, const EntryFile& entry);
+
     /**
      * @brief  Runs all registered callback functions once all desktop entry
      *         files have been loaded or updated, and notifies UpdateListeners
@@ -165,8 +330,8 @@ private:
      * @brief  Makes the thread sleep after loading or updating all desktop
      *         files.
      *
-     * @return  True if there are still files to(re)load, false if all desktop
-     *          files were loaded or updated.
+     * @return  True if there are still files to(re)load or watched changes
+     *          to find, false if all desktop files were loaded or updated.
      */
     virtual bool threadShouldWait() override;
 
@@ -187,7 +352,7 @@ private:
      *                     data directories, or an empty file object if no
      *                     matching file is found.
      */
-    juce::File findEntryFile(const juce::String entryFileID);
+    juce::File findEntryFile(const juce::String entryFileID) const;
 
     // Maps desktop ID strings to desktop entry objects.
     std::map<juce::String, EntryFile> entries;
@@ -198,16 +363,47 @@ private:
     // All <Desktop file ID, .desktop file> pairs waiting to be loaded.
     std::map<juce::String, juce::File> pendingFiles;
 
-    // Maps category names to lists of desktop file IDs.
-    std::map<juce::String, juce::StringArray> categories;
+    // All <Desktop file ID, .desktop file> pairs with up to date indexed data
+    // waiting to be loaded from the index.
+    std::map<juce::String, juce::File> indexedFiles;
+
+    // Stores parsed entry data between application launches:
+    EntryIndex entryIndex;
+
+    // Maps category names to the numbers of all entries in each category.
+    CategoryIndex categoryIndex;
 
     // Tracks if desktop entries were completely loaded, and aren't currently
     // being updated.
     bool finishedLoading = false;
 
+    // Tracks if the entry index file was loaded:
+    bool indexLoaded = false;
+
+    // Sets if pending files should be parsed in parallel:
+    bool parallelLoading = true;
+
+    // Parses pending files in parallel, keeping its threads between updates:
+    ParsingPool parsingPool;
+
+    // Milliseconds spent in each loading phase during the last update:
+    struct PhaseTimes
+    {
+        // Finding new or updated files:
+        double scan = 0;
+        // Reading and parsing files:
+        double parse = 0;
+        // Saving parsed entry data:
+        double commit = 0;
+    };
+    PhaseTimes phaseTimes;
+
     // Callbacks to run when desktop entries finish loading.
     std::map<CallbackID, std::function<void()>> onFinish;
 
+    // Callbacks to run when the entry index finishes loading.
+    std::map<CallbackID, std::function<void()>> onIndexLoaded;
+
     // Stored data from the last desktop entry update:
 
     // The last time desktop entry files were scanned.
@@ -224,4 +420,18 @@ private:
     // Lists the IDs of all hidden or removed desktop entry files discovered
     // during the last update scan.
     juce::StringArray lastRemovedIDs;
+
+    // Watched changes waiting to be loaded, shared with the watcher thread:
+
+    // Protects watched change data:
+    juce::CriticalSection watchedChangeLock;
+
+    // Desktop file IDs of all changed files reported by the watcher:
+    juce::StringArray watchedChangeIDs;
+
+    // Whether the watcher requested a complete directory scan:
+    bool watchedRescan = false;
+
+    // Tracks changes within desktop entry directories:
+    DirectoryWatcher directoryWatcher;
 };
@@ -0,0 +1,59 @@
+#define DESKTOP_ENTRY_IMPLEMENTATION
+#include "DesktopEntry_ParsingPool.h"
+#include "DesktopEntry_FileError.h"
+#include "DesktopEntry_FormatError.h"
+
+#ifdef JUCE_DEBUG
+// Print the full class name before all debug output:
+static const constexpr char* dbgPrefix = "DesktopEntry::ParsingPool::";
+#endif
+
+// Sets the maximum number of threads the pool may use.
+DesktopEntry::ParsingPool::ParsingPool(const int maxThreads) :
+workerPool(maxThreads) { }
+
+
+// Parses a set of desktop entry files, waiting until all files have been
+// parsed.
+std::vector<DesktopEntry::ParsingPool::Result>
+DesktopEntry::ParsingPool::parseFiles
+(const std::map<juce::String, juce::File>& entryFiles)
+{
+    std::vector<const std::pair<const juce::String, juce::File>*> fileList;
+    fileList.reserve(entryFiles.size());
+    for (const auto& fileIter : entryFiles)
+    {
+        fileList.push_back(&fileIter);
+    }
+    std::vector<Result> results(fileList.size());
+
+    // Every result index is only written by a single thread:
+    workerPool.runTasks((int) fileList.size(),
+            [&fileList, &results](const int index)
+    {
+        Result& result = results[(size_t) index];
+        result.entryID = fileList[(size_t) index]->first;
+        try
+        {
+            result.entry = EntryFile(fileList[(size_t) index]->second,
+                    result.entryID);
+            result.parsed = true;
+        }
+        catch(FileError e)
+        {
+            DBG(dbgPrefix << "parseFiles: File error: " << e.what());
+        }
+        catch(FormatError e)
+        {
+            DBG(dbgPrefix << "parseFiles: Format error: " << e.what());
+        }
+    });
+    return results;
+}
+
+
+// Gets the number of threads that will be used to parse a set of files.
+int DesktopEntry::ParsingPool::getThreadCount(const int fileCount) const
+{
+    return workerPool.getThreadCount(fileCount);
+}
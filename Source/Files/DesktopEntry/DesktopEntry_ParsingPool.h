@@ -0,0 +1,89 @@
+#ifndef DESKTOP_ENTRY_IMPLEMENTATION
+    #error File included directly outside of DesktopEntry implementation.
+#endif
+#pragma once
+/**
+ * @file  DesktopEntry_ParsingPool.h
+ *
+ * @brief  Parses sets of desktop entry files using a bounded group of worker
+ *         threads.
+ */
+
+#include "DesktopEntry_EntryFile.h"
+#include "Util_WorkerPool.h"
+#include <map>
+#include <vector>
+
+namespace DesktopEntry { class ParsingPool; }
+
+/**
+ * @brief  Reads desktop entry files into EntryFile objects in parallel.
+ *
+ *  ParsingPool splits a set of desktop entry files between the threads of a
+ * Util::WorkerPool, which read and parse files until none are left. The calling
+ * thread also parses files while the workers run, and only returns once every
+ * file has been parsed. Worker threads are kept until the ParsingPool is
+ * destroyed, so they may be reused for each set of files.
+ *
+ *  ParsingPool does not access any shared desktop entry data, so the
+ * LoadingThread may parse entry files without holding its resource lock, and
+ * then save all parsed entries at once.
+ */
+class DesktopEntry::ParsingPool
+{
+public:
+    /**
+     * @brief  Holds the results of parsing a single desktop entry file.
+     */
+    struct Result
+    {
+        // The desktop file ID of the parsed file:
+        juce::String entryID;
+        // The entry object created from the file:
+        EntryFile entry;
+        // Whether the file was successfully parsed:
+        bool parsed = false;
+    };
+
+    /**
+     * @brief  Sets the maximum number of threads the pool may use.
+     *
+     * @param maxThreads  The maximum number of threads, including the calling
+     *                    thread, that may parse files at once. If this value
+     *                    is less than one, the number of CPU cores will be
+     *                    used.
+     */
+    ParsingPool(const int maxThreads = 0);
+
+    virtual ~ParsingPool() { }
+
+    /**
+     * @brief  Parses a set of desktop entry files, waiting until all files
+     *         have been parsed.
+     *
+     * @param entryFiles  A map of desktop file IDs to the .desktop files that
+     *                    should be parsed.
+     *
+     * @return            Parsing results for each file, in the same order as
+     *                    the entryFiles map.
+     */
+    std::vector<Result> parseFiles
+    (const std::map<juce::String, juce::File>& entryFiles);
+
+    /**
+     * @brief  Gets the number of threads that will be used to parse a set of
+     *         files.
+     *
+     * @param fileCount  The number of files to parse.
+     *
+     * @return           The number of threads that would parse those files,
+     *                   including the calling thread.
+     */
+    int getThreadCount(const int fileCount) const;
+
+private:
+    // The threads used to parse files:
+    Util::WorkerPool workerPool;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParsingPool)
+};
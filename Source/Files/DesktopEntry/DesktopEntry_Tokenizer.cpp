@@ -0,0 +1,299 @@
+#define DESKTOP_ENTRY_IMPLEMENTATION
+#include "DesktopEntry_Tokenizer.h"
+#include <cstring>
+
+// All data keys defined in the desktop entry specifications:
+static constexpr const char* standardKeys[] =
+{
+    "Type",
+    "Version",
+    "Name",
+    "GenericName",
+    "NoDisplay",
+    "Comment",
+    "Icon",
+    "Hidden",
+    "OnlyShowIn",
+    "NotShowIn",
+    "DBusActivatable",
+    "TryExec",
+    "Exec",
+    "Path",
+    "Terminal",
+    "Actions",
+    "MimeType",
+    "Categories",
+    "Implements",
+    "Keywords",
+    "StartupNotify",
+    "StartupWMClass",
+    "URL"
+};
+
+// Number of standard data keys:
+static constexpr int keyCount = sizeof(standardKeys) / sizeof(standardKeys[0]);
+
+// Number of slots in the key hash table:
+static constexpr size_t hashTableSize = 64;
+
+/**
+ * @brief  Finds the length of a null-terminated string at compile time.
+ *
+ * @param text  A null-terminated string.
+ *
+ * @return      The number of characters before the terminating null.
+ */
+static constexpr size_t constLength(const char* text)
+{
+    size_t length = 0;
+    while (text[length] != '\0')
+    {
+        length++;
+    }
+    return length;
+}
+
+/**
+ * @brief  Hashes a desktop entry key using its length, first character, and
+ *         last character.
+ *
+ *  These multipliers were chosen because they map every standard key to a
+ * unique table slot.
+ *
+ * @param key     The start of a non-empty key.
+ *
+ * @param length  The number of characters in the key.
+ *
+ * @return        The key's slot in the key hash table.
+ */
+static constexpr size_t keyHash(const char* key, const size_t length)
+{
+    return (length + (size_t) (unsigned char) key[0] * 5
+            + (size_t) (unsigned char) key[length - 1] * 25) % hashTableSize;
+}
+
+/**
+ * @brief  Maps hash table slots to standard key indices.
+ */
+struct KeyTable
+{
+    // Key indices for each slot, or -1 for unused slots:
+    int slots[hashTableSize];
+    // Whether no two standard keys share a slot:
+    bool isPerfect;
+};
+
+/**
+ * @brief  Builds the standard key hash table at compile time.
+ *
+ * @return  The completed key table.
+ */
+static constexpr KeyTable buildKeyTable()
+{
+    KeyTable table {};
+    table.isPerfect = true;
+    for (size_t i = 0; i < hashTableSize; i++)
+    {
+        table.slots[i] = -1;
+    }
+    for (int i = 0; i < keyCount; i++)
+    {
+        const size_t slot = keyHash(standardKeys[i],
+                constLength(standardKeys[i]));
+        if (table.slots[slot] != -1)
+        {
+            table.isPerfect = false;
+        }
+        table.slots[slot] = i;
+    }
+    return table;
+}
+
+// Maps key hashes to standard key indices:
+static constexpr KeyTable keyTable = buildKeyTable();
+
+static_assert(keyTable.isPerfect,
+        "Standard desktop entry keys must have unique hash values.");
+
+/**
+ * @brief  Checks if a character is a space or tab.
+ *
+ * @param testChar  Any character.
+ *
+ * @return          Whether the character is a space or tab.
+ */
+static inline bool isBlank(const char testChar)
+{
+    return testChar == ' ' || testChar == '\t';
+}
+
+
+// Checks if the range contains no text.
+bool DesktopEntry::Tokenizer::TextRange::isEmpty() const
+{
+    return length == 0;
+}
+
+
+// Checks if the range holds the same text as a string.
+bool DesktopEntry::Tokenizer::TextRange::equals
+(const char* text, const size_t length) const
+{
+    return this->length == length
+            && (length == 0 || std::memcmp(start, text, length) == 0);
+}
+
+
+// Checks if the range begins with a string.
+bool DesktopEntry::Tokenizer::TextRange::startsWith(const char* prefix) const
+{
+    const size_t prefixLength = std::strlen(prefix);
+    return length >= prefixLength
+            && std::memcmp(start, prefix, prefixLength) == 0;
+}
+
+
+// Copies the range into a new string.
+juce::String DesktopEntry::Tokenizer::TextRange::toString() const
+{
+    if (length == 0)
+    {
+        return juce::String();
+    }
+    return juce::String::fromUTF8(start, (int) length);
+}
+
+
+// Prepares to tokenize a buffer of desktop entry file data.
+DesktopEntry::Tokenizer::Tokenizer(const char* data, const size_t size) :
+readPos(data), bufferEnd(data + size) { }
+
+
+// Reads the next line from the buffer, skipping empty lines and comments.
+bool DesktopEntry::Tokenizer::nextLine(Line& line)
+{
+    while (readPos < bufferEnd)
+    {
+        const char* lineStart = readPos;
+        const char* lineEnd = static_cast<const char*>(
+                std::memchr(lineStart, '\n', bufferEnd - lineStart));
+        if (lineEnd == nullptr)
+        {
+            lineEnd = bufferEnd;
+            readPos = bufferEnd;
+        }
+        else
+        {
+            readPos = lineEnd + 1;
+        }
+        if (lineEnd > lineStart && lineEnd[-1] == '\r')
+        {
+            lineEnd--;
+        }
+
+        // Skip empty lines and comments:
+        const char* textStart = lineStart;
+        while (textStart < lineEnd && isBlank(*textStart))
+        {
+            textStart++;
+        }
+        if (textStart == lineEnd || *textStart == '#')
+        {
+            continue;
+        }
+
+        line = Line();
+        line.text.start = lineStart;
+        line.text.length = lineEnd - lineStart;
+        if (*lineStart == '[' && lineEnd[-1] == ']')
+        {
+            line.type = LineType::header;
+            line.header.start = lineStart + 1;
+            line.header.length = line.text.length - 2;
+            return true;
+        }
+
+        const char* separator = static_cast<const char*>(
+                std::memchr(lineStart, '=', lineEnd - lineStart));
+        if (separator == nullptr)
+        {
+            line.type = LineType::invalid;
+            return true;
+        }
+        line.type = LineType::keyValue;
+
+        // Find the key and optional locale before the separator:
+        const char* keyEnd = separator;
+        const char* localeStart = static_cast<const char*>(
+                std::memchr(lineStart, '[', separator - lineStart));
+        if (localeStart != nullptr)
+        {
+            const char* localeEnd = static_cast<const char*>(std::memchr(
+                    localeStart, ']', separator - localeStart));
+            if (localeEnd != nullptr)
+            {
+                line.locale.start = localeStart + 1;
+                line.locale.length = localeEnd - localeStart - 1;
+            }
+            keyEnd = localeStart;
+        }
+        const char* keyStart = lineStart;
+        while (keyStart < keyEnd && isBlank(*keyStart))
+        {
+            keyStart++;
+        }
+        while (keyEnd > keyStart && isBlank(keyEnd[-1]))
+        {
+            keyEnd--;
+        }
+        line.key.start = keyStart;
+        line.key.length = keyEnd - keyStart;
+        line.keyIndex = findKeyIndex(line.key);
+
+        // Spaces before the value are ignored:
+        const char* valueStart = separator + 1;
+        while (valueStart < lineEnd && isBlank(*valueStart))
+        {
+            valueStart++;
+        }
+        line.value.start = valueStart;
+        line.value.length = lineEnd - valueStart;
+        return true;
+    }
+    return false;
+}
+
+
+// Finds a key in the list of standard desktop entry keys.
+int DesktopEntry::Tokenizer::findKeyIndex(const TextRange& key)
+{
+    if (key.isEmpty())
+    {
+        return -1;
+    }
+    const int keyIndex = keyTable.slots[keyHash(key.start, key.length)];
+    if (keyIndex >= 0 && key.equals(standardKeys[keyIndex],
+                std::strlen(standardKeys[keyIndex])))
+    {
+        return keyIndex;
+    }
+    return -1;
+}
+
+
+// Gets a standard desktop entry key from its index.
+const char* DesktopEntry::Tokenizer::getKeyName(const int keyIndex)
+{
+    if (keyIndex < 0 || keyIndex >= keyCount)
+    {
+        return nullptr;
+    }
+    return standardKeys[keyIndex];
+}
+
+
+// Gets the number of keys in the standard desktop entry key list.
+int DesktopEntry::Tokenizer::getKeyCount()
+{
+    return keyCount;
+}
@@ -0,0 +1,173 @@
+#ifndef DESKTOP_ENTRY_IMPLEMENTATION
+    #error File included directly outside of DesktopEntry implementation.
+#endif
+#pragma once
+/**
+ * @file  DesktopEntry_Tokenizer.h
+ *
+ * @brief  Splits desktop entry file data into group headers and key/value
+ *         lines in a single pass.
+ */
+
+#include "JuceHeader.h"
+
+namespace DesktopEntry { class Tokenizer; }
+
+/**
+ * @brief  Reads desktop entry lines directly from a buffer of file data,
+ *         without copying the data into intermediate strings.
+ *
+ *  Each call to nextLine classifies the next meaningful line in the buffer as
+ * either a group header or a key/value line, and finds the header, key, locale
+ * and value sections of the line as ranges within the original buffer. Empty
+ * lines and comments are skipped.
+ *
+ *  The Tokenizer also recognizes every key defined in the desktop entry
+ * standard using a perfect hash table built at compile time, so that known
+ * keys may be identified without creating strings or Identifiers.
+ *
+ *  The buffer passed to the Tokenizer must remain valid and unchanged for as
+ * long as the Tokenizer or any TextRange it returns is used.
+ */
+class DesktopEntry::Tokenizer
+{
+public:
+    /**
+     * @brief  A section of text within the tokenized buffer.
+     */
+    struct TextRange
+    {
+        // The first character in the range:
+        const char* start = nullptr;
+        // The number of bytes in the range:
+        size_t length = 0;
+
+        /**
+         * @brief  Checks if the range contains no text.
+         *
+         * @return  Whether the range length is zero.
+         */
+        bool isEmpty() const;
+
+        /**
+         * @brief  Checks if the range holds the same text as a string.
+         *
+         * @param text    A string to compare with the range.
+         *
+         * @param length  The number of bytes in the text.
+         *
+         * @return        Whether the range and the text are identical.
+         */
+        bool equals(const char* text, const size_t length) const;
+
+        /**
+         * @brief  Checks if the range begins with a string.
+         *
+         * @param prefix  A null-terminated string to find at the start of the
+         *                range.
+         *
+         * @return        Whether the range begins with the prefix.
+         */
+        bool startsWith(const char* prefix) const;
+
+        /**
+         * @brief  Copies the range into a new string.
+         *
+         * @return  The range text, read as UTF-8.
+         */
+        juce::String toString() const;
+    };
+
+    /**
+     * @brief  Types of lines returned by the tokenizer.
+     */
+    enum class LineType
+    {
+        // A group header line, e.g. "[Desktop Entry]":
+        header,
+        // A line containing a key/value pair:
+        keyValue,
+        // A line that is neither a valid header nor a key/value pair:
+        invalid
+    };
+
+    /**
+     * @brief  Holds the sections of a single tokenized line.
+     */
+    struct Line
+    {
+        // The line's type:
+        LineType type = LineType::invalid;
+        // The full line, excluding line breaks:
+        TextRange text;
+        // The group header title within the brackets of header lines:
+        TextRange header;
+        // The key of key/value lines, excluding any locale:
+        TextRange key;
+        // The optional locale of key/value lines, within the brackets after
+        // the key:
+        TextRange locale;
+        // The value of key/value lines:
+        TextRange value;
+        // The index of the key in the list of standard keys, or -1 if the key
+        // is not a standard desktop entry key:
+        int keyIndex = -1;
+    };
+
+    /**
+     * @brief  Prepares to tokenize a buffer of desktop entry file data.
+     *
+     * @param data  The start of the desktop entry data.
+     *
+     * @param size  The number of bytes of data in the buffer.
+     */
+    Tokenizer(const char* data, const size_t size);
+
+    virtual ~Tokenizer() { }
+
+    /**
+     * @brief  Reads the next line from the buffer, skipping empty lines and
+     *         comments.
+     *
+     * @param line  The object where tokenized line data will be stored.
+     *
+     * @return      Whether a line was read, or false if the end of the buffer
+     *              was reached.
+     */
+    bool nextLine(Line& line);
+
+    /**
+     * @brief  Finds a key in the list of standard desktop entry keys.
+     *
+     * @param key  A key read from a desktop entry file.
+     *
+     * @return     The key's index in the standard key list, or -1 if the key
+     *             is not a standard key.
+     */
+    static int findKeyIndex(const TextRange& key);
+
+    /**
+     * @brief  Gets a standard desktop entry key from its index.
+     *
+     * @param keyIndex  An index in the standard key list.
+     *
+     * @return          The key name, or nullptr if the index is out of bounds.
+     */
+    static const char* getKeyName(const int keyIndex);
+
+    /**
+     * @brief  Gets the number of keys in the standard desktop entry key list.
+     *
+     * @return  The number of standard keys.
+     */
+    static int getKeyCount();
+
+private:
+    // The next byte to read:
+    const char* readPos;
+
+    // The end of the data buffer:
+    const char* const bufferEnd;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Tokenizer)
+};
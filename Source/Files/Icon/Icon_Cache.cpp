@@ -1,4 +1,5 @@
 #include "Icon_Cache.h"
+#include "Assets_XDGDirectories.h"
 #include <fcntl.h>
 #include <unistd.h>
 
@@ -10,6 +11,10 @@ static const constexpr char* dbgPrefix = "Icon::Cache::";
 // Filename shared by all icon cache files:
 static const constexpr char* cacheFileName = "/icon-theme.cache";
 
+// Directory within the user cache directory where generated cache files are
+// stored:
+static const constexpr char* generatedCacheDir = "/pocket-home/icon-caches/";
+
 // Icon file extension flags:
 
 // According to the documentation, these are the correct flag values:
@@ -29,31 +34,18 @@ Icon::Cache::Cache(const juce::String& themePath)
     using juce::String;
     using juce::File;
     using juce::uint32;
-    String cachePath = themePath + cacheFileName;
-    File cacheFile(cachePath);
-    if (!cacheFile.existsAsFile())
+    const File themeDir(themePath);
+    File cacheFile = getThemeCacheFile(themePath);
+    if (!isUsableCacheFile(cacheFile, themeDir))
     {
-        DBG(dbgPrefix << __func__ << ": Failed to find cache file "
-                << cachePath);
-        return;
+        cacheFile = getGeneratedCacheFile(themePath);
+        if (!isUsableCacheFile(cacheFile, themeDir))
+        {
+            return;
+        }
     }
-
+    const String cachePath = cacheFile.getFullPathName();
     fileLen = cacheFile.getSize();
-    if (fileLen <= 0)
-    {
-        DBG(dbgPrefix << __func__ << ": Cache file is empty, path = "
-                << cachePath);
-        return;
-    }
-
-    if (cacheFile.getLastModificationTime().toMilliseconds() <
-        cacheFile.getParentDirectory().getLastModificationTime()
-        .toMilliseconds())
-    {
-        DBG(dbgPrefix << __func__ << ": Cache file is out of date, path = "
-                << cachePath);
-        return;
-    }
 
     fd = open(cachePath.toRawUTF8(), O_RDONLY, 0);
     if (fd <= 0)
@@ -180,12 +172,29 @@ std::map<juce::String, juce::String> Icon::Cache::lookupIcon
 }
 
 
-// Calculate the hash value of an icon name.
-juce::uint32 Icon::Cache::hashValue(const char* icon) const
+// Gets the cache file stored within an icon theme directory.
+juce::File Icon::Cache::getThemeCacheFile(const juce::String& themePath)
 {
-    if (icon == nullptr)
+    return juce::File(themePath + cacheFileName);
+}
+
+
+// Gets the file where pocket-home stores a generated cache for an icon theme
+// directory it can't write to.
+juce::File Icon::Cache::getGeneratedCacheFile(const juce::String& themePath)
+{
+    const juce::String fileName = themePath.trimCharactersAtStart("/")
+            .replaceCharacter('/', '_') + ".cache";
+    return juce::File(Assets::XDGDirectories::getUserCachePath()
+            + generatedCacheDir + fileName);
+}
+
+
+// Calculates the hash of an icon name used by GTK icon caches.
+juce::uint32 Icon::Cache::hashIconName(const char* icon)
+{
+    if (icon == nullptr || *icon == '\0')
     {
-        jassertfalse;
         return 0;
     }
     juce::uint32 val = (int) * icon;
@@ -193,7 +202,46 @@ juce::uint32 Icon::Cache::hashValue(const char* icon) const
     {
         val = (val << 5) - val + *ch;
     }
-    return val % hashBuckets;
+    return val;
+}
+
+
+// Checks if a cache file exists and is up to date.
+bool Icon::Cache::isUsableCacheFile
+(const juce::File& cacheFile, const juce::File& themeDir)
+{
+    if (!cacheFile.existsAsFile())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to find cache file "
+                << cacheFile.getFullPathName());
+        return false;
+    }
+    if (cacheFile.getSize() <= 0)
+    {
+        DBG(dbgPrefix << __func__ << ": Cache file is empty, path = "
+                << cacheFile.getFullPathName());
+        return false;
+    }
+    if (cacheFile.getLastModificationTime().toMilliseconds()
+            < themeDir.getLastModificationTime().toMilliseconds())
+    {
+        DBG(dbgPrefix << __func__ << ": Cache file is out of date, path = "
+                << cacheFile.getFullPathName());
+        return false;
+    }
+    return true;
+}
+
+
+// Calculate the hash value of an icon name.
+juce::uint32 Icon::Cache::hashValue(const char* icon) const
+{
+    if (icon == nullptr)
+    {
+        jassertfalse;
+        return 0;
+    }
+    return hashIconName(icon) % hashBuckets;
 }
 
 
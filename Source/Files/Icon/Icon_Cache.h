@@ -24,6 +24,10 @@ public:
     /**
      * @brief  Maps an icon theme cache file to memory.
      *
+     *  If the theme directory has no up to date cache file, a cache file
+     * generated by pocket-home for that theme will be used instead, if one
+     * exists and is up to date.
+     *
      * @param themePath  The absolute path of an icon theme directory.
      */
     Cache(const juce::String& themePath);
@@ -60,6 +64,49 @@ public:
     std::map<juce::String, juce::String> lookupIcon
     (const juce::String& iconName) const;
 
+    /**
+     * @brief  Gets the cache file stored within an icon theme directory.
+     *
+     * @param themePath  The absolute path of an icon theme directory.
+     *
+     * @return           The theme's icon-theme.cache file.
+     */
+    static juce::File getThemeCacheFile(const juce::String& themePath);
+
+    /**
+     * @brief  Gets the file where pocket-home stores a generated cache for an
+     *         icon theme directory it can't write to.
+     *
+     * @param themePath  The absolute path of an icon theme directory.
+     *
+     * @return           The generated cache file, in the user's cache
+     *                   directory.
+     */
+    static juce::File getGeneratedCacheFile(const juce::String& themePath);
+
+    /**
+     * @brief  Calculates the hash of an icon name used by GTK icon caches.
+     *
+     * @param icon  The name of an icon file, without the file extension.
+     *
+     * @return      The full hash value, before it is reduced to a hash bucket
+     *              index.
+     */
+    static juce::uint32 hashIconName(const char* icon);
+
+    /**
+     * @brief  Checks if a cache file exists and is up to date.
+     *
+     * @param cacheFile  A potential cache file for the theme.
+     *
+     * @param themeDir   The theme directory.
+     *
+     * @return           Whether the cache file exists, contains data, and is
+     *                   not older than the theme directory.
+     */
+    static bool isUsableCacheFile(const juce::File& cacheFile,
+            const juce::File& themeDir);
+
 private:
     /**
      * @brief  Calculates the hash value of an icon name.
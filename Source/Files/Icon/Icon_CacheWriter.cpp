@@ -0,0 +1,261 @@
+#include "Icon_CacheWriter.h"
+#include "Icon_Cache.h"
+#include "Icon_DirectoryIndex.h"
+#include "JuceHeader.h"
+#include <map>
+#include <vector>
+
+#ifdef JUCE_DEBUG
+// Print the full namespace name before all debug output:
+static const constexpr char* dbgPrefix = "Icon::CacheWriter::";
+#endif
+
+// Cache file format version numbers:
+static const constexpr juce::uint16 majorVersion = 1;
+static const constexpr juce::uint16 minorVersion = 0;
+
+// Size in bytes of the cache file header:
+static const constexpr juce::uint32 headerSize = 12;
+
+// Size in bytes of each icon entry in a hash chain:
+static const constexpr juce::uint32 iconEntrySize = 12;
+
+// Size in bytes of each image entry in an icon's image list:
+static const constexpr juce::uint32 imageEntrySize = 8;
+
+// Icon file extension flags used in cache files. These match the values used
+// by Icon::Cache, not the values given in the cache format documentation:
+static const constexpr juce::uint16 xpmCacheFlag = 1;
+static const constexpr juce::uint16 svgCacheFlag = 2;
+static const constexpr juce::uint16 pngCacheFlag = 4;
+
+/**
+ * @brief  Holds the data needed to write a single icon to a cache file.
+ */
+struct CachedIcon
+{
+    // The icon's name:
+    juce::String name;
+    // The hash bucket where the icon is stored:
+    juce::uint32 bucket;
+    // Each cache directory index containing the icon, paired with the icon's
+    // extension flags in that directory:
+    std::vector<std::pair<juce::uint16, juce::uint16>> images;
+};
+
+/**
+ * @brief  Converts DirectoryIndex extension flags to cache file extension
+ *         flags.
+ *
+ * @param indexFlags  A combination of DirectoryIndex::ExtensionFlag values.
+ *
+ * @return            The equivalent cache file extension flags.
+ */
+static juce::uint16 getCacheFlags(const juce::uint8 indexFlags)
+{
+    using Icon::DirectoryIndex;
+    juce::uint16 cacheFlags = 0;
+    if ((indexFlags & DirectoryIndex::pngFlag) != 0)
+    {
+        cacheFlags |= pngCacheFlag;
+    }
+    if ((indexFlags & DirectoryIndex::svgFlag) != 0)
+    {
+        cacheFlags |= svgCacheFlag;
+    }
+    if ((indexFlags & DirectoryIndex::xpmFlag) != 0)
+    {
+        cacheFlags |= xpmCacheFlag;
+    }
+    return cacheFlags;
+}
+
+
+// Writes a GTK icon cache file listing every icon in a theme's directory
+// index.
+bool Icon::CacheWriter::writeCacheFile(const DirectoryIndex& themeIndex)
+{
+    using juce::uint16;
+    using juce::uint32;
+    if (!themeIndex.isBuilt() || themeIndex.getRootPath().isEmpty())
+    {
+        return false;
+    }
+
+    // Assign cache directory indices to all directories containing icons. As
+    // in GTK caches, icons in the theme's base directory are not included.
+    std::map<int, uint16> cacheDirIndices;
+    juce::StringArray cacheDirs;
+    std::vector<CachedIcon> icons;
+    bool tooManyDirs = false;
+    themeIndex.foreachIcon([&themeIndex, &cacheDirIndices, &cacheDirs, &icons,
+            &tooManyDirs]
+            (const juce::String& iconName,
+             const std::vector<DirectoryIndex::IconFile>& iconFiles)
+    {
+        CachedIcon icon;
+        icon.name = iconName;
+        for (const DirectoryIndex::IconFile& iconFile : iconFiles)
+        {
+            const juce::String& dirPath
+                    = themeIndex.getDirectoryPath(iconFile.directory);
+            const uint16 flags = getCacheFlags(iconFile.extensions);
+            if (dirPath.isEmpty() || flags == 0)
+            {
+                continue;
+            }
+            auto dirIter = cacheDirIndices.find(iconFile.directory);
+            if (dirIter == cacheDirIndices.end())
+            {
+                if (cacheDirs.size() > 0xffff)
+                {
+                    tooManyDirs = true;
+                    return;
+                }
+                dirIter = cacheDirIndices.insert(std::make_pair(
+                        iconFile.directory, (uint16) cacheDirs.size())).first;
+                cacheDirs.add(dirPath);
+            }
+            icon.images.push_back(std::make_pair(dirIter->second, flags));
+        }
+        if (!icon.images.empty())
+        {
+            icons.push_back(icon);
+        }
+    });
+    if (tooManyDirs || icons.empty())
+    {
+        DBG(dbgPrefix << __func__ << ": Not writing a cache for "
+                << themeIndex.getRootPath() << ", "
+                << (tooManyDirs ? "too many directories." : "no icons found."));
+        return false;
+    }
+
+    // Sort icons into hash chains:
+    const uint32 bucketCount = ((uint32) icons.size() / 2) | 1;
+    std::vector<std::vector<size_t>> buckets(bucketCount);
+    for (size_t i = 0; i < icons.size(); i++)
+    {
+        icons[i].bucket = Cache::hashIconName(icons[i].name.toRawUTF8())
+                % bucketCount;
+        buckets[icons[i].bucket].push_back(i);
+    }
+
+    // Find the offset of each section of the cache file:
+    const uint32 hashOffset = headerSize;
+    const uint32 iconOffset = hashOffset + 4 + 4 * bucketCount;
+    std::vector<uint32> iconOffsets(icons.size());
+    std::vector<uint32> imageListOffsets(icons.size());
+    uint32 sectionEnd = iconOffset + iconEntrySize * (uint32) icons.size();
+    for (size_t i = 0; i < icons.size(); i++)
+    {
+        iconOffsets[i] = iconOffset + iconEntrySize * (uint32) i;
+        imageListOffsets[i] = sectionEnd;
+        sectionEnd += 4 + imageEntrySize * (uint32) icons[i].images.size();
+    }
+    const uint32 dirListOffset = sectionEnd;
+    uint32 stringOffset = dirListOffset + 4 + 4 * (uint32) cacheDirs.size();
+    std::vector<uint32> nameOffsets(icons.size());
+    for (size_t i = 0; i < icons.size(); i++)
+    {
+        nameOffsets[i] = stringOffset;
+        stringOffset += (uint32) icons[i].name.getNumBytesAsUTF8() + 1;
+    }
+    std::vector<uint32> dirOffsets((size_t) cacheDirs.size());
+    for (int i = 0; i < cacheDirs.size(); i++)
+    {
+        dirOffsets[(size_t) i] = stringOffset;
+        stringOffset += (uint32) cacheDirs[i].getNumBytesAsUTF8() + 1;
+    }
+
+    // Write all cache data:
+    juce::MemoryOutputStream cacheData((size_t) stringOffset);
+    cacheData.writeShortBigEndian((short) majorVersion);
+    cacheData.writeShortBigEndian((short) minorVersion);
+    cacheData.writeIntBigEndian((int) hashOffset);
+    cacheData.writeIntBigEndian((int) dirListOffset);
+    cacheData.writeIntBigEndian((int) bucketCount);
+    for (const std::vector<size_t>& bucket : buckets)
+    {
+        cacheData.writeIntBigEndian(bucket.empty() ? 0
+                : (int) iconOffsets[bucket.front()]);
+    }
+    std::vector<uint32> chainOffsets(icons.size(), 0);
+    for (const std::vector<size_t>& bucket : buckets)
+    {
+        for (size_t i = 1; i < bucket.size(); i++)
+        {
+            chainOffsets[bucket[i - 1]] = iconOffsets[bucket[i]];
+        }
+    }
+    for (size_t i = 0; i < icons.size(); i++)
+    {
+        cacheData.writeIntBigEndian((int) chainOffsets[i]);
+        cacheData.writeIntBigEndian((int) nameOffsets[i]);
+        cacheData.writeIntBigEndian((int) imageListOffsets[i]);
+    }
+    for (const CachedIcon& icon : icons)
+    {
+        cacheData.writeIntBigEndian((int) icon.images.size());
+        for (const auto& image : icon.images)
+        {
+            cacheData.writeShortBigEndian((short) image.first);
+            cacheData.writeShortBigEndian((short) image.second);
+            // Image data is not cached:
+            cacheData.writeIntBigEndian(0);
+        }
+    }
+    cacheData.writeIntBigEndian(cacheDirs.size());
+    for (const uint32 dirOffset : dirOffsets)
+    {
+        cacheData.writeIntBigEndian((int) dirOffset);
+    }
+    for (const CachedIcon& icon : icons)
+    {
+        cacheData.write(icon.name.toRawUTF8(),
+                icon.name.getNumBytesAsUTF8() + 1);
+    }
+    for (const juce::String& dirPath : cacheDirs)
+    {
+        cacheData.write(dirPath.toRawUTF8(), dirPath.getNumBytesAsUTF8() + 1);
+    }
+    jassert(cacheData.getDataSize() == stringOffset);
+
+    // Write to a temporary file, then replace the cache file:
+    const juce::File cacheFile
+            = getCacheFileLocation(themeIndex.getRootPath());
+    if (!cacheFile.getParentDirectory().createDirectory())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to create cache directory for "
+                << cacheFile.getFullPathName());
+        return false;
+    }
+    juce::TemporaryFile tempFile(cacheFile);
+    if (!tempFile.getFile().replaceWithData(cacheData.getData(),
+                cacheData.getDataSize())
+            || !tempFile.overwriteTargetFileWithTemporary())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to write cache file "
+                << cacheFile.getFullPathName());
+        return false;
+    }
+    // Replacing the cache file updates the theme directory's modification
+    // time, so the cache file time is updated afterwards to keep it from
+    // seeming out of date:
+    cacheFile.setLastModificationTime(juce::Time::getCurrentTime());
+    DBG(dbgPrefix << __func__ << ": Wrote " << (int) icons.size()
+            << " icons to " << cacheFile.getFullPathName());
+    return true;
+}
+
+
+// Finds where the cache file for an icon theme directory should be written.
+juce::File Icon::CacheWriter::getCacheFileLocation
+(const juce::String& themePath)
+{
+    if (juce::File(themePath).hasWriteAccess())
+    {
+        return Cache::getThemeCacheFile(themePath);
+    }
+    return Cache::getGeneratedCacheFile(themePath);
+}
@@ -0,0 +1,48 @@
+#pragma once
+/**
+ * @file  Icon_CacheWriter.h
+ *
+ * @brief  Creates GTK icon cache files for icon theme directories.
+ */
+
+namespace juce { class File; class String; }
+namespace Icon { class DirectoryIndex; }
+
+namespace Icon
+{
+    namespace CacheWriter
+    {
+        /**
+         * @brief  Writes a GTK icon cache file listing every icon in a
+         *         theme's directory index.
+         *
+         *  The cache is saved to the theme directory's icon-theme.cache file
+         * if the theme directory is writable, or to the theme's generated
+         * cache file within the user's cache directory otherwise. Cache data
+         * is written to a temporary file that then replaces the cache file,
+         * so Cache objects will never read a partially written cache file.
+         *
+         *  Generated caches use the format described at
+         * https://raw.githubusercontent.com/GNOME/gtk/master/docs/iconcache.txt
+         * and do not include any image data.
+         *
+         * @param themeIndex  A built directory index of an icon theme
+         *                    directory.
+         *
+         * @return            Whether the cache file was successfully written.
+         */
+        bool writeCacheFile(const DirectoryIndex& themeIndex);
+
+        /**
+         * @brief  Finds where the cache file for an icon theme directory
+         *         should be written.
+         *
+         * @param themePath  The absolute path of an icon theme directory.
+         *
+         * @return           The theme's icon-theme.cache file if the theme
+         *                   directory is writable, or its generated cache file
+         *                   otherwise.
+         */
+        juce::File getCacheFileLocation(const juce::String& themePath);
+    }
+}
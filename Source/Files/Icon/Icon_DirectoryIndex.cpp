@@ -0,0 +1,365 @@
+#include "Icon_DirectoryIndex.h"
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <set>
+
+#ifdef JUCE_DEBUG
+// Print the full class name before all debug output:
+static const constexpr char* dbgPrefix = "Icon::DirectoryIndex::";
+#endif
+
+// Icon theme index file name:
+static const constexpr char* themeIndexFile = "index.theme";
+
+// Events that may indicate a change to an indexed directory:
+static const constexpr juce::uint32 watchMask = IN_CREATE | IN_DELETE
+        | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF
+        | IN_ONLYDIR;
+
+// Creates an index for a directory tree without reading any directories.
+Icon::DirectoryIndex::DirectoryIndex
+(const juce::File& rootDir, const int maxDepth, const bool skipThemes) :
+rootPath(rootDir.getFullPathName()), maxDepth(maxDepth),
+skipThemes(skipThemes) { }
+
+
+// Closes the inotify instance used to watch indexed directories.
+Icon::DirectoryIndex::~DirectoryIndex()
+{
+    clearIndex();
+}
+
+
+// Reads all directories in the directory tree, replacing any existing index
+// data.
+void Icon::DirectoryIndex::buildIndex()
+{
+    clearIndex();
+    built = true;
+    if (rootPath.isEmpty() || !juce::File(rootPath).isDirectory())
+    {
+        return;
+    }
+    if (!inotify.init())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to initialize inotify, "
+                << rootPath << " will not be refreshed.");
+    }
+    indexDirectory(juce::String(), 0);
+    DBG(dbgPrefix << __func__ << ": Indexed " << (int) iconFiles.size()
+            << " icons in " << (int) directoryNumbers.size()
+            << " directories under " << rootPath);
+}
+
+
+// Checks if the index has been built.
+bool Icon::DirectoryIndex::isBuilt() const
+{
+    return built;
+}
+
+
+// Updates all indexed directories that changed since the index was last built
+// or refreshed.
+bool Icon::DirectoryIndex::refresh()
+{
+    if (!inotify.isInitialized())
+    {
+        return false;
+    }
+    std::set<int> changedDirs;
+    bool rebuildIndex = false;
+    inotify.readEvents([this, &changedDirs, &rebuildIndex]
+            (const Util::InotifyWatcher::Event& event)
+    {
+        if (event.mask & IN_Q_OVERFLOW)
+        {
+            rebuildIndex = true;
+            return;
+        }
+        auto watchIter = watchedDirectories.find(event.watchDescriptor);
+        if (watchIter == watchedDirectories.end())
+        {
+            return;
+        }
+        const int directory = watchIter->second;
+        // Ignore changes to files that aren't icons:
+        if (event.name.isNotEmpty() && !(event.mask & IN_ISDIR)
+                && getExtensionFlag(event.name.fromLastOccurrenceOf(".", true,
+                        false)) == 0)
+        {
+            return;
+        }
+        if (event.mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED))
+        {
+            // The directory is gone, so it will be indexed again if its parent
+            // directory receives a new directory with its name:
+            clearDirectory(directory);
+            directoryNumbers.erase(directories[(size_t) directory].path);
+            if (!(event.mask & IN_IGNORED))
+            {
+                inotify.removeWatch(event.watchDescriptor);
+            }
+            watchedDirectories.erase(watchIter);
+            changedDirs.erase(directory);
+            if (directory == 0)
+            {
+                rebuildIndex = true;
+            }
+            return;
+        }
+        changedDirs.insert(directory);
+    });
+    if (rebuildIndex)
+    {
+        DBG(dbgPrefix << __func__ << ": Rebuilding index for " << rootPath);
+        buildIndex();
+        return true;
+    }
+    for (const int directory : changedDirs)
+    {
+        clearDirectory(directory);
+        readDirectory(directory);
+    }
+    return !changedDirs.empty();
+}
+
+
+// Finds all indexed files for an icon.
+const std::vector<Icon::DirectoryIndex::IconFile>*
+Icon::DirectoryIndex::findIcon(const juce::String& iconName) const
+{
+    auto searchIter = iconFiles.find(iconName);
+    return (searchIter == iconFiles.end()) ? nullptr : &searchIter->second;
+}
+
+
+// Gets the full path of the index's root directory.
+const juce::String& Icon::DirectoryIndex::getRootPath() const
+{
+    return rootPath;
+}
+
+
+// Runs a function for each icon name in the index.
+void Icon::DirectoryIndex::foreachIcon(const std::function<void(
+            const juce::String&, const std::vector<IconFile>&)> iconAction)
+    const
+{
+    for (const auto& iconIter : iconFiles)
+    {
+        iconAction(iconIter.first, iconIter.second);
+    }
+}
+
+
+// Gets the path of an indexed directory.
+const juce::String& Icon::DirectoryIndex::getDirectoryPath
+(const int directory) const
+{
+    jassert(directory >= 0 && directory < (int) directories.size());
+    return directories[(size_t) directory].path;
+}
+
+
+// Gets the full path of an indexed icon file.
+juce::String Icon::DirectoryIndex::getIconPath(const juce::String& iconName,
+        const IconFile& iconFile,
+        const juce::StringArray& extensionOrder) const
+{
+    for (const juce::String& extension : extensionOrder)
+    {
+        if ((iconFile.extensions & getExtensionFlag(extension)) != 0)
+        {
+            const juce::String& dirPath = getDirectoryPath(iconFile.directory);
+            return rootPath + "/" + (dirPath.isEmpty() ? "" : dirPath + "/")
+                    + iconName + extension;
+        }
+    }
+    return juce::String();
+}
+
+
+// Gets the extension flag used for an image file extension.
+juce::uint8 Icon::DirectoryIndex::getExtensionFlag
+(const juce::String& extension)
+{
+    if (extension == ".png")
+    {
+        return pngFlag;
+    }
+    if (extension == ".svg")
+    {
+        return svgFlag;
+    }
+    if (extension == ".xpm")
+    {
+        return xpmFlag;
+    }
+    return 0;
+}
+
+
+// Adds a directory to the index, and adds all of its files and
+// subdirectories.
+void Icon::DirectoryIndex::indexDirectory
+(const juce::String& relativePath, const int depth)
+{
+    const int directory = (int) directories.size();
+    directories.push_back({ relativePath, depth, {} });
+    directoryNumbers[relativePath] = directory;
+    if (inotify.isInitialized())
+    {
+        const juce::String fullPath = relativePath.isEmpty() ? rootPath
+                : rootPath + "/" + relativePath;
+        const int watchDescriptor = inotify.addWatch(fullPath, watchMask);
+        if (watchDescriptor >= 0)
+        {
+            watchedDirectories[watchDescriptor] = directory;
+        }
+        else
+        {
+            DBG(dbgPrefix << __func__ << ": Failed to watch " << fullPath);
+        }
+    }
+    readDirectory(directory);
+}
+
+
+// Reads a directory's files into the index, indexing any subdirectories that
+// weren't already indexed.
+void Icon::DirectoryIndex::readDirectory(const int directory)
+{
+    // Copy directory data, as indexing subdirectories may reallocate the
+    // directory list:
+    const juce::String relativePath = directories[(size_t) directory].path;
+    const int depth = directories[(size_t) directory].depth;
+    const juce::String fullPath = relativePath.isEmpty() ? rootPath
+            : rootPath + "/" + relativePath;
+    DIR* dirStream = opendir(fullPath.toRawUTF8());
+    if (dirStream == nullptr)
+    {
+        return;
+    }
+    juce::StringArray subDirectories;
+    struct dirent* dirEntry;
+    while ((dirEntry = readdir(dirStream)) != nullptr)
+    {
+        const char* fileName = dirEntry->d_name;
+        if (fileName[0] == '.')
+        {
+            continue;
+        }
+        bool isDirectory = (dirEntry->d_type == DT_DIR);
+        if (dirEntry->d_type == DT_UNKNOWN || dirEntry->d_type == DT_LNK)
+        {
+            // The file type must be checked directly:
+            struct stat fileInfo;
+            const juce::String filePath = fullPath + "/"
+                    + juce::String::fromUTF8(fileName);
+            if (stat(filePath.toRawUTF8(), &fileInfo) != 0)
+            {
+                continue;
+            }
+            isDirectory = S_ISDIR(fileInfo.st_mode);
+        }
+        const juce::String name = juce::String::fromUTF8(fileName);
+        if (isDirectory)
+        {
+            subDirectories.add(name);
+            continue;
+        }
+        const int extensionStart = name.lastIndexOfChar('.');
+        if (extensionStart <= 0)
+        {
+            continue;
+        }
+        const juce::uint8 extensionFlag
+                = getExtensionFlag(name.substring(extensionStart));
+        if (extensionFlag == 0)
+        {
+            continue;
+        }
+        const juce::String iconName = name.substring(0, extensionStart);
+        std::vector<IconFile>& fileList = iconFiles[iconName];
+        bool directoryFound = false;
+        for (IconFile& iconFile : fileList)
+        {
+            if (iconFile.directory == directory)
+            {
+                iconFile.extensions |= extensionFlag;
+                directoryFound = true;
+                break;
+            }
+        }
+        if (!directoryFound)
+        {
+            fileList.push_back({ directory, extensionFlag });
+            directories[(size_t) directory].icons.push_back(iconName);
+        }
+    }
+    closedir(dirStream);
+
+    if (depth >= maxDepth)
+    {
+        return;
+    }
+    for (const juce::String& subDirectory : subDirectories)
+    {
+        const juce::String subPath = relativePath.isEmpty() ? subDirectory
+                : relativePath + "/" + subDirectory;
+        if (directoryNumbers.count(subPath) != 0)
+        {
+            continue;
+        }
+        if (skipThemes && juce::File(rootPath + "/" + subPath)
+                .getChildFile(themeIndexFile).existsAsFile())
+        {
+            continue;
+        }
+        indexDirectory(subPath, depth + 1);
+    }
+}
+
+
+// Removes all files within a directory from the index.
+void Icon::DirectoryIndex::clearDirectory(const int directory)
+{
+    std::vector<juce::String>& icons = directories[(size_t) directory].icons;
+    for (const juce::String& iconName : icons)
+    {
+        auto fileIter = iconFiles.find(iconName);
+        if (fileIter == iconFiles.end())
+        {
+            continue;
+        }
+        std::vector<IconFile>& fileList = fileIter->second;
+        for (auto listIter = fileList.begin(); listIter != fileList.end();
+                listIter++)
+        {
+            if (listIter->directory == directory)
+            {
+                fileList.erase(listIter);
+                break;
+            }
+        }
+        if (fileList.empty())
+        {
+            iconFiles.erase(fileIter);
+        }
+    }
+    icons.clear();
+}
+
+
+// Removes all index data and closes all directory watches.
+void Icon::DirectoryIndex::clearIndex()
+{
+    inotify.close();
+    watchedDirectories.clear();
+    directories.clear();
+    directoryNumbers.clear();
+    iconFiles.clear();
+    built = false;
+}
@@ -0,0 +1,252 @@
+#pragma once
+/**
+ * @file  Icon_DirectoryIndex.h
+ *
+ * @brief  Lists all icon files within a directory tree, so that icons can be
+ *         found without checking for files on disk.
+ */
+
+#include "Util_InotifyWatcher.h"
+#include "JuceHeader.h"
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace Icon { class DirectoryIndex; }
+
+/**
+ * @brief  Maps icon names to the directories and file extensions of all icon
+ *         files with that name within a directory tree.
+ *
+ *  A DirectoryIndex reads each directory in its tree once when the index is
+ * built. After that, icon lookups only search the index, and never access the
+ * file system. If inotify is available, the index watches each indexed
+ * directory, and refresh() may be called to update only the directories that
+ * changed since the index was built or last refreshed.
+ *
+ *  DirectoryIndex is not thread-safe. It may be read by several threads at
+ * once, but buildIndex and refresh must not run while any other thread is
+ * reading the index.
+ */
+class Icon::DirectoryIndex
+{
+public:
+    /**
+     * @brief  Flags used to mark the image file types found for an icon.
+     */
+    enum ExtensionFlag
+    {
+        pngFlag = 1,
+        svgFlag = 2,
+        xpmFlag = 4
+    };
+
+    /**
+     * @brief  Describes the files found for an icon within one directory.
+     */
+    struct IconFile
+    {
+        // The directory's number within the index:
+        int directory;
+        // ExtensionFlag values of every file found for the icon within the
+        // directory:
+        juce::uint8 extensions;
+    };
+
+    /**
+     * @brief  Creates an index for a directory tree without reading any
+     *         directories.
+     *
+     * @param rootDir     The base directory of the directory tree.
+     *
+     * @param maxDepth    The maximum number of subdirectory levels to index
+     *                    below the root directory.
+     *
+     * @param skipThemes  Whether subdirectories containing icon theme
+     *                    index.theme files should be left out of the index.
+     */
+    DirectoryIndex(const juce::File& rootDir, const int maxDepth,
+            const bool skipThemes = false);
+
+    /**
+     * @brief  Creates an empty index with no root directory.
+     */
+    DirectoryIndex() { }
+
+    /**
+     * @brief  Closes the inotify instance used to watch indexed directories.
+     */
+    virtual ~DirectoryIndex();
+
+    /**
+     * @brief  Reads all directories in the directory tree, replacing any
+     *         existing index data.
+     */
+    void buildIndex();
+
+    /**
+     * @brief  Checks if the index has been built.
+     *
+     * @return  Whether buildIndex has been called.
+     */
+    bool isBuilt() const;
+
+    /**
+     * @brief  Updates all indexed directories that changed since the index was
+     *         last built or refreshed.
+     *
+     * @return  Whether any indexed files or directories changed.
+     */
+    bool refresh();
+
+    /**
+     * @brief  Finds all indexed files for an icon.
+     *
+     * @param iconName  An icon name, without any file extension.
+     *
+     * @return          The directories and extensions of all files with that
+     *                  name, or nullptr if no matching files were indexed. This
+     *                  pointer is only valid until the index next changes.
+     */
+    const std::vector<IconFile>* findIcon(const juce::String& iconName) const;
+
+    /**
+     * @brief  Gets the full path of the index's root directory.
+     *
+     * @return  The root directory path.
+     */
+    const juce::String& getRootPath() const;
+
+    /**
+     * @brief  Runs a function for each icon name in the index.
+     *
+     * @param iconAction  A function to call with each icon name, and the list
+     *                    of all indexed files for that icon.
+     */
+    void foreachIcon(const std::function<void(const juce::String&,
+                const std::vector<IconFile>&)> iconAction) const;
+
+    /**
+     * @brief  Gets the path of an indexed directory.
+     *
+     * @param directory  A directory number taken from an IconFile.
+     *
+     * @return           The directory's path relative to the root directory,
+     *                   or the empty string for the root directory itself.
+     */
+    const juce::String& getDirectoryPath(const int directory) const;
+
+    /**
+     * @brief  Gets the full path of an indexed icon file.
+     *
+     * @param iconName        The icon's name, without any file extension.
+     *
+     * @param iconFile        The icon's indexed file data.
+     *
+     * @param extensionOrder  File extensions in order of preference.
+     *
+     * @return                The path of the icon file with the most preferred
+     *                        extension, or the empty string if the icon has
+     *                        none of those extensions.
+     */
+    juce::String getIconPath(const juce::String& iconName,
+            const IconFile& iconFile,
+            const juce::StringArray& extensionOrder) const;
+
+    /**
+     * @brief  Gets the extension flag used for an image file extension.
+     *
+     * @param extension  A file extension, including the leading period.
+     *
+     * @return           The matching ExtensionFlag, or zero if the extension
+     *                   is not a supported icon file type.
+     */
+    static juce::uint8 getExtensionFlag(const juce::String& extension);
+
+private:
+    /**
+     * @brief  Adds a directory to the index, and adds all of its files and
+     *         subdirectories.
+     *
+     * @param relativePath  The directory's path relative to the root
+     *                      directory.
+     *
+     * @param depth         The number of levels the directory is below the
+     *                      root directory.
+     */
+    void indexDirectory(const juce::String& relativePath, const int depth);
+
+    /**
+     * @brief  Reads a directory's files into the index, indexing any
+     *         subdirectories that weren't already indexed.
+     *
+     * @param directory  The number of an indexed directory.
+     */
+    void readDirectory(const int directory);
+
+    /**
+     * @brief  Removes all files within a directory from the index.
+     *
+     * @param directory  The number of an indexed directory.
+     */
+    void clearDirectory(const int directory);
+
+    /**
+     * @brief  Removes all index data and closes all directory watches.
+     */
+    void clearIndex();
+
+    /**
+     * @brief  Hashes juce::String keys using their content.
+     */
+    struct StringHash
+    {
+        size_t operator()(const juce::String& key) const
+        {
+            return (size_t) key.hashCode64();
+        }
+    };
+
+    /**
+     * @brief  Holds data describing an indexed directory.
+     */
+    struct Directory
+    {
+        // The directory path, relative to the root directory:
+        juce::String path;
+        // The number of levels the directory is below the root directory:
+        int depth;
+        // The names of all icons indexed within the directory:
+        std::vector<juce::String> icons;
+    };
+
+    // The root directory's full path:
+    juce::String rootPath;
+
+    // The maximum subdirectory depth to index:
+    int maxDepth = 0;
+
+    // Whether icon theme subdirectories are excluded:
+    bool skipThemes = false;
+
+    // Whether the index has been built:
+    bool built = false;
+
+    // All indexed directories, stored at their directory numbers:
+    std::vector<Directory> directories;
+
+    // Maps relative directory paths to directory numbers:
+    std::map<juce::String, int> directoryNumbers;
+
+    // Maps icon names to their indexed files:
+    std::unordered_map<juce::String, std::vector<IconFile>, StringHash>
+            iconFiles;
+
+    // Watches indexed directories, if inotify could be initialized:
+    Util::InotifyWatcher inotify;
+
+    // Maps inotify watch descriptors to directory numbers:
+    std::map<int, int> watchedDirectories;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DirectoryIndex)
+};
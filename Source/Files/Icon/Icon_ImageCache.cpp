@@ -0,0 +1,68 @@
+#include "Icon_ImageCache.h"
+
+// Sorts keys by size, scale, and context, then by name.
+bool Icon::ImageCache::Key::operator<(const Key& rhs) const
+{
+    if (size != rhs.size)
+    {
+        return size < rhs.size;
+    }
+    if (scale != rhs.scale)
+    {
+        return scale < rhs.scale;
+    }
+    if (context != rhs.context)
+    {
+        return context < rhs.context;
+    }
+    return name < rhs.name;
+}
+
+
+// Creates an empty image cache.
+Icon::ImageCache::ImageCache(const size_t byteBudget) : lruCache(byteBudget)
+{ }
+
+
+// Finds a cached image, marking it as the most recently used image.
+juce::Image Icon::ImageCache::findImage(const Key& key)
+{
+    return lruCache.findImage(key);
+}
+
+
+// Adds an image to the cache, removing the least recently used images if
+// necessary to keep the cache within its byte budget.
+void Icon::ImageCache::addImage(const Key& key, const juce::Image& image)
+{
+    lruCache.addImage(key, image);
+}
+
+
+// Changes the cache's byte budget, removing images if necessary to fit within
+// the new budget.
+void Icon::ImageCache::setByteBudget(const size_t newBudget)
+{
+    lruCache.setByteBudget(newBudget);
+}
+
+
+// Removes all images from the cache.
+void Icon::ImageCache::clear()
+{
+    lruCache.clear();
+}
+
+
+// Gets the cache's current size and activity counters.
+Icon::ImageCache::Statistics Icon::ImageCache::getStatistics() const
+{
+    return lruCache.getStatistics();
+}
+
+
+// Finds the amount of memory used to store an image's pixel data.
+size_t Icon::ImageCache::getImageBytes(const juce::Image& image)
+{
+    return Util::ImageLRUCache<Key>::getImageBytes(image);
+}
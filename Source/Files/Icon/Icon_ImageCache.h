@@ -0,0 +1,129 @@
+#pragma once
+/**
+ * @file  Icon_ImageCache.h
+ *
+ * @brief  Stores loaded icon images within a limited memory budget.
+ */
+
+#include "Icon_Context.h"
+#include "Util_ImageLRUCache.h"
+#include "JuceHeader.h"
+
+namespace Icon { class ImageCache; }
+
+/**
+ * @brief  Caches loaded icon images by icon name, size, scale, and context,
+ *         discarding the least recently used images whenever the total size of
+ *         all cached images exceeds a byte budget.
+ *
+ *  Each cached image is stored under the exact request that loaded it, so
+ * requests for the same icon at different sizes are cached separately. The
+ * ImageCache counts cache hits, misses, and evictions so that cache behavior
+ * can be checked while the application runs.
+ *
+ *  ImageCache is not thread-safe. Because looking up an image updates its
+ * position in the cache's usage order, both lookups and insertions must be
+ * protected from concurrent access.
+ */
+class Icon::ImageCache
+{
+public:
+    /**
+     * @brief  Identifies a cached icon image.
+     */
+    struct Key
+    {
+        // Icon name
+        juce::String name;
+        // Requested width/height, in pixels
+        int size;
+        // Requested scale factor
+        int scale;
+        // Requested icon category
+        Context context;
+
+        /**
+         * @brief  Sorts keys by size, scale, and context, then by name.
+         *
+         *  The cheap integer fields are compared first, so that names are
+         * only compared when the other fields match.
+         *
+         * @param rhs  Another cache key.
+         *
+         * @return     Whether this key comes before rhs.
+         */
+        bool operator<(const Key& rhs) const;
+    };
+
+    // Describes the cache's current size and activity:
+    typedef Util::ImageLRUCache<Key>::Statistics Statistics;
+
+    /**
+     * @brief  Creates an empty image cache.
+     *
+     * @param byteBudget  The maximum total size in bytes of all cached images.
+     */
+    ImageCache(const size_t byteBudget);
+
+    virtual ~ImageCache() { }
+
+    /**
+     * @brief  Finds a cached image, marking it as the most recently used
+     *         image.
+     *
+     * @param key  The image's cache key.
+     *
+     * @return     The cached image, or a null image if no image with that key
+     *             is cached.
+     */
+    juce::Image findImage(const Key& key);
+
+    /**
+     * @brief  Adds an image to the cache, removing the least recently used
+     *         images if necessary to keep the cache within its byte budget.
+     *
+     *  Images that are larger than the entire byte budget will not be cached.
+     *
+     * @param key    The image's cache key. Any image already saved with this
+     *               key will be replaced.
+     *
+     * @param image  A valid image to cache.
+     */
+    void addImage(const Key& key, const juce::Image& image);
+
+    /**
+     * @brief  Changes the cache's byte budget, removing images if necessary to
+     *         fit within the new budget.
+     *
+     * @param newBudget  The new maximum total size in bytes of all cached
+     *                   images.
+     */
+    void setByteBudget(const size_t newBudget);
+
+    /**
+     * @brief  Removes all images from the cache.
+     */
+    void clear();
+
+    /**
+     * @brief  Gets the cache's current size and activity counters.
+     *
+     * @return  The current cache statistics.
+     */
+    Statistics getStatistics() const;
+
+    /**
+     * @brief  Finds the amount of memory used to store an image's pixel data.
+     *
+     * @param image  Any image object.
+     *
+     * @return       The image's approximate size in bytes.
+     */
+    static size_t getImageBytes(const juce::Image& image);
+
+private:
+    // Stores cached images in least recently used order:
+    Util::ImageLRUCache<Key> lruCache;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ImageCache)
+};
@@ -35,3 +35,10 @@ void Icon::Loader::cancelImageRequest(const RequestID toCancel)
 }
 
 
+// Gets the current size and activity counters of the shared icon image cache.
+Icon::ImageCache::Statistics Icon::Loader::getCacheStatistics() const
+{
+    SharedResource::LockedPtr<const ThreadResource> iconThread
+            = getReadLockedResource();
+    return iconThread->getCacheStatistics();
+}
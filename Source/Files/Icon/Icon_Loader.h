@@ -8,6 +8,7 @@
 #include "SharedResource_Handler.h"
 #include "Icon_RequestID.h"
 #include "Icon_Context.h"
+#include "Icon_ImageCache.h"
 
 namespace Icon { class Loader; }
 namespace Icon { class ThreadResource; }
@@ -69,4 +70,13 @@ public:
      * @param toCancel  The callback ID of the assignment function to cancel.
      */
     void cancelImageRequest(const RequestID toCancel);
+
+    /**
+     * @brief  Gets the current size and activity counters of the shared icon
+     *         image cache.
+     *
+     * @return  The number of cache hits, misses, and evictions, along with the
+     *          number and total size of cached images.
+     */
+    ImageCache::Statistics getCacheStatistics() const;
 };
@@ -1,4 +1,5 @@
 #include "Icon_ThemeIndex.h"
+#include "Icon_CacheWriter.h"
 #include <limits>
 
 #ifdef JUCE_DEBUG
@@ -9,10 +10,17 @@ static const constexpr char* dbgPrefix = "Icon::ThemeIndex::";
 // Filename shared by all icon theme indexes:
 static const constexpr char* indexFileName = "/index.theme";
 
+// Maximum subdirectory depth of icon files within a theme:
+static const constexpr int maxThemeDepth = 3;
+
+// Icon file extensions, in order of preference:
+static const juce::StringArray iconExtensions = {".png", ".svg", ".xpm"};
+
 // Creates a new ThemeIndex for a single icon theme directory.
 Icon::ThemeIndex::ThemeIndex(juce::File themeDir) :
 path(themeDir.getFullPathName()),
-cacheFile(themeDir.getFullPathName())
+cacheFile(themeDir.getFullPathName()),
+fileIndex(themeDir, maxThemeDepth)
 {
     using juce::String;
     using juce::StringArray;
@@ -213,6 +221,10 @@ juce::String Icon::ThemeIndex::lookupIcon
     {
         return String();
     }
+    if (fileIndex.isBuilt())
+    {
+        return lookupIndexedIcon(icon, size, context, scale);
+    }
 
     juce::Array<IconDirectory> searchDirs;
 
@@ -285,8 +297,7 @@ juce::String Icon::ThemeIndex::lookupIcon
             // File extensions not found, continue on to check all possible
             // extensions:
         }
-        static const juce::StringArray extensions = {".png", ".svg", ".xpm"};
-        for (const String& ext : extensions)
+        for (const String& ext : iconExtensions)
         {
             juce::File iconFile(filePath + ext);
             if (iconFile.existsAsFile())
@@ -299,6 +310,142 @@ juce::String Icon::ThemeIndex::lookupIcon
 }
 
 
+// Reads all icon files in the theme directory into the theme's file index.
+void Icon::ThemeIndex::buildFileIndex()
+{
+    if (isValidTheme())
+    {
+        fileIndex.buildIndex();
+        cacheOutdated = !cacheFile.isValidCache() || !isCacheCurrent();
+    }
+}
+
+
+// Updates the theme's file index with any changes to theme directories since
+// the index was built or last refreshed.
+bool Icon::ThemeIndex::refreshFileIndex()
+{
+    const bool indexChanged = fileIndex.refresh();
+    cacheOutdated = cacheOutdated || indexChanged;
+    return indexChanged;
+}
+
+
+// Checks if the theme's file index has been built.
+bool Icon::ThemeIndex::isFileIndexBuilt() const
+{
+    return fileIndex.isBuilt();
+}
+
+
+// Checks if the theme has an up to date icon cache file.
+bool Icon::ThemeIndex::hasValidCache() const
+{
+    return cacheFile.isValidCache();
+}
+
+
+// Checks if the theme's cache files are still up to date.
+bool Icon::ThemeIndex::isCacheCurrent() const
+{
+    const juce::File themeDir(path);
+    return Cache::isUsableCacheFile(Cache::getThemeCacheFile(path), themeDir)
+            || Cache::isUsableCacheFile(Cache::getGeneratedCacheFile(path),
+                themeDir);
+}
+
+
+// Checks if the theme's cache file should be written or replaced using the
+// theme's file index.
+bool Icon::ThemeIndex::needsCacheUpdate() const
+{
+    return cacheOutdated && fileIndex.isBuilt();
+}
+
+
+// Writes a new icon cache file for the theme using the theme's file index.
+bool Icon::ThemeIndex::updateCacheFile()
+{
+    if (!fileIndex.isBuilt())
+    {
+        return false;
+    }
+    // Don't keep retrying if the cache can't be written:
+    cacheOutdated = false;
+    return CacheWriter::writeCacheFile(fileIndex);
+}
+
+
+// Finds the path of an icon within the theme using the theme's file index.
+juce::String Icon::ThemeIndex::lookupIndexedIcon(const juce::String& icon,
+        const int size, const Context context, const int scale) const
+{
+    const std::vector<DirectoryIndex::IconFile>* iconFiles
+            = fileIndex.findIcon(icon);
+    if (iconFiles == nullptr)
+    {
+        return juce::String();
+    }
+
+    // Icon files in directories not defined in the index file are only used
+    // if no defined directories contain the icon. Directories with the wrong
+    // context are only used if no directories with the requested context
+    // contain the icon.
+    juce::Array<IconDirectory> searchDirs;
+    juce::Array<IconDirectory> otherContextDirs;
+    std::map<juce::String, const DirectoryIndex::IconFile*> dirFiles;
+    for (const DirectoryIndex::IconFile& iconFile : *iconFiles)
+    {
+        const juce::String& dirPath
+                = fileIndex.getDirectoryPath(iconFile.directory);
+        dirFiles[dirPath] = &iconFile;
+        auto dirIter = directories.find(dirPath);
+        if (dirIter == directories.end())
+        {
+            IconDirectory undefinedDir;
+            undefinedDir.path = dirPath;
+            undefinedDir.undefined = true;
+            searchDirs.add(undefinedDir);
+        }
+        else if (context == Context::unknown
+                || context == dirIter->second.context)
+        {
+            searchDirs.add(dirIter->second);
+        }
+        else
+        {
+            otherContextDirs.add(dirIter->second);
+        }
+    }
+    bool definedDirFound = false;
+    for (const IconDirectory& dir : searchDirs)
+    {
+        if (!dir.undefined)
+        {
+            definedDirFound = true;
+            break;
+        }
+    }
+    if (!definedDirFound)
+    {
+        searchDirs.addArray(otherContextDirs);
+    }
+
+    DirectoryComparator comp(size, scale);
+    searchDirs.sort(comp);
+    for (const IconDirectory& dir : searchDirs)
+    {
+        const juce::String iconPath = fileIndex.getIconPath(icon,
+                *dirFiles[dir.path], iconExtensions);
+        if (iconPath.isNotEmpty())
+        {
+            return iconPath;
+        }
+    }
+    return juce::String();
+}
+
+
 // Gets the name of the icon theme.
 juce::String Icon::ThemeIndex::getName() const
 {
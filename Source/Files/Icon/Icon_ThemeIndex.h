@@ -6,6 +6,7 @@
  */
 
 #include "Icon_Cache.h"
+#include "Icon_DirectoryIndex.h"
 #include "Icon_Context.h"
 #include "JuceHeader.h"
 #include <map>
@@ -18,6 +19,11 @@ namespace Icon { class ThemeIndex; }
  *
  *  Icon themes follow the icon theme specification provided at
  * https://specifications.freedesktop.org
+ *
+ *  Once buildFileIndex has been called, icons are found using a
+ * DirectoryIndex of all files in the theme, without checking if any files
+ * exist. Until then, the theme's icon cache file is used to find icons if
+ * possible, and icon directories are searched directly otherwise.
  */
 class Icon::ThemeIndex
 {
@@ -80,6 +86,71 @@ public:
     juce::String lookupIcon(juce::String icon, int size,
             Context context = Context::unknown, int scale = 1) const;
 
+    /**
+     * @brief  Reads all icon files in the theme directory into the theme's
+     *         file index.
+     *
+     *  This may take some time, and should not be called while any other
+     * thread might be looking up icons within the theme.
+     */
+    void buildFileIndex();
+
+    /**
+     * @brief  Updates the theme's file index with any changes to theme
+     *         directories since the index was built or last refreshed.
+     *
+     *  This should not be called while any other thread might be looking up
+     * icons within the theme.
+     *
+     * @return  Whether any icon files or directories changed.
+     */
+    bool refreshFileIndex();
+
+    /**
+     * @brief  Checks if the theme's file index has been built.
+     *
+     * @return  Whether buildFileIndex has been called.
+     */
+    bool isFileIndexBuilt() const;
+
+    /**
+     * @brief  Checks if the theme has an up to date icon cache file.
+     *
+     * @return  Whether a valid icon cache file was found when the theme was
+     *          loaded.
+     */
+    bool hasValidCache() const;
+
+    /**
+     * @brief  Checks if the theme's cache files are still up to date.
+     *
+     *  Unlike hasValidCache, this checks the cache files on disk, so it
+     * detects theme directory changes made after the theme was loaded.
+     *
+     * @return  Whether the theme has a cache file that is not older than the
+     *          theme directory.
+     */
+    bool isCacheCurrent() const;
+
+    /**
+     * @brief  Checks if the theme's cache file should be written or replaced
+     *         using the theme's file index.
+     *
+     * @return  Whether the theme's file index was built without a valid cache
+     *          file, or changed since the cache file was last written.
+     */
+    bool needsCacheUpdate() const;
+
+    /**
+     * @brief  Writes a new icon cache file for the theme using the theme's
+     *         file index.
+     *
+     *  This should not be called while the file index might be changing.
+     *
+     * @return  Whether the cache file was written successfully.
+     */
+    bool updateCacheFile();
+
     /**
      * @brief  Gets the name of the icon theme.
      *
@@ -142,6 +213,24 @@ private:
         bool undefined = false;
     };
 
+    /**
+     * @brief  Finds the path of an icon within the theme using the theme's
+     *         file index.
+     *
+     * @param icon     The name of an icon file, without the file extension.
+     *
+     * @param size     The desired icon width and height, in pixels.
+     *
+     * @param context  The preferred context of the requested icon.
+     *
+     * @param scale    The intended scale factor of the requested icon.
+     *
+     * @return         The path of a suitable icon file, or the empty string if
+     *                 no match is found.
+     */
+    juce::String lookupIndexedIcon(const juce::String& icon, const int size,
+            const Context context, const int scale) const;
+
     /**
      * @brief  Sorts icon directories by distance from a target size and scale,
      *         from closet to farthest.
@@ -221,6 +310,11 @@ private:
     juce::String example;
     // Accesses the theme's cache file, if one exists:
     Cache cacheFile;
+    // Lists all icon files within the theme:
+    DirectoryIndex fileIndex;
+    // Whether the cache file is missing, out of date, or doesn't match the
+    // file index:
+    bool cacheOutdated = false;
     // All icon sub-directories in the theme, indexed by relative path name:
     std::map<juce::String, IconDirectory> directories;
 };
@@ -1,7 +1,9 @@
 #include "Icon_ThreadResource.h"
 #include "Theme_Image_ConfigFile.h"
+#include "Config_MainFile.h"
 #include "Assets_XDGDirectories.h"
 #include "Assets.h"
+#include <limits>
 
 #ifdef JUCE_DEBUG
 // Print the full class name before all debug output:
@@ -33,8 +35,8 @@ static const constexpr char* iconThemeKey = "gtk-icon-theme-name";
 // Backup icon theme selection key in the iconThemeFile:
 static const constexpr char* backupThemeKey = "gtk-fallback-icon-theme";
 
-// Icon theme file name:
-static const constexpr char* indexFileName = "index.theme";
+// Number of subdirectory levels to index within unthemed icon directories:
+static const constexpr int unthemedIndexDepth = 1;
 
 // Default fallback icon theme:
 static const constexpr char* fallbackTheme = "hicolor";
@@ -44,8 +46,15 @@ static const constexpr char* fallbackTheme = "hicolor";
 static const constexpr char* pocketHomeIconPath
         = "/usr/share/pocket-home/icons";
 
+// Maximum number of queued requests handled in each batch:
+static const constexpr size_t maxBatchSize = 16;
+
+// Image cache byte budget used until the configured budget is loaded:
+static const constexpr size_t defaultCacheBudget = 8 * 1024 * 1024;
+
 Icon::ThreadResource::ThreadResource() :
-SharedResource::Thread::Resource(resourceKey, ::threadName)
+SharedResource::Thread::Resource(resourceKey, ::threadName),
+imageCache(defaultCacheBudget)
 {
     using juce::StringArray;
     using juce::String;
@@ -140,11 +149,30 @@ SharedResource::Thread::Resource(resourceKey, ::threadName)
     }
     DBG(dbgPrefix << __func__ << ": Loaded icon themes: " << dbgThemeNames);
     #endif
+
+    // Unthemed icon directories are indexed without their icon theme
+    // subdirectories:
+    for (const String& dir : iconDirectories)
+    {
+        unthemedIndexes.add(new DirectoryIndex(File(dir), unthemedIndexDepth,
+                    true));
+    }
+
+    // Start the thread now, so that icon files are indexed before the first
+    // icon request:
+    startResourceThread();
 }
 
 Icon::ThreadResource::~ThreadResource()
 {
-    loadedImageCache.clear();
+    #ifdef JUCE_DEBUG
+    const ImageCache::Statistics stats = imageCache.getStatistics();
+    DBG(dbgPrefix << __func__ << ": Image cache hits: " << stats.hits
+            << ", misses: " << stats.misses << ", evictions: "
+            << stats.evictions << ", cached bytes: "
+            << (juce::int64) stats.cachedBytes);
+    #endif
+    imageCache.clear();
 }
 
 
@@ -152,6 +180,7 @@ Icon::ThreadResource::~ThreadResource()
 void Icon::ThreadResource::cancelRequest(const RequestID requestID)
 {
     requestMap.erase(requestID);
+    activeRequests.erase(requestID);
 }
 
 
@@ -166,26 +195,22 @@ Icon::RequestID Icon::ThreadResource::addRequest(IconRequest request)
     {
         return 0;
     }
-    // First, attempt to load the icon from the loaded image cache or assets.
-    Image preLoadedIcon;
-    if (request.icon[0] == '/')
+    // If icon is a partial path, trim it. Full paths are loaded by the icon
+    // thread, so image files are never read on the message thread.
+    if (request.icon[0] != '/' && request.icon.contains("/"))
     {
-        preLoadedIcon = Assets::loadImageAsset(request.icon);
+        request.icon = request.icon.substring
+            (1 + request.icon.lastIndexOf("/"));
     }
-    if (preLoadedIcon.isNull())
+    // First, attempt to load the icon from the loaded image cache.
+    if (!cacheBudgetLoaded)
     {
-        //if icon is a partial path, trim it
-        if (request.icon.contains("/"))
-        {
-            request.icon = request.icon.substring
-                (1 + request.icon.lastIndexOf("/"));
-        }
-        if (loadedImageCache.contains(request.icon))
-        {
-            preLoadedIcon = loadedImageCache[request.icon];
-            jassert(preLoadedIcon.isValid());
-        }
+        const Config::MainFile config;
+        const int budgetKB = config.getIconCacheSize();
+        imageCache.setByteBudget((size_t) juce::jmax(0, budgetKB) * 1024);
+        cacheBudgetLoaded = true;
     }
+    const Image preLoadedIcon = imageCache.findImage(getCacheKey(request));
     if (preLoadedIcon.isValid()) // Icon already found, apply now.
     {
         request.loadingCallback(preLoadedIcon);
@@ -220,7 +245,8 @@ Icon::RequestID Icon::ThreadResource::addRequest(IconRequest request)
         }
 
         static RequestID newID = 0;
-        while (newID == 0 || requestMap.count(newID) != 0)
+        while (newID == 0 || requestMap.count(newID) != 0
+                || activeRequests.count(newID) != 0)
         {
             newID++;
         }
@@ -238,79 +264,67 @@ Icon::RequestID Icon::ThreadResource::addRequest(IconRequest request)
 }
 
 
-// Asynchronously handles queued icon requests.
-void Icon::ThreadResource::runLoop(SharedResource::Thread::Lock& lock)
+// Gets the current size and activity counters of the loaded icon image cache.
+Icon::ImageCache::Statistics Icon::ThreadResource::getCacheStatistics() const
 {
-    using juce::Image;
-    using juce::String;
-    using std::function;
-    lock.enterRead();
-    RequestID requestID = requestMap.begin()->first;
-    IconRequest firstRequest = requestMap[requestID];
-    lock.exitRead();
-
-    String icon = firstRequest.icon;
-    String iconPath = getIconPath(firstRequest);
-    if (iconPath.isNotEmpty())
-    {
-        // Loading svg files into drawable components requires the message
-        // thread to be locked.
-        Image iconImg;
-        {
-            const juce::MessageManagerLock mmLock((juce::Thread*) this);
-            if (!mmLock.lockWasGained())
-            {
-                DBG(dbgPrefix << __func__
-                        << ":: Exiting, stop instead of loading icon \""
-                        << icon << "\"");
-                return;
-            }
-            iconImg = Assets::loadImageAsset(iconPath);
-            if (iconImg.isNull())
-            {
-                DBG(dbgPrefix << __func__ << ": Unable to load icon " << icon);
-                return;
-            }
-        }
+    return imageCache.getStatistics();
+}
 
-        lock.enterWrite();
-        loadedImageCache.set(icon, iconImg);
-        lock.exitWrite();
 
-        // If callback wasn't removed, lock the message thread, check again
-        // that it's still there, run the callback, and remove it from the map.
-        const juce::MessageManagerLock mmLock((juce::Thread*) this);
-        if (!mmLock.lockWasGained())
-        {
-            DBG(dbgPrefix << __func__
-                    << ":: Exiting, skipping callback for icon \"" << icon
-                    << "\"");
-            return;
-        }
+// Asynchronously handles a batch of queued icon requests.
+void Icon::ThreadResource::runLoop(SharedResource::Thread::Lock& lock)
+{
+    // Icons that couldn't be found may now be available if indexed
+    // directories changed:
+    const bool indexChanged = refreshFileIndexes();
+    std::vector<LoadedIcon> batch;
+    lock.enterWrite();
+    if (indexChanged)
+    {
+        missingIcons.clear();
+    }
+    while (!requestMap.empty() && batch.size() < maxBatchSize)
+    {
+        auto requestIter = requestMap.begin();
+        batch.push_back({ requestIter->first, requestIter->second,
+                juce::Image() });
+        activeRequests[requestIter->first] = requestIter->second;
+        requestMap.erase(requestIter);
+    }
+    lock.exitWrite();
+
+    loadIconBatch(batch);
 
-        lock.enterRead();
-        const bool requestPresent = (requestMap.count(requestID) != 0);
-        if (requestPresent)
+    lock.enterWrite();
+    for (LoadedIcon& loadedIcon : batch)
+    {
+        if (loadedIcon.image.isValid())
         {
-            firstRequest.loadingCallback(iconImg);
+            imageCache.addImage(getCacheKey(loadedIcon.request),
+                    loadedIcon.image);
+            loadedIcons.push_back(loadedIcon);
         }
-        lock.exitRead();
-
-        if (requestPresent)
+        else
         {
-            lock.enterWrite();
-            requestMap.erase(requestID);
-            lock.exitWrite();
+            // Couldn't find the icon, remove the request
+            DBG(dbgPrefix << __func__ << ": Unable to load icon "
+                    << loadedIcon.request.icon);
+            missingIcons.addIfNotAlreadyThere(loadedIcon.request.icon);
+            activeRequests.erase(loadedIcon.requestID);
         }
     }
-    else
+    // Icons loaded before the message thread handles the last delivery are
+    // delivered together with it:
+    if (!loadedIcons.empty() && !deliveryScheduled)
     {
-        // Couldn't find the icon, remove the request
-        lock.enterWrite();
-        missingIcons.add(firstRequest.icon);
-        requestMap.erase(requestID);
-        lock.exitWrite();
+        deliveryScheduled = true;
+        juce::MessageManager::callAsync(buildAsyncFunction(
+                    SharedResource::LockType::write, [this]
+        {
+            deliverLoadedIcons();
+        }));
     }
+    lock.exitWrite();
 }
 
 
@@ -323,6 +337,7 @@ bool Icon::ThreadResource::threadShouldWait()
 
 // Search icon theme directories for an icon matching a given request.
 juce::String Icon::ThreadResource::getIconPath(const IconRequest& request)
+    const
 {
     using juce::String;
     using juce::File;
@@ -368,82 +383,264 @@ juce::String Icon::ThreadResource::getIconPath(const IconRequest& request)
 }
 
 
-/**
- * @brief  Sorts directory lists to prioritize ones with non-numeric names, and
- *         prioritize numeric directories with values close to a target integer.
- */
-class DirectoryComparator
+// Gets the image cache key used to store an icon request's image.
+Icon::ImageCache::Key Icon::ThreadResource::getCacheKey
+(const IconRequest& request)
+{
+    return { request.icon, request.size, request.scale, request.context };
+}
+
+
+// Searches icon directories for icon files not indexed by icon themes.
+juce::String Icon::ThreadResource::getUnindexedIconPath
+(const IconRequest& request) const
 {
-public:
-    DirectoryComparator(const int target) : target(target) { }
-
-    int compareElements(juce::File first, juce::File second)
-    {
-        using juce::String;
-        const String numericChars = "0123456789";
-        juce::String firstNumber = first.getFileName()
-                .initialSectionContainingOnly(numericChars);
-        juce::String secondNumber = first.getFileName()
-                .initialSectionContainingOnly(numericChars);
-        // Prioritize non-numeric
-        if (firstNumber.isEmpty())
+    using juce::String;
+    static const juce::StringArray iconExtensions = {".png", ".xpm", ".svg"};
+    for (const DirectoryIndex* iconDirectory : unthemedIndexes)
+    {
+        const std::vector<DirectoryIndex::IconFile>* iconFiles
+                = iconDirectory->findIcon(request.icon);
+        if (iconFiles == nullptr)
         {
-            return secondNumber.isEmpty() ? 0 : -1;
+            continue;
         }
-        else if (secondNumber.isEmpty())
+        // Prefer icons in the main directory, then icons in directories with
+        // non-numeric names, then icons in directories with numeric names
+        // closest to the requested size:
+        const DirectoryIndex::IconFile* bestFile = nullptr;
+        int bestDistance = std::numeric_limits<int>::max();
+        for (const DirectoryIndex::IconFile& iconFile : *iconFiles)
         {
-            return 1;
+            const String& dirPath
+                    = iconDirectory->getDirectoryPath(iconFile.directory);
+            const String sizeName
+                    = dirPath.initialSectionContainingOnly("0123456789");
+            int distance;
+            if (dirPath.isEmpty())
+            {
+                distance = -1;
+            }
+            else if (sizeName.isEmpty())
+            {
+                distance = 0;
+            }
+            else
+            {
+                distance = 1 + abs(sizeName.getIntValue() - request.size);
+            }
+            if (distance < bestDistance)
+            {
+                bestDistance = distance;
+                bestFile = &iconFile;
+            }
+        }
+        if (bestFile != nullptr)
+        {
+            const String iconPath = iconDirectory->getIconPath(request.icon,
+                    *bestFile, iconExtensions);
+            if (iconPath.isNotEmpty())
+            {
+                return iconPath;
+            }
         }
-        const int firstDistance = abs(firstNumber.getIntValue() - target);
-        const int secondDistance = abs(secondNumber.getIntValue() - target);
-        return firstDistance - secondDistance;
     }
+    return String();
+}
+
 
-private:
-    const int target;
-};
+// Reads unthemed icon directories and icon themes without valid cache files
+// into file indexes.
+void Icon::ThreadResource::buildFileIndexes()
+{
+    const double indexStart = juce::Time::getMillisecondCounterHiRes();
+    // Themes with valid cache files can already find icons quickly, so they
+    // are only indexed if their cache files go out of date:
+    for (ThemeIndex* iconTheme : iconThemes)
+    {
+        if (!iconTheme->hasValidCache())
+        {
+            iconTheme->buildFileIndex();
+        }
+    }
+    for (DirectoryIndex* iconDirectory : unthemedIndexes)
+    {
+        iconDirectory->buildIndex();
+    }
+    DBG(dbgPrefix << __func__ << ": Indexed icon files in "
+            << (juce::Time::getMillisecondCounterHiRes() - indexStart)
+            << "ms");
+}
 
 
-// Searches icon directories for icon files not indexed by icon themes.
-juce::String Icon::ThreadResource::getUnindexedIconPath
-(const IconRequest& request)
+// Updates all file indexes with any changes to indexed directories.
+bool Icon::ThreadResource::refreshFileIndexes()
 {
+    bool indexChanged = false;
+    for (ThemeIndex* iconTheme : iconThemes)
+    {
+        indexChanged = iconTheme->refreshFileIndex() || indexChanged;
+    }
+    for (DirectoryIndex* iconDirectory : unthemedIndexes)
+    {
+        indexChanged = iconDirectory->refresh() || indexChanged;
+    }
+    return indexChanged;
+}
+
+
+// Indexes icon themes with cache files that went out of date, and writes
+// missing or outdated icon cache files while the thread has no icon requests to
+// handle.
+void Icon::ThreadResource::cleanup(SharedResource::Thread::Lock& lock)
+{
+    for (ThemeIndex* iconTheme : iconThemes)
+    {
+        if (threadShouldExit())
+        {
+            return;
+        }
+        if (!iconTheme->isFileIndexBuilt() && !iconTheme->isCacheCurrent())
+        {
+            iconTheme->buildFileIndex();
+        }
+        if (iconTheme->needsCacheUpdate())
+        {
+            iconTheme->updateCacheFile();
+        }
+    }
+}
+
+
+// Builds icon file indexes the first time the thread starts.
+void Icon::ThreadResource::init(SharedResource::Thread::Lock& lock)
+{
+    if (!filesIndexed)
+    {
+        buildFileIndexes();
+        filesIndexed = true;
+    }
+}
+
+
+// Finds and loads icon images for a batch of requests, using several worker
+// threads.
+void Icon::ThreadResource::loadIconBatch(std::vector<LoadedIcon>& batch)
+{
+    // Requests for the same icon with the same size only need to be loaded
+    // once:
+    std::vector<size_t> uniqueIndices;
+    std::vector<size_t> sourceIndices(batch.size());
+    std::map<ImageCache::Key, size_t> keyIndices;
+    for (size_t i = 0; i < batch.size(); i++)
+    {
+        const ImageCache::Key key = getCacheKey(batch[i].request);
+        auto keyIter = keyIndices.find(key);
+        if (keyIter == keyIndices.end())
+        {
+            keyIndices[key] = i;
+            uniqueIndices.push_back(i);
+            sourceIndices[i] = i;
+        }
+        else
+        {
+            sourceIndices[i] = keyIter->second;
+        }
+    }
+
+    // Every batch item is only written by a single thread:
+    loadingPool.runTasks((int) uniqueIndices.size(),
+            [this, &batch, &uniqueIndices](const int index)
+    {
+        LoadedIcon& loadedIcon = batch[uniqueIndices[(size_t) index]];
+        loadedIcon.image = loadIconImage(loadedIcon.request);
+    });
+
+    for (size_t i = 0; i < batch.size(); i++)
+    {
+        if (sourceIndices[i] != i)
+        {
+            batch[i].image = batch[sourceIndices[i]].image;
+        }
+    }
+}
+
+
+// Finds and loads the icon image for a single request.
+juce::Image Icon::ThreadResource::loadIconImage(const IconRequest& request)
+    const
+{
+    using juce::Image;
     using juce::String;
-    using juce::StringArray;
-    using juce::File;
-    StringArray searchPaths = iconDirectories;
-    DirectoryComparator comp(request.size);
-    for (int i = 0; i < searchPaths.size(); i++)
-    {
-        int insertIndex = i + 1;
-        File iconDir(searchPaths[i]);
-        juce::Array<File> subDirectories
-                = iconDir.findChildFiles(File::findDirectories, false);
-        subDirectories.sort(comp);
-        for (const File& subDirectory : subDirectories)
+    String iconPath;
+    if (request.icon[0] == '/')
+    {
+        if (Assets::findAssetFile(request.icon).existsAsFile())
         {
-            File indexFile = subDirectory.getChildFile(indexFileName);
-            if (indexFile.existsAsFile())
-            {
-                continue;
-            }
-            searchPaths.insert(insertIndex, subDirectory.getFullPathName());
-            insertIndex++;
+            iconPath = request.icon;
         }
+        else
+        {
+            // Search for an icon matching the file name instead:
+            IconRequest nameRequest = request;
+            nameRequest.icon = request.icon.fromLastOccurrenceOf("/", false,
+                    false);
+            iconPath = getIconPath(nameRequest);
+        }
+    }
+    else
+    {
+        iconPath = getIconPath(request);
     }
+    if (iconPath.isEmpty())
+    {
+        return Image();
+    }
+
+    const int targetSize = request.size * juce::jmax(1, request.scale);
+    Image iconImg;
+    if (iconPath.endsWith(".svg") && targetSize > 0)
+    {
+        iconImg = Assets::loadSVGImage(iconPath, targetSize, targetSize);
+    }
+    else
+    {
+        iconImg = Assets::loadImageAsset(iconPath);
+    }
+
+    // Store oversized images at the requested size, so that cached images
+    // don't use more memory than needed and don't need to be scaled down
+    // every time they're drawn:
+    if (iconImg.isValid() && targetSize > 0
+            && (iconImg.getWidth() > targetSize
+                || iconImg.getHeight() > targetSize))
+    {
+        const int largestSide = juce::jmax(iconImg.getWidth(),
+                iconImg.getHeight());
+        iconImg = iconImg.rescaled(
+                juce::jmax(1, iconImg.getWidth() * targetSize / largestSide),
+                juce::jmax(1, iconImg.getHeight() * targetSize / largestSide));
+    }
+    return iconImg;
+}
 
-    for (const String& iconDir : searchPaths)
+
+// Passes all loaded icons to their request callbacks, skipping requests that
+// were cancelled.
+void Icon::ThreadResource::deliverLoadedIcons()
+{
+    std::vector<LoadedIcon> delivered;
+    delivered.swap(loadedIcons);
+    deliveryScheduled = false;
+    for (LoadedIcon& loadedIcon : delivered)
     {
-        static const juce::StringArray iconExtensions
-                = {".png", ".xpm", ".svg"};
-        for (const String& ext : iconExtensions)
+        auto requestIter = activeRequests.find(loadedIcon.requestID);
+        if (requestIter != activeRequests.end())
         {
-            String iconPath = iconDir + String("/") + request.icon + ext;
-            if (File(iconPath).existsAsFile())
-            {
-                return iconPath;
-            }
+            const std::function<void(juce::Image)> callback
+                    = requestIter->second.loadingCallback;
+            activeRequests.erase(requestIter);
+            callback(loadedIcon.image);
         }
     }
-    return String();
 }
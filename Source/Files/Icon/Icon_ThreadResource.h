@@ -8,9 +8,13 @@
 
 #include "SharedResource_Thread_Resource.h"
 #include "Icon_ThemeIndex.h"
+#include "Icon_ImageCache.h"
+#include "Icon_DirectoryIndex.h"
 #include "Icon_RequestID.h"
+#include "Util_WorkerPool.h"
 #include "JuceHeader.h"
 #include <map>
+#include <vector>
 
 namespace Icon { class ThreadResource; }
 
@@ -20,7 +24,10 @@ namespace Icon { class ThreadResource; }
  *
  *  The ThreadResource handles these requests asynchronously, searching the
  * user's selected icon theme directories for the closest icon matching the
- * request.
+ * request. Queued requests are handled in batches, with icon files found and
+ * loaded by several worker threads at once. Loaded icons are passed to their
+ * request callbacks on the message thread, with all icons loaded since the
+ * last update applied together.
  *
  *  This process uses the XDG Base Directory Specification, the user's .gtkrc
  * config file, and the icon themes' index.theme files to determine which
@@ -73,9 +80,38 @@ public:
      */
     RequestID addRequest(IconRequest request);
 
+    /**
+     * @brief  Gets the current size and activity counters of the loaded icon
+     *         image cache.
+     *
+     * @return  The image cache statistics.
+     */
+    ImageCache::Statistics getCacheStatistics() const;
+
 private:
     /**
-     * @brief  Asynchronously handles queued icon requests.
+     * @brief  Builds icon file indexes the first time the thread starts.
+     *
+     * @param lock  The thread's resource lock.
+     */
+    virtual void init(SharedResource::Thread::Lock& lock) override;
+
+    /**
+     * @brief  Indexes icon themes with cache files that went out of date,
+     *         and writes missing or outdated icon cache files while the
+     *         thread has no icon requests to handle.
+     *
+     *  Themes with current cache files keep using them to find icons, and
+     * are never indexed.
+     *
+     * @param lock  The thread's resource lock.
+     */
+    virtual void cleanup(SharedResource::Thread::Lock& lock) override;
+
+    /**
+     * @brief  Asynchronously handles a batch of queued icon requests.
+     *
+     * @param lock  The thread's resource lock.
      */
     virtual void runLoop(SharedResource::Thread::Lock& lock) override;
 
@@ -97,7 +133,7 @@ private:
      * @return         The full path of the best matching icon file, or the
      *                 empty string if no match is found.
      */
-    juce::String getIconPath(const IconRequest& request);
+    juce::String getIconPath(const IconRequest& request) const;
 
     /**
      * @brief  Searches icon directories for icon files not indexed by icon
@@ -108,20 +144,110 @@ private:
      * @return         The full path of the best matching icon file, or the
      *                 empty string if no match is found.
      */
-    juce::String getUnindexedIconPath(const IconRequest& request);
+    juce::String getUnindexedIconPath(const IconRequest& request) const;
+
+    /**
+     * @brief  Reads unthemed icon directories and icon themes without valid
+     *         cache files into file indexes.
+     */
+    void buildFileIndexes();
+
+    /**
+     * @brief  Updates all file indexes with any changes to indexed
+     *         directories.
+     *
+     * @return  Whether any indexed files or directories changed.
+     */
+    bool refreshFileIndexes();
+
+    /**
+     * @brief  Holds an icon request along with the image loaded for that
+     *         request.
+     */
+    struct LoadedIcon
+    {
+        // The request's ID:
+        RequestID requestID;
+        // The icon request:
+        IconRequest request;
+        // The loaded icon image, or a null image if loading failed:
+        juce::Image image;
+    };
+
+    /**
+     * @brief  Finds and loads icon images for a batch of requests, using
+     *         several worker threads.
+     *
+     *  This does not access any data that is changed outside of the icon
+     * thread, so it may run without holding the thread's resource lock.
+     *
+     * @param batch  A list of requests. Loaded images will be saved to each
+     *               LoadedIcon in this list.
+     */
+    void loadIconBatch(std::vector<LoadedIcon>& batch);
+
+    /**
+     * @brief  Finds and loads the icon image for a single request.
+     *
+     * @param request  An icon request.
+     *
+     * @return         The loaded image, no larger than the requested size, or
+     *                 a null image if no icon file was found.
+     */
+    juce::Image loadIconImage(const IconRequest& request) const;
+
+    /**
+     * @brief  Passes all loaded icons to their request callbacks, skipping
+     *         requests that were cancelled. This should only be called on the
+     *         message thread, while the resource is locked for writing.
+     */
+    void deliverLoadedIcons();
 
-    // All pending icon requests, mapped by ID so they can be cancelled.
+    /**
+     * @brief  Gets the image cache key used to store an icon request's image.
+     *
+     * @param request  An icon request with a trimmed icon name.
+     *
+     * @return         The request's image cache key.
+     */
+    static ImageCache::Key getCacheKey(const IconRequest& request);
+
+    // All queued icon requests, mapped by ID so they can be cancelled.
     std::map<RequestID, IconRequest> requestMap;
 
+    // Requests taken from the queue that haven't yet been passed their icons,
+    // mapped by ID so they can be cancelled:
+    std::map<RequestID, IconRequest> activeRequests;
+
+    // Loaded icons waiting to be passed to their callbacks:
+    std::vector<LoadedIcon> loadedIcons;
+
+    // Whether the message thread has been asked to deliver loaded icons:
+    bool deliveryScheduled = false;
+
     // Icon theme indexes used to load icons, in order of priority
     juce::OwnedArray<ThemeIndex> iconThemes;
 
     // Directories to search, in order, for icon themes and unthemed icons.
     juce::StringArray iconDirectories;
 
-    // Stores loaded icon names mapped to image objects to avoid having to
-    // repeatedly load icons:
-    juce::HashMap<juce::String, juce::Image> loadedImageCache;
+    // File indexes for unthemed icons in each icon directory, in order of
+    // priority:
+    juce::OwnedArray<DirectoryIndex> unthemedIndexes;
+
+    // Whether initial icon file indexes have been built:
+    bool filesIndexed = false;
+
+    // Stores recently loaded icon images to avoid having to repeatedly load
+    // icons:
+    ImageCache imageCache;
+
+    // Whether the image cache budget has been read from the configuration
+    // file:
+    bool cacheBudgetLoaded = false;
+
+    // Threads used to load each batch of icons:
+    Util::WorkerPool loadingPool;
 
     // Store the names of icons that couldn't be found, to avoid wasting time
     // searching for them more than once:
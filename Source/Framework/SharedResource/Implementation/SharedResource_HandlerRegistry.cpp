@@ -0,0 +1,125 @@
+#define SHARED_RESOURCE_IMPLEMENTATION
+#include "SharedResource_HandlerRegistry.h"
+#include "SharedResource_ReferenceInterface.h"
+#include <algorithm>
+
+// Adds a new Reference to the registry.
+void SharedResource::HandlerRegistry::addReference
+(ReferenceInterface* reference)
+{
+    const juce::ScopedLock listLock(registryLock);
+    for (auto& typeIter : typeLists)
+    {
+        typeIter.second.unsorted.push_back(reference);
+    }
+}
+
+
+// Removes a Reference from the registry and all of its handler type lists.
+void SharedResource::HandlerRegistry::removeReference
+(ReferenceInterface* reference)
+{
+    const juce::ScopedLock listLock(registryLock);
+    for (auto& typeIter : typeLists)
+    {
+        TypeList& typeList = typeIter.second;
+        typeList.handlers.erase(std::remove_if(typeList.handlers.begin(),
+                    typeList.handlers.end(),
+                    [reference](const SortedHandler& sorted)
+                    {
+                        return sorted.entry.reference == reference;
+                    }), typeList.handlers.end());
+        typeList.unsorted.erase(std::remove(typeList.unsorted.begin(),
+                    typeList.unsorted.end(), reference),
+                typeList.unsorted.end());
+        typeList.unmatched.erase(reference);
+    }
+}
+
+
+// Gets a handler from a handler type's list, adding all new or changed
+// Reference objects to that list if needed.
+bool SharedResource::HandlerRegistry::getHandler
+(const std::type_index& handlerType,
+        const HandlerCast& castReference,
+        const size_t index,
+        const juce::Array<ReferenceInterface*>& allReferences,
+        HandlerEntry& handlerEntry)
+{
+    const juce::ScopedLock listLock(registryLock);
+    auto typeIter = typeLists.find(handlerType);
+    if (typeIter == typeLists.end())
+    {
+        typeIter = typeLists.emplace(handlerType, TypeList()).first;
+        for (ReferenceInterface* reference : allReferences)
+        {
+            if (reference != nullptr)
+            {
+                typeIter->second.unsorted.push_back(reference);
+            }
+        }
+    }
+    TypeList& typeList = typeIter->second;
+    if (index == 0)
+    {
+        sortReferences(typeList, castReference);
+    }
+    if (index >= typeList.handlers.size())
+    {
+        return false;
+    }
+    SortedHandler& sorted = typeList.handlers[index];
+    const std::type_index dynamicType(typeid(*sorted.entry.reference));
+    if (dynamicType != sorted.dynamicType)
+    {
+        sorted.entry.handler = castReference(sorted.entry.reference);
+        sorted.dynamicType = dynamicType;
+    }
+    handlerEntry = sorted.entry;
+    return true;
+}
+
+
+// Sorts all unchecked or changed Reference objects into a handler type list.
+void SharedResource::HandlerRegistry::sortReferences(TypeList& typeList,
+        const HandlerCast& castReference)
+{
+    for (auto iter = typeList.unmatched.begin();
+            iter != typeList.unmatched.end();)
+    {
+        if (std::type_index(typeid(*iter->first)) == iter->second)
+        {
+            iter++;
+            continue;
+        }
+        typeList.unsorted.push_back(iter->first);
+        iter = typeList.unmatched.erase(iter);
+    }
+    for (auto iter = typeList.handlers.begin();
+            iter != typeList.handlers.end();)
+    {
+        if (iter->entry.handler != nullptr && std::type_index(
+                    typeid(*iter->entry.reference)) == iter->dynamicType)
+        {
+            iter++;
+            continue;
+        }
+        typeList.unsorted.push_back(iter->entry.reference);
+        iter = typeList.handlers.erase(iter);
+    }
+    for (ReferenceInterface* reference : typeList.unsorted)
+    {
+        void* handler = castReference(reference);
+        const std::type_index dynamicType(typeid(*reference));
+        if (handler != nullptr)
+        {
+            typeList.handlers.push_back(
+                    { { reference, handler }, dynamicType });
+        }
+        else
+        {
+            typeList.unmatched.emplace(reference, dynamicType);
+        }
+    }
+    typeList.unsorted.clear();
+}
@@ -0,0 +1,155 @@
+#ifndef SHARED_RESOURCE_IMPLEMENTATION
+    #error File included directly outside of SharedResource implementation.
+#endif
+#pragma once
+/**
+ * @file  SharedResource_HandlerRegistry.h
+ *
+ * @brief  Sorts a resource's Reference objects by the Handler interface types
+ *         the resource uses to notify them.
+ */
+
+#include "JuceHeader.h"
+#include <functional>
+#include <map>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace SharedResource { class HandlerRegistry; }
+namespace SharedResource { class ReferenceInterface; }
+
+/**
+ * @brief  Keeps a separate list of matching Reference objects for each
+ *         Handler interface type a resource acts on.
+ *
+ *  Each handler type's list is created the first time the resource acts on
+ * that type. After that, each Reference only needs to be checked against the
+ * handler type once, when it is first found after being added to the
+ * resource, instead of every time the resource acts on its handlers.
+ *
+ *  A Reference is added to the resource in its constructor, before the Handler
+ * subclass containing it is fully constructed, and removed in its destructor,
+ * after that subclass is partially destroyed. To make sure incomplete objects
+ * are never treated as the wrong type, the registry saves each Reference
+ * object's dynamic type when it is checked, and checks it again whenever that
+ * type changes.
+ *
+ *  HandlerRegistry functions are threadsafe, but callers must ensure that
+ * Reference objects are not destroyed while their handler pointers are in
+ * use.
+ */
+class SharedResource::HandlerRegistry
+{
+public:
+    /**
+     * @brief  Converts a Reference to a specific handler type.
+     *
+     *  This should return the address of the handler object, or nullptr if
+     * the Reference does not have the handler type.
+     */
+    typedef std::function<void*(ReferenceInterface*)> HandlerCast;
+
+    /**
+     * @brief  A Reference connected to the resource, and its address as a
+     *         specific handler type.
+     */
+    struct HandlerEntry
+    {
+        ReferenceInterface* reference;
+        void* handler;
+    };
+
+    HandlerRegistry() { }
+
+    virtual ~HandlerRegistry() { }
+
+    /**
+     * @brief  Adds a new Reference to the registry. The Reference will be
+     *         sorted into each handler type list the next time that list is
+     *         used.
+     *
+     * @param reference  A Reference that was just connected to the resource.
+     */
+    void addReference(ReferenceInterface* reference);
+
+    /**
+     * @brief  Removes a Reference from the registry and all of its handler
+     *         type lists.
+     *
+     * @param reference  A Reference being disconnected from the resource.
+     */
+    void removeReference(ReferenceInterface* reference);
+
+    /**
+     * @brief  Gets a handler from a handler type's list, adding all new or
+     *         changed Reference objects to that list if needed.
+     *
+     * @param handlerType     The type of handler to find.
+     *
+     * @param castReference   A function used to convert Reference objects to
+     *                        the handler type.
+     *
+     * @param index           The index of the handler within the list.
+     *
+     * @param allReferences   All References connected to the resource, used
+     *                        to create the handler type's list if necessary.
+     *
+     * @param handlerEntry    If the index is valid, the handler and its
+     *                        Reference will be copied here. The handler will
+     *                        be null if the Reference no longer has the handler
+     *                        type.
+     *
+     * @return                Whether the index was valid.
+     */
+    bool getHandler(const std::type_index& handlerType,
+            const HandlerCast& castReference,
+            const size_t index,
+            const juce::Array<ReferenceInterface*>& allReferences,
+            HandlerEntry& handlerEntry);
+
+private:
+    /**
+     * @brief  A Reference that had the handler type when it was last checked.
+     */
+    struct SortedHandler
+    {
+        HandlerEntry entry;
+        // The Reference object's dynamic type when it was last checked:
+        std::type_index dynamicType;
+    };
+
+    /**
+     * @brief  Holds all Reference objects sorted for one handler type.
+     */
+    struct TypeList
+    {
+        // All References that have the handler type:
+        std::vector<SortedHandler> handlers;
+        // References not yet checked against the handler type:
+        std::vector<ReferenceInterface*> unsorted;
+        // References that didn't have the handler type, mapped to their
+        // dynamic type when they were last checked:
+        std::unordered_map<ReferenceInterface*, std::type_index> unmatched;
+    };
+
+    /**
+     * @brief  Sorts all unchecked or changed Reference objects into a handler
+     *         type list.
+     *
+     * @param typeList       The handler type's list.
+     *
+     * @param castReference  The function used to convert Reference objects to
+     *                       the handler type.
+     */
+    static void sortReferences(TypeList& typeList,
+            const HandlerCast& castReference);
+
+    // Prevents concurrent access to the handler type lists:
+    juce::CriticalSection registryLock;
+
+    // Maps each handler type to its list:
+    std::map<std::type_index, TypeList> typeLists;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HandlerRegistry)
+};
@@ -26,31 +26,18 @@ SharedResource::Holder::~Holder()
 #ifdef JUCE_DEBUG
     // Test that all resources were properly destroyed. Claim all resource
     // locks for writing in case a resource is still being deleted.
-    for (int i = 0; i < resourceList.size(); i++)
+    for (auto& slotIter : resourceSlots)
     {
-        const juce::ScopedWriteLock resourceLock(*resourceLocks[i]);
-        if (resourceList[i] != nullptr)
+        const juce::ScopedWriteLock resourceLock(slotIter.second->lock);
+        if (slotIter.second->resource.load() != nullptr)
         {
-            juce::String resourceName = "[Missing ID!]";
-            for (auto iter : resourceIndices)
-            {
-                if (iter.second == i)
-                {
-                    resourceName = iter.first.toString();
-                    break;
-                }
-            }
-            DBG(dbgPrefix << __func__ << ": Resource " << resourceName
-                    << " was not destroyed!");
+            DBG(dbgPrefix << __func__ << ": Resource "
+                    << slotIter.first.toString() << " was not destroyed!");
             jassertfalse;
         }
     }
-    jassert(resourceIndices.size() == resourceList.size()
-            && resourceList.size() == resourceLocks.size());
 #endif
-    resourceIndices.clear();
-    resourceList.clear();
-    resourceLocks.clear();
+    resourceSlots.clear();
 }
 
 
@@ -69,11 +56,12 @@ SharedResource::Holder* SharedResource::Holder::getHolderInstance()
 // Deletes the holder instance if it is holding no valid Instance pointers.
 void SharedResource::Holder::clearIfEmpty()
 {
+    const juce::ScopedLock clearLock(holderLock);
     if (holderInstance != nullptr)
     {
-        for (Instance* resourceInstance : holderInstance->resourceList)
+        for (auto& slotIter : holderInstance->resourceSlots)
         {
-            if (resourceInstance != nullptr)
+            if (slotIter.second->resource.load() != nullptr)
             {
                 return;
             }
@@ -87,9 +75,7 @@ void SharedResource::Holder::clearIfEmpty()
 SharedResource::Instance* SharedResource::Holder::getResource
 (const juce::Identifier& resourceKey)
 {
-    const juce::ScopedLock resourceLock(holderLock);
-    const int resourceIndex = getResourceIndex(resourceKey);
-    return holderInstance->resourceList.getUnchecked(resourceIndex);
+    return getResourceSlot(resourceKey).resource.load();
 }
 
 
@@ -98,29 +84,26 @@ void SharedResource::Holder::setResource(const juce::Identifier& resourceKey,
         Instance* resource)
 {
     const juce::ScopedLock resourceLock(holderLock);
-    const int resourceIndex = getResourceIndex(resourceKey);
-    Holder* const holder = getHolderInstance();
+    ResourceSlot& resourceSlot = getResourceSlot(resourceKey);
 
 #ifdef JUCE_DEBUG
     // Make sure either a null resource is becoming non-null, or a
     // non-null resource is becoming null.
-    if (resource == nullptr
-            && holder->resourceList.getUnchecked(resourceIndex) == nullptr)
+    if (resource == nullptr && resourceSlot.resource.load() == nullptr)
     {
         DBG(dbgPrefix << __func__ << ": Error, setting resource "
                 << resourceKey.toString()
                 << " to null when it is already null!");
         jassertfalse;
     }
-    else if (resource != nullptr
-            && holder->resourceList.getUnchecked(resourceIndex) != nullptr)
+    else if (resource != nullptr && resourceSlot.resource.load() != nullptr)
     {
         DBG(dbgPrefix << __func__ << ": Error, setting new resource "
                 << resourceKey.toString() << " when it already exists!");
         jassertfalse;
     }
 #endif
-    holder->resourceList.set(resourceIndex, resource);
+    resourceSlot.resource.store(resource);
 }
 
 
@@ -128,32 +111,21 @@ void SharedResource::Holder::setResource(const juce::Identifier& resourceKey,
 const juce::ReadWriteLock&
 SharedResource::Holder::getResourceLock(const juce::Identifier& resourceKey)
 {
-    const juce::ScopedLock resourceLock(holderLock);
-    const int resourceIndex = getResourceIndex(resourceKey);
-    return *getHolderInstance()->resourceLocks[resourceIndex];
+    return getResourceSlot(resourceKey).lock;
 }
 
 
-// Gets the index where a resource and its lock are stored in the resourceList
-// and resourceLocks arrays.
-int SharedResource::Holder::getResourceIndex
+// Gets the slot holding a resource's Instance pointer and lock, creating the
+// slot if necessary.
+SharedResource::ResourceSlot& SharedResource::Holder::getResourceSlot
 (const juce::Identifier& resourceKey)
 {
-    if (getHolderInstance()->resourceIndices.count(resourceKey) == 0)
+    const juce::ScopedLock slotLock(holderLock);
+    std::unique_ptr<ResourceSlot>& resourceSlot
+            = getHolderInstance()->resourceSlots[resourceKey];
+    if (resourceSlot == nullptr)
     {
-        initResource(resourceKey);
+        resourceSlot.reset(new ResourceSlot);
     }
-    return getHolderInstance()->resourceIndices.at(resourceKey);
-}
-
-
-// Initializes a resource container, assigning it an index, creating its lock,
-// and setting the initial resource instance address as nullptr.
-void SharedResource::Holder::initResource(const juce::Identifier& resourceKey)
-{
-    Holder* const holder = getHolderInstance();
-    jassert(holder->resourceList.size() == holder->resourceLocks.size());
-    holder->resourceIndices[resourceKey] = holder->resourceList.size();
-    holder->resourceList.add(nullptr);
-    holder->resourceLocks.add(new juce::ReadWriteLock());
+    return *resourceSlot;
 }
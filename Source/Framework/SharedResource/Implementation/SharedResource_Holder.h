@@ -9,7 +9,9 @@
  */
 
 #include <map>
+#include <memory>
 #include "JuceHeader.h"
+#include "SharedResource_ResourceSlot.h"
 
 namespace SharedResource { class Holder; }
 namespace SharedResource { class Instance; }
@@ -18,6 +20,11 @@ namespace SharedResource { class Instance; }
  * @brief  Stores all resource Instance objects, creates their dedicated lock
  *         objects, and ensures resource initialization and destruction is
  *         threadsafe.
+ *
+ *  Each resource's Instance and lock are kept in a ResourceSlot. Finding a
+ * slot by its resource key requires the Holder's lock, so objects that access
+ * their resource repeatedly should find their slot once with getResourceSlot,
+ * and use that slot directly afterwards.
  */
 class SharedResource::Holder
 {
@@ -83,40 +90,22 @@ public:
     static const juce::ReadWriteLock& getResourceLock
     (const juce::Identifier& resourceKey);
 
-private:
     /**
-     * @brief  Gets the index where a resource and its lock are stored in the
-     *         resourceList and resourceLocks arrays.
-     *
-     *  If necessary, this will initialize the resource container, creating a
-     * new lock and assigning an index.
+     * @brief  Gets the slot holding a resource's Instance pointer and lock,
+     *         creating the slot if necessary.
      *
      * @param resourceKey  A unique key identifying a Resource subclass.
      *
-     * @return             The index needed to find the resource index and its
-     *                     lock.
+     * @return             The resource's slot. This remains valid until the
+     *                     Holder is destroyed, which cannot happen while any
+     *                     Reference to the resource exists.
      */
-    static int getResourceIndex(const juce::Identifier& resourceKey);
-
-    /**
-     * @brief  Initializes a resource container, assigning it an index,
-     *         creating its lock, and setting the initial resource instance
-     *         address as nullptr.
-     *
-     * @param resourceKey  A unique key identifying a Resource subclass.
-     */
-    static void initResource(const juce::Identifier& resourceKey);
+    static ResourceSlot& getResourceSlot(const juce::Identifier& resourceKey);
 
+private:
     // Prevents concurrent access to the containers holding resource data.
     static juce::CriticalSection holderLock;
 
-    // Maps each resource ID to the index where its Instance and lock
-    // are stored.
-    std::map<juce::Identifier, int> resourceIndices;
-
-    // Holds all resource instances.
-    juce::Array<Instance*> resourceList;
-
-    // Holds all resource locks.
-    juce::OwnedArray<juce::ReadWriteLock> resourceLocks;
+    // Maps each resource ID to the slot holding its Instance and lock.
+    std::map<juce::Identifier, std::unique_ptr<ResourceSlot>> resourceSlots;
 };
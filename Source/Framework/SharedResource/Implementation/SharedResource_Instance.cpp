@@ -1,7 +1,10 @@
 #define SHARED_RESOURCE_IMPLEMENTATION
 #include "SharedResource_Holder.h"
+#include "SharedResource_ResourceSlot.h"
 #include "SharedResource_Instance.h"
 #include "SharedResource_ReferenceInterface.h"
+#include "SharedResource_HandlerRegistry.h"
+#include <unordered_set>
 
 #ifdef JUCE_DEBUG
 // Print the full class name before all debug output:
@@ -10,7 +13,9 @@ static const constexpr char* dbgPrefix = "SharedResource::Instance::";
 
 // Creates the unique resource object instance.
 SharedResource::Instance::Instance
-(const juce::Identifier& resourceKey) : resourceKey(resourceKey)
+(const juce::Identifier& resourceKey) : resourceKey(resourceKey),
+resourceSlot(Holder::getResourceSlot(resourceKey)),
+handlerRegistry(new HandlerRegistry)
 {
     DBG(dbgPrefix << __func__ << ": Creating resource \""
             << resourceKey.toString() << "\"");
@@ -22,7 +27,7 @@ SharedResource::Instance::Instance
     // this, the reference list is created with an initial null reference,
     // which the creating Reference will replace.
     references.add(nullptr);
-    Holder::getHolderInstance()->setResource(resourceKey, this);
+    Holder::setResource(resourceKey, this);
 }
 
 
@@ -64,12 +69,10 @@ int SharedResource::Instance::getReferenceCount() const
 void SharedResource::Instance::foreachReference
 (std::function<void(ReferenceInterface*)> referenceAction)
 {
-    Holder* resourceHolder = Holder::getHolderInstance();
-    const juce::ReadWriteLock& resourceLock = resourceHolder->getResourceLock
-        (resourceKey);
+    const juce::ReadWriteLock& resourceLock = resourceSlot.lock;
     const juce::ScopedReadLock referenceListLock(resourceLock);
 
-    juce::Array<ReferenceInterface*> handledReferences;
+    std::unordered_set<ReferenceInterface*> handledReferences;
     int referencesHandled;
     do
     {
@@ -77,13 +80,14 @@ void SharedResource::Instance::foreachReference
         for (int i = 0; i < references.size(); i++)
         {
             ReferenceInterface* reference = references[i];
-            if (reference != nullptr && !handledReferences.contains(reference))
+            if (reference != nullptr
+                    && handledReferences.count(reference) == 0)
             {
                 const juce::ScopedLock referenceLock(reference->getLock());
                 resourceLock.exitRead();
                 referenceAction(reference);
                 resourceLock.enterRead();
-                handledReferences.add(reference);
+                handledReferences.insert(reference);
                 referencesHandled++;
             }
         }
@@ -91,3 +95,43 @@ void SharedResource::Instance::foreachReference
     while (referencesHandled > 0);
 }
 
+
+// Runs an arbitrary function once on each handler object of a specific type
+// connected to the resource.
+void SharedResource::Instance::foreachTypedReference
+(const std::type_index& handlerType,
+        const std::function<void*(ReferenceInterface*)> castReference,
+        const std::function<void(void*)> handlerAction)
+{
+    const juce::ReadWriteLock& resourceLock = resourceSlot.lock;
+    const juce::ScopedReadLock referenceListLock(resourceLock);
+
+    // One object may contain several References that are all handlers of the
+    // same type, so handlers are tracked instead of References:
+    std::unordered_set<void*> handled;
+    int handlersHandled;
+    do
+    {
+        // Handlers may be added or removed while the resource is unlocked to
+        // run the action, so keep searching until no unhandled handlers are
+        // found:
+        handlersHandled = 0;
+        HandlerRegistry::HandlerEntry entry;
+        for (size_t i = 0; handlerRegistry->getHandler(handlerType,
+                    castReference, i, references, entry); i++)
+        {
+            if (entry.handler != nullptr
+                    && handled.insert(entry.handler).second)
+            {
+                const juce::ScopedLock referenceLock(
+                        entry.reference->getLock());
+                resourceLock.exitRead();
+                handlerAction(entry.handler);
+                resourceLock.enterRead();
+                handlersHandled++;
+            }
+        }
+    }
+    while (handlersHandled > 0);
+}
+
@@ -7,9 +7,13 @@
  */
 
 #include "JuceHeader.h"
+#include <memory>
+#include <typeindex>
 
 namespace SharedResource { class Instance; }
 namespace SharedResource { class ReferenceInterface; }
+namespace SharedResource { class HandlerRegistry; }
+namespace SharedResource { struct ResourceSlot; }
 
 /**
  * @brief  The parent class of all Resource objects, used to manage the
@@ -71,9 +75,38 @@ private:
     void foreachReference
     (std::function<void(ReferenceInterface*)> referenceAction);
 
+    /**
+     * @brief  Runs an arbitrary function once on each handler object of a
+     *         specific type connected to the resource.
+     *
+     *  References are checked against each handler type when the type is
+     * first used, and then only when new References are added, so repeatedly
+     * acting on the same handler type doesn't need to check every Reference
+     * again.
+     *
+     * @param handlerType    The type of handler to act on.
+     *
+     * @param castReference  A function that returns the address of a Reference
+     *                       as the handler type, or nullptr if the Reference
+     *                       isn't a handler of that type.
+     *
+     * @param handlerAction  An action to run once for each distinct handler of
+     *                       the given type, passing in the address returned by
+     *                       castReference.
+     */
+    void foreachTypedReference(const std::type_index& handlerType,
+            const std::function<void*(ReferenceInterface*)> castReference,
+            const std::function<void(void*)> handlerAction);
+
     // The resource's unique key identifier.
     const juce::Identifier& resourceKey;
 
+    // The resource's Instance pointer and lock.
+    ResourceSlot& resourceSlot;
+
     // Tracks all reference object associated with the resource.
     juce::Array<ReferenceInterface*> references;
+
+    // Sorts References by the handler types the resource acts on.
+    std::unique_ptr<HandlerRegistry> handlerRegistry;
 };
@@ -1,15 +1,14 @@
 #define SHARED_RESOURCE_IMPLEMENTATION
 #include "SharedResource_LockedInstancePtr.h"
-#include "SharedResource_Holder.h"
+#include "SharedResource_ResourceSlot.h"
 
 // Initializes the resource pointer, locking the resource.
 SharedResource::LockedInstancePtr::LockedInstancePtr
-(const juce::Identifier& resourceKey, const LockType lockType) :
-resourceKey(resourceKey),
-lockType(lockType)
+(ResourceSlot& resourceSlot, const LockType lockType) :
+lockType(lockType),
+resourceSlot(resourceSlot)
 {
-    const juce::ReadWriteLock& resourceLock
-        = Holder::getHolderInstance()->getResourceLock(resourceKey);
+    const juce::ReadWriteLock& resourceLock = resourceSlot.lock;
     if (lockType == LockType::read)
     {
         resourceLock.enterRead();
@@ -35,8 +34,7 @@ void SharedResource::LockedInstancePtr::unlock()
 {
     if (locked)
     {
-        const juce::ReadWriteLock& resourceLock
-            = Holder::getHolderInstance()->getResourceLock(resourceKey);
+        const juce::ReadWriteLock& resourceLock = resourceSlot.lock;
         if (lockType == LockType::read)
         {
             resourceLock.exitRead();
@@ -63,7 +61,7 @@ SharedResource::LockedInstancePtr::getInstance() const
 {
     if (locked)
     {
-        return Holder::getHolderInstance()->getResource(resourceKey);
+        return resourceSlot.resource.load();
     }
     else
     {
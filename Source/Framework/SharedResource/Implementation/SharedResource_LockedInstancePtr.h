@@ -13,6 +13,7 @@ namespace SharedResource
 {
     class LockedInstancePtr;
     class Instance;
+    struct ResourceSlot;
     template<class ResourceType> class LockedPtr;
     namespace Modular
     {
@@ -43,13 +44,12 @@ private:
     /**
      * @brief  Initializes the instance pointer, locking the resource.
      *
-     * @param resourceKey  Identifies the resource Instance this pointer will
-     *                     access.
+     * @param resourceSlot  Holds the resource Instance this pointer will
+     *                      access, and the lock used to secure it.
      *
-     * @param lockType     The type of lock used to secure the resource.
+     * @param lockType      The type of lock used to secure the resource.
      */
-    LockedInstancePtr(const juce::Identifier& resourceKey,
-            const LockType lockType);
+    LockedInstancePtr(ResourceSlot& resourceSlot, const LockType lockType);
 
 public:
     /**
@@ -84,8 +84,8 @@ protected:
 private:
     // The type of resource lock the LockedInstancePtr maintains.
     const LockType lockType;
-    // Identifies the resource accessed by this LockedInstancePtr.
-    const juce::Identifier& resourceKey;
+    // Holds the resource and lock accessed by this LockedInstancePtr.
+    ResourceSlot& resourceSlot;
     // Stores if the resource is currently locked and may be accessed.
     bool locked = false;
 };
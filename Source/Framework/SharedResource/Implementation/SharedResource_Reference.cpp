@@ -1,7 +1,9 @@
 #define SHARED_RESOURCE_IMPLEMENTATION
 #include "SharedResource_Reference.h"
 #include "SharedResource_Holder.h"
+#include "SharedResource_ResourceSlot.h"
 #include "SharedResource_Instance.h"
+#include "SharedResource_HandlerRegistry.h"
 
 // Removes this Reference from its resource Instance object, destroying the
 // resource if no references to it remain.
@@ -13,6 +15,7 @@ SharedResource::Reference::~Reference()
         Instance* resourceInstance = getResourceInstance();
         jassert(resourceInstance != nullptr);
         resourceInstance->references.removeFirstMatchingValue(this);
+        resourceInstance->handlerRegistry->removeReference(this);
         if (resourceInstance->references.isEmpty())
         {
             Holder::setResource(resourceKey, nullptr);
@@ -28,7 +31,8 @@ SharedResource::Reference::~Reference()
 // object if necessary.
 SharedResource::Reference::Reference(const juce::Identifier& resourceKey,
         const std::function<Instance*()> createResource) :
-resourceKey(resourceKey)
+resourceKey(resourceKey),
+resourceSlot(Holder::getResourceSlot(resourceKey))
 {
     const juce::ScopedWriteLock initLock(getResourceLock());
     Instance* resourceInstance = getResourceInstance();
@@ -43,13 +47,21 @@ resourceKey(resourceKey)
     {
         resourceInstance->references.add(this);
     }
+    resourceInstance->handlerRegistry->addReference(this);
 }
 
 
 // Gets the lock used to control access to the referenced resource.
 const juce::ReadWriteLock& SharedResource::Reference::getResourceLock() const
 {
-    return Holder::getResourceLock(resourceKey);
+    return resourceSlot.lock;
+}
+
+
+// Gets the slot holding the referenced resource's Instance pointer and lock.
+SharedResource::ResourceSlot& SharedResource::Reference::getResourceSlot() const
+{
+    return resourceSlot;
 }
 
 
@@ -57,5 +69,5 @@ const juce::ReadWriteLock& SharedResource::Reference::getResourceLock() const
 SharedResource::Instance*
 SharedResource::Reference::getResourceInstance() const
 {
-    return Holder::getResource(resourceKey);
+    return resourceSlot.resource.load();
 }
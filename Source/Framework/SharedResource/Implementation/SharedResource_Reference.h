@@ -14,6 +14,7 @@ namespace SharedResource
 {
     class Reference;
     class Instance;
+    struct ResourceSlot;
 }
 
 /**
@@ -52,6 +53,18 @@ protected:
      */
     const juce::ReadWriteLock& getResourceLock() const;
 
+    /**
+     * @brief  Gets the slot holding the referenced resource's Instance pointer
+     *         and lock.
+     *
+     *  LockedPtr objects created by Handlers use this slot to lock and access
+     * their resource without searching for it through the Holder.
+     *
+     * @return  The resource's slot, which remains valid for as long as this
+     *          Reference exists.
+     */
+    ResourceSlot& getResourceSlot() const;
+
 private:
     /**
      * @brief  Gets a pointer to this reference's resource object Instance.
@@ -62,4 +75,7 @@ private:
 
     // The resource's unique key identifier.
     const juce::Identifier& resourceKey;
+
+    // The resource's Instance pointer and lock, found once on construction.
+    ResourceSlot& resourceSlot;
 };
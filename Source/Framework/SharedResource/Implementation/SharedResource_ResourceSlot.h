@@ -0,0 +1,35 @@
+#ifndef SHARED_RESOURCE_IMPLEMENTATION
+    #error File included directly outside of SharedResource implementation.
+#endif
+#pragma once
+/**
+ * @file  SharedResource_ResourceSlot.h
+ *
+ * @brief  Stores a single resource Instance pointer along with the lock used
+ *         to control access to that resource.
+ */
+
+#include "JuceHeader.h"
+#include <atomic>
+
+namespace SharedResource { struct ResourceSlot; }
+namespace SharedResource { class Instance; }
+
+/**
+ * @brief  Holds the Instance pointer and lock of a single resource.
+ *
+ *  The Holder creates exactly one ResourceSlot for each resource key. Slots
+ * are never moved or destroyed while the Holder exists, so Reference and
+ * LockedInstancePtr objects find their slot once and then access their
+ * resource and lock directly, without searching through the Holder or
+ * claiming the Holder's lock.
+ */
+struct SharedResource::ResourceSlot
+{
+    // The resource's Instance, or nullptr if it doesn't currently exist. This
+    // is only changed while the Holder is locked, but may be read at any time.
+    std::atomic<Instance*> resource { nullptr };
+
+    // The lock used to control access to the resource Instance.
+    juce::ReadWriteLock lock;
+};
@@ -48,7 +48,7 @@ protected:
     LockedPtr<ResourceType, const ModuleType> getReadLockedResource() const
     {
         return LockedPtr<ResourceType, const ModuleType>
-                (Handler::getResourceKey(), LockType::read);
+                (Handler::getResourceSlot(), LockType::read);
     }
 
     /**
@@ -60,6 +60,6 @@ protected:
     LockedPtr<ResourceType, ModuleType> getWriteLockedResource() const
     {
         return LockedPtr<ResourceType, ModuleType>
-                (Handler::getResourceKey(), LockType::write);
+                (Handler::getResourceSlot(), LockType::write);
     }
 };
@@ -38,13 +38,12 @@ private:
      * @brief  Locks the ResourceType resource for as long as the LockedPtr
      *         exists.
      *
-     * @param resourceKey  The unique key string identifying the ResourceType
-     *                     Resource class.
+     * @param resourceSlot  Holds the ResourceType resource and its lock.
      *
-     * @param lockType     The type of lock used to secure the resource.
+     * @param lockType      The type of lock used to secure the resource.
      */
-    LockedPtr(const juce::Identifier& resourceKey, const LockType lockType) :
-        LockedInstancePtr(resourceKey, lockType) { }
+    LockedPtr(ResourceSlot& resourceSlot, const LockType lockType) :
+        LockedInstancePtr(resourceSlot, lockType) { }
 
 public:
     virtual ~LockedPtr() { }
@@ -86,7 +86,7 @@ protected:
     template <class LockedType = ResourceType>
     LockedPtr<const LockedType> getReadLockedResource() const
     {
-        return LockedPtr<const LockedType> (resourceKey, LockType::read);
+        return LockedPtr<const LockedType>(getResourceSlot(), LockType::read);
     }
 
     /**
@@ -106,7 +106,7 @@ protected:
     template <class LockedType = ResourceType>
     LockedPtr<LockedType> getWriteLockedResource() const
     {
-        return LockedPtr<LockedType>(resourceKey, LockType::write);
+        return LockedPtr<LockedType>(getResourceSlot(), LockType::write);
     }
 
     /**
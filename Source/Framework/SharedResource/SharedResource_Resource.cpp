@@ -21,7 +21,8 @@ std::function<void()> SharedResource::Resource::buildAsyncFunction(
         Holder* resourceHolder = Holder::getHolderInstance();
         if (lockType == LockType::read)
         {
-            juce::ScopedReadLock(resourceHolder->getResourceLock(resKey));
+            const juce::ScopedReadLock asyncLock
+                    (resourceHolder->getResourceLock(resKey));
             if (this == resourceHolder->getResource(resKey))
             {
                 action();
@@ -30,7 +31,8 @@ std::function<void()> SharedResource::Resource::buildAsyncFunction(
         }
         else
         {
-            juce::ScopedWriteLock(resourceHolder->getResourceLock(resKey));
+            const juce::ScopedWriteLock asyncLock
+                    (resourceHolder->getResourceLock(resKey));
             if (this == resourceHolder->getResource(resKey))
             {
                 action();
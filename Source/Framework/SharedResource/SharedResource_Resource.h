@@ -61,6 +61,10 @@ protected:
      * @brief  Runs an arbitrary function on each Handler object with type
      *         HandlerType connected to the resource.
      *
+     *  Each Handler is only checked against HandlerType once after it is
+     * created, so acting on the same handler type repeatedly only visits
+     * handlers of that type.
+     *
      * @tparam HandlerType   The handlerAction will only run for Handlers that
      *                       have this type.
      *
@@ -73,20 +77,18 @@ protected:
     {
         // Through template shenanigans, it is possible for one object to
         // inherit from multiple Handler subclasses that are all connected to
-        // this resource. Tracking notified HandlerType* object here is
-        // necessary to prevent these objects from being acted upon multiple
-        // times.
-        juce::Array<HandlerType*> alreadyActedOn;
-        foreachReference([&handlerAction, &alreadyActedOn]
-                (ReferenceInterface* reference)
-        {
-            HandlerType* handler = dynamic_cast<HandlerType*>(reference);
-            if (handler != nullptr && !alreadyActedOn.contains(handler))
-            {
-                handlerAction(handler);
-                alreadyActedOn.add(handler);
-            }
-        });
+        // this resource. foreachTypedReference only acts once on each
+        // distinct HandlerType* address to prevent these objects from being
+        // acted upon multiple times.
+        foreachTypedReference(typeid(HandlerType),
+                [](ReferenceInterface* reference)->void*
+                {
+                    return dynamic_cast<HandlerType*>(reference);
+                },
+                [&handlerAction](void* handler)
+                {
+                    handlerAction(static_cast<HandlerType*>(handler));
+                });
     }
 
 private:
@@ -1,4 +1,5 @@
 #include "SharedResource_Thread_Thread.h"
+#include "SharedResource_Thread_ScopedReadLock.h"
 
 // Number of milliseconds to wait before forcibly terminating the thread:
 static const constexpr int timeoutMilliseconds = 5000;
@@ -106,7 +107,7 @@ void ThreadResource::Thread::run()
             signalThreadShouldExit();
         }
 
-        if (threadShouldWait() && !threadShouldExit())
+        if (shouldWaitForNotification())
         {
             DBG(dbgPrefix << __func__ << ": Thread \"" << getThreadName()
                     << "\" running cleanup before waiting.");
@@ -119,7 +120,13 @@ void ThreadResource::Thread::run()
             notify();
             bool resetThread = wait(-1);
             jassert(resetThread);
-            wait(-1);
+            // Clearing the saved notification also clears notifications sent
+            // after the last check, so check again before waiting. Any
+            // notification sent after this check will end the next wait.
+            if (shouldWaitForNotification())
+            {
+                wait(-1);
+            }
             DBG(dbgPrefix << __func__ << ": Thread \"" << getThreadName()
                     << "\" waking and re-initializing.");
             init(*threadLock);
@@ -176,6 +183,15 @@ void ThreadResource::Thread::run()
 }
 
 
+// Checks if the thread should wait for a notification before running the
+// action loop again.
+bool ThreadResource::Thread::shouldWaitForNotification()
+{
+    const ScopedReadLock waitCheckLock(*threadLock);
+    return threadShouldWait() && !threadShouldExit();
+}
+
+
 // Ensures the thread is stopped when the application starts to shut down.
 void ThreadResource::Thread::onShutdown()
 {
@@ -66,6 +66,7 @@ protected:
     using juce::Thread::signalThreadShouldExit;
     using juce::Thread::threadShouldExit;
     using juce::Thread::getThreadId;
+    using juce::Thread::wait;
 
     /**
      * @brief  Gets the Thread::Resource's resource key.
@@ -127,6 +128,19 @@ private:
      */
     virtual void run() final override;
 
+    /**
+     * @brief  Checks if the thread should wait for a notification before
+     *         running the action loop again.
+     *
+     *  The thread's resource is locked for reading while threadShouldWait is
+     * checked, so requests added while the resource is locked for writing are
+     * never missed.
+     *
+     * @return  Whether threadShouldWait returned true and the thread isn't
+     *          exiting.
+     */
+    bool shouldWaitForNotification();
+
     /**
      * @brief  Ensures the thread is stopped when the application starts to
      *         shut down.
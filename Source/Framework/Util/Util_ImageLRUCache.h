@@ -0,0 +1,225 @@
+#pragma once
+/**
+ * @file  Util_ImageLRUCache.h
+ *
+ * @brief  A template for image caches limited by total image size.
+ */
+
+#include "JuceHeader.h"
+#include <list>
+#include <map>
+
+namespace Util { template<class KeyType> class ImageLRUCache; }
+
+/**
+ * @brief  Caches images under unique keys, discarding the least recently used
+ *         images whenever the total size of all cached images exceeds a byte
+ *         budget.
+ *
+ *  Cached images are kept in a list ordered from most to least recently used,
+ * and a map of keys to list positions is used to find images and move them to
+ * the front of the list, so lookups, insertions, and evictions never need to
+ * search the list.
+ *
+ *  ImageLRUCache is not thread-safe. Because looking up an image updates its
+ * position in the cache's usage order, both lookups and insertions must be
+ * protected from concurrent access.
+ *
+ * @tparam KeyType  The type used to identify cached images. KeyType must be
+ *                  copyable and must define operator<.
+ */
+template<class KeyType>
+class Util::ImageLRUCache
+{
+public:
+    /**
+     * @brief  Describes the cache's current size and activity.
+     */
+    struct Statistics
+    {
+        // Number of lookups that found a cached image:
+        juce::int64 hits = 0;
+        // Number of lookups that didn't find a cached image:
+        juce::int64 misses = 0;
+        // Number of images removed to stay within the byte budget:
+        juce::int64 evictions = 0;
+        // Number of images currently cached:
+        int imageCount = 0;
+        // Total size in bytes of all cached images:
+        size_t cachedBytes = 0;
+        // Maximum total size in bytes of all cached images:
+        size_t byteBudget = 0;
+    };
+
+    /**
+     * @brief  Creates an empty image cache.
+     *
+     * @param byteBudget  The maximum total size in bytes of all cached images.
+     */
+    ImageLRUCache(const size_t byteBudget)
+    {
+        statistics.byteBudget = byteBudget;
+    }
+
+    virtual ~ImageLRUCache() { }
+
+    /**
+     * @brief  Finds a cached image, marking it as the most recently used
+     *         image.
+     *
+     * @param key  The image's cache key.
+     *
+     * @return     The cached image, or a null image if no image with that key
+     *             is cached.
+     */
+    juce::Image findImage(const KeyType& key)
+    {
+        auto searchIter = entryMap.find(key);
+        if (searchIter == entryMap.end())
+        {
+            statistics.misses++;
+            return juce::Image();
+        }
+        statistics.hits++;
+        usageOrder.splice(usageOrder.begin(), usageOrder, searchIter->second);
+        return searchIter->second->image;
+    }
+
+    /**
+     * @brief  Adds an image to the cache, removing the least recently used
+     *         images if necessary to keep the cache within its byte budget.
+     *
+     *  Images that are larger than the entire byte budget will not be cached.
+     *
+     * @param key    The image's cache key. Any image already saved with this
+     *               key will be replaced.
+     *
+     * @param image  A valid image to cache.
+     */
+    void addImage(const KeyType& key, const juce::Image& image)
+    {
+        jassert(image.isValid());
+        auto searchIter = entryMap.find(key);
+        if (searchIter != entryMap.end())
+        {
+            statistics.cachedBytes -= searchIter->second->bytes;
+            statistics.imageCount--;
+            usageOrder.erase(searchIter->second);
+            entryMap.erase(searchIter);
+        }
+        const size_t imageBytes = getImageBytes(image);
+        if (imageBytes > statistics.byteBudget)
+        {
+            return;
+        }
+        evictUntilWithin(statistics.byteBudget - imageBytes);
+        usageOrder.push_front({ key, image, imageBytes });
+        entryMap[key] = usageOrder.begin();
+        statistics.cachedBytes += imageBytes;
+        statistics.imageCount++;
+    }
+
+    /**
+     * @brief  Changes the cache's byte budget, removing images if necessary to
+     *         fit within the new budget.
+     *
+     * @param newBudget  The new maximum total size in bytes of all cached
+     *                   images.
+     */
+    void setByteBudget(const size_t newBudget)
+    {
+        statistics.byteBudget = newBudget;
+        evictUntilWithin(newBudget);
+    }
+
+    /**
+     * @brief  Removes all images from the cache.
+     */
+    void clear()
+    {
+        usageOrder.clear();
+        entryMap.clear();
+        statistics.cachedBytes = 0;
+        statistics.imageCount = 0;
+    }
+
+    /**
+     * @brief  Gets the cache's current size and activity counters.
+     *
+     * @return  The current cache statistics.
+     */
+    Statistics getStatistics() const
+    {
+        return statistics;
+    }
+
+    /**
+     * @brief  Finds the amount of memory used to store an image's pixel data.
+     *
+     * @param image  Any image object.
+     *
+     * @return       The image's approximate size in bytes.
+     */
+    static size_t getImageBytes(const juce::Image& image)
+    {
+        if (!image.isValid())
+        {
+            return 0;
+        }
+        size_t pixelBytes;
+        switch (image.getFormat())
+        {
+            case juce::Image::RGB:
+                pixelBytes = 3;
+                break;
+            case juce::Image::SingleChannel:
+                pixelBytes = 1;
+                break;
+            default:
+                pixelBytes = 4;
+        }
+        return (size_t) image.getWidth() * (size_t) image.getHeight()
+                * pixelBytes;
+    }
+
+private:
+    /**
+     * @brief  Removes least recently used images until the cache fits within
+     *         a byte limit.
+     *
+     * @param byteLimit  The maximum number of bytes to keep cached.
+     */
+    void evictUntilWithin(const size_t byteLimit)
+    {
+        while (statistics.cachedBytes > byteLimit && !usageOrder.empty())
+        {
+            const CacheEntry& oldest = usageOrder.back();
+            statistics.cachedBytes -= oldest.bytes;
+            statistics.imageCount--;
+            statistics.evictions++;
+            entryMap.erase(oldest.key);
+            usageOrder.pop_back();
+        }
+    }
+
+    /**
+     * @brief  Holds a cached image and its key.
+     */
+    struct CacheEntry
+    {
+        KeyType key;
+        juce::Image image;
+        size_t bytes;
+    };
+
+    // Cached images, ordered from most to least recently used:
+    std::list<CacheEntry> usageOrder;
+
+    // Maps cache keys to their entries in the usage order list:
+    std::map<KeyType, typename std::list<CacheEntry>::iterator> entryMap;
+
+    // Current cache size and activity:
+    Statistics statistics;
+
+    JUCE_DECLARE_NON_COPYABLE(ImageLRUCache)
+};
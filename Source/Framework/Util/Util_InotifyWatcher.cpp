@@ -0,0 +1,133 @@
+#include "Util_InotifyWatcher.h"
+#include <sys/inotify.h>
+#include <poll.h>
+#include <cerrno>
+#include <unistd.h>
+
+// Size of the buffer used to read inotify events:
+static const constexpr int eventBufferSize = 16 * 1024;
+
+// Closes the inotify file descriptor, removing all watches.
+Util::InotifyWatcher::~InotifyWatcher()
+{
+    close();
+}
+
+
+// Initializes a new inotify instance, closing any existing instance and its
+// watches.
+bool Util::InotifyWatcher::init()
+{
+    close();
+    inotifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    return inotifyFD >= 0;
+}
+
+
+// Checks if the watcher has an open inotify instance.
+bool Util::InotifyWatcher::isInitialized() const
+{
+    return inotifyFD >= 0;
+}
+
+
+// Closes the inotify file descriptor, removing all watches.
+void Util::InotifyWatcher::close()
+{
+    if (inotifyFD >= 0)
+    {
+        // Closing the inotify file descriptor also removes all of its
+        // watches:
+        ::close(inotifyFD);
+        inotifyFD = -1;
+    }
+}
+
+
+// Adds a watch to a file or directory.
+int Util::InotifyWatcher::addWatch
+(const juce::String& path, const juce::uint32 mask)
+{
+    if (inotifyFD < 0)
+    {
+        return -1;
+    }
+    return inotify_add_watch(inotifyFD, path.toRawUTF8(), mask);
+}
+
+
+// Removes a watch that hasn't already been removed by inotify.
+void Util::InotifyWatcher::removeWatch(const int watchDescriptor)
+{
+    if (inotifyFD >= 0 && watchDescriptor >= 0)
+    {
+        inotify_rm_watch(inotifyFD, watchDescriptor);
+    }
+}
+
+
+// Waits until events are available to read, the timeout period ends, or
+// polling fails.
+Util::InotifyWatcher::WaitResult Util::InotifyWatcher::waitForEvents
+(const int timeout)
+{
+    if (inotifyFD < 0)
+    {
+        return WaitResult::failed;
+    }
+    struct pollfd pollData;
+    pollData.fd = inotifyFD;
+    pollData.events = POLLIN;
+    pollData.revents = 0;
+    const int pollResult = poll(&pollData, 1, timeout);
+    if (pollResult > 0 && (pollData.revents & POLLIN))
+    {
+        return WaitResult::eventsReady;
+    }
+    // Error conditions are reported immediately on every poll, so they must
+    // be treated as failures to avoid polling again in a busy loop:
+    if ((pollResult < 0 && errno != EINTR)
+            || (pollResult > 0
+                && (pollData.revents & (POLLERR | POLLHUP | POLLNVAL))))
+    {
+        return WaitResult::failed;
+    }
+    return WaitResult::timedOut;
+}
+
+
+// Reads all available events without blocking.
+int Util::InotifyWatcher::readEvents
+(const std::function<void(const Event&)> eventHandler)
+{
+    if (inotifyFD < 0)
+    {
+        return 0;
+    }
+    int eventCount = 0;
+    alignas(struct inotify_event) char eventBuffer[eventBufferSize];
+    ssize_t bytesRead;
+    while ((bytesRead = read(inotifyFD, eventBuffer, eventBufferSize)) > 0)
+    {
+        for (char* eventPtr = eventBuffer; eventPtr < eventBuffer + bytesRead;
+                eventPtr += sizeof(struct inotify_event)
+                + ((struct inotify_event*) eventPtr)->len)
+        {
+            const struct inotify_event* rawEvent
+                    = (const struct inotify_event*) eventPtr;
+            Event event;
+            event.watchDescriptor = rawEvent->wd;
+            event.mask = rawEvent->mask;
+            if (rawEvent->len > 0)
+            {
+                event.name = juce::String::fromUTF8(rawEvent->name);
+            }
+            eventCount++;
+            if (eventHandler)
+            {
+                eventHandler(event);
+            }
+        }
+    }
+    return eventCount;
+}
@@ -0,0 +1,132 @@
+#pragma once
+/**
+ * @file  Util_InotifyWatcher.h
+ *
+ * @brief  Manages an inotify instance, and reads its file change events.
+ */
+
+#include "JuceHeader.h"
+#include <functional>
+
+namespace Util { class InotifyWatcher; }
+
+/**
+ * @brief  Owns a non-blocking inotify file descriptor and its watches, and
+ *         handles waiting for, reading, and decoding inotify events.
+ *
+ *  InotifyWatcher only reads raw events. Deciding which events are relevant,
+ * and when to act on them, is left to the objects that use it. Event masks
+ * passed to and from the InotifyWatcher are standard inotify masks from
+ * sys/inotify.h.
+ *
+ *  InotifyWatcher is not thread-safe. Watches should only be added, removed,
+ * or read by one thread at a time.
+ */
+class Util::InotifyWatcher
+{
+public:
+    /**
+     * @brief  Describes a single inotify event.
+     */
+    struct Event
+    {
+        // The watch descriptor of the watch that received the event, or -1
+        // for queue overflow events:
+        int watchDescriptor;
+        // The inotify event mask:
+        juce::uint32 mask;
+        // The name of the file within the watched directory that changed, or
+        // the empty string if the event applies to the watched file or
+        // directory itself:
+        juce::String name;
+    };
+
+    /**
+     * @brief  The results of waiting for new events.
+     */
+    enum class WaitResult
+    {
+        eventsReady,
+        timedOut,
+        failed
+    };
+
+    /**
+     * @brief  Creates the watcher without initializing inotify.
+     */
+    InotifyWatcher() { }
+
+    /**
+     * @brief  Closes the inotify file descriptor, removing all watches.
+     */
+    virtual ~InotifyWatcher();
+
+    /**
+     * @brief  Initializes a new inotify instance, closing any existing
+     *         instance and its watches.
+     *
+     * @return  Whether inotify was successfully initialized.
+     */
+    bool init();
+
+    /**
+     * @brief  Checks if the watcher has an open inotify instance.
+     *
+     * @return  Whether init succeeded and close hasn't been called since.
+     */
+    bool isInitialized() const;
+
+    /**
+     * @brief  Closes the inotify file descriptor, removing all watches.
+     */
+    void close();
+
+    /**
+     * @brief  Adds a watch to a file or directory.
+     *
+     * @param path  The full path of the file or directory to watch.
+     *
+     * @param mask  The inotify event mask to use for the watch.
+     *
+     * @return      The new watch descriptor, or -1 if the watch couldn't be
+     *              added.
+     */
+    int addWatch(const juce::String& path, const juce::uint32 mask);
+
+    /**
+     * @brief  Removes a watch that hasn't already been removed by inotify.
+     *
+     * @param watchDescriptor  A watch descriptor returned by addWatch.
+     */
+    void removeWatch(const int watchDescriptor);
+
+    /**
+     * @brief  Waits until events are available to read, the timeout period
+     *         ends, or polling fails.
+     *
+     * @param timeout  The maximum number of milliseconds to wait. If zero, the
+     *                 watcher only checks for events without waiting.
+     *
+     * @return         Whether events are available to read. If polling was
+     *                 interrupted by a signal, this returns timedOut. If
+     *                 polling fails or the inotify file descriptor reports an
+     *                 error, this returns failed.
+     */
+    WaitResult waitForEvents(const int timeout);
+
+    /**
+     * @brief  Reads all available events without blocking.
+     *
+     * @param eventHandler  A function to call with each event read, in the
+     *                      order they were received.
+     *
+     * @return              The number of events that were read.
+     */
+    int readEvents(const std::function<void(const Event&)> eventHandler);
+
+private:
+    // The inotify file descriptor, or -1 if inotify isn't initialized:
+    int inotifyFD = -1;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(InotifyWatcher)
+};
@@ -0,0 +1,114 @@
+#include "Util_WorkerPool.h"
+
+// Sets the maximum number of threads the pool may use.
+Util::WorkerPool::WorkerPool(const int maxThreads) :
+maxThreads((maxThreads > 0) ? maxThreads : juce::SystemStats::getNumCpus()),
+nextTask(0) { }
+
+
+// Stops and joins all worker threads.
+Util::WorkerPool::~WorkerPool()
+{
+    {
+        const std::lock_guard<std::mutex> poolLock(poolMutex);
+        stopWorkers = true;
+    }
+    tasksAdded.notify_all();
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+
+// Runs a set of tasks, waiting until all tasks have finished.
+void Util::WorkerPool::runTasks(const int taskCount,
+        const std::function<void(const int)> task)
+{
+    const std::lock_guard<std::mutex> runLock(runMutex);
+    const int threadCount = getThreadCount(taskCount);
+    if (threadCount <= 1)
+    {
+        for (int i = 0; i < taskCount; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+    {
+        const std::lock_guard<std::mutex> poolLock(poolMutex);
+        while ((int) workers.size() < threadCount - 1)
+        {
+            workers.emplace_back([this]() { workerLoop(); });
+        }
+        currentTask = &task;
+        currentTaskCount = taskCount;
+        nextTask = 0;
+        taskSetNumber++;
+    }
+    tasksAdded.notify_all();
+    runClaimedTasks(task, taskCount);
+
+    // Every task is claimed, but workers may still be running their last
+    // tasks:
+    std::unique_lock<std::mutex> poolLock(poolMutex);
+    workersIdle.wait(poolLock, [this]() { return activeWorkers == 0; });
+    // Workers that wake up late must not find the finished task function:
+    currentTask = nullptr;
+    currentTaskCount = 0;
+}
+
+
+// Gets the number of threads that will be used to run a set of tasks.
+int Util::WorkerPool::getThreadCount(const int taskCount) const
+{
+    return juce::jmax(1, juce::jmin(maxThreads, taskCount));
+}
+
+
+// Waits for new sets of tasks, and helps run them, until the pool is
+// destroyed.
+void Util::WorkerPool::workerLoop()
+{
+    juce::uint64 lastTaskSet = 0;
+    std::unique_lock<std::mutex> poolLock(poolMutex);
+    while (true)
+    {
+        tasksAdded.wait(poolLock, [this, &lastTaskSet]()
+        {
+            return stopWorkers || taskSetNumber != lastTaskSet;
+        });
+        if (stopWorkers)
+        {
+            return;
+        }
+        lastTaskSet = taskSetNumber;
+        if (currentTask == nullptr)
+        {
+            continue;
+        }
+        const std::function<void(const int)>& task = *currentTask;
+        const int taskCount = currentTaskCount;
+        activeWorkers++;
+        poolLock.unlock();
+        runClaimedTasks(task, taskCount);
+        poolLock.lock();
+        activeWorkers--;
+        if (activeWorkers == 0)
+        {
+            workersIdle.notify_all();
+        }
+    }
+}
+
+
+// Runs unclaimed tasks until every task in the current set has been claimed.
+void Util::WorkerPool::runClaimedTasks
+(const std::function<void(const int)>& task, const int taskCount)
+{
+    int taskNum;
+    while ((taskNum = nextTask++) < taskCount)
+    {
+        task(taskNum);
+    }
+}
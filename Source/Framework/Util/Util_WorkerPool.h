@@ -0,0 +1,133 @@
+#pragma once
+/**
+ * @file  Util_WorkerPool.h
+ *
+ * @brief  Runs sets of independent tasks in parallel on a group of reusable
+ *         worker threads.
+ */
+
+#include "JuceHeader.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Util { class WorkerPool; }
+
+/**
+ * @brief  Splits numbered tasks between a bounded group of worker threads,
+ *         waiting until every task is finished.
+ *
+ *  Each thread claims the next unstarted task number until all tasks are
+ * claimed, so slow tasks don't leave other threads idle. The thread calling
+ * runTasks also runs tasks while the workers run, and only returns once every
+ * task has finished.
+ *
+ *  Worker threads are created the first time they're needed, and then wait
+ * for more tasks until the WorkerPool is destroyed. Objects that repeatedly
+ * run small sets of tasks should keep a WorkerPool instead of creating a new
+ * one for each set.
+ *
+ *  Tasks must not throw exceptions. Several threads may call runTasks at
+ * once, but each set of tasks will run only after all earlier sets have
+ * finished.
+ */
+class Util::WorkerPool
+{
+public:
+    /**
+     * @brief  Sets the maximum number of threads the pool may use.
+     *
+     * @param maxThreads  The maximum number of threads, including the calling
+     *                    thread, that may run tasks at once. If this value is
+     *                    less than one, the number of CPU cores will be used.
+     */
+    WorkerPool(const int maxThreads = 0);
+
+    /**
+     * @brief  Stops and joins all worker threads.
+     */
+    virtual ~WorkerPool();
+
+    /**
+     * @brief  Runs a set of tasks, waiting until all tasks have finished.
+     *
+     * @param taskCount  The number of tasks to run.
+     *
+     * @param task       A function to call once with each task number between
+     *                   zero and taskCount - 1. Each call may run on a
+     *                   different thread.
+     */
+    void runTasks(const int taskCount,
+            const std::function<void(const int)> task);
+
+    /**
+     * @brief  Gets the number of threads that will be used to run a set of
+     *         tasks.
+     *
+     * @param taskCount  The number of tasks to run.
+     *
+     * @return           The number of threads that would run those tasks,
+     *                   including the calling thread.
+     */
+    int getThreadCount(const int taskCount) const;
+
+private:
+    /**
+     * @brief  Waits for new sets of tasks, and helps run them, until the pool
+     *         is destroyed.
+     */
+    void workerLoop();
+
+    /**
+     * @brief  Runs unclaimed tasks until every task in the current set has
+     *         been claimed.
+     *
+     * @param task       The function used to run each task.
+     *
+     * @param taskCount  The number of tasks in the current set.
+     */
+    void runClaimedTasks(const std::function<void(const int)>& task,
+            const int taskCount);
+
+    // The maximum number of threads used to run tasks:
+    const int maxThreads;
+
+    // Only allows one set of tasks to run at once:
+    std::mutex runMutex;
+
+    // Protects all data shared with worker threads:
+    std::mutex poolMutex;
+
+    // Wakes workers when new tasks are added, or when the pool is destroyed:
+    std::condition_variable tasksAdded;
+
+    // Wakes the thread running tasks when all workers are idle:
+    std::condition_variable workersIdle;
+
+    // All worker threads:
+    std::vector<std::thread> workers;
+
+    // The function running the current set of tasks, or nullptr if no tasks
+    // are running:
+    const std::function<void(const int)>* currentTask = nullptr;
+
+    // The number of tasks in the current set:
+    int currentTaskCount = 0;
+
+    // The next unclaimed task number:
+    std::atomic<int> nextTask;
+
+    // Counts each set of tasks, so workers can tell when new tasks are added:
+    juce::uint64 taskSetNumber = 0;
+
+    // The number of workers currently running tasks:
+    int activeWorkers = 0;
+
+    // Whether workers should exit:
+    bool stopWorkers = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WorkerPool)
+};
@@ -1,6 +1,7 @@
 #define APPMENU_IMPLEMENTATION
 #include "AppMenu.h"
 #include "AppMenu_MainComponent.h"
+#include "AppMenu_SearchComponent.h"
 
 // Creates an AppMenu::MainComponent, initialized with the menu format saved
 // through AppMenu::Settings.
@@ -8,3 +9,25 @@ juce::Component* AppMenu::createAppMenu()
 {
     return new MainComponent();
 }
+
+
+// Creates an AppMenu::SearchComponent, used to find and launch applications by
+// name or description.
+juce::Component* AppMenu::createSearchComponent()
+{
+    return new SearchComponent();
+}
+
+
+// Sets the search text of a component created with createSearchComponent.
+void AppMenu::setSearchText(juce::Component* searchComponent,
+        const juce::String& searchText)
+{
+    SearchComponent* appSearch = dynamic_cast<SearchComponent*>
+            (searchComponent);
+    jassert(appSearch != nullptr);
+    if (appSearch != nullptr)
+    {
+        appSearch->setSearchText(searchText);
+    }
+}
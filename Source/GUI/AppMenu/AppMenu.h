@@ -2,8 +2,8 @@
 /**
  * @file  AppMenu.h
  *
- * @brief  Creates the AppMenu application menu component, and returns it as a
- *         generic juce::Component pointer.
+ * @brief  Creates the AppMenu application menu and application search
+ *         components, and returns them as generic juce::Component pointers.
  */
 
 #include "JuceHeader.h"
@@ -12,8 +12,9 @@
  * @brief  Provides the interface used outside the AppMenu to create application
  *         menu objects.
  *
- *  The application menu is returned as a generic juce::Component pointer, and
- * can be treated like any other Component.
+ *  The application menu and application search components are returned as
+ * generic juce::Component pointers, and can be treated like any other
+ * Component.
  */
 namespace AppMenu
 {
@@ -25,4 +26,23 @@ namespace AppMenu
      *          AppMenu::MainComponent.
      */
     juce::Component* createAppMenu();
+
+    /**
+     * @brief  Creates an AppMenu::SearchComponent, used to find and launch
+     *         applications by name or description.
+     *
+     * @return  A pointer to a newly allocated AppMenu::SearchComponent.
+     */
+    juce::Component* createSearchComponent();
+
+    /**
+     * @brief  Sets the search text of a component created with
+     *         createSearchComponent.
+     *
+     * @param searchComponent  A search component created by the AppMenu.
+     *
+     * @param searchText       The new search text to apply.
+     */
+    void setSearchText(juce::Component* searchComponent,
+            const juce::String& searchText);
 }
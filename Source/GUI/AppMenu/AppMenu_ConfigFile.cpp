@@ -100,3 +100,35 @@ int AppMenu::ConfigFile::getLaunchTimeoutPeriod()
 {
     return std::max(1, getConfigValue<int>(ConfigKeys::timeoutPeriod));
 }
+
+
+// Checks if desktop entry menu items should be ordered by how often they are
+// launched.
+bool AppMenu::ConfigFile::getSortByUsage()
+{
+    return getConfigValue<bool>(ConfigKeys::sortByUsage);
+}
+
+
+// Sets whether desktop entry menu items should be ordered by how often they
+// are launched.
+void AppMenu::ConfigFile::setSortByUsage(const bool sortByUsage)
+{
+    setConfigValue<bool>(ConfigKeys::sortByUsage, sortByUsage);
+}
+
+
+// Gets the folder category used to select folders that hold the most frequently
+// launched applications.
+juce::String AppMenu::ConfigFile::getFrequentCategory()
+{
+    return getConfigValue<juce::String>(ConfigKeys::frequentCategory);
+}
+
+
+// Gets the maximum number of applications added to folders that hold the most
+// frequently launched applications.
+int AppMenu::ConfigFile::getFrequentAppCount()
+{
+    return std::max(0, getConfigValue<int>(ConfigKeys::frequentAppCount));
+}
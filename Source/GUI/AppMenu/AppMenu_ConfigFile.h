@@ -123,6 +123,45 @@ public:
      */
     int getLaunchTimeoutPeriod();
 
+    /**
+     * @brief  Checks if desktop entry menu items should be ordered by how
+     *         often they are launched.
+     *
+     * @return  Whether desktop entry items are sorted by launch frequency, or
+     *          false if they are sorted by title.
+     */
+    bool getSortByUsage();
+
+    /**
+     * @brief  Sets whether desktop entry menu items should be ordered by how
+     *         often they are launched.
+     *
+     *  Changes take effect the next time desktop entries are loaded into the
+     * menu.
+     *
+     * @param sortByUsage  Whether desktop entry items will be sorted by launch
+     *                     frequency instead of by title.
+     */
+    void setSortByUsage(const bool sortByUsage);
+
+    /**
+     * @brief  Gets the folder category used to select folders that hold the
+     *         most frequently launched applications.
+     *
+     * @return  The frequent application category, or the empty string if no
+     *          folders should hold frequently launched applications.
+     */
+    juce::String getFrequentCategory();
+
+    /**
+     * @brief  Gets the maximum number of applications added to folders that
+     *         hold the most frequently launched applications.
+     *
+     * @return  The maximum frequent application count. This value will never
+     *          be less than zero.
+     */
+    int getFrequentAppCount();
+
     // Listens for changes to AppMenu::MenuFile's basic data values
     class Listener : public Config::Listener<ConfigJSON>
     {
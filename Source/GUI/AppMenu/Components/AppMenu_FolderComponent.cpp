@@ -18,26 +18,19 @@ folderItem(folderItem)
 }
 
 
-// Creates, adds, and shows the folder's menu buttons if they have not yet been
-// initialized.
+// Allows the folder to create, add, and show menu buttons for its visible menu
+// items.
 void AppMenu::FolderComponent::initMenuItems()
 {
-    const int itemCount = folderItem.getFolderSize();
-    for (int i = 0; i < itemCount; i++)
-    {
-        MenuItem buttonItem = folderItem.getFolderItem(i);
-        jassert(!buttonItem.isNull());
-        MenuButton* newButton = createMenuButton(buttonItem);
-        folderButtons.add(newButton);
-        addAndMakeVisible(newButton);
-    }
+    buttonsInitialized = true;
+    updateButtonLayout();
 }
 
 
 // Gets the number of menu items in this folder.
 int AppMenu::FolderComponent::getFolderSize() const
 {
-    return folderButtons.size();
+    return folderItem.getFolderSize();
 }
 
 
@@ -51,11 +44,11 @@ AppMenu::MenuItem AppMenu::FolderComponent::getFolderMenuItem() const
 // Gets the current selected folder item.
 AppMenu::MenuItem AppMenu::FolderComponent::getSelectedItem() const
 {
-    if (selectedIndex < 0 || selectedIndex > folderButtons.size())
+    if (selectedIndex < 0 || selectedIndex >= getFolderSize())
     {
         return MenuItem();
     }
-    return folderButtons[selectedIndex]->getMenuItem();
+    return folderItem.getFolderItem(selectedIndex);
 }
 
 
@@ -73,14 +66,19 @@ void AppMenu::FolderComponent::setSelectedIndex(const int newSelection)
     {
         return;
     }
-    if (selectedIndex >= 0 && selectedIndex < folderButtons.size())
+    MenuButton* lastSelected = getButtonComponent(selectedIndex);
+    if (lastSelected != nullptr)
     {
-        getButtonComponent(selectedIndex)->setSelected(false);
+        lastSelected->setSelected(false);
     }
-    if (newSelection >= 0 && newSelection < folderButtons.size())
+    if (newSelection >= 0 && newSelection < getFolderSize())
     {
         selectedIndex = newSelection;
-        getButtonComponent(selectedIndex)->setSelected(true);
+        MenuButton* newSelected = getButtonComponent(selectedIndex);
+        if (newSelected != nullptr)
+        {
+            newSelected->setSelected(true);
+        }
     }
     else
     {
@@ -93,56 +91,109 @@ void AppMenu::FolderComponent::setSelectedIndex(const int newSelection)
 AppMenu::MenuButton*
 AppMenu::FolderComponent::getButtonComponent(const int index) const
 {
-    if (index < 0 || index >= folderButtons.size())
+    auto buttonIter = boundButtons.find(index);
+    if (buttonIter == boundButtons.end())
     {
         return nullptr;
     }
-    return folderButtons[index];
+    return buttonIter->second;
 }
 
 
-// Creates and inserts a new ItemButton when a new child menu button is created.
-void AppMenu::FolderComponent::childAdded(const int childIndex)
+// Gets the part of the folder that is currently visible within its parent
+// component.
+juce::Rectangle<int> AppMenu::FolderComponent::getVisibleArea() const
 {
-    MenuItem newChild = folderItem.getFolderItem(childIndex);
-    folderButtons.insert(childIndex, createMenuButton(newChild));
-    addAndMakeVisible(folderButtons[childIndex]);
-    if (selectedIndex >= childIndex)
-    {
-        selectedIndex++;
-    }
-    // Trigger the parent's resized() function to force a layout update
     juce::Component* parent = getParentComponent();
-    if (parent != nullptr)
+    if (parent == nullptr)
     {
-        parent->resized();
+        return juce::Rectangle<int>();
     }
+    return getLocalArea(parent, parent->getLocalBounds())
+            .getIntersection(getLocalBounds());
 }
 
 
-// Removes the corresponding ItemButton when a child menu item is removed.
-void AppMenu::FolderComponent::childRemoved(const int removedIndex)
+// Makes sure that exactly the menu items within an index range have button
+// components.
+void AppMenu::FolderComponent::bindButtons(const juce::Range<int> indexRange)
 {
-    removeChildComponent(folderButtons[removedIndex]);
-    folderButtons.remove(removedIndex);
-    if (removedIndex == folderButtons.size())
+    boundRange = limitIndexRange(indexRange);
+    for (auto buttonIter = boundButtons.begin();
+            buttonIter != boundButtons.end();)
     {
-        setSelectedIndex(selectedIndex - 1);
+        if (boundRange.contains(buttonIter->first))
+        {
+            buttonIter++;
+            continue;
+        }
+        buttonIter->second->setVisible(false);
+        unusedButtons.push_back(buttonIter->second);
+        buttonIter = boundButtons.erase(buttonIter);
     }
-    else if (selectedIndex == removedIndex)
+    for (int i = boundRange.getStart(); i < boundRange.getEnd(); i++)
     {
-        getButtonComponent(selectedIndex)->setSelected(true);
+        if (boundButtons.count(i) > 0)
+        {
+            continue;
+        }
+        MenuItem buttonItem = folderItem.getFolderItem(i);
+        jassert(!buttonItem.isNull());
+        MenuButton* button;
+        if (unusedButtons.empty())
+        {
+            button = createMenuButton(buttonItem);
+            buttonPool.add(button);
+            addChildComponent(button);
+        }
+        else
+        {
+            button = unusedButtons.back();
+            unusedButtons.pop_back();
+            button->setMenuItem(buttonItem);
+        }
+        button->setSelected(i == selectedIndex);
+        button->setVisible(true);
+        boundButtons[i] = button;
     }
-    else if (selectedIndex > removedIndex)
+}
+
+
+// Limits a range of menu item indices to the indices that may currently have
+// buttons.
+juce::Range<int> AppMenu::FolderComponent::limitIndexRange
+(const juce::Range<int> indexRange) const
+{
+    if (!buttonsInitialized)
     {
-        selectedIndex--;
+        return juce::Range<int>();
     }
-    // Trigger the parent's resized() function to force a layout update
-    juce::Component* parent = getParentComponent();
-    if (parent != nullptr)
+    return indexRange.getIntersectionWith(juce::Range<int>(0,
+                getFolderSize()));
+}
+
+
+// Creates and inserts a new ItemButton when a new child menu button is created.
+void AppMenu::FolderComponent::childAdded(const int childIndex)
+{
+    if (selectedIndex >= childIndex)
     {
-        parent->resized();
+        selectedIndex++;
+    }
+    folderItemAdded(childIndex);
+    refreshFolderItems();
+}
+
+
+// Removes the corresponding ItemButton when a child menu item is removed.
+void AppMenu::FolderComponent::childRemoved(const int removedIndex)
+{
+    if (selectedIndex > removedIndex || selectedIndex >= getFolderSize())
+    {
+        selectedIndex--;
     }
+    folderItemRemoved(removedIndex);
+    refreshFolderItems();
 }
 
 
@@ -151,11 +202,6 @@ void AppMenu::FolderComponent::childRemoved(const int removedIndex)
 void AppMenu::FolderComponent::childrenSwapped
 (const int swapIndex1, const int swapIndex2)
 {
-    juce::Rectangle<int> firstBounds = folderButtons[swapIndex1]->getBounds();
-    folderButtons[swapIndex1]->setBounds
-        (folderButtons[swapIndex2]->getBounds());
-    folderButtons[swapIndex2]->setBounds(firstBounds);
-    folderButtons.swap(swapIndex1, swapIndex2);
     if (selectedIndex == swapIndex1)
     {
         selectedIndex = swapIndex2;
@@ -164,6 +210,30 @@ void AppMenu::FolderComponent::childrenSwapped
     {
         selectedIndex = swapIndex1;
     }
+    folderItemsSwapped(swapIndex1, swapIndex2);
+    refreshFolderItems();
+}
+
+
+// Unbinds all buttons and updates the folder layout after the folder's child
+// menu items change.
+void AppMenu::FolderComponent::refreshFolderItems()
+{
+    // Menu item indices changed, so every button needs to be bound again:
+    for (auto& buttonPair : boundButtons)
+    {
+        buttonPair.second->setVisible(false);
+        unusedButtons.push_back(buttonPair.second);
+    }
+    boundButtons.clear();
+    boundRange = juce::Range<int>();
+    updateButtonLayout();
+    // Trigger the parent's resized() function to force a layout update
+    juce::Component* parent = getParentComponent();
+    if (parent != nullptr)
+    {
+        parent->resized();
+    }
 }
 
 
@@ -172,3 +242,14 @@ void AppMenu::FolderComponent::resized()
 {
     updateButtonLayout();
 }
+
+
+// Updates which menu items have buttons when the folder moves, if the range of
+// menu items that should have buttons changed.
+void AppMenu::FolderComponent::moved()
+{
+    if (limitIndexRange(getBoundIndexRange()) != boundRange)
+    {
+        updateButtonLayout();
+    }
+}
@@ -11,21 +11,31 @@
 
 #include "AppMenu_MenuButton.h"
 #include "AppMenu_MenuItem.h"
+#include <map>
+#include <vector>
 
 namespace AppMenu { class FolderComponent; }
 
 /**
- * @brief  Creates and displays MenuButton components for each item in a menu
- *         folder.
+ * @brief  Creates and displays MenuButton components for the visible items in
+ *         a menu folder.
  *
  *  The FolderComponent is assigned a folder MenuItem on construction. It is
- * responsible for creating MenuButton components for each of that MenuItem's
- * child menu items, holding those MenuButtons as child components, and setting
- * how they are arranged within its bounds. It listens for changes to its
+ * responsible for creating MenuButton components for that MenuItem's child
+ * menu items, holding those MenuButtons as child components, and setting how
+ * they are arranged within its bounds. It listens for changes to its
  * MenuItem, updating its child items whenever its menu data changes. It also
- * tracks which one of its MenuButtons, if any, is currently selected by the
+ * tracks which one of its menu items, if any, is currently selected by the
  * user.
  *
+ *  Folders may hold hundreds of menu items, but only a few of them fit within
+ * the menu bounds at once. FolderComponent only creates MenuButtons for menu
+ * items within or near the visible part of the folder. When the folder moves
+ * or changes size, buttons that are no longer needed are hidden and kept in a
+ * pool, and are reused for newly visible menu items. The number of MenuButtons
+ * a folder holds depends only on how many fit on the screen, not on the size
+ * of the folder.
+ *
  *  FolderComponent is an abstract base class. Each AppMenu Format should have
  * a FolderComponent implementation that defines how that format arranges menu
  * buttons within its folders.
@@ -44,15 +54,15 @@ public:
     virtual ~FolderComponent() { }
 
     /**
-     * @brief  Creates, adds, and shows the folder's menu buttons if they have
-     *         not yet been initialized.
+     * @brief  Allows the folder to create, add, and show menu buttons for its
+     *         visible menu items.
      */
     void initMenuItems();
 
     /**
      * @brief  Gets the number of menu items in this folder.
      *
-     * @return  The number of MenuButton child components this folder holds.
+     * @return  The number of child menu items in the folder's MenuItem.
      */
     int getFolderSize() const;
 
@@ -103,7 +113,8 @@ public:
     virtual int closestIndex(const int xPos, const int yPos) const = 0;
 
     /**
-     * @brief  Updates the sizes and positions of all buttons in the menu.
+     * @brief  Updates which menu items have buttons, and the sizes and
+     *         positions of all buttons in the menu.
      */
     virtual void updateButtonLayout() = 0;
 
@@ -113,11 +124,62 @@ public:
      * @param index  The index of one of this folder's child menu items.
      *
      * @return       The MenuButton representing that menu item, or nullptr if
-     *               the index is out of bounds.
+     *               the index is out of bounds or the menu item is not near
+     *               the visible part of the folder.
      */
     MenuButton* getButtonComponent(const int index) const;
 
+protected:
+    /**
+     * @brief  Gets the part of the folder that is currently visible within
+     *         its parent component.
+     *
+     * @return  The visible area, relative to the folder's bounds.
+     */
+    juce::Rectangle<int> getVisibleArea() const;
+
+    /**
+     * @brief  Finds the range of menu item indices that should have button
+     *         components, based on the part of the folder that is currently
+     *         visible.
+     *
+     * @return  The indices of all visible menu items, along with any nearby
+     *          menu items that should have buttons ready before they become
+     *          visible. This range does not need to be limited to the folder's
+     *          actual index range.
+     */
+    virtual juce::Range<int> getBoundIndexRange() const = 0;
+
+    /**
+     * @brief  Makes sure that exactly the menu items within an index range
+     *         have button components.
+     *
+     *  Buttons outside of the range are hidden and saved for reuse. Each menu
+     * item in the range without a button is given a saved button, or a new
+     * button if no saved buttons are available. FolderComponent
+     * implementations should call this with the range returned by
+     * getBoundIndexRange at the start of updateButtonLayout, before positioning
+     * the buttons in the range.
+     *
+     * @param indexRange  The range of menu item indices that should have
+     *                    buttons. This will be limited to the folder's
+     *                    actual index range.
+     */
+    void bindButtons(const juce::Range<int> indexRange);
+
 private:
+    /**
+     * @brief  Limits a range of menu item indices to the indices that may
+     *         currently have buttons.
+     *
+     * @param indexRange  A range of menu item indices.
+     *
+     * @return            The part of the range within the folder's index
+     *                    range, or an empty range if buttons may not be
+     *                    created yet.
+     */
+    juce::Range<int> limitIndexRange(const juce::Range<int> indexRange) const;
+
     /**
      * @brief  Creates a button component for one of the folder's child menu
      *         items.
@@ -156,13 +218,72 @@ private:
     virtual void childrenSwapped(const int swapIndex1, const int swapIndex2)
         final override;
 
+    /**
+     * @brief  Runs after a menu item is added to the folder, before the button
+     *         layout is updated.
+     *
+     *  FolderComponent implementations may override this and the other folder
+     * item change functions to update any cached values that depend on the
+     * folder's menu items.
+     *
+     * @param childIndex  The index of the new menu item.
+     */
+    virtual void folderItemAdded(const int childIndex) { }
+
+    /**
+     * @brief  Runs after a menu item is removed from the folder, before the
+     *         button layout is updated.
+     *
+     * @param removedIndex  The former index of the removed menu item.
+     */
+    virtual void folderItemRemoved(const int removedIndex) { }
+
+    /**
+     * @brief  Runs after two of the folder's menu items are swapped, before
+     *         the button layout is updated.
+     *
+     * @param swapIndex1  The index of the first swapped menu item.
+     *
+     * @param swapIndex2  The index of the second swapped menu item.
+     */
+    virtual void folderItemsSwapped(const int swapIndex1,
+            const int swapIndex2) { }
+
+    /**
+     * @brief  Unbinds all buttons and updates the folder layout after the
+     *         folder's child menu items change.
+     */
+    void refreshFolderItems();
+
     /**
      * @brief  Recalculates menu button layout when the folder bounds change.
      */
     virtual void resized() override;
 
-    // Holds the button components representing the menu's child folder items.
-    juce::OwnedArray<MenuButton> folderButtons;
+    /**
+     * @brief  Updates which menu items have buttons when the folder moves, if
+     *         the range of menu items that should have buttons changed.
+     *
+     *  The folder moves on every frame of menu animations, but the button
+     * layout within the folder doesn't depend on the folder's position, so
+     * buttons are only rebound when a new range of menu items is visible.
+     */
+    virtual void moved() override;
+
+    // Holds every button component created by this folder.
+    juce::OwnedArray<MenuButton> buttonPool;
+
+    // Hidden buttons waiting to be reused:
+    std::vector<MenuButton*> unusedButtons;
+
+    // Buttons currently showing menu items, mapped by menu item index:
+    std::map<int, MenuButton*> boundButtons;
+
+    // The range of menu item indices that currently have buttons:
+    juce::Range<int> boundRange;
+
+    // Whether the folder may create menu buttons:
+    bool buttonsInitialized = false;
 
     // The current selected button index.
     int selectedIndex = -1;
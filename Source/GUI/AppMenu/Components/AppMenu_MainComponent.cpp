@@ -1,6 +1,7 @@
 #define APPMENU_IMPLEMENTATION
 #include "AppMenu_MainComponent.h"
 #include "AppMenu_ConfigKeys.h"
+#include "AppMenu_EntryActions.h"
 #include "AppMenu_Paged_Initializer.h"
 #include "AppMenu_Scrolling_Initializer.h"
 
@@ -9,6 +10,9 @@
 static const constexpr char* dbgPrefix = "AppMenu::MainComponent::";
 #endif
 
+// Number of frequently launched applications with icons loaded in advance:
+static const constexpr int prewarmedIconCount = 8;
+
 // Creates and initializes the application menu.
 AppMenu::MainComponent::MainComponent() :
 formatUpdater(this)
@@ -50,6 +54,7 @@ void AppMenu::MainComponent::loadMenuFormat(const Initializer* initializer)
     if (!getBounds().isEmpty())
     {
         menuComponent->parentResized(getLocalBounds());
+        prewarmFrequentIcons();
     }
 }
 
@@ -75,11 +80,61 @@ void AppMenu::MainComponent::resized()
     if (menuComponent != nullptr)
     {
         menuComponent->parentResized(getLocalBounds());
+        prewarmFrequentIcons();
     }
     loadingSpinner.setBounds(getLocalBounds());
 }
 
 
+// Loads the icons of the most frequently launched menu items into the icon
+// cache, if this hasn't already been done.
+void AppMenu::MainComponent::prewarmFrequentIcons()
+{
+    if (iconsPrewarmed || menuComponent == nullptr)
+    {
+        return;
+    }
+    const FolderComponent* rootFolder = menuComponent->getOpenFolder(0);
+    const MenuButton* firstButton = (rootFolder == nullptr)
+            ? nullptr : rootFolder->getButtonComponent(0);
+    if (firstButton == nullptr || firstButton->getIconSize() <= 0)
+    {
+        return;
+    }
+    iconsPrewarmed = true;
+    const int iconSize = firstButton->getIconSize();
+    const juce::StringArray mostUsed
+            = usageTracker.getMostUsed(prewarmedIconCount);
+    if (mostUsed.isEmpty())
+    {
+        return;
+    }
+    juce::StringArray iconNames;
+    EntryActions::recursiveFolderAction(menuConfig.getRootFolderItem(),
+    [&mostUsed, &iconNames](MenuItem folder)
+    {
+        for (int i = 0; i < folder.getFolderSize(); i++)
+        {
+            const MenuItem menuItem = folder.getFolderItem(i);
+            if (!menuItem.isFolder()
+                    && mostUsed.contains(menuItem.getLaunchCommand()))
+            {
+                iconNames.addIfNotAlreadyThere(menuItem.getIconName());
+            }
+        }
+    });
+    DBG(dbgPrefix << __func__ << ": Loading " << iconNames.size()
+            << " frequently used icons at size " << iconSize);
+    // Loaded icons are kept in the icon cache, so they don't need to be used
+    // here:
+    Icon::Loader prewarmLoader;
+    for (const juce::String& iconName : iconNames)
+    {
+        prewarmLoader.loadIcon(iconName, iconSize, [](juce::Image) { });
+    }
+}
+
+
 // Initializes the updater, tracking the format key and saving a pointer to the
 // MainComponent it updates.
 AppMenu::MainComponent::FormatUpdater::FormatUpdater
@@ -14,8 +14,10 @@
 #include "AppMenu_MenuComponent.h"
 #include "AppMenu_EntryUpdater.h"
 #include "AppMenu_MenuFile.h"
+#include "AppMenu_Searcher.h"
 #include "AppMenu_Controller.h"
 #include "Widgets_OverlaySpinner.h"
+#include "Process_UsageTracker.h"
 #include "Icon_Loader.h"
 #include "JuceHeader.h"
 
@@ -32,7 +34,9 @@ namespace AppMenu { class Initializer; }
  *
  *  The MainComponent's main responsibility is to initialize the menu component
  * in a particular AppMenu format, and automatically update the menu whenever a
- * new menu format is selected.
+ * new menu format is selected. Once the menu has been laid out, it also loads
+ * the icons of the most frequently launched applications at the menu's icon
+ * size, so they are cached before their folders are opened.
  */
 class AppMenu::MainComponent : public juce::Component
 {
@@ -66,6 +70,15 @@ private:
      */
     virtual void resized() final override;
 
+    /**
+     * @brief  Loads the icons of the most frequently launched menu items into
+     *         the icon cache, if this hasn't already been done.
+     *
+     *  Icons are loaded at the size used by the menu's buttons, so this does
+     * nothing until the menu has buttons with valid icon bounds.
+     */
+    void prewarmFrequentIcons();
+
     /**
      * @brief  Private listener class that updates the menu format whenever the
      *         saved format selection changes.
@@ -113,9 +126,19 @@ private:
     // Ensures JSON menu data stays in memory as long as the AppMenu does.
     MenuFile menuConfig;
 
+    // Keeps the application search index loaded and updated as long as the
+    // AppMenu exists, so searches never need to wait for it to be rebuilt.
+    Searcher menuSearcher;
+
     // Ensures the icon cache exists as long as the AppMenu does.
     const Icon::Loader iconLoader;
 
+    // Keeps application usage statistics loaded as long as the AppMenu exists.
+    const Process::UsageTracker usageTracker;
+
+    // Whether frequently launched application icons were loaded:
+    bool iconsPrewarmed = false;
+
     // The menu's loading spinner.
     Widgets::OverlaySpinner loadingSpinner;
 
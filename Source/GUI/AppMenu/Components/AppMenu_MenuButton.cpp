@@ -25,12 +25,7 @@ juce::Button(menuItem.getTitle())
 // Cancels any pending icon loading callback.
 AppMenu::MenuButton::~MenuButton()
 {
-    if (iconCallbackID != 0)
-    {
-        Icon::Loader iconLoader;
-        iconLoader.cancelImageRequest(iconCallbackID);
-        iconCallbackID = 0;
-    }
+    cancelIconRequest();
 }
 
 
@@ -56,6 +51,24 @@ AppMenu::MenuItem AppMenu::MenuButton::getMenuItem() const
 }
 
 
+// Reuses this button to represent a different menu item.
+void AppMenu::MenuButton::setMenuItem(MenuItem newItem)
+{
+    cancelIconRequest();
+    menuItem = newItem;
+    selected = false;
+    icon = juce::Image();
+    setButtonText(menuItem.getTitle());
+    if (!getLocalBounds().isEmpty())
+    {
+        updateTitleBounds();
+        updateFont();
+        loadIcon();
+    }
+    repaint();
+}
+
+
 // Gets the width of the button's title string.
 int AppMenu::MenuButton::getTitleWidth() const
 {
@@ -63,6 +76,24 @@ int AppMenu::MenuButton::getTitleWidth() const
 }
 
 
+// Gets the size used when loading the button's icon.
+int AppMenu::MenuButton::getIconSize() const
+{
+    return iconBounds.toNearestInt().getWidth();
+}
+
+
+// Gets the width a menu title needs when drawn with the default title font,
+// without creating a button.
+int AppMenu::MenuButton::findDefaultTitleWidth(const juce::String& title)
+{
+    Layout::Component::ConfigFile config;
+    const juce::Font defaultFont(config.getFontHeight(
+                Layout::Component::TextSize::smallText));
+    return defaultFont.getStringWidth(title + titleBuffer);
+}
+
+
 // Updates the component if necessary whenever its menu data changes.
 void AppMenu::MenuButton::dataChanged(MenuItem::DataField changedField)
 {
@@ -131,7 +162,7 @@ void AppMenu::MenuButton::loadIcon()
         Icon::Loader iconLoader;
         iconCallbackID = iconLoader.loadIcon(
                 getMenuItem().getIconName(),
-                iconBounds.toNearestInt().getWidth(),
+                getIconSize(),
                 [this](Image iconImg)
                 {
                     iconCallbackID = 0;
@@ -142,6 +173,18 @@ void AppMenu::MenuButton::loadIcon()
 }
 
 
+// Cancels the pending icon request, if any.
+void AppMenu::MenuButton::cancelIconRequest()
+{
+    if (iconCallbackID != 0)
+    {
+        Icon::Loader iconLoader;
+        iconLoader.cancelImageRequest(iconCallbackID);
+        iconCallbackID = 0;
+    }
+}
+
+
 // Calls AppMenu::MenuButton::menuButtonResized() and re-calculates title and
 // icon layout whenever the button's bounds change.
 void AppMenu::MenuButton::resized()
@@ -78,10 +78,21 @@ public:
     /**
      * @brief  Gets the MenuItem that defines this button.
      *
-     * @return  The MenuItem used to create the MenuButton.
+     * @return  The MenuItem used to create the MenuButton, or the last
+     *          MenuItem assigned to it with setMenuItem.
      */
     MenuItem getMenuItem() const;
 
+    /**
+     * @brief  Reuses this button to represent a different menu item.
+     *
+     *  Any pending icon request is cancelled, the button is deselected, and
+     * the new item's title layout and icon are loaded.
+     *
+     * @param newItem  The button's new menu data source.
+     */
+    void setMenuItem(MenuItem newItem);
+
     /**
      * @brief  Gets the width of the button's title string.
      *
@@ -91,6 +102,25 @@ public:
      */
     int getTitleWidth() const;
 
+    /**
+     * @brief  Gets the size used when loading the button's icon.
+     *
+     * @return  The width in pixels of the button's icon bounds, or zero if the
+     *          button has no icon bounds.
+     */
+    int getIconSize() const;
+
+    /**
+     * @brief  Gets the width a menu title needs when drawn with the default
+     *         title font, without creating a button.
+     *
+     * @param title  A menu item title.
+     *
+     * @return       The number of horizontal pixels needed to print the title
+     *               and its padding with the default title font.
+     */
+    static int findDefaultTitleWidth(const juce::String& title);
+
     /**
      * @brief  Updates the component if necessary whenever its menu data
      *         changes.
@@ -198,6 +228,11 @@ private:
      */
     void loadIcon();
 
+    /**
+     * @brief  Cancels the pending icon request, if any.
+     */
+    void cancelIconRequest();
+
     /**
      * @brief  Runs whenever the menu button is resized, just before
      *         recalculating icon bounds, text bounds, and font size.
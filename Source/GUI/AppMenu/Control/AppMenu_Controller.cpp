@@ -5,7 +5,6 @@
 #include "AppMenu_NewDesktopAppEditor.h"
 #include "AppMenu_MenuFile.h"
 #include "AppMenu_ConfigFile.h"
-#include "Config_MainFile.h"
 #include "Windows_Alert.h"
 
 #ifdef JUCE_DEBUG
@@ -247,14 +246,7 @@ void AppMenu::Controller::handleContextMenuAction(OptionCode selectedOption,
 // Launches or focuses an application from the menu.
 void AppMenu::Controller::launchOrFocusApplication(MenuItem toLaunch)
 {
-    using juce::String;
-    String command = toLaunch.getCommand();
-    if (toLaunch.getLaunchedInTerm())
-    {
-        Config::MainFile mainConfig;
-        String termPrefix = mainConfig.getTermLaunchPrefix();
-        command = termPrefix + " " + command;
-    }
+    const juce::String command = toLaunch.getLaunchCommand();
     const juce::String loadingText = localeText(TextKey::launchingAPP)
             + " " + toLaunch.getTitle();
     setLoadingState(true, loadingText);
@@ -350,7 +342,12 @@ void AppMenu::Controller::createExistingItemEditor(MenuItem toEdit)
                     = menuComponent->getOpenFolder(folderIndex);
             MenuButton* editedButton
                     = folder->getButtonComponent(toEdit.getIndex());
-            editedButton->dataChanged(MenuItem::DataField::icon);
+            // Buttons are only created for visible menu items, and load
+            // their current icon when created:
+            if (editedButton != nullptr)
+            {
+                editedButton->dataChanged(MenuItem::DataField::icon);
+            }
         }
         menuComponent->removeEditor();
     });
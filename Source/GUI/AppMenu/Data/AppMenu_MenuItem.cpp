@@ -1,5 +1,6 @@
 #define APPMENU_IMPLEMENTATION
 #include "AppMenu_MenuItem.h"
+#include "Config_MainFile.h"
 
 // Creates a menu item from some source of menu data.
 AppMenu::MenuItem::MenuItem(ItemData::Ptr dataSource) :
@@ -55,6 +56,19 @@ bool AppMenu::MenuItem::getLaunchedInTerm() const
 }
 
 
+// Gets the full command used to launch this menu item's application.
+juce::String AppMenu::MenuItem::getLaunchCommand() const
+{
+    const juce::String command = getCommand();
+    if (command.isEmpty() || !getLaunchedInTerm())
+    {
+        return command;
+    }
+    Config::MainFile mainConfig;
+    return mainConfig.getTermLaunchPrefix() + " " + command;
+}
+
+
 // Gets all application categories associated with this menu item.
 juce::StringArray AppMenu::MenuItem::getCategories() const
 {
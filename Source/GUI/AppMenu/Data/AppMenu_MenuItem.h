@@ -84,6 +84,16 @@ public:
      */
     bool getLaunchedInTerm() const;
 
+    /**
+     * @brief  Gets the full command used to launch this menu item's
+     *         application.
+     *
+     * @return  The menu item's launch command, with the terminal launch prefix
+     *          added if the application launches in a terminal window, or the
+     *          empty string if the menu item doesn't launch an application.
+     */
+    juce::String getLaunchCommand() const;
+
     /**
      * @brief  Gets all application categories associated with this menu item.
      *
@@ -2,7 +2,60 @@
 #include "AppMenu_EntryActions.h"
 #include "AppMenu_EntryData.h"
 #include "AppMenu_MenuItem.h"
+#include "AppMenu_ConfigFile.h"
 #include "DesktopEntry_EntryFile.h"
+#include "DesktopEntry_CategoryIndex.h"
+#include <map>
+#include <set>
+
+// Reads menu options and launch frequency data.
+AppMenu::EntryActions::UsageData::UsageData()
+{
+    ConfigFile menuConfig;
+    sortByUsage = menuConfig.getSortByUsage();
+    frequentCategory = menuConfig.getFrequentCategory();
+    const int frequentAppCount = menuConfig.getFrequentAppCount();
+    if (frequentCategory.isNotEmpty() && frequentAppCount > 0)
+    {
+        mostUsed = usageTracker.getMostUsed(frequentAppCount);
+    }
+}
+
+
+// Checks if a folder holds the most frequently launched applications.
+bool AppMenu::EntryActions::UsageData::isFrequentFolder
+(const MenuItem folder) const
+{
+    return frequentCategory.isNotEmpty()
+            && folder.getCategories().contains(frequentCategory);
+}
+
+
+// Checks if desktop entry menu items in a folder should be ordered by launch
+// frequency before title.
+bool AppMenu::EntryActions::UsageData::shouldSortByUsage
+(const MenuItem folder) const
+{
+    return sortByUsage || isFrequentFolder(folder);
+}
+
+
+// Checks if a desktop entry is one of the most frequently launched
+// applications.
+bool AppMenu::EntryActions::UsageData::isFrequentlyUsed
+(const DesktopEntry::EntryFile& entry) const
+{
+    return mostUsed.contains(entry.getLaunchCommand());
+}
+
+
+// Gets the launch score of a desktop entry menu item.
+double AppMenu::EntryActions::UsageData::getLaunchScore
+(const MenuItem& entryItem) const
+{
+    return usageTracker.getLaunchScore(entryItem.getLaunchCommand());
+}
+
 
 // Recursively applies a function to a menu folder and all its subfolders.
 void AppMenu::EntryActions::recursiveFolderAction(
@@ -26,6 +79,8 @@ void AppMenu::EntryActions::recursiveFolderAction(
 void AppMenu::EntryActions::foreachMatchingEntry(
         MenuItem folder,
         const juce::Array<DesktopEntry::EntryFile>& entries,
+        const DesktopEntry::CategoryIndex& categoryIndex,
+        const UsageData& usageData,
         std::function<void(const DesktopEntry::EntryFile&)> entryAction)
 {
     juce::StringArray folderCategories = folder.getCategories();
@@ -34,46 +89,94 @@ void AppMenu::EntryActions::foreachMatchingEntry(
         return;
     }
 
-    // TODO: hardcoding this in at this level is sloppy, find a better option
-    if (folderCategories.contains("All"))
+    if (usageData.isFrequentFolder(folder))
     {
         for (const DesktopEntry::EntryFile& entry : entries)
         {
-            if (!entry.isMissingData())
+            if (!entry.isMissingData() && usageData.isFrequentlyUsed(entry))
             {
                 entryAction(entry);
             }
         }
         return;
     }
-
-    for (const DesktopEntry::EntryFile& entry : entries)
+    if (folderCategories.contains("All"))
     {
-        if (entry.isMissingData())
-        {
-            continue;
-        }
-        juce::StringArray entryCategories = entry.getCategories();
-        for (const juce::String& category : entryCategories)
+        for (const DesktopEntry::EntryFile& entry : entries)
         {
-            if (folderCategories.contains(category))
+            if (!entry.isMissingData())
             {
                 entryAction(entry);
-                break;
             }
         }
+        return;
+    }
+
+    const std::vector<int> matchingEntries
+            = categoryIndex.findEntriesInAny(folderCategories);
+    for (const int entryNumber : matchingEntries)
+    {
+        jassert(entryNumber < entries.size());
+        const DesktopEntry::EntryFile& entry
+                = entries.getReference(entryNumber);
+        if (!entry.isMissingData())
+        {
+            entryAction(entry);
+        }
     }
 }
 
+namespace
+{
 /**
- * @brief  An anonymous class used to sort desktop entry menu items by title,
- *         ignoring case.
+ * @brief  Sorts desktop entry menu items by title ignoring case, or by launch
+ *         frequency and then by title.
  */
-static class
+class EntryItemComparator
 {
 public:
+    /**
+     * @brief  Prepares to sort a folder's desktop entry menu items.
+     *
+     * @param folder      The folder holding the sorted menu items.
+     *
+     * @param entryItems  All menu items that will be sorted. If sorting by
+     *                    launch frequency, launch scores are found for each of
+     *                    these items.
+     *
+     * @param usageData   Usage data and menu options read when the entries
+     *                    were loaded.
+     */
+    EntryItemComparator(const AppMenu::MenuItem folder,
+            const juce::Array<AppMenu::MenuItem>& entryItems,
+            const AppMenu::EntryActions::UsageData& usageData) :
+    sortByUsage(usageData.shouldSortByUsage(folder))
+    {
+        if (!sortByUsage)
+        {
+            return;
+        }
+        for (const AppMenu::MenuItem& entryItem : entryItems)
+        {
+            const double score = usageData.getLaunchScore(entryItem);
+            if (score > 0)
+            {
+                launchScores[entryItem.getID()] = score;
+            }
+        }
+    }
+
     int compareElements(AppMenu::MenuItem first, AppMenu::MenuItem second)
     {
+        if (sortByUsage)
+        {
+            const double firstScore = getScore(first);
+            const double secondScore = getScore(second);
+            if (firstScore != secondScore)
+            {
+                return (firstScore > secondScore) ? -1 : 1;
+            }
+        }
         juce::String firstTitle = first.getTitle().toUpperCase();
         juce::String secondTitle = second.getTitle().toUpperCase();
         if (firstTitle == secondTitle)
@@ -82,27 +185,54 @@ public:
         }
         return (firstTitle < secondTitle) ? -1 : 1;
     }
-} entryItemComparator;
+
+private:
+    /**
+     * @brief  Gets the launch score found for a sorted menu item.
+     *
+     * @param entryItem  One of the sorted menu items.
+     *
+     * @return           The item's launch score, or zero if it was never
+     *                   launched.
+     */
+    double getScore(const AppMenu::MenuItem& entryItem) const
+    {
+        auto searchIter = launchScores.find(entryItem.getID());
+        return (searchIter == launchScores.end()) ? 0 : searchIter->second;
+    }
+
+    // Whether items are sorted by launch frequency before title:
+    const bool sortByUsage;
+
+    // Launch scores of all sorted items that were launched before, mapped by
+    // desktop file ID:
+    std::map<juce::String, double> launchScores;
+};
+} // Close anonymous namespace
 
 // Adds folder items created from desktop entry files to a folder if the folder
 // and the entry share application categories.
 void AppMenu::EntryActions::addEntryItems(MenuItem folder,
-        const juce::Array<DesktopEntry::EntryFile>& entries)
+        const juce::Array<DesktopEntry::EntryFile>& entries,
+        const DesktopEntry::CategoryIndex& categoryIndex,
+        const UsageData& usageData)
 {
     juce::Array<MenuItem> entryItems = getDesktopEntryItems(folder);
-    foreachMatchingEntry(folder, entries, [&entryItems, &folder]
-    (const DesktopEntry::EntryFile& matchingEntry)
+    std::set<juce::String> folderIDs;
+    for (const MenuItem& entryItem : entryItems)
     {
-        for (const MenuItem& entryItem : entryItems)
+        folderIDs.insert(entryItem.getID());
+    }
+    foreachMatchingEntry(folder, entries, categoryIndex, usageData,
+    [&entryItems, &folderIDs](const DesktopEntry::EntryFile& matchingEntry)
+    {
+        // skip duplicate entries
+        if (folderIDs.insert(matchingEntry.getDesktopFileID()).second)
         {
-            if (entryItem.getID() == matchingEntry.getDesktopFileID())
-            {
-                // skip duplicate entries
-                return;
-            }
+            entryItems.add(MenuItem(new EntryData(matchingEntry)));
         }
-        entryItems.add(MenuItem(new EntryData(matchingEntry)));
     });
+    EntryItemComparator entryItemComparator(folder, entryItems, usageData);
     entryItems.sort(entryItemComparator, true);
     const int firstEntryIndex = folder.getMovableChildCount();
     for (int i = 0; i < entryItems.size(); i++)
@@ -146,13 +276,14 @@ void AppMenu::EntryActions::updateEntryItems(MenuItem folder,
                         << entryItem.getIndex());
                 entryItem.setTitle(entry.getName());
                 entryItem.setIconName(entry.getIcon());
-                entryItem.setCommand(entry.getLaunchCommand());
+                entryItem.setCommand(entry.getExec());
                 entryItem.setLaunchedInTerm(entry.getLaunchedInTerm());
                 entryItem.setCategories(entry.getCategories());
             }
         }
     }
     // Make sure entries are still sorted
+    EntryItemComparator entryItemComparator(folder, entryItems, usageData);
     entryItems.sort(entryItemComparator);
     const int firstEntryIndex = folder.getMovableChildCount();
     for (int i = 0; i < entryItems.size(); i++)
@@ -9,10 +9,89 @@
  *         AppMenu, shared by AppMenu::EntryLoader and AppMenu::EntryUpdater.
  */
 
+#include "Process_UsageTracker.h"
 #include "JuceHeader.h"
 
 namespace AppMenu { class MenuItem; }
+namespace AppMenu { namespace EntryActions { class UsageData; } }
 namespace DesktopEntry { class EntryFile; }
+namespace DesktopEntry { class CategoryIndex; }
+
+/**
+ * @brief  Holds the application usage data and menu options used to select and
+ *         order desktop entry menu items.
+ *
+ *  UsageData reads the menu configuration and finds the most frequently
+ * launched applications when it is created. A single UsageData object should
+ * be created each time desktop entries are loaded into the menu, and shared by
+ * every folder updated with those entries.
+ */
+class AppMenu::EntryActions::UsageData
+{
+public:
+    /**
+     * @brief  Reads menu options and launch frequency data.
+     */
+    UsageData();
+
+    virtual ~UsageData() { }
+
+    /**
+     * @brief  Checks if a folder holds the most frequently launched
+     *         applications.
+     *
+     * @param folder  A folder menu item.
+     *
+     * @return        Whether the folder has the configured frequent
+     *                application category.
+     */
+    bool isFrequentFolder(const MenuItem folder) const;
+
+    /**
+     * @brief  Checks if desktop entry menu items in a folder should be ordered
+     *         by launch frequency before title.
+     *
+     * @param folder  A folder menu item.
+     *
+     * @return        Whether the menu is configured to sort by launch
+     *                frequency, or the folder holds the most frequently
+     *                launched applications.
+     */
+    bool shouldSortByUsage(const MenuItem folder) const;
+
+    /**
+     * @brief  Checks if a desktop entry is one of the most frequently launched
+     *         applications.
+     *
+     * @param entry  A desktop entry file object.
+     *
+     * @return       Whether the entry belongs in frequent application folders.
+     */
+    bool isFrequentlyUsed(const DesktopEntry::EntryFile& entry) const;
+
+    /**
+     * @brief  Gets the launch score of a desktop entry menu item.
+     *
+     * @param entryItem  A desktop entry menu item.
+     *
+     * @return           The item's Process::UsageTracker launch score, or
+     *                   zero if it was never launched.
+     */
+    double getLaunchScore(const MenuItem& entryItem) const;
+
+private:
+    // Reads launch scores for menu items:
+    Process::UsageTracker usageTracker;
+
+    // Whether all desktop entry items are sorted by launch frequency:
+    bool sortByUsage;
+
+    // Category of folders that hold the most frequently launched applications:
+    juce::String frequentCategory;
+
+    // Launch commands of the most frequently launched applications:
+    juce::StringArray mostUsed;
+};
 
 namespace AppMenu
 {
@@ -34,15 +113,29 @@ namespace AppMenu
          * @brief  Applies a function to each desktop entry in a list that
          *         shares categories with a folder menu item.
          *
-         * @param folder        A folder menu item.
+         *  Folders with the "All" category match every entry, and folders
+         * with the configured frequent application category match the
+         * entries of the most frequently launched applications.
+         *
+         * @param folder         A folder menu item.
+         *
+         * @param entries        A list of desktop entries.
+         *
+         * @param categoryIndex  A category index created from the same list
+         *                       of entries. When applying actions to many
+         *                       folders, the same index should be reused for
+         *                       each folder.
          *
-         * @param entries       A list of desktop entries.
+         * @param usageData      Usage data and menu options read when the
+         *                       entries were loaded.
          *
-         * @param entryAction   A function to call for each entry that shares a
-         *                      category with the folder.
+         * @param entryAction    A function to call for each entry that shares
+         *                       a category with the folder.
          */
         void foreachMatchingEntry(MenuItem folder,
                 const juce::Array<DesktopEntry::EntryFile>& entries,
+                const DesktopEntry::CategoryIndex& categoryIndex,
+                const UsageData& usageData,
                 std::function<void(const DesktopEntry::EntryFile&)>
                     entryAction);
 
@@ -51,13 +144,26 @@ namespace AppMenu
          *         folder if the folder and the entry share application
          *         categories.
          *
-         * @param folder   A folder menu item.
+         *  Desktop entry items are ordered by title. If the menu is
+         * configured to sort by launch frequency, or if the folder holds the
+         * most frequently launched applications, items are first ordered by
+         * their Process::UsageTracker launch scores.
+         *
+         * @param folder         A folder menu item.
+         *
+         * @param entries        A list of entries that may need to be added to
+         *                       the folder as new menu items.
          *
-         * @param entries  A list of entries that may need to be added to the
-         *                 folder as new menu items.
+         * @param categoryIndex  A category index created from the same list
+         *                       of entries.
+         *
+         * @param usageData      Usage data and menu options read when the
+         *                       entries were loaded.
          */
         void addEntryItems(MenuItem folder,
-                const juce::Array<DesktopEntry::EntryFile>& entries);
+                const juce::Array<DesktopEntry::EntryFile>& entries,
+                const DesktopEntry::CategoryIndex& categoryIndex,
+                const UsageData& usageData);
 
         /**
          * @brief  Applies desktop entry updates to all matching menu items in a
@@ -5,23 +5,75 @@
 #include "AppMenu_MenuFile.h"
 #include "AppMenu_MenuItem.h"
 #include "DesktopEntry_Loader.h"
+#include "DesktopEntry_CategoryIndex.h"
+#include <map>
+
+/**
+ * @brief  Checks if a desktop entry menu item no longer matches its desktop
+ *         entry's current data.
+ *
+ * @param entryItem  A menu item created from a desktop entry.
+ *
+ * @param entry      The current version of the item's desktop entry.
+ *
+ * @return           Whether the menu item needs to be updated.
+ */
+static bool entryHasChanged(const AppMenu::MenuItem entryItem,
+        const DesktopEntry::EntryFile& entry)
+{
+    return entryItem.getTitle() != entry.getName()
+            || entryItem.getIconName() != entry.getIcon()
+            || entryItem.getCommand() != entry.getExec()
+            || entryItem.getLaunchedInTerm() != entry.getLaunchedInTerm()
+            || entryItem.getCategories() != entry.getCategories();
+}
+
 
 // Cancels any pending DesktopEntry::Loader callbacks the loader created.
 AppMenu::EntryLoader::~EntryLoader()
 {
-    if (initialLoadingID != 0)
+    if (initialLoadingID != 0 || indexLoadingID != 0)
     {
         DesktopEntry::Loader entryLoader;
         entryLoader.clearCallback(initialLoadingID);
+        entryLoader.clearCallback(indexLoadingID);
         initialLoadingID = 0;
+        indexLoadingID = 0;
     }
 }
 
 
 // Loads all desktop entry menu items for the first time.
-void AppMenu::EntryLoader::initialEntryLoad(){
+void AppMenu::EntryLoader::initialEntryLoad()
+{
     AppMenu::MenuFile appConfig;
     MenuItem rootFolder = appConfig.getRootFolderItem();
+
+    // Add entries from the desktop entry index as soon as it loads, so that
+    // the menu doesn't need to wait for every desktop entry file to be
+    // checked:
+    DesktopEntry::Loader entryLoader;
+    indexLoadingID = entryLoader.waitUntilIndexLoaded([this, rootFolder]()
+    {
+        indexLoadingID = 0;
+        DesktopEntry::Loader entryLoader;
+        juce::Array<DesktopEntry::EntryFile> indexedEntries
+            = entryLoader.getIndexedEntries();
+        if (indexedEntries.isEmpty())
+        {
+            return;
+        }
+        DBG("AppMenu::EntryLoader::initialEntryLoad: Adding "
+                << indexedEntries.size() << " indexed entries.");
+        const DesktopEntry::CategoryIndex categoryIndex(indexedEntries);
+        const EntryActions::UsageData usageData;
+        EntryActions::recursiveFolderAction(rootFolder,
+        [&indexedEntries, &categoryIndex, &usageData] (MenuItem folder)
+        {
+            EntryActions::addEntryItems(folder, indexedEntries, categoryIndex,
+                    usageData);
+        });
+    });
     loadFolderEntries(rootFolder);
 }
 
@@ -33,17 +85,46 @@ void AppMenu::EntryLoader::loadFolderEntries(MenuItem folderItem)
     DesktopEntry::Loader entryLoader;
     initialLoadingID = entryLoader.waitUntilLoaded([this, folderItem]()
     {
-        // The folder should have zero desktop entry items at this point!
-        jassert(folderItem.getMovableChildCount()
-                == folderItem.getFolderSize());
-
         DesktopEntry::Loader entryLoader;
         juce::Array<DesktopEntry::EntryFile> allEntries
             = entryLoader.getAllEntries();
-        EntryActions::recursiveFolderAction(folderItem, [this, &allEntries]
-            (MenuItem folder)
+        const DesktopEntry::CategoryIndex categoryIndex(allEntries);
+        const EntryActions::UsageData usageData;
+        EntryActions::recursiveFolderAction(folderItem,
+        [&allEntries, &categoryIndex, &usageData] (MenuItem folder)
         {
-            EntryActions::addEntryItems(folder, allEntries);
+            // Items added from the desktop entry index may belong to entries
+            // that were removed, changed, or moved to other categories since
+            // the index was saved:
+            std::map<juce::String, DesktopEntry::EntryFile> matchingEntries;
+            EntryActions::foreachMatchingEntry(folder, allEntries,
+                    categoryIndex, usageData,
+            [&matchingEntries](const DesktopEntry::EntryFile& matchingEntry)
+            {
+                matchingEntries[matchingEntry.getDesktopFileID()]
+                        = matchingEntry;
+            });
+            juce::Array<DesktopEntry::EntryFile> changedEntries;
+            juce::Array<MenuItem> entryItems
+                = EntryActions::getDesktopEntryItems(folder);
+            for (MenuItem entryItem : entryItems)
+            {
+                auto entryIter = matchingEntries.find(entryItem.getID());
+                if (entryIter == matchingEntries.end())
+                {
+                    entryItem.remove(false);
+                }
+                else if (entryHasChanged(entryItem, entryIter->second))
+                {
+                    changedEntries.add(entryIter->second);
+                }
+            }
+            if (!changedEntries.isEmpty())
+            {
+                EntryActions::updateEntryItems(folder, changedEntries);
+            }
+            EntryActions::addEntryItems(folder, allEntries, categoryIndex,
+                    usageData);
         });
     });
 }
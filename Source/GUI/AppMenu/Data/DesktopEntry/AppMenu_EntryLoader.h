@@ -50,4 +50,8 @@ private:
     // Holds the loading callback ID if waiting for the desktop entry thread to
     // load entry files.
     DesktopEntry::CallbackID initialLoadingID = 0;
+
+    // Holds the index callback ID if waiting for the desktop entry thread to
+    // load the desktop entry index.
+    DesktopEntry::CallbackID indexLoadingID = 0;
 };
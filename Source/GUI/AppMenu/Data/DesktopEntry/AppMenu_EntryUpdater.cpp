@@ -5,6 +5,7 @@
 #include "AppMenu_MenuItem.h"
 #include "AppMenu_MenuFile.h"
 #include "DesktopEntry_Loader.h"
+#include "DesktopEntry_CategoryIndex.h"
 
 /**
  * @brief  Loads a list of DesktopEntry::EntryFile objects from their desktop
@@ -39,11 +40,14 @@ void AppMenu::EntryUpdater::entriesAdded(const juce::StringArray entryFileIDs)
             << entryFileIDs.size() << " new entry files.");
     juce::Array<DesktopEntry::EntryFile> newEntries
         = loadEntryFiles(entryFileIDs);
+    const DesktopEntry::CategoryIndex categoryIndex(newEntries);
+    const EntryActions::UsageData usageData;
     MenuFile appConfig;
     EntryActions::recursiveFolderAction(appConfig.getRootFolderItem(),
-    [this, &newEntries](MenuItem folder)
+    [this, &newEntries, &categoryIndex, &usageData](MenuItem folder)
     {
-        EntryActions::addEntryItems(folder, newEntries);
+        EntryActions::addEntryItems(folder, newEntries, categoryIndex,
+                usageData);
     });
 }
 
@@ -78,13 +82,16 @@ void AppMenu::EntryUpdater::entriesUpdated(const juce::StringArray entryFileIDs)
             << entryFileIDs.size() << " changed entry files.");
     juce::Array<DesktopEntry::EntryFile> newEntries
         = loadEntryFiles(entryFileIDs);
+    const DesktopEntry::CategoryIndex categoryIndex(newEntries);
+    const EntryActions::UsageData usageData;
     MenuFile appConfig;
     EntryActions::recursiveFolderAction(appConfig.getRootFolderItem(),
-    [this, &newEntries](MenuItem folder)
+    [this, &newEntries, &categoryIndex, &usageData](MenuItem folder)
     {
         // Find and remove any entries that no longer have matching categories.
         juce::Array<DesktopEntry::EntryFile> toRemove = newEntries;
-        EntryActions::foreachMatchingEntry(folder, newEntries,
+        EntryActions::foreachMatchingEntry(folder, newEntries, categoryIndex,
+                usageData,
         [&toRemove](const DesktopEntry::EntryFile& matchingEntry)
         {
             toRemove.removeAllInstancesOf(matchingEntry);
@@ -108,6 +115,7 @@ void AppMenu::EntryUpdater::entriesUpdated(const juce::StringArray entryFileIDs)
 
         // Add existing entries that were changed to share a category with the
         // folder.
-        EntryActions::addEntryItems(folder, newEntries);
+        EntryActions::addEntryItems(folder, newEntries, categoryIndex,
+                usageData);
     });
 }
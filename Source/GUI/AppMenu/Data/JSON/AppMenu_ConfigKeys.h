@@ -38,11 +38,27 @@ namespace AppMenu
         static const Config::DataKey timeoutPeriod
             ("application launch timeout", Config::DataKey::intType);
 
+        // Sets the maximum number of applications added to folders that hold
+        // the most frequently launched applications.
+        static const Config::DataKey frequentAppCount
+            ("frequent applications count", Config::DataKey::intType);
+
+        //###################### Boolean value keys: ###########################
+        // Sets whether desktop entry menu items are ordered by how often they
+        // are launched, instead of by title.
+        static const Config::DataKey sortByUsage
+            ("sort AppMenu by launch frequency", Config::DataKey::boolType);
+
         //####################### String value keys: ###########################
         // Sets the AppMenuComponent type to use on the home page.
         static const Config::DataKey menuFormat
             ("AppMenu format", Config::DataKey::stringType);
 
+        // Sets the folder category used to select folders that hold the most
+        // frequently launched applications.
+        static const Config::DataKey frequentCategory
+            ("frequent applications category", Config::DataKey::stringType);
+
         // All valid values of menuFormat
         static const std::map<Format, juce::String> formatStrings =
         {
@@ -58,7 +74,10 @@ namespace AppMenu
             pagedMenuColumns,
             pagedMenuRows,
             timeoutPeriod,
+            frequentAppCount,
+            sortByUsage,
             menuFormat,
+            frequentCategory,
         };
     }
 }
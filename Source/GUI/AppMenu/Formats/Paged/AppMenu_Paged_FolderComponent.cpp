@@ -19,22 +19,28 @@ static const constexpr float buttonXPaddingFraction = 0.05;
 // a fraction of the button's height.
 static const constexpr float buttonYPaddingFraction = 0.09;
 
+// Number of folder pages on each side of the visible pages that are also given
+// button components, so buttons are ready before pages scroll into view:
+static const constexpr int overscanPages = 1;
+
 // Creates a new paged folder component.
 AppMenu::Paged::FolderComponent::FolderComponent(MenuItem folderItem) :
-    AppMenu::FolderComponent(folderItem) { }
+    AppMenu::FolderComponent(folderItem)
+{
+    readConfigValues();
+}
 
 
 // Finds the closest index to a spot on the folder that was clicked.
 int AppMenu::Paged::FolderComponent::closestIndex
 (const int xPos, const int yPos) const
 {
-    ConfigFile formatConfig;
     const int pageCount  = getNumFolderPages();
     const int pageWidth  = getWidth() / getNumFolderPages();
     const int pageX      = xPos % pageWidth;
     const int pageIndex  = xPos / pageWidth;
-    const int columnSize = pageWidth / formatConfig.getPagedMenuColumns();
-    const int rowSize    = getHeight() / formatConfig.getPagedMenuRows();
+    const int columnSize = pageWidth / pageColumns;
+    const int rowSize    = getHeight() / pageRows;
     const int pageColumn = pageX / columnSize;
     const int pageRow    = yPos / rowSize;
     int index = positionIndex(pageIndex, pageColumn, pageRow);
@@ -58,13 +64,11 @@ AppMenu::MenuButton* AppMenu::Paged::FolderComponent::createMenuButton
 }
 
 
-// Updates the sizes and positions of all buttons in the menu.
+// Updates which folder pages have buttons, and the sizes and positions of all
+// buttons in the menu.
 void AppMenu::Paged::FolderComponent::updateButtonLayout()
 {
-    ConfigFile formatConfig;
     const int numPages    = getNumFolderPages();
-    const int pageColumns = formatConfig.getPagedMenuColumns();
-    const int pageRows    = formatConfig.getPagedMenuRows();
     const int pageWidth   = getWidth() / numPages;
     const int xMargin     = pageWidth * xMarginFraction;
     const int yMargin     = getHeight() * yMarginFraction;
@@ -77,8 +81,15 @@ void AppMenu::Paged::FolderComponent::updateButtonLayout()
     const int buttonWidth    = buttonXArea - (2 * buttonXPadding);
     const int buttonHeight   = buttonYArea - (2 * buttonYPadding);
 
-    for (int i = 0; i < getFolderSize(); i++)
+    const juce::Range<int> visibleItems = getBoundIndexRange();
+    bindButtons(visibleItems);
+    for (int i = visibleItems.getStart(); i < visibleItems.getEnd(); i++)
     {
+        AppMenu::MenuButton* button = getButtonComponent(i);
+        if (button == nullptr)
+        {
+            continue;
+        }
         const int pageNum   = i / buttonsPerPage;
         const int pageIndex = i % buttonsPerPage;
         const int column    = pageIndex % pageColumns;
@@ -90,12 +101,20 @@ void AppMenu::Paged::FolderComponent::updateButtonLayout()
         const int yPos = yMargin + row * buttonHeight
             + (row * 2 + 1) * buttonYPadding;
 
-        getButtonComponent(i)->setBounds(
-                xPos, yPos, buttonWidth, buttonHeight);
+        button->setBounds(xPos, yPos, buttonWidth, buttonHeight);
     }
 }
 
 
+// Reads the folder page grid dimensions from the AppMenu configuration file.
+void AppMenu::Paged::FolderComponent::readConfigValues()
+{
+    ConfigFile formatConfig;
+    pageColumns = std::max(formatConfig.getPagedMenuColumns(), 1);
+    pageRows = std::max(formatConfig.getPagedMenuRows(), 1);
+}
+
+
 // Gets the number of folder pages used by this FolderComponent.
 int AppMenu::Paged::FolderComponent::getNumFolderPages() const
 {
@@ -133,8 +152,7 @@ int AppMenu::Paged::FolderComponent::getSelectionColumn() const
     {
         return -1;
     }
-    ConfigFile formatConfig;
-    return pageIndex % formatConfig.getPagedMenuColumns();
+    return pageIndex % pageColumns;
 }
 
 
@@ -146,8 +164,7 @@ int AppMenu::Paged::FolderComponent::getSelectionRow() const
     {
         return -1;
     }
-    ConfigFile formatConfig;
-    return pageIndex / formatConfig.getPagedMenuColumns();
+    return pageIndex / pageColumns;
 }
 
 
@@ -156,16 +173,13 @@ int AppMenu::Paged::FolderComponent::getSelectionRow() const
 int AppMenu::Paged::FolderComponent::positionIndex
 (const int page, const int column, const int row) const
 {
-    ConfigFile formatConfig;
-    const int maxRows = formatConfig.getPagedMenuRows();
-    const int maxColumns = formatConfig.getPagedMenuColumns();
     if (page < 0 || column < 0 || row < 0
-            || column >= maxColumns || row >= maxRows)
+            || column >= pageColumns || row >= pageRows)
     {
         return -1;
     }
-    return page * maxRows * maxColumns
-        + row * maxColumns
+    return page * pageRows * pageColumns
+        + row * pageColumns
         + column;
 }
 
@@ -184,12 +198,29 @@ bool AppMenu::Paged::FolderComponent::setSelectedPosition
 }
 
 
+// Finds the range of menu item indices on the visible folder pages and the
+// pages beside them.
+juce::Range<int> AppMenu::Paged::FolderComponent::getBoundIndexRange() const
+{
+    const int pageWidth = getWidth() / getNumFolderPages();
+    const juce::Rectangle<int> visibleArea = getVisibleArea();
+    if (pageWidth <= 0 || visibleArea.isEmpty())
+    {
+        return juce::Range<int>();
+    }
+    const int buttonsPerPage = maxPageItemCount();
+    const int firstPage = visibleArea.getX() / pageWidth - overscanPages;
+    const int lastPage = (visibleArea.getRight() - 1) / pageWidth
+            + overscanPages;
+    return juce::Range<int>(firstPage * buttonsPerPage,
+            (lastPage + 1) * buttonsPerPage);
+}
+
+
 // Gets the number of menu items that fit in one folder page.
 int AppMenu::Paged::FolderComponent::maxPageItemCount() const
 {
-    ConfigFile formatConfig;
-    return formatConfig.getPagedMenuColumns()
-             * formatConfig.getPagedMenuRows();
+    return pageColumns * pageRows;
 }
 
 
@@ -29,6 +29,9 @@ namespace AppMenu { namespace Paged { class FolderComponent; } }
  * finding a menu item's position in its page grid, and for finding the index of
  * a menu item at a specific position on the page. These are supplied so that
  * the Paged::InputHandler can more easily provide navigation controls.
+ *
+ *  Only menu items on visible folder pages and the pages directly beside them
+ * are given MenuButton components.
  */
 class AppMenu::Paged::FolderComponent : public AppMenu::FolderComponent
 {
@@ -70,10 +73,20 @@ public:
         const final override;
 
     /**
-     * @brief  Updates the sizes and positions of all buttons in the menu.
+     * @brief  Updates which folder pages have buttons, and the sizes and
+     *         positions of all buttons in the menu.
      */
     virtual void updateButtonLayout() final override;
 
+    /**
+     * @brief  Reads the folder page grid dimensions from the AppMenu
+     *         configuration file.
+     *
+     *  The grid dimensions are read when the folder is created, and must be
+     * read again whenever the configured column or row count changes.
+     */
+    void readConfigValues();
+
     /**
      * @brief  Gets the number of folder pages used by this FolderComponent.
      *
@@ -146,6 +159,14 @@ public:
     bool setSelectedPosition(const int page, const int column, const int row);
 
 private:
+    /**
+     * @brief  Finds the range of menu item indices on the visible folder pages
+     *         and the pages beside them.
+     *
+     * @return  The indices of all menu items that should have buttons.
+     */
+    virtual juce::Range<int> getBoundIndexRange() const final override;
+
     /**
      * @brief  Gets the number of menu items that fit in one folder page.
      *
@@ -163,4 +184,10 @@ private:
 
     // Tracks which folder page is currently shown.
     int activeFolderPage = 0;
+
+    // Number of menu item columns in each folder page:
+    int pageColumns = 1;
+
+    // Number of menu item rows in each folder page:
+    int pageRows = 1;
 };
@@ -121,5 +121,12 @@ void AppMenu::Paged::MenuComponent::parentResized
 void AppMenu::Paged::MenuComponent::configValueChanged
 (const juce::Identifier& propertyKey)
 {
+    for (int i = 0; i < openFolderCount(); i++)
+    {
+        FolderComponent* folder = static_cast<AppMenu::Paged::FolderComponent*>
+            (getOpenFolder(i));
+        folder->readConfigValues();
+        folder->updateButtonLayout();
+    }
     updateMenuLayout(false);
 }
@@ -4,10 +4,25 @@
 #include "AppMenu_ConfigKeys.h"
 #include "AppMenu_ConfigFile.h"
 #include "Windows_Info.h"
+#include <algorithm>
+
+// Number of rows above and below the visible rows that are also given button
+// components, so buttons are ready before scrolling them into view:
+static const constexpr int overscanRows = 2;
 
 // Creates a new scrolling folder component.
 AppMenu::Scrolling::FolderComponent::FolderComponent(MenuItem folderItem) :
-    AppMenu::FolderComponent(folderItem) { }
+    AppMenu::FolderComponent(folderItem)
+{
+    readConfigValues();
+    const int folderSize = getFolderSize();
+    titleWidths.reserve(folderSize);
+    for (int i = 0; i < folderSize; i++)
+    {
+        titleWidths.push_back(measureTitleWidth(i));
+        maxTitleWidth = std::max(maxTitleWidth, titleWidths.back());
+    }
+}
 
 
 // Finds the closest index to a spot on the folder that was clicked.
@@ -27,18 +42,23 @@ AppMenu::Scrolling::FolderComponent::createMenuButton
 }
 
 
-// Updates the sizes and positions of all buttons in the menu.
+// Updates which rows have buttons, and the sizes and positions of all buttons
+// in the menu.
 void AppMenu::Scrolling::FolderComponent::updateButtonLayout()
 {
     const juce::Rectangle<int> folderBounds = getLocalBounds();
     const int buttonHeight = folderBounds.getHeight()
             / std::max(getFolderSize(), 1);
+    const juce::Range<int> visibleRows = getBoundIndexRange();
+    bindButtons(visibleRows);
     const int buttonWidth = getMinimumWidth();
-    int yPos = 0;
-    for (int i = 0; i < getFolderSize(); i++)
+    for (int i = visibleRows.getStart(); i < visibleRows.getEnd(); i++)
     {
-        getButtonComponent(i)->setBounds(0, yPos, buttonWidth, buttonHeight);
-        yPos += buttonHeight;
+        AppMenu::MenuButton* button = getButtonComponent(i);
+        if (button != nullptr)
+        {
+            button->setBounds(0, i * buttonHeight, buttonWidth, buttonHeight);
+        }
     }
 }
 
@@ -57,15 +77,75 @@ int AppMenu::Scrolling::FolderComponent::getSelectedItemYOffset() const
 
 // Gets the minimum width needed to fit this folder's menu items.
 int AppMenu::Scrolling::FolderComponent::getMinimumWidth() const
+{
+    const int iconWidth = Windows::Info::getHeight() / menuRows;
+    return iconWidth + maxTitleWidth;
+}
+
+
+// Reads the number of menu rows to fit on screen from the AppMenu
+// configuration file.
+void AppMenu::Scrolling::FolderComponent::readConfigValues()
 {
     ConfigFile appConfig;
-    const int iconWidth = Windows::Info::getHeight() /
-            appConfig.getScrollingMenuRows();
-    int maxTextWidth = 0;
-    for (int i = 0; i < getFolderSize(); i++)
+    menuRows = std::max(appConfig.getScrollingMenuRows(), 1);
+}
+
+
+// Finds the range of visible menu item rows and the rows near them.
+juce::Range<int> AppMenu::Scrolling::FolderComponent::getBoundIndexRange()
+    const
+{
+    const int buttonHeight = getHeight() / std::max(getFolderSize(), 1);
+    const juce::Rectangle<int> visibleArea = getVisibleArea();
+    if (buttonHeight <= 0 || visibleArea.isEmpty())
     {
-        maxTextWidth = std::max(maxTextWidth,
-                getButtonComponent(i)->getTitleWidth());
+        return juce::Range<int>();
     }
-    return iconWidth + maxTextWidth;
+    return juce::Range<int>(
+            visibleArea.getY() / buttonHeight - overscanRows,
+            (visibleArea.getBottom() + buttonHeight - 1) / buttonHeight
+            + overscanRows);
+}
+
+
+// Measures the title of a new folder menu item.
+void AppMenu::Scrolling::FolderComponent::folderItemAdded
+(const int childIndex)
+{
+    const int titleWidth = measureTitleWidth(childIndex);
+    titleWidths.insert(titleWidths.begin() + childIndex, titleWidth);
+    maxTitleWidth = std::max(maxTitleWidth, titleWidth);
+}
+
+
+// Removes a removed menu item's saved title width, finding the new widest
+// title if necessary.
+void AppMenu::Scrolling::FolderComponent::folderItemRemoved
+(const int removedIndex)
+{
+    const int titleWidth = titleWidths[removedIndex];
+    titleWidths.erase(titleWidths.begin() + removedIndex);
+    if (titleWidth >= maxTitleWidth)
+    {
+        maxTitleWidth = titleWidths.empty() ? 0
+            : *std::max_element(titleWidths.begin(), titleWidths.end());
+    }
+}
+
+
+// Swaps the saved title widths of two swapped menu items.
+void AppMenu::Scrolling::FolderComponent::folderItemsSwapped
+(const int swapIndex1, const int swapIndex2)
+{
+    std::swap(titleWidths[swapIndex1], titleWidths[swapIndex2]);
+}
+
+
+// Measures the width needed to show a folder menu item's title.
+int AppMenu::Scrolling::FolderComponent::measureTitleWidth
+(const int childIndex) const
+{
+    return AppMenu::MenuButton::findDefaultTitleWidth(
+            getFolderMenuItem().getFolderItem(childIndex).getTitle());
 }
@@ -9,6 +9,7 @@
  */
 
 #include "AppMenu_FolderComponent.h"
+#include <vector>
 
 namespace AppMenu { namespace Scrolling { class FolderComponent; } }
 
@@ -18,6 +19,9 @@ namespace AppMenu { namespace Scrolling { class FolderComponent; } }
  *  To assist the Scrolling::MenuComponent in creating the folder layout, the
  * FolderComponent shares how wide it needs to be to fit the widest menu item
  * title, and the pixel offset of the current selected menu item.
+ *
+ *  Only the rows visible within the menu bounds, along with a few rows above
+ * and below them, are given MenuButton components.
  */
 class AppMenu::Scrolling::FolderComponent : public AppMenu::FolderComponent
 {
@@ -59,7 +63,8 @@ public:
         const final override;
 
     /**
-     * @brief  Updates the sizes and positions of all buttons in the menu.
+     * @brief  Updates which rows have buttons, and the sizes and positions of
+     *         all buttons in the menu.
      */
     virtual void updateButtonLayout() final override;
 
@@ -78,4 +83,67 @@ public:
      * @return  The minimum folder width, in pixels.
      */
     int getMinimumWidth() const;
+
+    /**
+     * @brief  Reads the number of menu rows to fit on screen from the AppMenu
+     *         configuration file.
+     *
+     *  The row count is read when the folder is created, and must be read again
+     * whenever the configured row count changes.
+     */
+    void readConfigValues();
+
+private:
+    /**
+     * @brief  Finds the range of visible menu item rows and the rows near
+     *         them.
+     *
+     * @return  The indices of all menu items that should have buttons.
+     */
+    virtual juce::Range<int> getBoundIndexRange() const final override;
+
+    /**
+     * @brief  Measures the title of a new folder menu item.
+     *
+     * @param childIndex  The index of the new menu item.
+     */
+    virtual void folderItemAdded(const int childIndex) final override;
+
+    /**
+     * @brief  Removes a removed menu item's saved title width, finding the new
+     *         widest title if necessary.
+     *
+     * @param removedIndex  The former index of the removed menu item.
+     */
+    virtual void folderItemRemoved(const int removedIndex) final override;
+
+    /**
+     * @brief  Swaps the saved title widths of two swapped menu items.
+     *
+     * @param swapIndex1  The index of the first swapped menu item.
+     *
+     * @param swapIndex2  The index of the second swapped menu item.
+     */
+    virtual void folderItemsSwapped(const int swapIndex1,
+            const int swapIndex2) final override;
+
+    /**
+     * @brief  Measures the width needed to show a folder menu item's title.
+     *
+     * @param childIndex  The index of a menu item in the folder.
+     *
+     * @return            The width in pixels of the menu item's title.
+     */
+    int measureTitleWidth(const int childIndex) const;
+
+    // The width of each folder menu item's title, ordered by menu item index.
+    // Titles are measured without buttons, as most menu items won't have
+    // buttons:
+    std::vector<int> titleWidths;
+
+    // The width of the widest menu item title:
+    int maxTitleWidth = 0;
+
+    // Number of menu rows to fit on screen:
+    int menuRows = 1;
 };
@@ -131,5 +131,11 @@ void AppMenu::Scrolling::MenuComponent::configValueChanged
     jassert(propertyKey == ConfigKeys::scrollingMenuRows);
     ConfigFile formatConfig;
     maxRows = formatConfig.getScrollingMenuRows();
+    for (int i = 0; i < openFolderCount(); i++)
+    {
+        FolderComponent* folder = static_cast<FolderComponent*>
+                (getOpenFolder(i));
+        folder->readConfigValues();
+    }
     updateMenuLayout(false);
 }
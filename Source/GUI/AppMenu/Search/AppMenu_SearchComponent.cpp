@@ -0,0 +1,290 @@
+#define APPMENU_IMPLEMENTATION
+#include "AppMenu_SearchComponent.h"
+#include "AppMenu_MenuButton.h"
+#include "Layout_Component_ConfigFile.h"
+#include "Config_MainFile.h"
+#include "Icon_Loader.h"
+#include "Util_SafeCall.h"
+
+// Localized object class key:
+static const juce::Identifier localeClassKey = "AppMenu::SearchComponent";
+
+// Localized text keys:
+namespace TextKey
+{
+    static const juce::Identifier searchApps = "searchApps";
+}
+
+// Maximum number of search results to show:
+static const constexpr int maxResults = 6;
+
+// Fraction of the component height used by the search field:
+static const constexpr float searchFieldHeightFraction = 0.15;
+
+// Fraction of the component height left empty around the search field and
+// search results:
+static const constexpr float marginFraction = 0.025;
+
+// Fraction of the result button's height to use as the background corner
+// size:
+static const constexpr float cornerFraction = 0.1;
+
+// Creates the search field and all search result buttons.
+AppMenu::SearchComponent::SearchComponent() :
+Locale::TextUser(localeClassKey)
+{
+#if JUCE_DEBUG
+    setName("AppMenu::SearchComponent");
+#endif
+    searchField.setTextToShowWhenEmpty(localeText(TextKey::searchApps),
+            findColour(juce::TextEditor::textColourId).withAlpha(0.5f));
+    searchField.setSelectAllWhenFocused(true);
+    searchField.addListener(this);
+    addAndMakeVisible(searchField);
+    for (int i = 0; i < maxResults; i++)
+    {
+        ResultButton* resultButton = new ResultButton;
+        resultButton->addListener(this);
+        resultButtons.add(resultButton);
+        addChildComponent(resultButton);
+    }
+}
+
+
+// Replaces the search text, immediately updating search results.
+void AppMenu::SearchComponent::setSearchText(const juce::String& searchText)
+{
+    searchField.setText(searchText, false);
+    searchField.moveCaretToEnd();
+    updateResults();
+}
+
+
+// Shows the items that best match the current search text.
+void AppMenu::SearchComponent::updateResults()
+{
+    const std::vector<SearchIndex::Item> results
+            = findMatches(searchField.getText(), maxResults);
+    resultCount = (int) results.size();
+    for (int i = 0; i < resultButtons.size(); i++)
+    {
+        ResultButton* resultButton = resultButtons[i];
+        if (i < resultCount)
+        {
+            resultButton->setItem(results[i]);
+            resultButton->setSelected(i == 0);
+        }
+        resultButton->setVisible(i < resultCount);
+    }
+}
+
+
+// Launches or focuses the application of a search result item.
+void AppMenu::SearchComponent::launchItem(const SearchIndex::Item& item)
+{
+    juce::String command = item.command;
+    if (item.launchedInTerm)
+    {
+        Config::MainFile mainConfig;
+        command = mainConfig.getTermLaunchPrefix() + " " + command;
+    }
+    appLauncher.startOrFocusApp(command);
+}
+
+
+// Refreshes the search results when the search index changes.
+void AppMenu::SearchComponent::searchIndexUpdated()
+{
+    updateResults();
+}
+
+
+// Updates the search results whenever the search text changes.
+void AppMenu::SearchComponent::textEditorTextChanged(juce::TextEditor& editor)
+{
+    updateResults();
+}
+
+
+// Launches the first search result when the return key is pressed.
+void AppMenu::SearchComponent::textEditorReturnKeyPressed
+(juce::TextEditor& editor)
+{
+    if (resultCount > 0)
+    {
+        launchItem(resultButtons[0]->getItem());
+    }
+}
+
+
+// Clears the search text when the escape key is pressed.
+void AppMenu::SearchComponent::textEditorEscapeKeyPressed
+(juce::TextEditor& editor)
+{
+    setSearchText(juce::String());
+}
+
+
+// Launches the application of a clicked search result.
+void AppMenu::SearchComponent::buttonClicked(juce::Button* button)
+{
+    ResultButton* resultButton = static_cast<ResultButton*>(button);
+    launchItem(resultButton->getItem());
+}
+
+
+// Grabs keyboard focus for the search field when the component becomes
+// visible.
+void AppMenu::SearchComponent::visibilityChanged()
+{
+    if (isShowing())
+    {
+        // The search field can't take focus until its parent page finishes
+        // becoming visible:
+        Util::SafeCall::callAsync<SearchComponent>(this,
+                [](SearchComponent* searchComponent)
+        {
+            searchComponent->searchField.grabKeyboardFocus();
+        });
+    }
+}
+
+
+// Updates the search field and result button bounds to fit the component.
+void AppMenu::SearchComponent::resized()
+{
+    juce::Rectangle<int> bounds = getLocalBounds();
+    const int margin = getHeight() * marginFraction;
+    bounds.reduce(margin, margin);
+    searchField.setBounds(bounds.removeFromTop(getHeight()
+                * searchFieldHeightFraction));
+    bounds.removeFromTop(margin);
+    const int rowHeight = bounds.getHeight() / maxResults;
+    for (ResultButton* resultButton : resultButtons)
+    {
+        resultButton->setBounds(bounds.removeFromTop(rowHeight));
+    }
+}
+
+
+AppMenu::SearchComponent::ResultButton::ResultButton() :
+juce::Button(juce::String())
+{
+    setWantsKeyboardFocus(false);
+}
+
+
+// Cancels any pending icon request.
+AppMenu::SearchComponent::ResultButton::~ResultButton()
+{
+    cancelIconRequest();
+}
+
+
+// Gets the search result shown by this button.
+const AppMenu::SearchIndex::Item&
+AppMenu::SearchComponent::ResultButton::getItem() const
+{
+    return item;
+}
+
+
+// Shows a new search result in this button.
+void AppMenu::SearchComponent::ResultButton::setItem
+(const SearchIndex::Item& newItem)
+{
+    if (newItem.iconName != item.iconName)
+    {
+        cancelIconRequest();
+        icon = juce::Image();
+    }
+    item = newItem;
+    setButtonText(item.title);
+    if (icon.isNull())
+    {
+        loadIcon();
+    }
+    repaint();
+}
+
+
+// Sets whether this button is drawn as the selected result.
+void AppMenu::SearchComponent::ResultButton::setSelected
+(const bool isSelected)
+{
+    if (selected != isSelected)
+    {
+        selected = isSelected;
+        repaint();
+    }
+}
+
+
+// Requests the item icon, if the button has bounds and the icon isn't already
+// loaded or requested.
+void AppMenu::SearchComponent::ResultButton::loadIcon()
+{
+    if (getHeight() > 0 && iconRequestID == 0)
+    {
+        Icon::Loader iconLoader;
+        iconRequestID = iconLoader.loadIcon(item.iconName, getHeight(),
+                [this](juce::Image iconImage)
+        {
+            iconRequestID = 0;
+            icon = iconImage;
+            repaint();
+        });
+    }
+}
+
+
+// Cancels the pending icon request, if any.
+void AppMenu::SearchComponent::ResultButton::cancelIconRequest()
+{
+    if (iconRequestID != 0)
+    {
+        Icon::Loader iconLoader;
+        iconLoader.cancelImageRequest(iconRequestID);
+        iconRequestID = 0;
+    }
+}
+
+
+// Loads the item icon when the button is resized.
+void AppMenu::SearchComponent::ResultButton::resized()
+{
+    if (icon.isNull())
+    {
+        loadIcon();
+    }
+}
+
+
+// Draws the item icon and title.
+void AppMenu::SearchComponent::ResultButton::paintButton
+(juce::Graphics& graphics, bool isMouseOver, bool isButtonDown)
+{
+    using juce::Rectangle;
+    Rectangle<int> bounds = getLocalBounds();
+    if (selected || isButtonDown)
+    {
+        graphics.setColour(findColour(MenuButton::selectedBGColourId));
+        graphics.fillRoundedRectangle(bounds.toFloat(),
+                getHeight() * cornerFraction);
+    }
+    const Rectangle<int> iconBounds = bounds.removeFromLeft(getHeight())
+            .reduced(getHeight() / 10);
+    graphics.drawImageWithin(icon, iconBounds.getX(), iconBounds.getY(),
+            iconBounds.getWidth(), iconBounds.getHeight(),
+            juce::RectanglePlacement::centred, false);
+    bounds.removeFromLeft(getHeight() / 4);
+
+    Layout::Component::ConfigFile config;
+    graphics.setFont(juce::Font(config.getFontHeight(
+                Layout::Component::TextSize::smallText)));
+    graphics.setColour(findColour(selected
+                ? MenuButton::selectedTextColourId
+                : MenuButton::textColourId));
+    graphics.drawText(item.title, bounds, juce::Justification::centredLeft,
+            true);
+}
@@ -0,0 +1,203 @@
+#ifndef APPMENU_IMPLEMENTATION
+    #error File included directly outside of AppMenu implementation.
+#endif
+#pragma once
+/**
+ * @file  AppMenu_SearchComponent.h
+ *
+ * @brief  Finds and launches applications using text typed by the user.
+ */
+
+#include "AppMenu_Searcher.h"
+#include "Widgets_TextEditor.h"
+#include "Locale_TextUser.h"
+#include "Process_Launcher.h"
+#include "Icon_RequestID.h"
+#include "JuceHeader.h"
+
+namespace AppMenu { class SearchComponent; }
+
+/**
+ * @brief  Shows a search field above a list of the applications that best
+ *         match the search text.
+ *
+ *  Search results are updated every time the search text changes, and again
+ * whenever the search index is updated. Clicking a search result launches its
+ * application, or focuses the application window if it is already running.
+ * Pressing the return key launches the first result.
+ *
+ *  The SearchComponent creates a fixed number of result buttons. As the search
+ * text changes, buttons are reused to show the new results, so no components
+ * are created or destroyed while the user types.
+ */
+class AppMenu::SearchComponent : public juce::Component, public Searcher,
+    private juce::TextEditor::Listener, private juce::Button::Listener,
+    private Locale::TextUser
+{
+public:
+    /**
+     * @brief  Creates the search field and all search result buttons.
+     */
+    SearchComponent();
+
+    virtual ~SearchComponent() { }
+
+    /**
+     * @brief  Replaces the search text, immediately updating search results.
+     *
+     * @param searchText  The new search text.
+     */
+    void setSearchText(const juce::String& searchText);
+
+private:
+    /**
+     * @brief  Shows the items that best match the current search text.
+     */
+    void updateResults();
+
+    /**
+     * @brief  Launches or focuses the application of a search result item.
+     *
+     * @param item  A search result item.
+     */
+    void launchItem(const SearchIndex::Item& item);
+
+    /**
+     * @brief  Refreshes the search results when the search index changes.
+     */
+    virtual void searchIndexUpdated() override;
+
+    /**
+     * @brief  Updates the search results whenever the search text changes.
+     *
+     * @param editor  The search text editor.
+     */
+    virtual void textEditorTextChanged(juce::TextEditor& editor) override;
+
+    /**
+     * @brief  Launches the first search result when the return key is
+     *         pressed.
+     *
+     * @param editor  The search text editor.
+     */
+    virtual void textEditorReturnKeyPressed(juce::TextEditor& editor)
+        override;
+
+    /**
+     * @brief  Clears the search text when the escape key is pressed.
+     *
+     * @param editor  The search text editor.
+     */
+    virtual void textEditorEscapeKeyPressed(juce::TextEditor& editor)
+        override;
+
+    /**
+     * @brief  Launches the application of a clicked search result.
+     *
+     * @param button  The search result button that was clicked.
+     */
+    virtual void buttonClicked(juce::Button* button) override;
+
+    /**
+     * @brief  Grabs keyboard focus for the search field when the component
+     *         becomes visible.
+     */
+    virtual void visibilityChanged() override;
+
+    /**
+     * @brief  Updates the search field and result button bounds to fit the
+     *         component.
+     */
+    virtual void resized() override;
+
+    /**
+     * @brief  A button that shows a single search result.
+     */
+    class ResultButton : public juce::Button
+    {
+    public:
+        ResultButton();
+
+        /**
+         * @brief  Cancels any pending icon request.
+         */
+        virtual ~ResultButton();
+
+        /**
+         * @brief  Gets the search result shown by this button.
+         *
+         * @return  The button's search result item.
+         */
+        const SearchIndex::Item& getItem() const;
+
+        /**
+         * @brief  Shows a new search result in this button.
+         *
+         * @param newItem  The search result item to show.
+         */
+        void setItem(const SearchIndex::Item& newItem);
+
+        /**
+         * @brief  Sets whether this button is drawn as the selected result.
+         *
+         * @param isSelected  Whether the button's item will launch if the
+         *                    return key is pressed.
+         */
+        void setSelected(const bool isSelected);
+
+    private:
+        /**
+         * @brief  Requests the item icon, if the button has bounds and the
+         *         icon isn't already loaded or requested.
+         */
+        void loadIcon();
+
+        /**
+         * @brief  Cancels the pending icon request, if any.
+         */
+        void cancelIconRequest();
+
+        /**
+         * @brief  Loads the item icon when the button is resized.
+         */
+        virtual void resized() override;
+
+        /**
+         * @brief  Draws the item icon and title.
+         *
+         * @param graphics     The graphics context used to draw the button.
+         *
+         * @param isMouseOver  Whether the mouse is over the button.
+         *
+         * @param isButtonDown Whether the button is being clicked.
+         */
+        virtual void paintButton(juce::Graphics& graphics,
+                bool isMouseOver, bool isButtonDown) override;
+
+        // The search result shown by this button:
+        SearchIndex::Item item;
+        // The loaded item icon:
+        juce::Image icon;
+        // The ID of the pending icon request, or zero if no icon is
+        // requested:
+        Icon::RequestID iconRequestID = 0;
+        // Whether the button is drawn as the selected result:
+        bool selected = false;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ResultButton)
+    };
+
+    // Used to enter search text:
+    Widgets::TextEditor searchField;
+
+    // Shows search results, with the best match first:
+    juce::OwnedArray<ResultButton> resultButtons;
+
+    // The number of results shown in the result buttons:
+    int resultCount = 0;
+
+    // Launches or focuses selected applications:
+    Process::Launcher appLauncher;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SearchComponent)
+};
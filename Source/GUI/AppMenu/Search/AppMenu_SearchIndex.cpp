@@ -0,0 +1,407 @@
+#define APPMENU_IMPLEMENTATION
+#include "AppMenu_SearchIndex.h"
+#include <algorithm>
+#include <cmath>
+
+// Character value used to mark the start of a word in index keys. This is never
+// a letter or number, so it is never included in normalized text:
+static const constexpr juce::juce_wchar wordMarker = 1;
+
+// Fraction of a search word's index keys an item must contain to match that
+// word:
+static const constexpr float minKeyFraction = 0.6f;
+
+// Relative importance of each item text field, in the order that fields are
+// stored in IndexedItem objects:
+static const constexpr float fieldWeights[] =
+{
+    8.0f, // title
+    4.0f, // genericName
+    3.0f, // keywords
+    2.0f, // executable
+    1.0f  // categories
+};
+
+// Search word score when a field starts with the search word:
+static const constexpr float fieldStartScore = 4.0f;
+// Search word score when a field word starts with the search word:
+static const constexpr float wordStartScore = 3.0f;
+// Search word score when the search word is found within a field word:
+static const constexpr float substringScore = 2.0f;
+// Largest possible search word score when the search word is misspelled:
+static const constexpr float misspelledScore = 1.0f;
+
+
+/**
+ * @brief  Packs three characters into a single index key.
+ *
+ * @param first   The first character in the sequence.
+ *
+ * @param second  The second character in the sequence.
+ *
+ * @param third   The third character in the sequence.
+ *
+ * @return        The packed index key.
+ */
+static inline juce::uint64 packKey(const juce::juce_wchar first,
+        const juce::juce_wchar second, const juce::juce_wchar third)
+{
+    // Unicode characters never need more than 21 bits:
+    static const constexpr juce::uint64 charMask = 0x1fffff;
+    return ((first & charMask) << 42) | ((second & charMask) << 21)
+            | (third & charMask);
+}
+
+
+/**
+ * @brief  Splits normalized text into individual words.
+ *
+ * @param text  Text returned by SearchIndex::normalizeText.
+ *
+ * @return      Each word in the text, in order.
+ */
+static std::vector<std::basic_string<juce::juce_wchar>> splitWords
+(const std::basic_string<juce::juce_wchar>& text)
+{
+    std::vector<std::basic_string<juce::juce_wchar>> words;
+    size_t wordStart = 0;
+    while (wordStart < text.size())
+    {
+        size_t wordEnd = text.find(' ', wordStart);
+        if (wordEnd == std::basic_string<juce::juce_wchar>::npos)
+        {
+            wordEnd = text.size();
+        }
+        words.push_back(text.substr(wordStart, wordEnd - wordStart));
+        wordStart = wordEnd + 1;
+    }
+    return words;
+}
+
+
+// Adds an item to the index, replacing any item that was previously added with
+// the same key.
+void AppMenu::SearchIndex::addItem
+(const juce::String& itemKey, const Item& item)
+{
+    removeItem(itemKey);
+    IndexedItem indexedItem;
+    indexedItem.item = item;
+    indexedItem.fields =
+    {
+        normalizeText(item.title),
+        normalizeText(item.genericName),
+        normalizeText(item.keywords.joinIntoString(" ")),
+        normalizeText(item.executable),
+        normalizeText(item.categories.joinIntoString(" "))
+    };
+    for (const SearchText& field : indexedItem.fields)
+    {
+        for (const SearchText& word : splitWords(field))
+        {
+            addWordKeys(word, indexedItem.indexKeys);
+        }
+    }
+    std::vector<juce::uint64>& indexKeys = indexedItem.indexKeys;
+    std::sort(indexKeys.begin(), indexKeys.end());
+    indexKeys.erase(std::unique(indexKeys.begin(), indexKeys.end()),
+            indexKeys.end());
+
+    int itemNum;
+    if (unusedItemNumbers.empty())
+    {
+        itemNum = (int) items.size();
+        items.push_back(IndexedItem());
+    }
+    else
+    {
+        itemNum = unusedItemNumbers.back();
+        unusedItemNumbers.pop_back();
+    }
+    for (const juce::uint64 indexKey : indexKeys)
+    {
+        std::vector<int>& keyItems = keyMap[indexKey];
+        keyItems.insert(std::lower_bound(keyItems.begin(), keyItems.end(),
+                    itemNum), itemNum);
+    }
+    items[itemNum] = std::move(indexedItem);
+    itemNumbers[itemKey] = itemNum;
+}
+
+
+// Removes an item from the index.
+bool AppMenu::SearchIndex::removeItem(const juce::String& itemKey)
+{
+    auto numberIter = itemNumbers.find(itemKey);
+    if (numberIter == itemNumbers.end())
+    {
+        return false;
+    }
+    const int itemNum = numberIter->second;
+    for (const juce::uint64 indexKey : items[itemNum].indexKeys)
+    {
+        auto keyIter = keyMap.find(indexKey);
+        if (keyIter == keyMap.end())
+        {
+            continue;
+        }
+        std::vector<int>& keyItems = keyIter->second;
+        auto itemIter = std::lower_bound(keyItems.begin(), keyItems.end(),
+                itemNum);
+        if (itemIter != keyItems.end() && *itemIter == itemNum)
+        {
+            keyItems.erase(itemIter);
+        }
+        if (keyItems.empty())
+        {
+            keyMap.erase(keyIter);
+        }
+    }
+    items[itemNum] = IndexedItem();
+    unusedItemNumbers.push_back(itemNum);
+    itemNumbers.erase(numberIter);
+    return true;
+}
+
+
+// Checks if an item is in the index.
+bool AppMenu::SearchIndex::containsItem(const juce::String& itemKey) const
+{
+    return itemNumbers.count(itemKey) > 0;
+}
+
+
+// Gets the keys of all items in the index.
+juce::StringArray AppMenu::SearchIndex::getItemKeys() const
+{
+    juce::StringArray itemKeys;
+    for (const auto& numberPair : itemNumbers)
+    {
+        itemKeys.add(numberPair.first);
+    }
+    return itemKeys;
+}
+
+
+// Gets the number of items in the index.
+int AppMenu::SearchIndex::getItemCount() const
+{
+    return (int) itemNumbers.size();
+}
+
+
+// Finds the items that best match search text.
+std::vector<AppMenu::SearchIndex::Item> AppMenu::SearchIndex::findMatches
+(const juce::String& searchText, const int maxResults) const
+{
+    std::vector<Item> results;
+    const std::vector<SearchText> searchWords
+            = splitWords(normalizeText(searchText));
+    if (searchWords.empty() || maxResults <= 0)
+    {
+        return results;
+    }
+
+    // Items must match every search word, so only items that matched all
+    // previous words are considered when checking each word:
+    std::vector<int> matchedWords(items.size(), 0);
+    std::vector<int> keyMatches(items.size(), 0);
+    std::vector<int> checkedItems;
+    for (int wordNum = 0; wordNum < (int) searchWords.size(); wordNum++)
+    {
+        const SearchText& word = searchWords[wordNum];
+        std::vector<juce::uint64> wordKeys;
+        if (word.size() == 1)
+        {
+            wordKeys.push_back(packKey(wordMarker, wordMarker, word[0]));
+        }
+        else if (word.size() == 2)
+        {
+            wordKeys.push_back(packKey(wordMarker, word[0], word[1]));
+        }
+        else
+        {
+            for (size_t i = 0; (i + 2) < word.size(); i++)
+            {
+                wordKeys.push_back(packKey(word[i], word[i + 1],
+                            word[i + 2]));
+            }
+            std::sort(wordKeys.begin(), wordKeys.end());
+            wordKeys.erase(std::unique(wordKeys.begin(), wordKeys.end()),
+                    wordKeys.end());
+        }
+        const int requiredMatches = std::max(1,
+                (int) std::ceil(wordKeys.size() * minKeyFraction));
+
+        checkedItems.clear();
+        for (const juce::uint64 wordKey : wordKeys)
+        {
+            auto keyIter = keyMap.find(wordKey);
+            if (keyIter == keyMap.end())
+            {
+                continue;
+            }
+            for (const int itemNum : keyIter->second)
+            {
+                if (matchedWords[itemNum] == wordNum
+                        && keyMatches[itemNum]++ == 0)
+                {
+                    checkedItems.push_back(itemNum);
+                }
+            }
+        }
+        if (checkedItems.empty())
+        {
+            return results;
+        }
+        for (const int itemNum : checkedItems)
+        {
+            if (keyMatches[itemNum] >= requiredMatches)
+            {
+                matchedWords[itemNum]++;
+            }
+            keyMatches[itemNum] = 0;
+        }
+    }
+
+    // Rank all items that matched every search word:
+    std::vector<std::pair<float, int>> rankedItems;
+    for (const int itemNum : checkedItems)
+    {
+        if (matchedWords[itemNum] != (int) searchWords.size())
+        {
+            continue;
+        }
+        const IndexedItem& indexedItem = items[itemNum];
+        float itemScore = 0;
+        for (const SearchText& word : searchWords)
+        {
+            float wordScore = 0;
+            for (size_t i = 0; i < indexedItem.fields.size(); i++)
+            {
+                wordScore = std::max(wordScore, fieldWeights[i]
+                        * scoreField(indexedItem.fields[i], word));
+            }
+            itemScore += wordScore;
+        }
+        rankedItems.push_back({ itemScore, itemNum });
+    }
+    const size_t resultCount = std::min<size_t>(rankedItems.size(),
+            maxResults);
+    std::partial_sort(rankedItems.begin(), rankedItems.begin() + resultCount,
+            rankedItems.end(),
+            [this](const std::pair<float, int>& first,
+                const std::pair<float, int>& second)
+    {
+        if (first.first != second.first)
+        {
+            return first.first > second.first;
+        }
+        // Prefer shorter titles, as they match a greater fraction of the
+        // search text:
+        const juce::String& firstTitle = items[first.second].item.title;
+        const juce::String& secondTitle = items[second.second].item.title;
+        if (firstTitle.length() != secondTitle.length())
+        {
+            return firstTitle.length() < secondTitle.length();
+        }
+        return firstTitle.compareIgnoreCase(secondTitle) < 0;
+    });
+    for (size_t i = 0; i < resultCount; i++)
+    {
+        results.push_back(items[rankedItems[i].second].item);
+    }
+    return results;
+}
+
+
+// Converts text into lower-case words separated by single spaces, treating all
+// characters besides letters and numbers as word separators.
+AppMenu::SearchIndex::SearchText AppMenu::SearchIndex::normalizeText
+(const juce::String& text)
+{
+    SearchText normalized;
+    bool lastWasSeparator = true;
+    juce::String::CharPointerType textPtr = text.getCharPointer();
+    while (!textPtr.isEmpty())
+    {
+        const juce::juce_wchar character = textPtr.getAndAdvance();
+        if (juce::CharacterFunctions::isLetterOrDigit(character))
+        {
+            normalized += juce::CharacterFunctions::toLowerCase(character);
+            lastWasSeparator = false;
+        }
+        else if (!lastWasSeparator)
+        {
+            normalized += ' ';
+            lastWasSeparator = true;
+        }
+    }
+    if (!normalized.empty() && lastWasSeparator)
+    {
+        normalized.pop_back();
+    }
+    return normalized;
+}
+
+
+// Adds all index keys used to find a single normalized word.
+void AppMenu::SearchIndex::addWordKeys
+(const SearchText& word, std::vector<juce::uint64>& indexKeys)
+{
+    if (word.empty())
+    {
+        return;
+    }
+    indexKeys.push_back(packKey(wordMarker, wordMarker, word[0]));
+    if (word.size() > 1)
+    {
+        indexKeys.push_back(packKey(wordMarker, word[0], word[1]));
+    }
+    for (size_t i = 0; (i + 2) < word.size(); i++)
+    {
+        indexKeys.push_back(packKey(word[i], word[i + 1], word[i + 2]));
+    }
+}
+
+
+// Scores how closely a search word matches a normalized text field.
+float AppMenu::SearchIndex::scoreField
+(const SearchText& field, const SearchText& searchWord)
+{
+    size_t matchPos = field.find(searchWord);
+    if (matchPos != SearchText::npos)
+    {
+        float bestScore = substringScore;
+        while (matchPos != SearchText::npos)
+        {
+            if (matchPos == 0)
+            {
+                return fieldStartScore;
+            }
+            if (field[matchPos - 1] == ' ')
+            {
+                bestScore = wordStartScore;
+            }
+            matchPos = field.find(searchWord, matchPos + 1);
+        }
+        return bestScore;
+    }
+    if (searchWord.size() < 3)
+    {
+        return 0;
+    }
+    // Score misspelled words by the fraction of their trigrams found in the
+    // field:
+    int trigramCount = 0;
+    int matchingTrigrams = 0;
+    for (size_t i = 0; (i + 2) < searchWord.size(); i++)
+    {
+        trigramCount++;
+        if (field.find(searchWord.c_str() + i, 0, 3) != SearchText::npos)
+        {
+            matchingTrigrams++;
+        }
+    }
+    return misspelledScore * matchingTrigrams / trigramCount;
+}
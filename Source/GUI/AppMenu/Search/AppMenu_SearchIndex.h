@@ -0,0 +1,199 @@
+#ifndef APPMENU_IMPLEMENTATION
+    #error File included directly outside of AppMenu implementation.
+#endif
+#pragma once
+/**
+ * @file  AppMenu_SearchIndex.h
+ *
+ * @brief  Indexes application launch items so they can be found by partial,
+ *         misspelled, or out of order search text.
+ */
+
+#include "JuceHeader.h"
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace AppMenu { class SearchIndex; }
+
+/**
+ * @brief  Finds and ranks application items that match search text.
+ *
+ *  Each indexed item's searchable text is split into lower-case words, and each
+ * word is broken into overlapping three character sequences (trigrams). The
+ * SearchIndex maps every trigram to the sorted list of items that contain it.
+ * The first one and two characters of each word are also mapped, so that very
+ * short searches only match the start of words.
+ *
+ *  When searching, items are found by counting how many of each search word's
+ * trigrams they contain. Items only need to contain most of the trigrams in
+ * each search word, so searches still succeed when the search text has minor
+ * spelling errors. Matching items are then ranked by how closely each search
+ * word matches each of the item's text fields, with matches in the item title
+ * weighted most heavily.
+ *
+ *  Items may be added, replaced, or removed individually without rebuilding
+ * the rest of the index. SearchIndex objects are not thread-safe, but a
+ * SearchIndex may be copied, updated, and then shared as an unchanging
+ * snapshot once updates are finished.
+ */
+class AppMenu::SearchIndex
+{
+public:
+    /**
+     * @brief  Holds the searchable text of an application item, along with
+     *         the data needed to display and launch it.
+     */
+    struct Item
+    {
+        // The desktop file ID of a desktop entry item, or the empty string
+        // for menu shortcuts:
+        juce::String entryFileID;
+        // The displayed item title:
+        juce::String title;
+        // The name or path of the item's icon:
+        juce::String iconName;
+        // The application launch command:
+        juce::String command;
+        // Whether the application should launch in a terminal window:
+        bool launchedInTerm = false;
+        // A generic description of the application:
+        juce::String genericName;
+        // Extra search terms associated with the application:
+        juce::StringArray keywords;
+        // The name of the application's executable file:
+        juce::String executable;
+        // The item's application categories:
+        juce::StringArray categories;
+    };
+
+    SearchIndex() { }
+
+    virtual ~SearchIndex() { }
+
+    /**
+     * @brief  Adds an item to the index, replacing any item that was
+     *         previously added with the same key.
+     *
+     * @param itemKey  A string that uniquely identifies the item.
+     *
+     * @param item     The item to add.
+     */
+    void addItem(const juce::String& itemKey, const Item& item);
+
+    /**
+     * @brief  Removes an item from the index.
+     *
+     * @param itemKey  The key of an item previously added to the index.
+     *
+     * @return         Whether a matching item was found and removed.
+     */
+    bool removeItem(const juce::String& itemKey);
+
+    /**
+     * @brief  Checks if an item is in the index.
+     *
+     * @param itemKey  The key of an item that may have been added to the
+     *                 index.
+     *
+     * @return         Whether an item with that key is in the index.
+     */
+    bool containsItem(const juce::String& itemKey) const;
+
+    /**
+     * @brief  Gets the keys of all items in the index.
+     *
+     * @return  All indexed item keys, in sorted order.
+     */
+    juce::StringArray getItemKeys() const;
+
+    /**
+     * @brief  Gets the number of items in the index.
+     *
+     * @return  The indexed item count.
+     */
+    int getItemCount() const;
+
+    /**
+     * @brief  Finds the items that best match search text.
+     *
+     * @param searchText  The text to search for. Each word in the search text
+     *                    must match at least one of an item's text fields for
+     *                    the item to be included.
+     *
+     * @param maxResults  The maximum number of items to return.
+     *
+     * @return            Up to maxResults matching items, with the best
+     *                    matches first.
+     */
+    std::vector<Item> findMatches(const juce::String& searchText,
+            const int maxResults) const;
+
+private:
+    // Normalized search text, stored as unicode code points:
+    typedef std::basic_string<juce::juce_wchar> SearchText;
+
+    /**
+     * @brief  Stores an item along with its normalized text fields and all of
+     *         the index keys created from those fields.
+     */
+    struct IndexedItem
+    {
+        // The original item data:
+        Item item;
+        // Normalized text fields, in the same order as the field weights:
+        std::vector<SearchText> fields;
+        // All index keys created from the item fields, sorted and unique:
+        std::vector<juce::uint64> indexKeys;
+    };
+
+    /**
+     * @brief  Converts text into lower-case words separated by single spaces,
+     *         treating all characters besides letters and numbers as word
+     *         separators.
+     *
+     * @param text  The text to normalize.
+     *
+     * @return      The normalized text.
+     */
+    static SearchText normalizeText(const juce::String& text);
+
+    /**
+     * @brief  Adds all index keys used to find a single normalized word.
+     *
+     * @param word       A normalized word, containing no spaces.
+     *
+     * @param indexKeys  The list where index keys will be added.
+     */
+    static void addWordKeys(const SearchText& word,
+            std::vector<juce::uint64>& indexKeys);
+
+    /**
+     * @brief  Scores how closely a search word matches a normalized text
+     *         field.
+     *
+     * @param field       A normalized item text field.
+     *
+     * @param searchWord  A normalized search word.
+     *
+     * @return            A score between zero and four, with larger numbers
+     *                    indicating a closer match.
+     */
+    static float scoreField(const SearchText& field,
+            const SearchText& searchWord);
+
+    // All indexed items. Item numbers used in the key map are indices in
+    // this list, and removed items are left empty until their numbers are
+    // reused:
+    std::vector<IndexedItem> items;
+
+    // Numbers of removed item slots that may be reused:
+    std::vector<int> unusedItemNumbers;
+
+    // Item numbers mapped by item key:
+    std::map<juce::String, int> itemNumbers;
+
+    // Sorted lists of item numbers mapped by index key:
+    std::unordered_map<juce::uint64, std::vector<int>> keyMap;
+};
@@ -0,0 +1,307 @@
+#define APPMENU_IMPLEMENTATION
+#include "AppMenu_SearchThread.h"
+#include "AppMenu_Searcher.h"
+#include "DesktopEntry_Loader.h"
+#include "DesktopEntry_EntryFile.h"
+#include "Process_UsageTracker.h"
+#include <stdexcept>
+
+#ifdef JUCE_DEBUG
+// Print the full class name before all debug output:
+static const constexpr char* dbgPrefix = "AppMenu::SearchThread::";
+#endif
+
+// SharedResource object key:
+const juce::Identifier AppMenu::SearchThread::resourceKey
+        = "AppMenu::SearchThread";
+
+// Resource thread name:
+static const juce::String threadName = "AppMenu_SearchThread";
+
+// Prefix added to the desktop file ID of a desktop entry to create its index
+// key:
+static const juce::String entryKeyPrefix = "entry:";
+
+// Prefix added to menu shortcut index keys:
+static const juce::String shortcutKeyPrefix = "shortcut:";
+
+// Number of frequently launched applications to index before all other
+// desktop entries:
+static const constexpr int prewarmedEntryCount = 8;
+
+
+/**
+ * @brief  Creates a search item from a desktop entry.
+ *
+ * @param entry  A loaded desktop entry file.
+ *
+ * @return       The search item used to find and launch the entry.
+ */
+static AppMenu::SearchIndex::Item createEntryItem
+(const DesktopEntry::EntryFile& entry)
+{
+    AppMenu::SearchIndex::Item entryItem;
+    entryItem.entryFileID = entry.getDesktopFileID();
+    entryItem.title = entry.getName();
+    entryItem.iconName = entry.getIcon();
+    // SearchComponent adds the terminal prefix when launching items, so the
+    // item stores the Exec value instead of the full launch command, which
+    // would already include that prefix:
+    entryItem.command = entry.getExec();
+    entryItem.launchedInTerm = entry.getLaunchedInTerm();
+    entryItem.genericName = entry.getGenericName();
+    entryItem.keywords = entry.getKeywords();
+    // Only the executable name is searchable, not its path or arguments:
+    const juce::String executable = entry.getExec().upToFirstOccurrenceOf(
+            " ", false, false).unquoted();
+    entryItem.executable = executable.fromLastOccurrenceOf("/", false, false);
+    entryItem.categories = entry.getCategories();
+    return entryItem;
+}
+
+
+/**
+ * @brief  Creates the index key used to store a menu shortcut.
+ *
+ * @param shortcut  A search item created from a menu shortcut.
+ *
+ * @return          A key that changes whenever any of the shortcut's data
+ *                  changes.
+ */
+static juce::String getShortcutKey(const AppMenu::SearchIndex::Item& shortcut)
+{
+    return shortcutKeyPrefix + shortcut.title + "\n" + shortcut.command + "\n"
+            + shortcut.iconName + "\n" + (shortcut.launchedInTerm ? "1" : "0");
+}
+
+
+// Creates the thread with an empty search index, scheduling all desktop entries
+// to be indexed once the thread starts.
+AppMenu::SearchThread::SearchThread() :
+SharedResource::Thread::Resource(resourceKey, ::threadName),
+searchIndex(new SearchIndex) { }
+
+
+// Gets the current search index.
+std::shared_ptr<const AppMenu::SearchIndex>
+AppMenu::SearchThread::getSearchIndex() const
+{
+    return searchIndex;
+}
+
+
+// Schedules desktop entries to be added or updated in the index.
+void AppMenu::SearchThread::updateEntries
+(const juce::StringArray& entryFileIDs)
+{
+    for (const juce::String& entryID : entryFileIDs)
+    {
+        removedEntryIDs.erase(entryID);
+        updatedEntryIDs.insert(entryID);
+    }
+    scheduleUpdate();
+}
+
+
+// Schedules desktop entries to be removed from the index.
+void AppMenu::SearchThread::removeEntries
+(const juce::StringArray& entryFileIDs)
+{
+    for (const juce::String& entryID : entryFileIDs)
+    {
+        updatedEntryIDs.erase(entryID);
+        removedEntryIDs.insert(entryID);
+    }
+    scheduleUpdate();
+}
+
+
+// Schedules the index to be updated with the current list of menu shortcuts,
+// if the list has changed.
+void AppMenu::SearchThread::updateShortcuts
+(const std::vector<SearchIndex::Item>& shortcuts)
+{
+    std::map<juce::String, SearchIndex::Item> newShortcuts;
+    for (const SearchIndex::Item& shortcut : shortcuts)
+    {
+        newShortcuts[getShortcutKey(shortcut)] = shortcut;
+    }
+    bool keysChanged = (newShortcuts.size() != menuShortcuts.size());
+    for (auto newIter = newShortcuts.begin(), oldIter = menuShortcuts.begin();
+            !keysChanged && newIter != newShortcuts.end();
+            newIter++, oldIter++)
+    {
+        keysChanged = (newIter->first != oldIter->first);
+    }
+    if (keysChanged)
+    {
+        menuShortcuts.swap(newShortcuts);
+        shortcutsChanged = true;
+    }
+    // The first update starts the thread, even if there are no shortcuts to
+    // index:
+    if (keysChanged || !isThreadRunning())
+    {
+        scheduleUpdate();
+    }
+}
+
+
+// Applies all scheduled changes to a copy of the search index, replaces the
+// current index with the updated copy, and notifies all Searcher objects on the
+// message thread.
+void AppMenu::SearchThread::runLoop(SharedResource::Thread::Lock& lock)
+{
+    lock.enterWrite();
+    const bool indexEntries = indexAllEntries;
+    indexAllEntries = false;
+    std::set<juce::String> entriesToUpdate;
+    entriesToUpdate.swap(updatedEntryIDs);
+    std::set<juce::String> entriesToRemove;
+    entriesToRemove.swap(removedEntryIDs);
+    const bool indexShortcuts = shortcutsChanged;
+    shortcutsChanged = false;
+    const std::map<juce::String, SearchIndex::Item> shortcuts = menuShortcuts;
+    const std::shared_ptr<const SearchIndex> currentIndex = searchIndex;
+    lock.exitWrite();
+
+    // The current index never changes, so searches may continue to use it
+    // while a copy is updated:
+    const juce::uint32 startTime = juce::Time::getMillisecondCounter();
+    std::shared_ptr<SearchIndex> updatedIndex(new SearchIndex(*currentIndex));
+    DesktopEntry::Loader entryLoader;
+    if (indexEntries)
+    {
+        for (const juce::String& itemKey : updatedIndex->getItemKeys())
+        {
+            if (itemKey.startsWith(entryKeyPrefix))
+            {
+                updatedIndex->removeItem(itemKey);
+            }
+        }
+        // Index the most frequently launched applications first, and share
+        // them before indexing everything else, so the applications users are
+        // most likely to search for can be found as soon as possible:
+        Process::UsageTracker usageTracker;
+        const juce::StringArray mostUsed
+                = usageTracker.getMostUsed(prewarmedEntryCount);
+        juce::Array<DesktopEntry::EntryFile> allEntries
+                = entryLoader.getAllEntries();
+        juce::Array<DesktopEntry::EntryFile> otherEntries;
+        for (const DesktopEntry::EntryFile& entry : allEntries)
+        {
+            if (mostUsed.contains(entry.getLaunchCommand()))
+            {
+                updatedIndex->addItem(entryKeyPrefix
+                        + entry.getDesktopFileID(), createEntryItem(entry));
+            }
+            else
+            {
+                otherEntries.add(entry);
+            }
+        }
+        if (otherEntries.size() < allEntries.size())
+        {
+            replaceSearchIndex(lock, std::shared_ptr<const SearchIndex>(
+                        new SearchIndex(*updatedIndex)));
+        }
+        for (const DesktopEntry::EntryFile& entry : otherEntries)
+        {
+            updatedIndex->addItem(entryKeyPrefix + entry.getDesktopFileID(),
+                    createEntryItem(entry));
+        }
+    }
+    for (const juce::String& entryID : entriesToRemove)
+    {
+        updatedIndex->removeItem(entryKeyPrefix + entryID);
+    }
+    for (const juce::String& entryID : entriesToUpdate)
+    {
+        DesktopEntry::EntryFile entry;
+        try
+        {
+            entry = entryLoader.getDesktopEntry(entryID);
+        }
+        catch (std::out_of_range e)
+        {
+            DBG(dbgPrefix << __func__ << ": Entry " << entryID
+                    << " no longer exists.");
+        }
+        if (entry.isMissingData())
+        {
+            updatedIndex->removeItem(entryKeyPrefix + entryID);
+        }
+        else
+        {
+            updatedIndex->addItem(entryKeyPrefix + entryID,
+                    createEntryItem(entry));
+        }
+    }
+    if (indexShortcuts)
+    {
+        for (const juce::String& itemKey : updatedIndex->getItemKeys())
+        {
+            if (itemKey.startsWith(shortcutKeyPrefix)
+                    && shortcuts.count(itemKey) == 0)
+            {
+                updatedIndex->removeItem(itemKey);
+            }
+        }
+        for (const auto& shortcutPair : shortcuts)
+        {
+            if (!updatedIndex->containsItem(shortcutPair.first))
+            {
+                updatedIndex->addItem(shortcutPair.first,
+                        shortcutPair.second);
+            }
+        }
+    }
+    DBG(dbgPrefix << __func__ << ": Indexed "
+            << updatedIndex->getItemCount() << " items in "
+            << (int) (juce::Time::getMillisecondCounter() - startTime)
+            << "ms.");
+
+    replaceSearchIndex(lock, updatedIndex);
+}
+
+
+// Replaces the current search index, and notifies all Searcher objects on the
+// message thread.
+void AppMenu::SearchThread::replaceSearchIndex
+(SharedResource::Thread::Lock& lock,
+ const std::shared_ptr<const SearchIndex> newIndex)
+{
+    lock.enterWrite();
+    searchIndex = newIndex;
+    lock.exitWrite();
+    juce::MessageManager::callAsync(buildAsyncFunction(
+                SharedResource::LockType::read, [this]
+    {
+        foreachHandler<Searcher>([](Searcher* searcher)
+        {
+            searcher->searchIndexUpdated();
+        });
+    }));
+}
+
+
+// Keeps the thread dormant while no changes are scheduled.
+bool AppMenu::SearchThread::threadShouldWait()
+{
+    return !indexAllEntries && !shortcutsChanged && updatedEntryIDs.empty()
+            && removedEntryIDs.empty();
+}
+
+
+// Starts the thread if necessary, or wakes it if it is waiting for updates.
+void AppMenu::SearchThread::scheduleUpdate()
+{
+    if (!isThreadRunning())
+    {
+        startResourceThread();
+    }
+    else
+    {
+        notify();
+    }
+}
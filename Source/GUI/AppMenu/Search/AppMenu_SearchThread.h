@@ -0,0 +1,137 @@
+#ifndef APPMENU_IMPLEMENTATION
+    #error File included directly outside of AppMenu implementation.
+#endif
+#pragma once
+/**
+ * @file  AppMenu_SearchThread.h
+ *
+ * @brief  Builds and updates the application search index without blocking
+ *         the message thread.
+ */
+
+#include "AppMenu_SearchIndex.h"
+#include "SharedResource_Thread_Resource.h"
+#include "JuceHeader.h"
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace AppMenu { class SearchThread; }
+namespace AppMenu { class Searcher; }
+
+/**
+ * @brief  Holds the shared AppMenu::SearchIndex, and applies all changes to
+ *         desktop entries and menu shortcuts to the index on its own thread.
+ *
+ *  The SearchThread indexes all desktop entries when it first starts. The
+ * entries of the most frequently launched applications are indexed and shared
+ * first, so they can be found before the rest of the index is ready. Once all
+ * entries are indexed, only desktop entries and menu shortcuts that were
+ * added, changed, or removed are updated. Updates are applied to a copy of the
+ * current index, and the updated copy replaces the current index once all
+ * changes are applied. Searches never need to wait for updates to finish.
+ *
+ *  The SearchThread should only be accessed through AppMenu::Searcher objects.
+ */
+class AppMenu::SearchThread : public SharedResource::Thread::Resource
+{
+public:
+    // SharedResource object key:
+    static const juce::Identifier resourceKey;
+
+    /**
+     * @brief  Creates the thread with an empty search index, scheduling all
+     *         desktop entries to be indexed once the thread starts.
+     */
+    SearchThread();
+
+    virtual ~SearchThread() { }
+
+    /**
+     * @brief  Gets the current search index.
+     *
+     * @return  The most recently completed search index. This will never be
+     *          changed, and may safely be used after the thread is unlocked.
+     */
+    std::shared_ptr<const SearchIndex> getSearchIndex() const;
+
+    /**
+     * @brief  Schedules desktop entries to be added or updated in the index.
+     *
+     * @param entryFileIDs  The desktop file IDs of new or changed entries.
+     */
+    void updateEntries(const juce::StringArray& entryFileIDs);
+
+    /**
+     * @brief  Schedules desktop entries to be removed from the index.
+     *
+     * @param entryFileIDs  The desktop file IDs of removed entries.
+     */
+    void removeEntries(const juce::StringArray& entryFileIDs);
+
+    /**
+     * @brief  Schedules the index to be updated with the current list of menu
+     *         shortcuts, if the list has changed.
+     *
+     * @param shortcuts  Search items created from all shortcuts defined in the
+     *                   menu configuration file.
+     */
+    void updateShortcuts(const std::vector<SearchIndex::Item>& shortcuts);
+
+private:
+    /**
+     * @brief  Applies all scheduled changes to a copy of the search index,
+     *         replaces the current index with the updated copy, and notifies
+     *         all Searcher objects on the message thread.
+     *
+     * @param lock  The thread's resource lock.
+     */
+    virtual void runLoop(SharedResource::Thread::Lock& lock) override;
+
+    /**
+     * @brief  Keeps the thread dormant while no changes are scheduled.
+     *
+     * @return  Whether the index is up to date.
+     */
+    virtual bool threadShouldWait() override;
+
+    /**
+     * @brief  Replaces the current search index, and notifies all Searcher
+     *         objects on the message thread.
+     *
+     * @param lock      The thread's resource lock. This must not be locked
+     *                  when this function is called.
+     *
+     * @param newIndex  The new search index. This must not be changed after
+     *                  it is shared.
+     */
+    void replaceSearchIndex(SharedResource::Thread::Lock& lock,
+            const std::shared_ptr<const SearchIndex> newIndex);
+
+    /**
+     * @brief  Starts the thread if necessary, or wakes it if it is waiting
+     *         for updates.
+     */
+    void scheduleUpdate();
+
+    // The most recently completed search index:
+    std::shared_ptr<const SearchIndex> searchIndex;
+
+    // Whether all desktop entries need to be indexed:
+    bool indexAllEntries = true;
+
+    // Desktop file IDs of entries waiting to be added or updated:
+    std::set<juce::String> updatedEntryIDs;
+
+    // Desktop file IDs of entries waiting to be removed:
+    std::set<juce::String> removedEntryIDs;
+
+    // Index keys of all menu shortcuts, mapped to their search items:
+    std::map<juce::String, SearchIndex::Item> menuShortcuts;
+
+    // Whether the menu shortcuts changed since they were last indexed:
+    bool shortcutsChanged = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SearchThread)
+};
@@ -0,0 +1,94 @@
+#define APPMENU_IMPLEMENTATION
+#include "AppMenu_Searcher.h"
+#include "AppMenu_SearchThread.h"
+#include "AppMenu_EntryActions.h"
+#include "AppMenu_MenuFile.h"
+#include "AppMenu_MenuItem.h"
+
+// Connects to the SearchThread and ensures that it has indexed the current menu
+// shortcuts.
+AppMenu::Searcher::Searcher() :
+SharedResource::Handler<SearchThread>(),
+DesktopEntry::UpdateListener()
+{
+    loadMenuShortcuts();
+}
+
+
+// Finds the application items that best match search text.
+std::vector<AppMenu::SearchIndex::Item> AppMenu::Searcher::findMatches
+(const juce::String& searchText, const int maxResults) const
+{
+    std::shared_ptr<const SearchIndex> searchIndex;
+    {
+        SharedResource::LockedPtr<const SearchThread> searchThread
+                = SharedResource::Handler<SearchThread>
+                ::getReadLockedResource();
+        searchIndex = searchThread->getSearchIndex();
+    }
+    // The index won't change, so it can be searched after the thread is
+    // unlocked:
+    return searchIndex->findMatches(searchText, maxResults);
+}
+
+
+// Reads all application shortcuts from the menu configuration file, and
+// schedules the search index to be updated if they have changed.
+void AppMenu::Searcher::loadMenuShortcuts()
+{
+    std::vector<SearchIndex::Item> shortcuts;
+    MenuFile menuFile;
+    EntryActions::recursiveFolderAction(menuFile.getRootFolderItem(),
+    [&shortcuts](MenuItem folder)
+    {
+        // Desktop entry items are always placed after all items from the
+        // menu configuration file:
+        for (int i = 0; i < folder.getMovableChildCount(); i++)
+        {
+            const MenuItem menuItem = folder.getFolderItem(i);
+            if (menuItem.isFolder() || menuItem.getCommand().isEmpty())
+            {
+                continue;
+            }
+            SearchIndex::Item shortcut;
+            shortcut.title = menuItem.getTitle();
+            shortcut.iconName = menuItem.getIconName();
+            shortcut.command = menuItem.getCommand();
+            shortcut.launchedInTerm = menuItem.getLaunchedInTerm();
+            shortcut.categories = menuItem.getCategories();
+            shortcut.executable = shortcut.command.upToFirstOccurrenceOf(
+                    " ", false, false).fromLastOccurrenceOf("/", false, false);
+            shortcuts.push_back(shortcut);
+        }
+    });
+    SharedResource::LockedPtr<SearchThread> searchThread
+            = SharedResource::Handler<SearchThread>::getWriteLockedResource();
+    searchThread->updateShortcuts(shortcuts);
+}
+
+
+// Schedules new desktop entries to be added to the search index.
+void AppMenu::Searcher::entriesAdded(const juce::StringArray entryFileIDs)
+{
+    SharedResource::LockedPtr<SearchThread> searchThread
+            = SharedResource::Handler<SearchThread>::getWriteLockedResource();
+    searchThread->updateEntries(entryFileIDs);
+}
+
+
+// Schedules removed desktop entries to be removed from the search index.
+void AppMenu::Searcher::entriesRemoved(const juce::StringArray entryFileIDs)
+{
+    SharedResource::LockedPtr<SearchThread> searchThread
+            = SharedResource::Handler<SearchThread>::getWriteLockedResource();
+    searchThread->removeEntries(entryFileIDs);
+}
+
+
+// Schedules changed desktop entries to be updated in the search index.
+void AppMenu::Searcher::entriesUpdated(const juce::StringArray entryFileIDs)
+{
+    SharedResource::LockedPtr<SearchThread> searchThread
+            = SharedResource::Handler<SearchThread>::getWriteLockedResource();
+    searchThread->updateEntries(entryFileIDs);
+}
@@ -0,0 +1,103 @@
+#ifndef APPMENU_IMPLEMENTATION
+    #error File included directly outside of AppMenu implementation.
+#endif
+#pragma once
+/**
+ * @file  AppMenu_Searcher.h
+ *
+ * @brief  Searches for applications using the shared application search index.
+ */
+
+#include "AppMenu_SearchIndex.h"
+#include "DesktopEntry_UpdateListener.h"
+#include "SharedResource_Handler.h"
+#include "JuceHeader.h"
+#include <vector>
+
+namespace AppMenu { class Searcher; }
+namespace AppMenu { class SearchThread; }
+
+/**
+ * @brief  Connects to the AppMenu::SearchThread to find applications, and
+ *         keeps the search index updated when desktop entries change.
+ *
+ *  Searches run on the calling thread using the most recently completed search
+ * index, so they never wait for the index to be updated. Searcher subclasses
+ * may override searchIndexUpdated to refresh their search results whenever the
+ * SearchThread finishes updating the index.
+ *
+ *  The DesktopEntry::LoadingThread finds its listeners by casting, so the
+ * UpdateListener base class, and the Searcher base class of any Searcher
+ * subclass, must be public.
+ */
+class AppMenu::Searcher : public SharedResource::Handler<SearchThread>,
+    public DesktopEntry::UpdateListener
+{
+public:
+    // Allow the SearchThread to send index update notifications:
+    friend class SearchThread;
+
+    /**
+     * @brief  Connects to the SearchThread and ensures that it has indexed the
+     *         current menu shortcuts.
+     */
+    Searcher();
+
+    virtual ~Searcher() { }
+
+    /**
+     * @brief  Finds the application items that best match search text.
+     *
+     * @param searchText  The text to search for.
+     *
+     * @param maxResults  The maximum number of items to return.
+     *
+     * @return            Up to maxResults matching items, with the best
+     *                    matches first.
+     */
+    std::vector<SearchIndex::Item> findMatches(const juce::String& searchText,
+            const int maxResults) const;
+
+    /**
+     * @brief  Reads all application shortcuts from the menu configuration
+     *         file, and schedules the search index to be updated if they have
+     *         changed.
+     *
+     *  This must only be called on the message thread.
+     */
+    void loadMenuShortcuts();
+
+private:
+    /**
+     * @brief  Called on the message thread whenever the SearchThread replaces
+     *         the search index. Searcher subclasses may override this to
+     *         refresh their search results.
+     */
+    virtual void searchIndexUpdated() { }
+
+    /**
+     * @brief  Schedules new desktop entries to be added to the search index.
+     *
+     * @param entryFileIDs  The desktop file IDs of all new desktop entries.
+     */
+    virtual void entriesAdded(const juce::StringArray entryFileIDs) override;
+
+    /**
+     * @brief  Schedules removed desktop entries to be removed from the search
+     *         index.
+     *
+     * @param entryFileIDs  The desktop file IDs of all removed or hidden
+     *                      desktop entries.
+     */
+    virtual void entriesRemoved(const juce::StringArray entryFileIDs) override;
+
+    /**
+     * @brief  Schedules changed desktop entries to be updated in the search
+     *         index.
+     *
+     * @param entryFileIDs  The desktop file IDs of all updated desktop entries.
+     */
+    virtual void entriesUpdated(const juce::StringArray entryFileIDs) override;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Searcher)
+};
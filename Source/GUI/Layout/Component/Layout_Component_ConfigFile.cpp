@@ -30,6 +30,19 @@ int ComponentLayout::ConfigFile::getFontHeight
 {
     SharedResource::LockedPtr<const JSONResource> config
             = getReadLockedResource();
+    return getFittedFontHeight(textBounds, text,
+            getFontHeight(TextSize::smallText),
+            getFontHeight(TextSize::mediumText),
+            getFontHeight(TextSize::largeText));
+}
+
+
+// Selects the most appropriate font size for drawing text from a set of
+// configured font heights.
+int ComponentLayout::ConfigFile::getFittedFontHeight
+(const juce::Rectangle<int> textBounds, const juce::String& text,
+        const int smallHeight, const int mediumHeight, const int largeHeight)
+{
     int numLines = 1;
     for (int i = 0; i < text.length(); i++)
     {
@@ -45,20 +58,17 @@ int ComponentLayout::ConfigFile::getFontHeight
     {
         height = textBounds.getWidth() * height / width;
     }
-    int testHeight = getFontHeight(TextSize::largeText);
-    if (height > testHeight)
+    if (height > largeHeight)
     {
-        return testHeight;
+        return largeHeight;
     }
-    testHeight = getFontHeight(TextSize::mediumText);
-    if (height > testHeight)
+    if (height > mediumHeight)
     {
-        return testHeight;
+        return mediumHeight;
     }
-    testHeight = getFontHeight(TextSize::smallText);
-    if (height > testHeight)
+    if (height > smallHeight)
     {
-        return testHeight;
+        return smallHeight;
     }
     return height;
 }
@@ -59,4 +59,29 @@ public:
      * @return          The height in pixels of that text size type.
      */
     int getFontHeight(TextSize sizeType);
+
+    /**
+     * @brief  Selects the most appropriate font size for drawing text from a
+     *         set of configured font heights.
+     *
+     *  This allows objects that save configured font heights to fit text
+     * without accessing the JSON resource.
+     *
+     * @param textBounds    The area in which the text will be drawn.
+     *
+     * @param text          The actual text being drawn.
+     *
+     * @param smallHeight   The small text height in pixels.
+     *
+     * @param mediumHeight  The medium text height in pixels.
+     *
+     * @param largeHeight   The large text height in pixels.
+     *
+     * @return              Whichever font height would best fit this text
+     *                      within its bounds, or the largest height that will
+     *                      fit if even the small font is too large to fit.
+     */
+    static int getFittedFontHeight(const juce::Rectangle<int> textBounds,
+            const juce::String& text, const int smallHeight,
+            const int mediumHeight, const int largeHeight);
 };
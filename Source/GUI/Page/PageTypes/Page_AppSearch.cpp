@@ -0,0 +1,25 @@
+#include "Page_AppSearch.h"
+#include "AppMenu.h"
+
+// Creates the search component and initializes the page layout.
+Page::AppSearch::AppSearch() :
+searchComponent(AppMenu::createSearchComponent())
+{
+#ifdef JUCE_DEBUG
+    setName("Page::AppSearch");
+#endif
+    using namespace Layout::Group;
+    RelativeLayout layout(
+    {
+        Row(1, { RowItem(searchComponent.get()) })
+    });
+    setBackButton(BackButtonType::left);
+    setLayout(layout);
+}
+
+
+// Replaces the page's search text.
+void Page::AppSearch::setSearchText(const juce::String& searchText)
+{
+    AppMenu::setSearchText(searchComponent.get(), searchText);
+}
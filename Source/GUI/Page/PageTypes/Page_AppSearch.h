@@ -0,0 +1,38 @@
+#pragma once
+/**
+ * @file  Page_AppSearch.h
+ *
+ * @brief  The application page used to search for and launch applications.
+ */
+
+#include "Page_Component.h"
+
+namespace Page { class AppSearch; }
+
+/**
+ * @brief  A page component that holds the AppMenu's application search
+ *         component.
+ */
+class Page::AppSearch final : public Component
+{
+public:
+    /**
+     * @brief  Creates the search component and initializes the page layout.
+     */
+    AppSearch();
+
+    virtual ~AppSearch() { }
+
+    /**
+     * @brief  Replaces the page's search text.
+     *
+     * @param searchText  The new search text.
+     */
+    void setSearchText(const juce::String& searchText);
+
+private:
+    // Finds and launches applications:
+    std::unique_ptr<juce::Component> searchComponent;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AppSearch)
+};
@@ -105,7 +105,7 @@ void Page::Component::removeFromStack(Layout::Transition::Type transition)
 
 
 // Creates and pushes a new page on top of the stack.
-void Page::Component::pushPageToStack(const Type pageType,
+Page::Component* Page::Component::pushPageToStack(const Type pageType,
         const Layout::Transition::Type transition)
 {
     if (isStackTop() && getFactoryInterface() != nullptr)
@@ -115,7 +115,9 @@ void Page::Component::pushPageToStack(const Type pageType,
         Component* newPage = static_cast<Component*>
                 (getFactoryInterface()->createPage(pageType));
         getStackInterface()->pushPage(newPage, transition);
+        return newPage;
     }
+    return nullptr;
 }
 
 
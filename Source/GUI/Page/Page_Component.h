@@ -142,8 +142,11 @@ protected:
 
      * @param transition  The transition animation to run if the page is
      *                    successfully added to the stack.
+     *
+     * @return            The new page, or nullptr if this page isn't on top
+     *                    of a page stack and couldn't add a new page.
      */
-    void pushPageToStack(Page::Type pageType,
+    Component* pushPageToStack(Page::Type pageType,
             Layout::Transition::Type transition
                 = Layout::Transition::Type::moveLeft);
 
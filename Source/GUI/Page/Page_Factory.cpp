@@ -1,4 +1,5 @@
 #include "Page_Factory.h"
+#include "Page_AppSearch.h"
 #include "Page_Fel.h"
 #include "Page_Type.h"
 #include "Page_HomeSettings.h"
@@ -54,6 +55,9 @@ Page::Component* Page::Factory::createPage(const Type pageType)
         case Type::homeSettings:
             newPage = new HomeSettings;
             break;
+        case Type::appSearch:
+            newPage = new AppSearch;
+            break;
 #ifdef CHIP_FEATURES
         case Type::fel:
             newPage = new Fel;
@@ -21,6 +21,7 @@ enum class Page::Type
     removePassword,
     colourSettings,
     homeSettings,
+    appSearch,
     #ifdef CHIP_FEATURES
     fel,
     #endif
@@ -240,16 +240,26 @@ void Settings::WifiList::ListComponent::selectionChanged()
 }
 
 
-// Schedules a list update when access point strength changes.
-void Settings::WifiList::ListComponent::signalStrengthUpdate
-(const Wifi::AccessPoint updatedAP)
+// Adds and removes changed access points, and then schedules a single list
+// update for all access point changes.
+void Settings::WifiList::ListComponent::accessPointsUpdated
+(const juce::Array<Wifi::AccessPoint>& addedAPs,
+        const juce::Array<Wifi::AccessPoint>& removedAPs,
+        const juce::Array<Wifi::AccessPoint>& updatedAPs)
 {
+    for (const Wifi::AccessPoint& addedAP : addedAPs)
+    {
+        accessPointAdded(addedAP);
+    }
+    for (const Wifi::AccessPoint& removedAP : removedAPs)
+    {
+        accessPointRemoved(removedAP);
+    }
     scheduleListUpdate();
 }
 
 
-// Adds a newly discovered access point to the list, and schedules a list
-// update.
+// Adds a newly discovered access point to the list.
 void Settings::WifiList::ListComponent::accessPointAdded
 (const Wifi::AccessPoint addedAP)
 {
@@ -264,12 +274,11 @@ void Settings::WifiList::ListComponent::accessPointAdded
             invalidSelectionIndex = -1;
         }
     }
-    scheduleListUpdate();
 }
 
 
-// Replaces the removed access point with a null access point and schedules a
-// list update whenever an access point is lost.
+// Replaces the removed access point with a null access point whenever an
+// access point is lost, or marks it for removal if it is selected.
 void Settings::WifiList::ListComponent::accessPointRemoved
 (const Wifi::AccessPoint removedAP)
 {
@@ -290,7 +299,6 @@ void Settings::WifiList::ListComponent::accessPointRemoved
         else
         {
             visibleAPs.set(removedIndex, Wifi::AccessPoint());
-            scheduleListUpdate();
         }
     }
 }
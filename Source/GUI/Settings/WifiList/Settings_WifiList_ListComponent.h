@@ -7,7 +7,7 @@
  */
 
 #include "Widgets_FocusingPagedList.h"
-#include "Wifi_AP_StrengthListener.h"
+#include "Wifi_AccessPoint.h"
 #include "Wifi_APList_Listener.h"
 #include "Wifi_Connection_Record_Listener.h"
 #include "Settings_WifiList_ControlComponent.h"
@@ -22,7 +22,6 @@ namespace Settings { namespace WifiList { class ListComponent; } }
  */
 class Settings::WifiList::ListComponent : public Widgets::FocusingPagedList,
         public Wifi::APList::Listener,
-        public Wifi::AP::StrengthListener,
         public Wifi::Connection::Record::Listener
 {
 public:
@@ -106,24 +105,32 @@ private:
     virtual void selectionChanged() final override;
 
     /**
-     * @brief  Schedules a list update when access point strength changes.
+     * @brief  Adds and removes changed access points, and then schedules a
+     *         single list update for all access point changes.
      *
-     * @param updatedAP  The AccessPoint with a new signal strength value.
+     * @param addedAPs    All newly discovered access points.
+     *
+     * @param removedAPs  All access points that are no longer visible.
+     *
+     * @param updatedAPs  All visible access points with significant signal
+     *                    strength changes.
      */
-    virtual void signalStrengthUpdate(const Wifi::AccessPoint updatedAP)
-        final override;
+    virtual void accessPointsUpdated
+    (const juce::Array<Wifi::AccessPoint>& addedAPs,
+            const juce::Array<Wifi::AccessPoint>& removedAPs,
+            const juce::Array<Wifi::AccessPoint>& updatedAPs) final override;
 
     /**
-     * @brief  Adds a newly discovered access point to the list, and schedules
-     *         a list update.
+     * @brief  Adds a newly discovered access point to the list.
      *
      * @param newAP  The new Wifi::AccessPoint object.
      */
     virtual void accessPointAdded(const Wifi::AccessPoint newAP) override;
 
     /**
-     * @brief  Replaces the removed access point with a null access point and
-     *         schedules a list update whenever an access point is lost.
+     * @brief  Replaces the removed access point with a null access point
+     *         whenever an access point is lost, or marks it for removal if it
+     *         is selected.
      *
      * @param removedAP  The access point that is no longer visible.
      */
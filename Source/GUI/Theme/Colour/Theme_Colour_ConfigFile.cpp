@@ -11,14 +11,9 @@ ColourTheme::ConfigFile::ConfigFile() { }
 // Look up the Colour value saved for a specific JUCE ColourId.
 juce::Colour ColourTheme::ConfigFile::getColour(const int colourId)
 {
-    using namespace JSONKeys;
-    juce::String colourStr = getColourString(getColourKey(colourId));
-    if (colourStr.isEmpty())
-    {
-        // No specific value set, look up the UICategory value.
-        return getColour(getUICategory(colourId));
-    }
-    return juce::Colour(colourStr.getHexValue32());
+    SharedResource::LockedPtr<const JSONResource> colourResource
+            = getReadLockedResource();
+    return colourResource->getColour(colourId);
 }
 
 
@@ -26,11 +21,9 @@ juce::Colour ColourTheme::ConfigFile::getColour(const int colourId)
 // category.
 juce::Colour ColourTheme::ConfigFile::getColour(UICategory category)
 {
-    if (category == UICategory::none)
-    {
-        return juce::Colour();
-    }
-    return getColour(JSONKeys::getCategoryKey(category));
+    SharedResource::LockedPtr<const JSONResource> colourResource
+            = getReadLockedResource();
+    return colourResource->getColour(category);
 }
 
 
@@ -38,18 +31,9 @@ juce::Colour ColourTheme::ConfigFile::getColour(UICategory category)
 juce::Colour ColourTheme::ConfigFile::getColour
 (const juce::Identifier& colourKey)
 {
-    juce::String colourStr = getColourString(colourKey);
-    if (colourStr.isEmpty())
-    {
-        // No specific value set, look up the UICategory value.
-        const int colourId = JSONKeys::getColourId(colourKey);
-        if (colourId == -1)
-        {
-            return juce::Colour();
-        }
-        return getColour(JSONKeys::getUICategory(colourId));
-    }
-    return juce::Colour(colourStr.getHexValue32());
+    SharedResource::LockedPtr<const JSONResource> colourResource
+            = getReadLockedResource();
+    return colourResource->getColour(colourKey);
 }
 
 
@@ -83,10 +67,3 @@ void ColourTheme::ConfigFile::setColour
     setConfigValue<juce::String>(colourKey, newColour.toString());
 }
 
-
-// Gets a Colour string saved to the colour config file.
-juce::String ColourTheme::ConfigFile::getColourString
-(const juce::Identifier& colourKey)
-{
-    return getConfigValue<juce::String>(colourKey);
-}
@@ -97,16 +97,5 @@ public:
             const juce::Colour newColour);
 
 private:
-    /**
-     * @brief  Gets a Colour string saved to the colour config file.
-     *
-     * @param colourKey  The key to a colour value saved in the colours.json
-     *                   file.
-     *
-     * @return           The colour hex string mapped to that key, or the empty
-     *                   string if the key isn't found.
-     */
-    juce::String getColourString(const juce::Identifier& colourKey);
-
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ConfigFile)
 };
@@ -1,6 +1,8 @@
 #include "Theme_Colour_ConfigListener.h"
 #include "Theme_Colour_JSONResource.h"
 #include "Theme_Colour_JSONKeys.h"
+#include <tuple>
+#include <vector>
 
 namespace ColourTheme = Theme::Colour;
 
@@ -44,33 +46,32 @@ ColourTheme::ConfigListener::getTrackedIds() const
 // each tracked colourId.
 void ColourTheme::ConfigListener::loadAllConfigProperties()
 {
-    using namespace Theme::Colour::JSONKeys;
-    using juce::String;
     using juce::Identifier;
     using juce::Colour;
-
-    const juce::ScopedLock colourLock(trackedColourIds.getLock());
-    for (const int& colourId : trackedColourIds)
+    // Tracked ColourIds paired with their source keys and colours:
+    std::vector<std::tuple<int, Identifier, Colour>> trackedColours;
     {
-        const Identifier& idKey = getColourKey(colourId);
-        if (idKey != invalidKey)
+        const juce::ScopedLock colourLock(trackedColourIds.getLock());
+        SharedResource::LockedPtr<const JSONResource> colourResource
+                = getReadLockedResource();
+        for (const int& colourId : trackedColourIds)
         {
-            String colourStr = getConfigValue<String>(idKey);
-            if (colourStr.isNotEmpty())
+            // IDs without a key or a category colour are skipped:
+            const Identifier& sourceKey
+                    = colourResource->getColourSourceKey(colourId);
+            if (sourceKey != JSONKeys::invalidKey)
             {
-                colourChanged(colourId, idKey,
-                        Colour(colourStr.getHexValue32()));
-                continue;
+                trackedColours.push_back(std::make_tuple(colourId, sourceKey,
+                            colourResource->getColour(colourId)));
             }
         }
-        // ID has no key, or specific colour not defined, use category colour:
-        UICategory idCategory = getUICategory(colourId);
-        if (idCategory != UICategory::none)
-        {
-            const Identifier& catKey = getCategoryKey(idCategory);
-            colourChanged(colourId, catKey,
-                    Colour(getConfigValue<String>(catKey).getHexValue32()));
-        }
+    }
+    // Notify without holding the resource lock, so colourChanged may safely
+    // use other colour config objects:
+    for (const auto& trackedColour : trackedColours)
+    {
+        colourChanged(std::get<0>(trackedColour), std::get<1>(trackedColour),
+                std::get<2>(trackedColour));
     }
     Config::Listener<JSONResource>::loadAllConfigProperties();
 }
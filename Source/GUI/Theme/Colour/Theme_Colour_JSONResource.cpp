@@ -1,5 +1,6 @@
 #include "Theme_Colour_JSONResource.h"
 #include "Theme_Colour_JSONKeys.h"
+#include "Theme_Colour_ColourIds.h"
 #include "Config_Listener.h"
 
 #ifdef JUCE_DEBUG
@@ -18,6 +19,71 @@ Theme::Colour::JSONResource::JSONResource() :
 Config::FileResource(resourceKey, configFilename)
 {
     loadJSONData();
+    buildColourTable();
+}
+
+
+// Gets the resolved Colour value of a JUCE ColourId.
+juce::Colour Theme::Colour::JSONResource::getColour(const int colourId) const
+{
+    auto indexIter = elementIndices.find(colourId);
+    if (indexIter == elementIndices.end())
+    {
+        return juce::Colour();
+    }
+    return elementColours[indexIter->second].colour;
+}
+
+
+// Gets the Colour value assigned to a UI category.
+juce::Colour Theme::Colour::JSONResource::getColour
+(const UICategory category) const
+{
+    if (category == UICategory::none)
+    {
+        return juce::Colour();
+    }
+    return categoryColours[(int) category];
+}
+
+
+// Gets the resolved Colour value associated with a colour key.
+juce::Colour Theme::Colour::JSONResource::getColour
+(const juce::Identifier& colourKey) const
+{
+    auto elementIter = elementKeyIndices.find(colourKey);
+    if (elementIter != elementKeyIndices.end())
+    {
+        return elementColours[elementIter->second].colour;
+    }
+    auto categoryIter = categoryKeyIndices.find(colourKey);
+    if (categoryIter != categoryKeyIndices.end())
+    {
+        return categoryColours[categoryIter->second];
+    }
+    return juce::Colour();
+}
+
+
+// Gets the key of the config value that sets a ColourId's resolved Colour.
+const juce::Identifier& Theme::Colour::JSONResource::getColourSourceKey
+(const int colourId) const
+{
+    auto indexIter = elementIndices.find(colourId);
+    if (indexIter == elementIndices.end())
+    {
+        return JSONKeys::invalidKey;
+    }
+    const ElementEntry& entry = elementColours[indexIter->second];
+    if (entry.hasOwnColour)
+    {
+        return entry.colourKey;
+    }
+    if (entry.categoryIndex < 0)
+    {
+        return JSONKeys::invalidKey;
+    }
+    return JSONKeys::getCategoryKey((UICategory) entry.categoryIndex);
 }
 
 
@@ -40,60 +106,136 @@ Theme::Colour::JSONResource::getConfigKeys() const
 }
 
 
-// Checks if a single handler object is a Listener tracking updates of a single
-// key value, and if so, notifies it that the tracked value has updated.
-void Theme::Colour::JSONResource::notifyListener(ListenerInterface* listener,
-        const juce::Identifier& key)
+// Updates the colour table when colour values change, and notifies
+// Colour::ConfigListener objects tracking ColourIds with updated colours.
+void Theme::Colour::JSONResource::configValuesChanged
+(const juce::Array<juce::Identifier>& changedKeys)
 {
-    using namespace Theme::Colour::JSONKeys;
-    using juce::String;
     using juce::Identifier;
-    Config::Listener<JSONResource>* configListener
-            = dynamic_cast<Config::Listener<JSONResource>*> (listener);
-    if (configListener != nullptr)
+    // Indices of updated colour table entries, paired with the keys that
+    // updated them:
+    std::vector<std::pair<int, const Identifier*>> updates;
+    for (const Identifier& key : changedKeys)
     {
-        // Check for and notify listeners tracking colours by ColourId:
-        String colourStr = getConfigValue<String>(key);
-        int colourId = getColourId(key);
-        if (colourStr.isEmpty())
+        auto elementIter = elementKeyIndices.find(key);
+        if (elementIter != elementKeyIndices.end())
         {
-            if (colourId == -1)
+            if (updateElementColour(elementIter->second))
             {
-                // Category colour removed, this shouldn't happen.
-                DBG(dbgPrefix << __func__ << ": Colour category "
-                        << key << " value was removed!");
-                jassertfalse;
+                updates.push_back({ elementIter->second, &key });
             }
-            // Colour removed, revert to category colour
-            colourStr = getConfigValue<String>
-                    (getCategoryKey(getUICategory(colourId)));
-            jassert(colourStr.isNotEmpty());
+            continue;
+        }
+        auto categoryIter = categoryKeyIndices.find(key);
+        if (categoryIter == categoryKeyIndices.end())
+        {
+            continue;
+        }
+        const int categoryIndex = categoryIter->second;
+        const juce::String colourStr = getConfigValue<juce::String>(key);
+        if (colourStr.isEmpty())
+        {
+            // Category colour removed, this shouldn't happen.
+            DBG(dbgPrefix << __func__ << ": Colour category "
+                    << key << " value was removed!");
+            jassertfalse;
         }
-        const juce::Colour newColour(colourStr.getHexValue32());
-        if (colourId > -1)
+        categoryColours[categoryIndex]
+                = juce::Colour(colourStr.getHexValue32());
+        for (int i = 0; i < (int) elementColours.size(); i++)
         {
-            if (listener->isTrackedId(colourId))
+            const ElementEntry& entry = elementColours[i];
+            if (entry.categoryIndex == categoryIndex && !entry.hasOwnColour
+                    && updateElementColour(i))
             {
-                listener->colourChanged(colourId, key, newColour);
+                updates.push_back({ i, &key });
             }
         }
-        else // Colour category changed
+    }
+    if (updates.empty())
+    {
+        return;
+    }
+    foreachHandler<Theme::Colour::ListenerInterface>([this, &updates]
+            (Theme::Colour::ListenerInterface* listener)
+    {
+        for (const auto& update : updates)
         {
-            UICategory category = getCategoryType(key);
-            const juce::Array<int, juce::CriticalSection>& trackedColourIds
-                    = listener->getTrackedIds();
-            for (const int& trackedId : trackedColourIds)
+            const ElementEntry& entry = elementColours[update.first];
+            if (listener->isTrackedId(entry.colourId))
             {
-                if (getUICategory(trackedId) == category)
-                {
-                    const Identifier& idKey = getColourKey(trackedId);
-                    if (idKey == invalidKey
-                            || getConfigValue<String>(idKey).isEmpty())
-                    {
-                        listener->colourChanged(trackedId, key, newColour);
-                    }
-                }
+                listener->colourChanged(entry.colourId, *update.second,
+                        entry.colour);
             }
         }
+    });
+}
+
+
+// Loads all colour table values from the colour config data.
+void Theme::Colour::JSONResource::buildColourTable()
+{
+    using juce::Identifier;
+    categoryColours.clear();
+    elementColours.clear();
+    elementIndices.clear();
+    elementKeyIndices.clear();
+    categoryKeyIndices.clear();
+
+    const juce::Array<Identifier>& categoryKeys = JSONKeys::getCategoryKeys();
+    for (int i = 0; i < categoryKeys.size(); i++)
+    {
+        categoryKeyIndices[categoryKeys[i]] = i;
+        categoryColours.push_back(juce::Colour(getConfigValue<juce::String>(
+                    categoryKeys[i]).getHexValue32()));
+    }
+
+    elementColours.reserve(ColourIds::allElements.size());
+    for (const Element* element : ColourIds::allElements)
+    {
+        const int elementIndex = (int) elementColours.size();
+        const UICategory category = element->getColourCategory();
+        ElementEntry entry;
+        entry.colourId = element->getColourId();
+        entry.categoryIndex = (category == UICategory::none)
+                ? -1 : (int) category;
+        entry.colourKey = JSONKeys::getColourKey(entry.colourId);
+        entry.hasOwnColour = false;
+        elementColours.push_back(entry);
+        elementIndices[entry.colourId] = elementIndex;
+        if (entry.colourKey != JSONKeys::invalidKey)
+        {
+            elementKeyIndices[entry.colourKey] = elementIndex;
+        }
+        updateElementColour(elementIndex);
+    }
+}
+
+
+// Updates a single ColourId's resolved colour table entry.
+bool Theme::Colour::JSONResource::updateElementColour(const int elementIndex)
+{
+    ElementEntry& entry = elementColours[elementIndex];
+    juce::Colour newColour;
+    entry.hasOwnColour = false;
+    if (entry.colourKey != JSONKeys::invalidKey)
+    {
+        const juce::String colourStr
+                = getConfigValue<juce::String>(entry.colourKey);
+        if (colourStr.isNotEmpty())
+        {
+            entry.hasOwnColour = true;
+            newColour = juce::Colour(colourStr.getHexValue32());
+        }
+    }
+    if (!entry.hasOwnColour && entry.categoryIndex >= 0)
+    {
+        newColour = categoryColours[entry.categoryIndex];
+    }
+    if (newColour == entry.colour)
+    {
+        return false;
     }
+    entry.colour = newColour;
+    return true;
 }
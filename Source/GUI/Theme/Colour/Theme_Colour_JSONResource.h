@@ -9,9 +9,23 @@
 #include "Config_FileResource.h"
 #include "Config_Listener.h"
 #include "Theme_Colour_ListenerInterface.h"
+#include <map>
+#include <unordered_map>
+#include <vector>
 
 namespace Theme { namespace Colour { class JSONResource; } }
 
+/**
+ * @brief  Loads all UI colour values, and notifies Colour::ConfigListener
+ *         objects when they change.
+ *
+ *  Along with the colour strings saved in colours.json, the JSONResource keeps
+ * a table of resolved Colour values for each UI category and each JUCE
+ * ColourId. Table values already have category fallback colours applied, so
+ * colours can be read without parsing colour strings or checking categories.
+ * When a colour value changes, only the table entries affected by that value
+ * are updated.
+ */
 class Theme::Colour::JSONResource : public Config::FileResource
 {
 public:
@@ -22,6 +36,51 @@ public:
 
     virtual ~JSONResource() { }
 
+    /**
+     * @brief  Gets the resolved Colour value of a JUCE ColourId.
+     *
+     * @param colourId  The ID value representing the colour of a specific UI
+     *                  element.
+     *
+     * @return          The Colour set for the colourId, the Colour of the
+     *                  colourId's UICategory if no specific colour is set, or
+     *                  Colour() if colourId is not a valid id.
+     */
+    juce::Colour getColour(const int colourId) const;
+
+    /**
+     * @brief  Gets the Colour value assigned to a UI category.
+     *
+     * @param category  One of the categories of UI elements.
+     *
+     * @return          The category's Colour, or Colour() if category is
+     *                  UICategory::none.
+     */
+    juce::Colour getColour(const UICategory category) const;
+
+    /**
+     * @brief  Gets the resolved Colour value associated with a colour key.
+     *
+     * @param colourKey  A ColourId key or UICategory key.
+     *
+     * @return           The resolved Colour for that key, or Colour() if the
+     *                   colour key isn't valid.
+     */
+    juce::Colour getColour(const juce::Identifier& colourKey) const;
+
+    /**
+     * @brief  Gets the key of the config value that sets a ColourId's
+     *         resolved Colour.
+     *
+     * @param colourId  The ID value representing the colour of a specific UI
+     *                  element.
+     *
+     * @return          The colourId's own key if it has a specific colour set,
+     *                  its UICategory key if it doesn't, or
+     *                  JSONKeys::invalidKey if colourId is not a valid id.
+     */
+    const juce::Identifier& getColourSourceKey(const int colourId) const;
+
 private:
     /**
      * @brief  Gets the set of all basic(non-array, non-object) properties
@@ -33,15 +92,58 @@ private:
         const final override;
 
     /**
-     * @brief  Checks if a single handler object is a Listener tracking updates
-     *         of a single key value, and if so, notifies it that the tracked
-     *         value has updated.
+     * @brief  Updates the colour table when colour values change, and
+     *         notifies Colour::ConfigListener objects tracking ColourIds with
+     *         updated colours.
+     *
+     * @param changedKeys  The keys of all colour values that just changed.
+     */
+    virtual void configValuesChanged
+    (const juce::Array<juce::Identifier>& changedKeys) override;
+
+    /**
+     * @brief  Loads all colour table values from the colour config data.
+     */
+    void buildColourTable();
+
+    /**
+     * @brief  Updates a single ColourId's resolved colour table entry.
      *
-     * @param listener  A Listener object attached to the JSON resource.
+     * @param elementIndex  The ColourId's index in the colour table.
      *
-     * @param key       The key to an updated configuration value.
+     * @return              Whether the resolved Colour changed.
      */
-    void notifyListener(ListenerInterface* listener,
-            const juce::Identifier& key);
-};
+    bool updateElementColour(const int elementIndex);
+
+    /**
+     * @brief  Holds the resolved colour of a single JUCE ColourId.
+     */
+    struct ElementEntry
+    {
+        // The element's JUCE ColourId:
+        int colourId;
+        // The element's UICategory index:
+        int categoryIndex;
+        // The element's colour key, or JSONKeys::invalidKey if it has none:
+        juce::Identifier colourKey;
+        // Whether the element's colour is set by its own key:
+        bool hasOwnColour;
+        // The element's resolved colour:
+        juce::Colour colour;
+    };
+
+    // Resolved UICategory colours, indexed by UICategory:
+    std::vector<juce::Colour> categoryColours;
 
+    // Resolved ColourId colours, sorted by ColourId:
+    std::vector<ElementEntry> elementColours;
+
+    // Maps each ColourId to its index in elementColours:
+    std::unordered_map<int, int> elementIndices;
+
+    // Maps each ColourId key to its index in elementColours:
+    std::map<juce::Identifier, int> elementKeyIndices;
+
+    // Maps each UICategory key to its index in categoryColours:
+    std::map<juce::Identifier, int> categoryKeyIndices;
+};
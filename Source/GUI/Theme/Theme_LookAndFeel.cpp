@@ -2,6 +2,9 @@
 #include "Theme_Colour_JSONKeys.h"
 #include "Config_MainKeys.h"
 #include "Layout_Component_ConfigFile.h"
+#include "Layout_Component_JSONResource.h"
+#include "Layout_Component_JSONKeys.h"
+#include "Windows_Info.h"
 #include "Widgets_Switch.h"
 #include "Widgets_BoundedLabel.h"
 #include "Widgets_DrawableImage.h"
@@ -16,7 +19,8 @@ Theme::LookAndFeel::LookAndFeel() :
 seguibl(juce::Typeface::createSystemTypefaceFor(BinaryData::LatoRegular_ttf,
         BinaryData::LatoRegular_ttfSize)),
 cursor(juce::MouseCursor::NoCursor),
-mainListener(*this)
+mainListener(*this),
+layoutListener(*this)
 {
     using juce::Array;
     using juce::Identifier;
@@ -177,11 +181,7 @@ void Theme::LookAndFeel::drawButtonText(
     textBounds.setWidth(width);
     textBounds.setHeight(height);
 
-    using TextSize = Layout::Component::TextSize;
-    Layout::Component::ConfigFile layoutConfig;
-    int fontHeight = layoutConfig.getFontHeight
-            (textBounds, button.getButtonText());
-    font.setHeight(fontHeight);
+    font.setHeight(getFontHeight(textBounds, button.getButtonText()));
     g.setFont(font);
 
     juce::Colour buttonColour = button.findColour(button.getToggleState() ?
@@ -239,8 +239,7 @@ juce::MouseCursor Theme::LookAndFeel::getMouseCursorFor
 juce::Font Theme::LookAndFeel::getPopupMenuFont()
 {
     using TextSize = Layout::Component::TextSize;
-    Layout::Component::ConfigFile config;
-    return juce::Font(config.getFontHeight(TextSize::mediumText));
+    return juce::Font(getFontHeight(TextSize::mediumText));
 }
 
 
@@ -248,10 +247,8 @@ juce::Font Theme::LookAndFeel::getPopupMenuFont()
 juce::Font Theme::LookAndFeel::getComboBoxFont(juce::ComboBox& comboBox)
 {
     using TextSize = Layout::Component::TextSize;
-    Layout::Component::ConfigFile config;
-    int height = config.getFontHeight(comboBox.getLocalBounds(),
-            comboBox.getText());
-    height = std::min( config.getFontHeight(TextSize::mediumText), height);
+    const int height = std::min(getFontHeight(TextSize::mediumText),
+            getFontHeight(comboBox.getLocalBounds(), comboBox.getText()));
     return juce::Font(height);
 }
 
@@ -266,10 +263,9 @@ juce::Font Theme::LookAndFeel::getLabelFont(juce::Label& label)
     {
         return label.getFont();
     }
-    Layout::Component::ConfigFile config;
     using TextSize = Layout::Component::TextSize;
-    int height = std::min(config.getFontHeight(TextSize::smallText),
-            config.getFontHeight(label.getLocalBounds(), label.getText()));
+    const int height = std::min(getFontHeight(TextSize::smallText),
+            getFontHeight(label.getLocalBounds(), label.getText()));
     return juce::Font(height);
 }
 
@@ -277,18 +273,61 @@ juce::Font Theme::LookAndFeel::getLabelFont(juce::Label& label)
 // Gets the default font to use for alert window title text.
 juce::Font Theme::LookAndFeel::getAlertWindowTitleFont()
 {
-    Layout::Component::ConfigFile config;
     using TextSize = Layout::Component::TextSize;
-    return juce::Font(config.getFontHeight(TextSize::largeText));
+    return juce::Font(getFontHeight(TextSize::largeText));
 }
 
 
 // Gets the default font to use for alert window message text.
 juce::Font Theme::LookAndFeel::getAlertWindowMessageFont()
 {
-    Layout::Component::ConfigFile config;
     using TextSize = Layout::Component::TextSize;
-    return juce::Font(config.getFontHeight(TextSize::mediumText));
+    return juce::Font(getFontHeight(TextSize::mediumText));
+}
+
+
+// Gets the height in pixels of one of the three configured text sizes,
+// updating saved font heights if necessary.
+int Theme::LookAndFeel::getFontHeight
+(const Layout::Component::TextSize sizeType)
+{
+    const juce::Rectangle<int> windowBounds = Windows::Info::getBounds();
+    if (fontHeightsOutdated
+            || windowBounds.getWidth() != fontWindowBounds.getWidth()
+            || windowBounds.getHeight() != fontWindowBounds.getHeight())
+    {
+        updateFontHeights(windowBounds);
+    }
+    return fontHeights[(int) sizeType];
+}
+
+
+// Gets the most appropriate saved font height for drawing text.
+int Theme::LookAndFeel::getFontHeight
+(const juce::Rectangle<int> textBounds, const juce::String& text)
+{
+    using TextSize = Layout::Component::TextSize;
+    const int smallHeight = getFontHeight(TextSize::smallText);
+    return Layout::Component::ConfigFile::getFittedFontHeight(textBounds, text,
+            smallHeight, fontHeights[(int) TextSize::mediumText],
+            fontHeights[(int) TextSize::largeText]);
+}
+
+
+// Reloads all configured font heights.
+void Theme::LookAndFeel::updateFontHeights
+(const juce::Rectangle<int> windowBounds)
+{
+    using TextSize = Layout::Component::TextSize;
+    // Clear the flag first, so changes made while loading aren't missed:
+    fontHeightsOutdated = false;
+    Layout::Component::ConfigFile config;
+    for (const TextSize sizeType : { TextSize::smallText,
+            TextSize::mediumText, TextSize::largeText })
+    {
+        fontHeights[(int) sizeType] = config.getFontHeight(sizeType);
+    }
+    fontWindowBounds = windowBounds;
 }
 
 Theme::LookAndFeel::MainListener::MainListener(Theme::LookAndFeel& owner) :
@@ -312,6 +351,24 @@ void Theme::LookAndFeel::MainListener::configValueChanged
 }
 
 
+Theme::LookAndFeel::LayoutListener::LayoutListener(Theme::LookAndFeel& owner) :
+owner(owner)
+{
+    namespace Keys = Layout::Component::JSONKeys;
+    addTrackedKey(Keys::smallText);
+    addTrackedKey(Keys::mediumText);
+    addTrackedKey(Keys::largeText);
+}
+
+
+// Notifies the LookAndFeel object when text size settings change.
+void Theme::LookAndFeel::LayoutListener::configValueChanged
+(const juce::Identifier& key)
+{
+    owner.fontHeightsOutdated = true;
+}
+
+
 // Updates Component colours when they're changed in the ColourConfigFile.
 void Theme::LookAndFeel::colourChanged(const int colourId,
         const juce::Identifier& colourKey, const juce::Colour newColour)
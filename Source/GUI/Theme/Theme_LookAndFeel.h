@@ -10,8 +10,11 @@
 #include "Config_MainListener.h"
 #include "Theme_Colour_ConfigFile.h"
 #include "Theme_Colour_ConfigListener.h"
+#include "Layout_Component_TextSize.h"
+#include <atomic>
 
 namespace Theme { class LookAndFeel; }
+namespace Layout { namespace Component { class JSONResource; } }
 
 /**
  * @brief  Sets UI values and defines custom draw routines for JUCE sliders and
@@ -21,6 +24,11 @@ namespace Theme { class LookAndFeel; }
  *  Directly interacting with this class should not be necessary, except when
  * the application calls LookAndFeel::setDefaultLookAndFeel() to set a
  * Theme::LookAndFeel object as the default.
+ *
+ *  Colours and font heights used while drawing are saved within the
+ * LookAndFeel, and only updated when their configuration values or the window
+ * size change, so drawing components never needs to access configuration
+ * file resources.
  */
 class Theme::LookAndFeel : public juce::LookAndFeel_V4,
         public Colour::ConfigListener
@@ -187,6 +195,61 @@ private:
     friend class MainListener;
     MainListener mainListener;
 
+    /**
+     * @brief  Marks saved font heights as outdated when text sizes change in
+     *         the component layout configuration file.
+     */
+    class LayoutListener :
+        public Config::Listener<Layout::Component::JSONResource>
+    {
+    public:
+        LayoutListener(LookAndFeel& owner);
+        virtual ~LayoutListener() { }
+    private:
+        /**
+         * @brief  Notifies the LookAndFeel object when text size settings
+         *         change.
+         *
+         * @param key  The updated text size key.
+         */
+        void configValueChanged(const juce::Identifier& key) override;
+        LookAndFeel& owner;
+    };
+    friend class LayoutListener;
+    LayoutListener layoutListener;
+
+    /**
+     * @brief  Gets the height in pixels of one of the three configured text
+     *         sizes, updating saved font heights if necessary.
+     *
+     * @param sizeType  A text size type defined in the Component config file.
+     *
+     * @return          The height in pixels of that text size type.
+     */
+    int getFontHeight(const Layout::Component::TextSize sizeType);
+
+    /**
+     * @brief  Gets the most appropriate saved font height for drawing text.
+     *
+     * @param textBounds  The area in which the text will be drawn.
+     *
+     * @param text        The actual text being drawn.
+     *
+     * @return            The configured font height that best fits the text
+     *                    within its bounds, or the largest height that will fit
+     *                    if even the small font is too large to fit.
+     */
+    int getFontHeight(const juce::Rectangle<int> textBounds,
+            const juce::String& text);
+
+    /**
+     * @brief  Reloads all configured font heights.
+     *
+     * @param windowBounds  The current bounds of the main application window,
+     *                      used to scale relative font heights.
+     */
+    void updateFontHeights(const juce::Rectangle<int> windowBounds);
+
     /**
      * @brief  Updates Component colours when they're changed in the component
      *         layout configuration file.
@@ -211,4 +274,11 @@ private:
     juce::Typeface::Ptr seguibl;
     // Application cursor:
     juce::MouseCursor::StandardCursorType cursor;
+
+    // Saved heights of each configured text size, indexed by TextSize:
+    int fontHeights[3] = { 0, 0, 0 };
+    // Window bounds used when the saved font heights were calculated:
+    juce::Rectangle<int> fontWindowBounds;
+    // Whether text size settings changed since font heights were saved:
+    std::atomic<bool> fontHeightsOutdated { true };
 };
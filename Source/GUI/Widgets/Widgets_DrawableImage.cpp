@@ -1,5 +1,6 @@
 #include "Widgets_DrawableImage.h"
 #include "Assets.h"
+#include "Assets_SVGLoader.h"
 #include "Theme_Colour_ConfigFile.h"
 #include <map>
 
@@ -85,7 +86,16 @@ void Widgets::DrawableImage::setImage(const juce::File imageFile)
         {
             removeChildComponent(imageDrawable.get());
         }
-        imageDrawable = juce::Drawable::createFromImageFile(imageFile);
+        if (imageFile.getFileExtension() == ".svg")
+        {
+            // Reuse the parsed SVG if it was already loaded:
+            const Assets::SVGLoader svgLoader;
+            imageDrawable = svgLoader.loadDrawable(imageFile);
+        }
+        else
+        {
+            imageDrawable = juce::Drawable::createFromImageFile(imageFile);
+        }
         if (imageDrawable != nullptr)
         {
             imageSource = imageFile;
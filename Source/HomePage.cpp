@@ -5,6 +5,7 @@
 #include "AppMenu.h"
 #include "AppMenu_ConfigFile.h"
 #include "Page_Type.h"
+#include "Page_AppSearch.h"
 #include "Config_MainFile.h"
 #include "Util_SafeCall.h"
 
@@ -144,3 +145,27 @@ void HomePage::pageResized()
         layoutManager.applyConfigBounds();
     }
 }
+
+
+// Opens the application search page when a text character is typed and the
+// AppMenu doesn't use the key event.
+bool HomePage::keyPressed(const juce::KeyPress& keyPress)
+{
+    const juce::ModifierKeys modifiers = keyPress.getModifiers();
+    const juce::juce_wchar typedChar = keyPress.getTextCharacter();
+    if (typedChar <= ' ' || modifiers.isCtrlDown() || modifiers.isAltDown()
+            || modifiers.isCommandDown())
+    {
+        return false;
+    }
+    Page::AppSearch* searchPage = static_cast<Page::AppSearch*>
+            (pushPageToStack(Page::Type::appSearch));
+    if (searchPage == nullptr)
+    {
+        return false;
+    }
+    // Start the search with the typed character, so it isn't lost while the
+    // search page opens:
+    searchPage->setSearchText(juce::String::charToString(typedChar));
+    return true;
+}
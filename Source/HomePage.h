@@ -28,7 +28,8 @@
  *
  *  HomePage displays the application menu, time, battery percentage, and Wifi
  * connection state. HomePage also provides navigation buttons used to access
- * the power and settings pages.
+ * the power and settings pages. Typing text while the HomePage is visible opens
+ * the application search page.
  *
  *  HomePage is Pocket-Home's base page component, and the first page shown,
  * except perhaps the login page. The HomePage will continue to exist as long as
@@ -77,6 +78,16 @@ private:
      */
     void pageResized() override;
 
+    /**
+     * @brief  Opens the application search page when a text character is
+     *         typed and the AppMenu doesn't use the key event.
+     *
+     * @param keyPress  The key event that wasn't used by the AppMenu.
+     *
+     * @return          Whether the search page was opened.
+     */
+    virtual bool keyPressed(const juce::KeyPress& keyPress) override;
+
     class PageListener: public juce::Button::Listener
     {
     public:
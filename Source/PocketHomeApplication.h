@@ -11,6 +11,7 @@
 #include "Layout_Component_ConfigFile.h"
 #include "Theme_Colour_ConfigFile.h"
 #include "Theme_Image_ConfigFile.h"
+#include "Assets_SVGLoader.h"
 #include "Util_ConditionChecker.h"
 
 /**
@@ -105,6 +106,9 @@ private:
     // Holds UI colour settings:
     Theme::Colour::ConfigFile colourConfig;
 
+    // Holds parsed SVG files and cached SVG images:
+    Assets::SVGLoader svgLoader;
+
     // These resources are dynamically allocated because they should be created
     // in the order listed here, and destroyed in the opposite order.
 
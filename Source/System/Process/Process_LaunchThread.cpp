@@ -0,0 +1,188 @@
+#include "Process_LaunchThread.h"
+#include "Process_Launched.h"
+
+#ifdef JUCE_DEBUG
+// Print the full class name before all debug output:
+static const constexpr char* dbgPrefix = "Process::LaunchThread::";
+#endif
+
+// SharedResource object key:
+const juce::Identifier Process::LaunchThread::resourceKey
+        = "Process::LaunchThread";
+
+// Resource thread name:
+static const juce::String threadName = "Process_LaunchThread";
+
+Process::LaunchThread::LaunchThread() :
+SharedResource::Thread::Resource(resourceKey, ::threadName) { }
+
+
+// Destroys any launched processes that were never delivered to their
+// requesters.
+Process::LaunchThread::~LaunchThread()
+{
+    for (Request& request : finishedRequests)
+    {
+        delete request.launched;
+    }
+}
+
+
+// Adds a request to validate a launch command and start a new process with it.
+void Process::LaunchThread::addLaunchRequest(const Launcher* requester,
+        const juce::String& command,
+        const std::function<void(Launched*)> onLaunch)
+{
+    queueRequest({ requester, command, -1, onLaunch, nullptr, nullptr,
+            false });
+}
+
+
+// Adds a request to focus the windows of a running process.
+void Process::LaunchThread::addFocusRequest(const Launcher* requester,
+        const int processId, const std::function<void(bool)> onFocus)
+{
+    queueRequest({ requester, juce::String(), processId, nullptr, onFocus,
+            nullptr, false });
+}
+
+
+// Cancels all pending requests from a Launcher.
+void Process::LaunchThread::cancelRequests(const Launcher* requester)
+{
+    for (auto requestIter = queuedRequests.begin();
+            requestIter != queuedRequests.end();)
+    {
+        if (requestIter->requester == requester)
+        {
+            requestIter = queuedRequests.erase(requestIter);
+        }
+        else
+        {
+            requestIter++;
+        }
+    }
+    for (Request& request : activeRequests)
+    {
+        if (request.requester == requester)
+        {
+            request.requester = nullptr;
+        }
+    }
+    for (Request& request : finishedRequests)
+    {
+        if (request.requester == requester)
+        {
+            request.requester = nullptr;
+        }
+    }
+}
+
+
+// Handles all queued requests, then schedules result delivery on the message
+// thread.
+void Process::LaunchThread::runLoop(SharedResource::Thread::Lock& lock)
+{
+    lock.enterWrite();
+    activeRequests.swap(queuedRequests);
+    std::vector<Request> batch = activeRequests;
+    lock.exitWrite();
+
+    // Requests are handled without holding the lock, so slow launches or
+    // window searches never block the message thread:
+    for (Request& request : batch)
+    {
+        if (request.command.isNotEmpty())
+        {
+            if (pathResolver.isValidCommand(request.command))
+            {
+                request.launched = new Launched(request.command);
+            }
+            else
+            {
+                DBG(dbgPrefix << __func__ << ": Invalid command "
+                        << request.command);
+            }
+        }
+        else
+        {
+            request.windowsFocused
+                    = Launched::activateProcessWindows(request.processId);
+        }
+    }
+
+    lock.enterWrite();
+    for (size_t i = 0; i < batch.size(); i++)
+    {
+        // Requests cancelled while they were handled won't be delivered:
+        if (activeRequests[i].requester == nullptr)
+        {
+            delete batch[i].launched;
+        }
+        else
+        {
+            finishedRequests.push_back(batch[i]);
+        }
+    }
+    activeRequests.clear();
+    if (!finishedRequests.empty() && !deliveryScheduled)
+    {
+        deliveryScheduled = true;
+        juce::MessageManager::callAsync(buildAsyncFunction(
+                    SharedResource::LockType::write, [this]
+        {
+            deliverResults();
+        }));
+    }
+    lock.exitWrite();
+}
+
+
+// Keeps the thread dormant while no requests are queued.
+bool Process::LaunchThread::threadShouldWait()
+{
+    return queuedRequests.empty();
+}
+
+
+// Passes all finished requests to their callback functions.
+void Process::LaunchThread::deliverResults()
+{
+    std::vector<Request> delivered;
+    delivered.swap(finishedRequests);
+    deliveryScheduled = false;
+    for (Request& request : delivered)
+    {
+        const bool cancelled = (request.requester == nullptr);
+        if (request.command.isNotEmpty())
+        {
+            if (!cancelled && request.launchCallback)
+            {
+                request.launchCallback(request.launched);
+            }
+            else
+            {
+                delete request.launched;
+            }
+        }
+        else if (!cancelled && request.focusCallback)
+        {
+            request.focusCallback(request.windowsFocused);
+        }
+    }
+}
+
+
+// Adds a request to the queue, starting the thread if needed.
+void Process::LaunchThread::queueRequest(const Request& request)
+{
+    queuedRequests.push_back(request);
+    if (!isThreadRunning())
+    {
+        startResourceThread();
+    }
+    else
+    {
+        notify();
+    }
+}
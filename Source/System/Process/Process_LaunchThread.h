@@ -0,0 +1,155 @@
+#pragma once
+/**
+ * @file  Process_LaunchThread.h
+ *
+ * @brief  Validates and starts application processes and focuses application
+ *         windows without blocking the message thread.
+ */
+
+#include "SharedResource_Thread_Resource.h"
+#include "Process_PathResolver.h"
+#include "JuceHeader.h"
+#include <functional>
+#include <vector>
+
+namespace Process { class LaunchThread; }
+namespace Process { class Launched; }
+namespace Process { class Launcher; }
+
+/**
+ * @brief  Handles application launch and window focus requests on a separate
+ *         thread.
+ *
+ *  Launch commands are checked with a Process::PathResolver and started as new
+ * Process::Launched objects. Focus requests search for and activate all
+ * windows belonging to a running process. Request results are passed to their
+ * callback functions on the message thread.
+ *
+ *  The LaunchThread should only be accessed through Process::Launcher objects.
+ */
+class Process::LaunchThread : public SharedResource::Thread::Resource
+{
+public:
+    // SharedResource object key:
+    static const juce::Identifier resourceKey;
+
+    LaunchThread();
+
+    /**
+     * @brief  Destroys any launched processes that were never delivered to
+     *         their requesters.
+     */
+    virtual ~LaunchThread();
+
+    /**
+     * @brief  Adds a request to validate a launch command and start a new
+     *         process with it.
+     *
+     * @param requester  The Launcher making the request.
+     *
+     * @param command    The application launch command.
+     *
+     * @param onLaunch   A function to call on the message thread when the
+     *                   launch finishes. It will be passed the new Launched
+     *                   process object, or nullptr if the command was invalid.
+     *                   The callback function takes ownership of the Launched
+     *                   object.
+     */
+    void addLaunchRequest(const Launcher* requester,
+            const juce::String& command,
+            const std::function<void(Launched*)> onLaunch);
+
+    /**
+     * @brief  Adds a request to focus the windows of a running process.
+     *
+     * @param requester  The Launcher making the request.
+     *
+     * @param processId  The ID of the process to focus.
+     *
+     * @param onFocus    A function to call on the message thread when the
+     *                   request finishes. It will be passed whether any
+     *                   windows were found and activated.
+     */
+    void addFocusRequest(const Launcher* requester, const int processId,
+            const std::function<void(bool)> onFocus);
+
+    /**
+     * @brief  Cancels all pending requests from a Launcher. Processes that
+     *         were already started will keep running.
+     *
+     * @param requester  The Launcher being destroyed.
+     */
+    void cancelRequests(const Launcher* requester);
+
+private:
+    /**
+     * @brief  Handles all queued requests, then schedules result delivery on
+     *         the message thread.
+     *
+     * @param lock  The thread's resource lock.
+     */
+    virtual void runLoop(SharedResource::Thread::Lock& lock) override;
+
+    /**
+     * @brief  Keeps the thread dormant while no requests are queued.
+     *
+     * @return  Whether the request queue is empty.
+     */
+    virtual bool threadShouldWait() override;
+
+    /**
+     * @brief  Passes all finished requests to their callback functions. This
+     *         should only be called on the message thread, while the resource
+     *         is locked for writing.
+     */
+    void deliverResults();
+
+    /**
+     * @brief  Holds a launch or focus request, along with its result once it
+     *         has been handled.
+     */
+    struct Request
+    {
+        // The Launcher that made the request:
+        const Launcher* requester;
+        // The launch command, or the empty string for focus requests:
+        juce::String command;
+        // The process to focus, used only for focus requests:
+        int processId;
+        // Launch request callback:
+        std::function<void(Launched*)> launchCallback;
+        // Focus request callback:
+        std::function<void(bool)> focusCallback;
+        // The launched process, once a launch request is handled:
+        Launched* launched;
+        // Whether windows were focused, once a focus request is handled:
+        bool windowsFocused;
+    };
+
+    /**
+     * @brief  Adds a request to the queue, starting the thread if needed.
+     *
+     * @param request  The new request.
+     */
+    void queueRequest(const Request& request);
+
+    // Requests waiting to be handled:
+    std::vector<Request> queuedRequests;
+
+    // Requests currently being handled by the thread. Cancelled requests
+    // remain in this list with a null requester until they are handled:
+    std::vector<Request> activeRequests;
+
+    // Handled requests waiting to be delivered:
+    std::vector<Request> finishedRequests;
+
+    // Whether the message thread has been asked to deliver results:
+    bool deliveryScheduled = false;
+
+    // Checks launch commands on the thread. Keeping this resolver for as long
+    // as the LaunchThread exists keeps search results cached between
+    // requests:
+    PathResolver pathResolver;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LaunchThread)
+};
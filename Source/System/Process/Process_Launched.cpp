@@ -1,47 +1,109 @@
 #include "Process_Launched.h"
-#include "Process_Data.h"
-#include "Process_State.h"
 #include "JuceHeader.h"
 #include "Windows_XInterface.h"
-#include <unistd.h>
+#include <cerrno>
+#include <csignal>
 #include <cstdint>
+#include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <unistd.h>
+#include <vector>
 
 #ifdef JUCE_DEBUG
 // Print the full class name before all debug output:
 static const constexpr char* dbgPrefix = "Process::Launched::";
 #endif
 
-// If a juce::ChildProcess crashes, attempts to wait for it to terminate will
-// wait forever if not given a timeout period. Instead of waiting indefinitely,
-// LaunchedProcess will repeatedly wait for processCheckInterval milliseconds,
-// checking the process state between waiting periods.
+// Process environment, passed on to launched processes:
+extern char** environ;
+
+// While waiting for a process to finish, Launched waits on its output
+// for up to processCheckInterval milliseconds at a time, checking the process
+// state between waiting periods. Processes that exit normally close their
+// output, so this only limits how often processes that pass their output on to
+// other processes are checked.
 static const constexpr int processCheckInterval = 500;
 
+// Milliseconds to wait between process checks once the process output has
+// closed, while the Supervisor reaps the process:
+static const constexpr int exitCheckInterval = 5;
+
+// Milliseconds to wait for a killed process to exit:
+static const constexpr int killTimeout = 1000;
+
+// Size in bytes of the buffer used to read process output:
+static const constexpr int readBufferSize = 4096;
+
 // Runs an application launch command in a new child process on construction.
 Process::Launched::Launched(const juce::String launchCommand) :
-launchCommand(launchCommand)
+launchCommand(launchCommand), exitWatcher(*this)
 {
-    if (childProcess.start(launchCommand))
+    // Split the command into arguments the same way as juce::ChildProcess:
+    juce::StringArray arguments;
+    arguments.addTokens(launchCommand, true);
+    arguments.removeEmptyStrings(true);
+    for (juce::String& argument : arguments)
     {
-        Data currentProcess(getpid());
-        juce::Array<Data> childProcesses = currentProcess.getChildProcesses();
-        jassert(!childProcesses.isEmpty());
-        for (const Data& process : childProcesses)
-        {
-            if (process.isValid())
-            {
-                if (launchCommand.contains(process.getExecutableName()))
-                {
-                    processId = process.getProcessId();
-                    break;
-                }
-            }
-        }
+        argument = argument.unquoted();
+    }
+    if (arguments.isEmpty())
+    {
+        DBG(dbgPrefix << __func__ << ": Empty launch command.");
+        outputValid = false;
+        return;
+    }
+    std::vector<char*> argumentPointers;
+    for (const juce::String& argument : arguments)
+    {
+        argumentPointers.push_back(const_cast<char*>(argument.toRawUTF8()));
+    }
+    argumentPointers.push_back(nullptr);
+
+    int outputPipe[2];
+    if (pipe2(outputPipe, O_CLOEXEC) != 0)
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to create output pipe.");
+        outputValid = false;
+        return;
     }
-    else
+    // Send both stdout and stderr to the output pipe:
+    posix_spawn_file_actions_t fileActions;
+    posix_spawn_file_actions_init(&fileActions);
+    posix_spawn_file_actions_adddup2(&fileActions, outputPipe[1],
+            STDOUT_FILENO);
+    posix_spawn_file_actions_adddup2(&fileActions, outputPipe[1],
+            STDERR_FILENO);
+    pid_t newProcessId = -1;
+    const int spawnResult = posix_spawnp(&newProcessId, argumentPointers[0],
+            &fileActions, nullptr, argumentPointers.data(), environ);
+    posix_spawn_file_actions_destroy(&fileActions);
+    close(outputPipe[1]);
+    if (spawnResult != 0)
     {
-        DBG(dbgPrefix << __func__ << ": Failed to launch " << launchCommand);
+        DBG(dbgPrefix << __func__ << ": Failed to launch " << launchCommand
+                << ", error=" << spawnResult);
+        close(outputPipe[0]);
         outputValid = false;
+        return;
+    }
+    processId = newProcessId;
+    outputFD = outputPipe[0];
+    fcntl(outputFD, F_SETFL, fcntl(outputFD, F_GETFL) | O_NONBLOCK);
+    exitWatcher.watchProcess(processId);
+}
+
+
+// Stops watching the process and closes its output pipe.
+Process::Launched::~Launched()
+{
+    if (processId > 0)
+    {
+        exitWatcher.forgetProcess(processId);
+    }
+    if (outputFD >= 0)
+    {
+        close(outputFD);
     }
 }
 
@@ -53,29 +115,35 @@ juce::String Process::Launched::getLaunchCommand() const
 }
 
 
+// Gets the system process ID of the launched process.
+int Process::Launched::getProcessId() const
+{
+    return processId;
+}
+
+
+// Sets a function to call on the message thread when the launched process
+// exits.
+void Process::Launched::setExitCallback(const std::function<void()> onExit)
+{
+    exitCallback = onExit;
+}
+
+
 // Checks if the launched application is still running.
 bool Process::Launched::isRunning()
 {
-    bool processRunning = childProcess.isRunning();
-    if (processRunning)
+    if (exited || processId < 0)
     {
-        Data processData(processId);
-        DBG(dbgPrefix << __func__ << ": process " << launchCommand
-                << " is in state " << stateString(processData.getLastState()));
-        if (!processData.isValid()
-                || processData.getLastState() == State::dead)
-        {
-            DBG(dbgPrefix << __func__
-                    << ": Launched process is dead/missing, but juce::Process "
-                    << "object reports that it is still running.");
-            DBG(dbgPrefix << __func__
-                    << ": Attempting to kill invalid process:");
-            const bool processKilled = kill();
-            jassert(processKilled);
-            processRunning = false;
-        }
+        return false;
     }
-    return processRunning;
+    if (exitWatcher.isProcessRunning(processId))
+    {
+        return true;
+    }
+    exited = true;
+    exitCode = exitWatcher.getExitCode(processId);
+    return false;
 }
 
 
@@ -83,47 +151,57 @@ bool Process::Launched::isRunning()
 bool Process::Launched::kill()
 {
     outputValid = false;
-    return childProcess.kill();
+    if (!isRunning())
+    {
+        return false;
+    }
+    if (::kill(processId, SIGKILL) != 0)
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to kill " << launchCommand
+                << ", errno=" << errno);
+        return false;
+    }
+    // SIGKILL can't be ignored, so the process should exit almost
+    // immediately:
+    waitForProcessToFinish(killTimeout);
+    return true;
 }
 
 
 // Waits for the application process to end.
 void Process::Launched::waitForProcessToFinish(const int timeoutMs)
 {
-    const bool noTimeout = (timeoutMs == -1);
-    juce::uint32 endTime = juce::Time::getMillisecondCounter() + timeoutMs;
-    Data process(processId);
-    while (childProcess.isRunning()
-            && process.getLastState() != State::zombie
-            && process.getLastState() != State::stopped
-            && process.getLastState() != State::dead
-            && process.getLastState() != State::unknown
-            && process.getLastState() != State::invalid
-            && (noTimeout || juce::Time::getMillisecondCounter() < endTime))
-
+    const bool noTimeout = (timeoutMs < 0);
+    const juce::uint32 endTime = juce::Time::getMillisecondCounter()
+            + timeoutMs;
+    while (isRunning())
     {
         int waitTime = processCheckInterval;
-        if (timeoutMs >= 0)
+        if (!noTimeout)
         {
-            juce::uint32 timeLeft = endTime
-                    - juce::Time::getMillisecondCounter();
-            if (timeLeft < waitTime)
+            const juce::uint32 currentTime
+                    = juce::Time::getMillisecondCounter();
+            if (currentTime >= endTime)
             {
-                waitTime = timeLeft;
+                DBG(dbgPrefix << __func__ << ": process " << launchCommand
+                        << " did not finish.");
+                return;
             }
+            waitTime = juce::jmin(waitTime, (int) (endTime - currentTime));
+        }
+        if (outputFD >= 0)
+        {
+            // Output must be read while waiting, or the process could block
+            // after filling the output pipe:
+            struct pollfd outputPoll = { outputFD, POLLIN, 0 };
+            poll(&outputPoll, 1, waitTime);
+            readOutput();
+        }
+        else
+        {
+            juce::Thread::sleep(juce::jmin(waitTime, exitCheckInterval));
         }
-        childProcess.waitForProcessToFinish(waitTime);
-        process = Data(processId);
-    }
-#ifdef JUCE_DEBUG
-    if (juce::Time::getMillisecondCounter() >= endTime
-            && childProcess.isRunning())
-    {
-        DBG(dbgPrefix << __func__ << ": process " << launchCommand
-                << " did not finish, process state="
-                << stateString(process.getLastState()));
     }
-#endif
 }
 
 
@@ -134,19 +212,16 @@ juce::String Process::Launched::getProcessOutput()
     {
         return juce::String();
     }
-    if (!isRunning())
-    {
-        return childProcess.readAllProcessOutput();
-    }
-    else
+    if (isRunning())
     {
-        Data process(processId);
         DBG(dbgPrefix << __func__ << ": process " << launchCommand
-                << " is still active in state "
-                << stateString(process.getLastState())
-                << ", can't get output");
+                << " is still active, can't get output");
         return juce::String();
     }
+    readOutput();
+    return juce::String::fromUTF8(
+            static_cast<const char*>(processOutput.getData()),
+            (int) processOutput.getSize());
 }
 
 
@@ -157,7 +232,8 @@ juce::uint32 Process::Launched::getExitCode()
     {
         return UINT32_MAX;
     }
-    return childProcess.getExitCode();
+    // Unknown exit codes are treated as success, as juce::ChildProcess did:
+    return (juce::uint32) juce::jmax(0, exitCode);
 }
 
 
@@ -176,9 +252,17 @@ void Process::Launched::activateWindow()
         return;
     }
 
+    activateProcessWindows(processId);
+}
+
+
+// Moves all windows belonging to a process in front of all other windows and
+// focuses them.
+bool Process::Launched::activateProcessWindows(const int processId)
+{
     Windows::XInterface xWindows;
     juce::Array<Window> appWindows = xWindows.getMatchingWindows(
-            [this, &xWindows](Window window)
+            [processId, &xWindows](Window window)
     {
         return xWindows.getWindowPID(window) == processId
                 && xWindows.getWindowName(window).isNotEmpty()
@@ -187,12 +271,68 @@ void Process::Launched::activateWindow()
     if (appWindows.isEmpty())
     {
         DBG(dbgPrefix << __func__ << ": no windows found!");
-        return;
+        return false;
     }
     for (const Window& window : appWindows)
     {
-        DBG(dbgPrefix << __func__ << ": Activating window for "
-                << launchCommand);
+        DBG(dbgPrefix << __func__ << ": Activating window for process "
+                << processId);
         xWindows.activateWindow(window);
     }
+    return true;
+}
+
+
+// Reads all process output that is currently available, closing the output
+// pipe once the process closes it.
+void Process::Launched::readOutput()
+{
+    char readBuffer[readBufferSize];
+    while (outputFD >= 0)
+    {
+        const ssize_t bytesRead = read(outputFD, readBuffer, readBufferSize);
+        if (bytesRead > 0)
+        {
+            processOutput.append(readBuffer, (size_t) bytesRead);
+        }
+        else if (bytesRead < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (bytesRead < 0 && errno == EAGAIN)
+        {
+            return;
+        }
+        else
+        {
+            close(outputFD);
+            outputFD = -1;
+        }
+    }
+}
+
+
+// Connects the ExitWatcher to its Launched process.
+Process::Launched::ExitWatcher::ExitWatcher(Launched& launched) :
+launched(launched) { }
+
+
+// Saves the exit code and runs the exit callback when the launched process
+// exits.
+void Process::Launched::ExitWatcher::processExited
+(const int processId, const int exitCode)
+{
+    if (processId != launched.processId)
+    {
+        return;
+    }
+    if (!launched.exited)
+    {
+        launched.exited = true;
+        launched.exitCode = exitCode;
+    }
+    if (launched.exitCallback)
+    {
+        launched.exitCallback();
+    }
 }
@@ -5,7 +5,9 @@
  */
 #pragma once
 
+#include "Process_Watcher.h"
 #include "JuceHeader.h"
+#include <functional>
 
 namespace Process { class Launched; }
 
@@ -17,6 +19,10 @@ namespace Process { class Launched; }
  * focus the application's window, stop the application, or read the
  * application's output.
  *
+ *  The process ID is known as soon as the process starts, and process exits
+ * are detected by the shared Process::Supervisor, so checking the process
+ * state never requires searching through system process data.
+ *
  *  Destroying the Launched object does not stop the associated child process.
  */
 class Process::Launched
@@ -30,7 +36,10 @@ public:
      */
     Launched(const juce::String launchCommand);
 
-    virtual ~Launched() { }
+    /**
+     * @brief  Stops watching the process and closes its output pipe.
+     */
+    virtual ~Launched();
 
     /**
      * @brief  Gets the launch command used to start the process.
@@ -39,6 +48,21 @@ public:
      */
     juce::String getLaunchCommand() const;
 
+    /**
+     * @brief  Gets the system process ID of the launched process.
+     *
+     * @return  The process ID, or -1 if the process failed to launch.
+     */
+    int getProcessId() const;
+
+    /**
+     * @brief  Sets a function to call on the message thread when the launched
+     *         process exits.
+     *
+     * @param onExit  The function to call after the process exits.
+     */
+    void setExitCallback(const std::function<void()> onExit);
+
     /**
      * @brief  Checks if the launched application is still running.
      *
@@ -83,15 +107,76 @@ public:
      */
     void activateWindow();
 
+    /**
+     * @brief  Moves all windows belonging to a process in front of all other
+     *         windows and focuses them.
+     *
+     *  This opens its own connection to the X display, so it may be called
+     * from any thread.
+     *
+     * @param processId  The ID of a running process.
+     *
+     * @return           Whether any windows belonging to the process were
+     *                   found.
+     */
+    static bool activateProcessWindows(const int processId);
+
 private:
-    // Handles the application's process.
-    juce::ChildProcess childProcess;
+    /**
+     * @brief  Reads all process output that is currently available, closing
+     *         the output pipe once the process closes it.
+     */
+    void readOutput();
+
+    /**
+     * @brief  Receives exit notifications from the Process::Supervisor.
+     */
+    class ExitWatcher : public Watcher
+    {
+    public:
+        /**
+         * @brief  Connects the ExitWatcher to its Launched process.
+         *
+         * @param launched  The Launched object that owns this ExitWatcher.
+         */
+        ExitWatcher(Launched& launched);
+
+        virtual ~ExitWatcher() { }
+
+    private:
+        /**
+         * @brief  Saves the exit code and runs the exit callback when the
+         *         launched process exits.
+         *
+         * @param processId  The ID of the process that exited.
+         *
+         * @param exitCode   The process exit code.
+         */
+        virtual void processExited(const int processId, const int exitCode)
+            override;
+
+        // The Launched object that owns this ExitWatcher:
+        Launched& launched;
+    };
+
     // The command used to launch the process.
     juce::String launchCommand;
     // The application's system process ID.
     int processId = -1;
     // Whether the process is in a state where valid output can be read.
     bool outputValid = true;
+    // Read end of the process output pipe, or -1 if the pipe is closed:
+    int outputFD = -1;
+    // All process output read so far:
+    juce::MemoryBlock processOutput;
+    // Whether the process is known to have exited:
+    bool exited = false;
+    // The process exit code, if it has exited:
+    int exitCode = 0;
+    // Runs when the process exits:
+    std::function<void()> exitCallback;
+    // Tracks the process state through the Process::Supervisor:
+    ExitWatcher exitWatcher;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Launched)
 };
@@ -1,14 +1,13 @@
 #include "Process_Launcher.h"
-#include "Util_Commands.h"
+#include "Process_LaunchThread.h"
+#include "Process_PathResolver.h"
+#include "Process_UsageTracker.h"
 
 #ifdef JUCE_DEBUG
 // Print the full class name before all debug output:
 static const constexpr char* dbgPrefix = "Process::Launcher::";
 #endif
 
-// Timer interval in milliseconds.
-static const int timerFrequency = 2000;
-
 // Milliseconds to wait before forcibly terminating a window focus operation.
 static const int windowFocusTimeout = 1000;
 
@@ -25,6 +24,16 @@ static const juce::Identifier notValidCommandTextKey = "notValidCommand";
 Process::Launcher::Launcher() : Locale::TextUser(localeClassKey),
 launchFailureCallback([](){}) { }
 
+
+// Cancels all pending launch and focus requests.
+Process::Launcher::~Launcher()
+{
+    SharedResource::LockedPtr<LaunchThread> launchThread
+            = getWriteLockedResource();
+    launchThread->cancelRequests(this);
+}
+
+
 void Process::Launcher::setLaunchFailureCallback
 (const std::function<void()> failureCallback)
 {
@@ -37,6 +46,12 @@ void Process::Launcher::setLaunchFailureCallback
 void Process::Launcher::startOrFocusApp(const juce::String& command)
 {
     DBG(dbgPrefix << __func__ << ": command = " << command);
+    if (pendingCommands.contains(command))
+    {
+        DBG(dbgPrefix << __func__ << ": already launching or focusing "
+                << command);
+        return;
+    }
     // Before adding another process to the list, clean out any old dead ones,
     // so they don't start piling up.
     std::vector<Launched*> toRemove;
@@ -58,52 +73,55 @@ void Process::Launcher::startOrFocusApp(const juce::String& command)
                 << appProcess->getLaunchCommand());
         runningApps.removeObject(appProcess);
     }
+    pendingCommands.add(command);
+    SharedResource::LockedPtr<LaunchThread> launchThread
+            = getWriteLockedResource();
     if (appInstance != nullptr)
     {
-        if (appInstance->isRunning())
+        DBG(dbgPrefix << __func__ << ": app is already running,"
+                << " focusing the window");
+        launchThread->addFocusRequest(this, appInstance->getProcessId(),
+                [this, command](const bool windowsFocused)
         {
-            DBG(dbgPrefix << __func__ << ": app is already running,"
-                    << " focusing the window");
-            appInstance->activateWindow();
-            return;
-        }
-        else
-        {
-            if (appInstance != nullptr)
+            pendingCommands.removeString(command);
+            if (!windowsFocused)
             {
-                DBG(dbgPrefix << __func__
-                        << ": Old process is dead, re-launching");
+                DBG(dbgPrefix << "startOrFocusApp: No windows to focus for "
+                        << command);
+                launchFailureCallback();
+                return;
             }
-        }
-    }
-    Launched* newApp = startApp(command);
-    if (newApp != nullptr)
-    {
-        runningApps.add(newApp);
+            UsageTracker usageTracker;
+            usageTracker.recordLaunch(command);
+        });
+        return;
     }
-    else
+    DBG(dbgPrefix << __func__  << ": Launching: "  << command);
+    launchThread->addLaunchRequest(this, command,
+            [this, command](Launched* newApp)
     {
-        DBG(dbgPrefix << __func__ << ": Failed to launch " << command);
-    }
+        pendingCommands.removeString(command);
+        startApp(command, newApp);
+    });
 }
 
 
-// Checks a string to see if it is a valid shell command.
+// Checks a string to see if it is a valid launch command.
 bool Process::Launcher::testCommand(const juce::String& command)
 {
-    Util::Commands systemCommands;
-    return systemCommands.runIntCommand(Util::CommandTypes::Int::commandCheck,
-            command) == 0;
+    PathResolver pathResolver;
+    return pathResolver.isValidCommand(command);
 }
 
 
-// Starts a new instance of an application process
-Process::Launched* Process::Launcher::startApp(const juce::String& command)
+// Starts tracking a new application process after the LaunchThread tries to
+// launch it.
+void Process::Launcher::startApp
+(const juce::String& command, Launched* newApp)
 {
     using juce::AlertWindow;
     using juce::String;
-    DBG(dbgPrefix << __func__  << ": Launching: "  << command);
-    if (!testCommand(command))
+    if (newApp == nullptr)
     {
         AlertWindow::showMessageBoxAsync
                 (AlertWindow::AlertIconType::WarningIcon,
@@ -111,55 +129,62 @@ Process::Launched* Process::Launcher::startApp(const juce::String& command)
                 String("\"") + command + String("\"")
                 + localeText(notValidCommandTextKey));
         launchFailureCallback();
-        return nullptr;
+        return;
     }
-
-    Launched* newApp = new Launched(command);
+    runningApps.add(newApp);
     timedProcess = newApp;
-    lastLaunch = juce::Time::getMillisecondCounter();
-    startTimer(timerFrequency);
-    return newApp;
+    UsageTracker usageTracker;
+    usageTracker.recordLaunch(command);
+    // Process exits are reported by the Process::Supervisor as they happen,
+    // so the launched process doesn't need to be repeatedly checked:
+    newApp->setExitCallback([this, newApp]()
+    {
+        if (timedProcess == newApp)
+        {
+            showLaunchFailure(newApp);
+        }
+    });
+    // The process may have exited before the exit callback was set:
+    if (!newApp->isRunning())
+    {
+        showLaunchFailure(newApp);
+        return;
+    }
+    startTimer(pendingLaunchTimeout);
 }
 
 
-// Checks if the last launched application started successfully, and displays an
-// error message if the application process died.
+// Displays the last lines of a launched application's output after it exits
+// before its launch finished.
+void Process::Launcher::showLaunchFailure(Launched* failedApp)
+{
+    DBG(dbgPrefix << __func__ << ": process died, show message");
+    juce::String output = failedApp->getProcessOutput();
+    juce::StringArray lines = juce::StringArray::fromLines(output);
+    output = "";
+    for (int i = lines.size() - 1; i > lines.size() - 6 && i >= 0; i--)
+    {
+        output = lines[i] + juce::String("\n") + output;
+    }
+    juce::AlertWindow::showMessageBoxAsync
+            (juce::AlertWindow::AlertIconType::WarningIcon,
+            localeText(couldNotOpenTextKey), output);
+    timedProcess = nullptr;
+    stopTimer();
+    launchFailureCallback();
+}
+
+
+// Stops waiting for the last launched application once the launch timeout
+// period ends.
 void Process::Launcher::timerCallback()
 {
     if (timedProcess != nullptr)
     {
-        if (timedProcess->isRunning())
-        {
-            // If the process is still going and we have yet to reach timeout,
-            // wait longer.
-            if (juce::Time::getMillisecondCounter() - lastLaunch
-                    < pendingLaunchTimeout)
-            {
-                return;
-            }
-            else
-            {
-                DBG(dbgPrefix << __func__ << ": Process \""
-                        << timedProcess->getLaunchCommand()
-                        << "\" launch timed out");
-            }
-        }
-        else
-        {
-            DBG(dbgPrefix << __func__ << ": process died, show message");
-            juce::String output = timedProcess->getProcessOutput();
-            juce::StringArray lines = juce::StringArray::fromLines(output);
-            output = "";
-            for (int i = lines.size() - 1;
-                i > lines.size() - 6 && i >= 0; i--)
-            {
-                output = lines[i] + juce::String("\n") + output;
-            }
-            juce::AlertWindow::showMessageBoxAsync
-                    (juce::AlertWindow::AlertIconType::WarningIcon,
-                    localeText(couldNotOpenTextKey), output);
-            timedProcess = nullptr;
-        }
+        DBG(dbgPrefix << __func__ << ": Process \""
+                << timedProcess->getLaunchCommand()
+                << "\" launch timed out");
+        timedProcess = nullptr;
     }
     launchFailureCallback();
     stopTimer();
@@ -171,4 +196,5 @@ void Process::Launcher::timerCallback()
 void Process::Launcher::onSuspend()
 {
     stopTimer();
+    timedProcess = nullptr;
 }
@@ -9,11 +9,13 @@
 #include <functional>
 #include <map>
 #include "Process_Launched.h"
+#include "SharedResource_Handler.h"
 #include "Locale_TextUser.h"
 #include "JuceHeader.h"
 #include "Windows_FocusedTimer.h"
 
 namespace Process { class Launcher; }
+namespace Process { class LaunchThread; }
 
 /**
  * @brief  Launches and manages independant windowed applications.
@@ -27,29 +29,44 @@ namespace Process { class Launcher; }
  * Launcher will attempt to find and focus an application window belonging to
  * that process, rather than creating a new process.
  *
+ *  Launch commands are validated, launched, and focused on the shared
+ * Process::LaunchThread, so the message thread never waits on a new process or
+ * the X display. Results are handled asynchronously on the message thread.
+ *
+ *  Every application that is successfully launched or focused is recorded
+ * through a Process::UsageTracker, so applications can be ordered by how
+ * often they are used.
+ *
  *  If Launcher is given an invalid launch command, or the launched process
  * dies before it gains window focus while still within a launch timeout
- * period, the launch is considered a failure. If a callback function was set
- * using setLaunchFailureCallback, that callback function will run once each
- * time an application launch fails. If the launch fails because the launch
- * command was invalid, an AlertWindow will also be created to explain the
- * failure to the user.
+ * period, the launch is considered a failure. Trying to focus a running
+ * application is also considered a failure if none of its windows could be
+ * found and focused. If a callback function was set using
+ * setLaunchFailureCallback, that callback function will run once each time an
+ * application launch or focus attempt fails. If the launch fails because the
+ * launch command was invalid, an AlertWindow will also be created to explain
+ * the failure to the user.
  *
  * TODO: Read timeout periods from a ConfigFile.
  */
 class Process::Launcher : public Windows::FocusedTimer,
-        private Locale::TextUser
+        private Locale::TextUser,
+        private SharedResource::Handler<LaunchThread>
 {
 public:
     Launcher();
 
-    virtual ~Launcher() { }
+    /**
+     * @brief  Cancels all pending launch and focus requests.
+     */
+    virtual ~Launcher();
 
     /**
      * @brief  Assigns a function to call if launching an application fails.
      *
      * @param failureCallback   A function to run if an application fails to
-     *                          launch.
+     *                          launch, or if no windows could be focused
+     *                          when focusing a running application.
      */
     void setLaunchFailureCallback(const std::function<void()> failureCallback);
 
@@ -57,37 +74,52 @@ public:
      * @brief  Launches a new application, or focuses its window if the
      *         application is already running
      *
+     *  The launch or focus operation finishes asynchronously. Requests for a
+     * command that is still being launched or focused are ignored.
+     *
      * @param command   The shell command that starts the application.
      */
     void startOrFocusApp(const juce::String& command);
 
     /**
-     * @brief  Checks a string to see if it is a valid shell command.
+     * @brief  Checks a string to see if it is a valid launch command.
+     *
+     *  This only searches for the command's executable file, using the
+     * cached results of earlier searches whenever possible.
      *
      * @param command  The command string to test.
      *
-     * @return         True if and only if the command string is a valid shell
-     *                 command.
+     * @return         True if and only if the command string starts with a
+     *                 valid executable.
      */
     static bool testCommand(const juce::String& command);
 
 private:
     /**
-     * @brief  Starts a new instance of an application process.
+     * @brief  Starts tracking a new application process after the
+     *         LaunchThread tries to launch it.
      *
-     *  If the launch command is invalid, the user will be shown a
+     *  If the launch command was invalid, the user will be shown a
      * juce::AlertWindow containing an error message.
      *
-     * @param command   The command used to launch the process.
+     * @param command  The command used to launch the process.
+     *
+     * @param newApp   The new application process, or nullptr if the command
+     *                 was invalid.
+     */
+    void startApp(const juce::String& command, Launched* newApp);
+
+    /**
+     * @brief  Displays the last lines of a launched application's output after
+     *         it exits before its launch finished.
      *
-     * @return          A pointer to the object representing the application
-     *                  process, or nullptr if the command was invalid.
+     * @param failedApp  The launched application process that exited.
      */
-    Launched* startApp(const juce::String& command);
+    void showLaunchFailure(Launched* failedApp);
 
     /**
-     * @brief  Checks if the last launched application started successfully,
-     *         and displays an error message if the application process died.
+     * @brief  Stops waiting for the last launched application once the launch
+     *         timeout period ends.
      */
     virtual void timerCallback() override;
 
@@ -103,9 +135,10 @@ private:
     // Holds all running process objects created by the AppLauncher.
     juce::OwnedArray<Launched> runningApps;
 
-    // Last application launch time from Time::getMillisecondCounter()
-    juce::uint32 lastLaunch = 0;
+    // Commands waiting to be launched or focused by the LaunchThread:
+    juce::StringArray pendingCommands;
 
-    // Process to check up on when the timer finishes.
+    // Process still within its launch timeout period, which will be treated
+    // as a failed launch if it exits before the timeout ends:
     Launched* timedProcess = nullptr;
 };
@@ -0,0 +1,180 @@
+#include "Process_PathCache.h"
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <cerrno>
+#include <cstdlib>
+#include <unistd.h>
+
+#ifdef JUCE_DEBUG
+// Print the full class name before all debug output:
+static const constexpr char* dbgPrefix = "Process::PathCache::";
+#endif
+
+// SharedResource object key:
+const juce::Identifier Process::PathCache::resourceKey = "Process::PathCache";
+
+// Search path used by execvp when PATH isn't set:
+static const constexpr char* defaultSearchPath = "/bin:/usr/bin";
+
+// Directory events that may change which executable a command resolves to:
+static const constexpr juce::uint32 watchMask = IN_CREATE | IN_DELETE
+        | IN_MOVED_FROM | IN_MOVED_TO | IN_ATTRIB | IN_DELETE_SELF
+        | IN_MOVE_SELF | IN_ONLYDIR;
+
+Process::PathCache::PathCache() : SharedResource::Resource(resourceKey) { }
+
+
+/**
+ * @brief  Checks if a path is an executable regular file.
+ *
+ * @param path  The path to check.
+ *
+ * @return      Whether the path is a regular file that this process may
+ *              execute.
+ */
+static bool isExecutableFile(const juce::String& path)
+{
+    struct stat fileStats;
+    return stat(path.toRawUTF8(), &fileStats) == 0
+            && S_ISREG(fileStats.st_mode)
+            && access(path.toRawUTF8(), X_OK) == 0;
+}
+
+
+// Finds the executable file that would run when executing a command.
+juce::String Process::PathCache::findExecutable
+(const juce::String& commandName)
+{
+    if (commandName.isEmpty())
+    {
+        return juce::String();
+    }
+    // Paths aren't searched for in PATH directories:
+    if (commandName.containsChar('/'))
+    {
+        return isExecutableFile(commandName) ? commandName : juce::String();
+    }
+    validateCache();
+    if (watchingDirs)
+    {
+        auto resolvedIter = resolvedCommands.find(commandName);
+        if (resolvedIter != resolvedCommands.end())
+        {
+            return resolvedIter->second;
+        }
+    }
+    juce::String executablePath;
+    for (const juce::String& dir : searchDirs)
+    {
+        const juce::String filePath = dir + "/" + commandName;
+        if (isExecutableFile(filePath))
+        {
+            executablePath = filePath;
+            break;
+        }
+    }
+    if (watchingDirs)
+    {
+        resolvedCommands[commandName] = executablePath;
+    }
+    return executablePath;
+}
+
+
+// Checks if a command's executable path is currently cached.
+bool Process::PathCache::isCached(const juce::String& commandName)
+{
+    validateCache();
+    return watchingDirs
+            && resolvedCommands.find(commandName) != resolvedCommands.end();
+}
+
+
+// Discards all cached results if a PATH directory changed, then updates the
+// search path.
+void Process::PathCache::validateCache()
+{
+    if (watchingDirs && readWatchEvents())
+    {
+        resolvedCommands.clear();
+    }
+    updateSearchPath();
+}
+
+
+// Reloads the PATH search directories and rebuilds all directory watches if
+// the PATH environment variable changed, or if a watched directory was
+// removed.
+void Process::PathCache::updateSearchPath()
+{
+    const char* pathVariable = getenv("PATH");
+    const juce::String newSearchPath = (pathVariable == nullptr)
+            ? juce::String(defaultSearchPath)
+            : juce::String::fromUTF8(pathVariable);
+    if (newSearchPath == searchPathValue && !watchesInvalid
+            && searchPathValue.isNotEmpty())
+    {
+        return;
+    }
+    closeWatches();
+    resolvedCommands.clear();
+    searchPathValue = newSearchPath;
+    watchesInvalid = false;
+    searchDirs.clear();
+    searchDirs.addTokens(searchPathValue, ":", "");
+    watchingDirs = inotify.init();
+    for (juce::String& dir : searchDirs)
+    {
+        // Empty PATH entries search the current working directory:
+        if (dir.isEmpty())
+        {
+            dir = ".";
+        }
+        // Relative directories change along with the working directory, so
+        // their results can't be cached:
+        if (!dir.startsWithChar('/'))
+        {
+            watchingDirs = false;
+        }
+        if (!watchingDirs || !juce::File(dir).isDirectory())
+        {
+            continue;
+        }
+        if (inotify.addWatch(dir, watchMask) < 0)
+        {
+            DBG(dbgPrefix << __func__ << ": Failed to watch " << dir
+                    << ", errno=" << errno);
+            watchingDirs = false;
+        }
+    }
+    if (!watchingDirs)
+    {
+        DBG(dbgPrefix << __func__
+                << ": Can't watch all PATH directories, caching disabled.");
+        closeWatches();
+    }
+}
+
+
+// Reads all pending inotify events without blocking.
+bool Process::PathCache::readWatchEvents()
+{
+    const int eventCount = inotify.readEvents(
+            [this](const Util::InotifyWatcher::Event& event)
+    {
+        if (event.mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF
+                    | IN_Q_OVERFLOW))
+        {
+            watchesInvalid = true;
+        }
+    });
+    return eventCount > 0;
+}
+
+
+// Removes all directory watches and disables caching.
+void Process::PathCache::closeWatches()
+{
+    inotify.close();
+    watchingDirs = false;
+}
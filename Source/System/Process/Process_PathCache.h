@@ -0,0 +1,117 @@
+#pragma once
+/**
+ * @file  Process_PathCache.h
+ *
+ * @brief  Finds and caches the locations of executable files within the
+ *         directories listed in the PATH environment variable.
+ */
+
+#include "SharedResource_Resource.h"
+#include "Util_InotifyWatcher.h"
+#include "JuceHeader.h"
+#include <map>
+
+namespace Process { class PathCache; }
+
+/**
+ * @brief  Resolves command names to executable files the same way posix_spawnp
+ *         and execvp do, caching all results.
+ *
+ *  Each PATH directory is watched with inotify. Before any cached result is
+ * used, the PathCache reads all pending inotify events without blocking, and
+ * discards all cached results if any executable file was added, removed,
+ * renamed, or had its permissions changed. Cached results are also discarded
+ * if the PATH environment variable changes.
+ *
+ *  If inotify can't be used, commands are still resolved correctly, but
+ * results aren't cached.
+ *
+ *  The PathCache should only be accessed through Process::PathResolver
+ * objects.
+ */
+class Process::PathCache : public SharedResource::Resource
+{
+public:
+    // SharedResource object key:
+    static const juce::Identifier resourceKey;
+
+    PathCache();
+
+    /**
+     * @brief  Removes all directory watches.
+     */
+    virtual ~PathCache() { }
+
+    /**
+     * @brief  Finds the executable file that would run when executing a
+     *         command.
+     *
+     * @param commandName  A command name, or an absolute or relative path to
+     *                     an executable file.
+     *
+     * @return             The path to the executable file, or the empty string
+     *                     if the command isn't a valid executable.
+     */
+    juce::String findExecutable(const juce::String& commandName);
+
+    /**
+     * @brief  Checks if a command's executable path is currently cached, so
+     *         the next search for that command won't need to check any PATH
+     *         directories.
+     *
+     * @param commandName  A command name.
+     *
+     * @return             Whether a current search result for that command is
+     *                     cached.
+     */
+    bool isCached(const juce::String& commandName);
+
+private:
+    /**
+     * @brief  Discards all cached results if a PATH directory changed, then
+     *         updates the search path.
+     */
+    void validateCache();
+
+    /**
+     * @brief  Reloads the PATH search directories and rebuilds all directory
+     *         watches if the PATH environment variable changed, or if a watched
+     *         directory was removed.
+     */
+    void updateSearchPath();
+
+    /**
+     * @brief  Reads all pending inotify events without blocking.
+     *
+     * @return  Whether any event indicates that a PATH directory changed.
+     */
+    bool readWatchEvents();
+
+    /**
+     * @brief  Removes all directory watches and disables caching.
+     */
+    void closeWatches();
+
+    // The last PATH value read from the environment:
+    juce::String searchPathValue;
+
+    // Directories to search for executables, in order:
+    juce::StringArray searchDirs;
+
+    // Resolved executable paths mapped by command name. Commands that weren't
+    // found are mapped to the empty string:
+    std::map<juce::String, juce::String> resolvedCommands;
+
+    // Watches all PATH directories for changes:
+    Util::InotifyWatcher inotify;
+
+    // Whether all existing PATH directories are watched, so cached results
+    // can be trusted:
+    bool watchingDirs = false;
+
+    // Whether a watched directory was removed or moved, so watches must be
+    // rebuilt:
+    bool watchesInvalid = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PathCache)
+};
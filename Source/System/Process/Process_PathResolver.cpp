@@ -0,0 +1,35 @@
+#include "Process_PathResolver.h"
+#include "Process_PathCache.h"
+
+Process::PathResolver::PathResolver() { }
+
+
+// Finds the executable file that would run when executing a command.
+juce::String Process::PathResolver::findExecutable
+(const juce::String& commandName)
+{
+    SharedResource::LockedPtr<PathCache> pathCache = getWriteLockedResource();
+    return pathCache->findExecutable(commandName);
+}
+
+
+// Checks if a command's executable path is currently cached.
+bool Process::PathResolver::isCached(const juce::String& commandName)
+{
+    SharedResource::LockedPtr<PathCache> pathCache = getWriteLockedResource();
+    return pathCache->isCached(commandName);
+}
+
+
+// Checks if a launch command starts with a valid executable.
+bool Process::PathResolver::isValidCommand(const juce::String& launchCommand)
+{
+    juce::StringArray arguments;
+    arguments.addTokens(launchCommand, true);
+    arguments.removeEmptyStrings(true);
+    if (arguments.isEmpty())
+    {
+        return false;
+    }
+    return findExecutable(arguments[0].unquoted()).isNotEmpty();
+}
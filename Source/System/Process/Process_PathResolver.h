@@ -0,0 +1,63 @@
+#pragma once
+/**
+ * @file  Process_PathResolver.h
+ *
+ * @brief  Checks if launch commands are valid using the shared
+ *         Process::PathCache.
+ */
+
+#include "SharedResource_Handler.h"
+#include "JuceHeader.h"
+
+namespace Process { class PathResolver; }
+namespace Process { class PathCache; }
+
+/**
+ * @brief  Finds the executable files used by commands without starting a new
+ *         process or shell.
+ *
+ *  Search results are cached by the shared PathCache only while at least one
+ * PathResolver exists. Objects that check commands often should keep a
+ * PathResolver instead of creating a new one for each check.
+ */
+class Process::PathResolver : public SharedResource::Handler<PathCache>
+{
+public:
+    PathResolver();
+
+    virtual ~PathResolver() { }
+
+    /**
+     * @brief  Finds the executable file that would run when executing a
+     *         command.
+     *
+     * @param commandName  A command name, or an absolute or relative path to
+     *                     an executable file.
+     *
+     * @return             The path to the executable file, or the empty string
+     *                     if the command isn't a valid executable.
+     */
+    juce::String findExecutable(const juce::String& commandName);
+
+    /**
+     * @brief  Checks if a command's executable path is currently cached.
+     *
+     * @param commandName  A command name.
+     *
+     * @return             Whether the next search for that command will use a
+     *                     cached result.
+     */
+    bool isCached(const juce::String& commandName);
+
+    /**
+     * @brief  Checks if a launch command starts with a valid executable.
+     *
+     *  The command is split into arguments the same way Process::Launched
+     * splits commands, and only the first argument is checked.
+     *
+     * @param launchCommand  A full application launch command.
+     *
+     * @return               Whether the command's executable was found.
+     */
+    bool isValidCommand(const juce::String& launchCommand);
+};
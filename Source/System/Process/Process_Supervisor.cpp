@@ -0,0 +1,346 @@
+#include "Process_Supervisor.h"
+#include "Process_Watcher.h"
+#include <vector>
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifdef JUCE_DEBUG
+// Print the full class name before all debug output:
+static const constexpr char* dbgPrefix = "Process::Supervisor::";
+#endif
+
+// SharedResource object key:
+const juce::Identifier Process::Supervisor::resourceKey
+        = "Process::Supervisor";
+
+// Resource thread name:
+static const juce::String threadName = "Process_Supervisor";
+
+// Milliseconds to wait before retrying if polling for events fails:
+static const constexpr int pollErrorDelay = 500;
+
+// Write end of the Supervisor's wake pipe, used by the SIGCHLD handler. This is
+// a sig_atomic_t so the handler never reads a partially written value:
+static volatile sig_atomic_t signalPipeFD = -1;
+
+// SIGCHLD action replaced by the Supervisor's handler:
+static struct sigaction lastChildAction;
+
+
+/**
+ * @brief  Opens a file descriptor that becomes readable when a process exits.
+ *
+ * @param processId  A process ID.
+ *
+ * @return           The process file descriptor, or -1 if pidfd_open failed
+ *                   or isn't supported.
+ */
+static int openPidFD(const int processId)
+{
+#ifdef SYS_pidfd_open
+    return (int) syscall(SYS_pidfd_open, processId, 0);
+#else
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+
+/**
+ * @brief  Wakes the Supervisor thread whenever a child process changes state.
+ *
+ * @param signalNumber  The received signal, always SIGCHLD.
+ */
+static void handleChildSignal(int signalNumber)
+{
+    const int savedErrno = errno;
+    const int pipeFD = signalPipeFD;
+    if (pipeFD >= 0)
+    {
+        const char wakeByte = 0;
+        // The pipe is non-blocking, so this fails harmlessly if the pipe is
+        // already full of unhandled wake signals:
+        (void) write(pipeFD, &wakeByte, 1);
+    }
+    errno = savedErrno;
+}
+
+
+// Opens the pipe used to wake the supervisor thread, and installs the SIGCHLD
+// handler if pidfd_open is unavailable.
+Process::Supervisor::Supervisor() :
+SharedResource::Thread::Resource(resourceKey, ::threadName)
+{
+    if (pipe2(wakePipe, O_NONBLOCK | O_CLOEXEC) != 0)
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to create wake pipe.");
+        wakePipe[0] = -1;
+        wakePipe[1] = -1;
+    }
+    const int testFD = openPidFD(getpid());
+    usePidFDs = (testFD >= 0);
+    if (usePidFDs)
+    {
+        close(testFD);
+    }
+    else if (wakePipe[1] >= 0)
+    {
+        DBG(dbgPrefix << __func__
+                << ": pidfd_open unavailable, watching SIGCHLD instead.");
+        signalPipeFD = wakePipe[1];
+        struct sigaction childAction = {};
+        childAction.sa_handler = handleChildSignal;
+        sigemptyset(&childAction.sa_mask);
+        childAction.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+        sigaction(SIGCHLD, &childAction, &lastChildAction);
+    }
+}
+
+
+// Closes all open file descriptors, and restores the previous SIGCHLD handler
+// if one was replaced.
+Process::Supervisor::~Supervisor()
+{
+    if (!usePidFDs && signalPipeFD >= 0)
+    {
+        sigaction(SIGCHLD, &lastChildAction, nullptr);
+        signalPipeFD = -1;
+    }
+    for (auto& recordPair : processRecords)
+    {
+        if (recordPair.second.pidFD >= 0)
+        {
+            close(recordPair.second.pidFD);
+        }
+    }
+    for (int pipeFD : wakePipe)
+    {
+        if (pipeFD >= 0)
+        {
+            close(pipeFD);
+        }
+    }
+}
+
+
+// Starts watching a child process.
+void Process::Supervisor::watchProcess(const int processId)
+{
+    if (processId <= 0 || processRecords.count(processId) > 0)
+    {
+        return;
+    }
+    ProcessRecord& record = processRecords[processId];
+    if (usePidFDs)
+    {
+        record.pidFD = openPidFD(processId);
+        if (record.pidFD >= 0)
+        {
+            fcntl(record.pidFD, F_SETFD, FD_CLOEXEC);
+        }
+    }
+    // The process may have exited before it could be watched:
+    reapIfExited(processId, record);
+    startResourceThread();
+    notify();
+    wakeThread();
+}
+
+
+// Stops watching a child process.
+void Process::Supervisor::forgetProcess(const int processId)
+{
+    auto recordIter = processRecords.find(processId);
+    if (recordIter == processRecords.end())
+    {
+        return;
+    }
+    ProcessRecord& record = recordIter->second;
+    if (record.exited)
+    {
+        processRecords.erase(recordIter);
+    }
+    else
+    {
+        record.forgotten = true;
+    }
+}
+
+
+// Checks if a watched process is still running, reaping it if it has exited.
+bool Process::Supervisor::updateProcessState(const int processId)
+{
+    auto recordIter = processRecords.find(processId);
+    if (recordIter == processRecords.end())
+    {
+        return false;
+    }
+    if (recordIter->second.exited)
+    {
+        return false;
+    }
+    const bool exited = reapIfExited(processId, recordIter->second);
+    if (exited)
+    {
+        // Make sure the exit notification is still sent:
+        wakeThread();
+    }
+    return !exited;
+}
+
+
+// Gets the exit code of a watched process.
+int Process::Supervisor::getExitCode(const int processId) const
+{
+    auto recordIter = processRecords.find(processId);
+    if (recordIter == processRecords.end() || !recordIter->second.exited)
+    {
+        return -1;
+    }
+    return recordIter->second.exitCode;
+}
+
+
+// Wakes the thread so it can stop, then stops the thread.
+void Process::Supervisor::stopResourceThread()
+{
+    signalThreadShouldExit();
+    wakeThread();
+    SharedResource::Thread::Resource::stopResourceThread();
+}
+
+
+// Waits for watched processes to exit, then reaps them and sends exit
+// notifications.
+void Process::Supervisor::runLoop(SharedResource::Thread::Lock& lock)
+{
+    std::vector<struct pollfd> pollData;
+    pollData.push_back({ wakePipe[0], POLLIN, 0 });
+    lock.enterRead();
+    for (const auto& recordPair : processRecords)
+    {
+        const ProcessRecord& record = recordPair.second;
+        if (!record.exited && record.pidFD >= 0)
+        {
+            pollData.push_back({ record.pidFD, POLLIN, 0 });
+        }
+    }
+    lock.exitRead();
+
+    const int pollResult = poll(pollData.data(), pollData.size(), -1);
+    if (pollResult < 0 && errno != EINTR)
+    {
+        DBG(dbgPrefix << __func__ << ": Polling failed, errno=" << errno);
+        wait(pollErrorDelay);
+    }
+    if (threadShouldExit())
+    {
+        return;
+    }
+    if (pollData[0].revents & POLLIN)
+    {
+        char wakeBuffer[64];
+        while (read(wakePipe[0], wakeBuffer, sizeof(wakeBuffer)) > 0) { }
+    }
+
+    // Only watched processes are checked, so this costs the same no matter
+    // how many other processes are running:
+    std::vector<std::pair<int, int>> exitedProcesses;
+    lock.enterWrite();
+    for (auto recordIter = processRecords.begin();
+            recordIter != processRecords.end();)
+    {
+        ProcessRecord& record = recordIter->second;
+        if (!record.exited)
+        {
+            reapIfExited(recordIter->first, record);
+        }
+        if (record.exited && !record.exitSent)
+        {
+            record.exitSent = true;
+            exitedProcesses.push_back({ recordIter->first, record.exitCode });
+        }
+        if (record.exited && record.forgotten)
+        {
+            recordIter = processRecords.erase(recordIter);
+        }
+        else
+        {
+            recordIter++;
+        }
+    }
+    lock.exitWrite();
+
+    if (!exitedProcesses.empty())
+    {
+        juce::MessageManager::callAsync(buildAsyncFunction(
+                    SharedResource::LockType::read,
+                    [this, exitedProcesses]()
+        {
+            foreachHandler<Watcher>([&exitedProcesses](Watcher* watcher)
+            {
+                for (const auto& exitedProcess : exitedProcesses)
+                {
+                    watcher->processExited(exitedProcess.first,
+                            exitedProcess.second);
+                }
+            });
+        }));
+    }
+}
+
+
+// Keeps the thread dormant while no processes are watched.
+bool Process::Supervisor::threadShouldWait()
+{
+    return processRecords.empty();
+}
+
+
+// Wakes the supervisor thread if it is waiting for events.
+void Process::Supervisor::wakeThread()
+{
+    if (wakePipe[1] >= 0)
+    {
+        const char wakeByte = 0;
+        (void) write(wakePipe[1], &wakeByte, 1);
+    }
+}
+
+
+// Reaps a watched process if it has exited.
+bool Process::Supervisor::reapIfExited
+(const int processId, ProcessRecord& record)
+{
+    int status = 0;
+    const pid_t result = waitpid(processId, &status, WNOHANG);
+    if (result == 0 || (result < 0 && errno == EINTR))
+    {
+        return false;
+    }
+    record.exited = true;
+    if (result == processId && WIFEXITED(status))
+    {
+        record.exitCode = WEXITSTATUS(status);
+    }
+    else if (result == processId && WIFSIGNALED(status))
+    {
+        record.exitCode = 128 + WTERMSIG(status);
+    }
+    else
+    {
+        // The process was already reaped elsewhere, or isn't a child process:
+        record.exitCode = -1;
+    }
+    if (record.pidFD >= 0)
+    {
+        close(record.pidFD);
+        record.pidFD = -1;
+    }
+    return true;
+}
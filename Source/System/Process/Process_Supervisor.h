@@ -0,0 +1,149 @@
+#pragma once
+/**
+ * @file  Process_Supervisor.h
+ *
+ * @brief  Watches launched child processes, detecting when they exit without
+ *         scanning system process data.
+ */
+
+#include "SharedResource_Thread_Resource.h"
+#include "JuceHeader.h"
+#include <map>
+
+namespace Process { class Supervisor; }
+
+/**
+ * @brief  Tracks the state of child processes launched by the application.
+ *
+ *  The Supervisor waits for child processes to exit on a single thread. When
+ * the kernel supports pidfd_open, a process file descriptor is opened for each
+ * watched process, and the thread waits for those descriptors to become
+ * readable. On older kernels, a SIGCHLD handler wakes the thread through a
+ * pipe instead. In both cases the thread sleeps until something changes, and
+ * only checks the processes it was asked to watch.
+ *
+ *  When a watched process exits, the Supervisor reaps it, saves its exit code,
+ * and notifies all Process::Watcher objects on the message thread.
+ *
+ *  The Supervisor should only be accessed through Process::Watcher objects.
+ */
+class Process::Supervisor : public SharedResource::Thread::Resource
+{
+public:
+    // SharedResource object key:
+    static const juce::Identifier resourceKey;
+
+    /**
+     * @brief  Opens the pipe used to wake the supervisor thread, and installs
+     *         the SIGCHLD handler if pidfd_open is unavailable.
+     */
+    Supervisor();
+
+    /**
+     * @brief  Closes all open file descriptors, and restores the previous
+     *         SIGCHLD handler if one was replaced.
+     */
+    virtual ~Supervisor();
+
+    /**
+     * @brief  Starts watching a child process.
+     *
+     * @param processId  The ID of a child process of this application.
+     */
+    void watchProcess(const int processId);
+
+    /**
+     * @brief  Stops watching a child process.
+     *
+     *  If the process is still running, the Supervisor will keep watching it
+     * until it exits, so that it doesn't remain as a zombie process.
+     *
+     * @param processId  The ID of a watched process.
+     */
+    void forgetProcess(const int processId);
+
+    /**
+     * @brief  Checks if a watched process is still running, reaping it if it
+     *         has exited.
+     *
+     * @param processId  The ID of a watched process.
+     *
+     * @return           Whether the process is still running.
+     */
+    bool updateProcessState(const int processId);
+
+    /**
+     * @brief  Gets the exit code of a watched process.
+     *
+     * @param processId  The ID of a watched process.
+     *
+     * @return           The process exit code, or -1 if the process is still
+     *                   running or isn't watched.
+     */
+    int getExitCode(const int processId) const;
+
+    /**
+     * @brief  Wakes the thread so it can stop, then stops the thread.
+     */
+    virtual void stopResourceThread() override;
+
+private:
+    /**
+     * @brief  Waits for watched processes to exit, then reaps them and sends
+     *         exit notifications.
+     *
+     * @param lock  The thread's resource lock.
+     */
+    virtual void runLoop(SharedResource::Thread::Lock& lock) override;
+
+    /**
+     * @brief  Keeps the thread dormant while no processes are watched.
+     *
+     * @return  Whether the Supervisor has no processes to watch.
+     */
+    virtual bool threadShouldWait() override;
+
+    /**
+     * @brief  Wakes the supervisor thread if it is waiting for events.
+     */
+    void wakeThread();
+
+    /**
+     * @brief  Holds the state of a single watched process.
+     */
+    struct ProcessRecord
+    {
+        // Process file descriptor, or -1 if pidfd_open is unavailable:
+        int pidFD = -1;
+        // Whether the process has exited and been reaped:
+        bool exited = false;
+        // The process exit code, if it has exited:
+        int exitCode = -1;
+        // Whether Watcher objects were notified that the process exited:
+        bool exitSent = false;
+        // Whether the process should be removed once it exits:
+        bool forgotten = false;
+    };
+
+    /**
+     * @brief  Reaps a watched process if it has exited.
+     *
+     * @param processId  The ID of a watched process.
+     *
+     * @param record     The process record to update.
+     *
+     * @return           Whether the process exited.
+     */
+    static bool reapIfExited(const int processId, ProcessRecord& record);
+
+    // All watched processes, mapped by process ID:
+    std::map<int, ProcessRecord> processRecords;
+
+    // Pipe used to wake the thread, read end first:
+    int wakePipe[2] = { -1, -1 };
+
+    // Whether process file descriptors are used to detect process exits:
+    bool usePidFDs = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Supervisor)
+};
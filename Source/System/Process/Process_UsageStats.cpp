@@ -0,0 +1,86 @@
+#include "Process_UsageStats.h"
+#include "Assets_XDGDirectories.h"
+#include <algorithm>
+#include <vector>
+
+// SharedResource object key:
+const juce::Identifier Process::UsageStats::resourceKey
+        = "Process::UsageStats";
+
+// Usage table path, relative to the user data directory:
+static const constexpr char* tablePath = "/pocket-home/appUsage.table";
+
+// Usage log path, relative to the user data directory:
+static const constexpr char* logPath = "/pocket-home/appUsage.log";
+
+// Number of logged launches that triggers usage table compaction:
+static const constexpr int maxLoggedLaunches = 64;
+
+// Loads saved usage data, compacting the usage table if any launches were
+// logged since it was last compacted.
+Process::UsageStats::UsageStats() : SharedResource::Resource(resourceKey),
+usageTable(Assets::XDGDirectories::getUserDataPath() + tablePath,
+        Assets::XDGDirectories::getUserDataPath() + logPath)
+{
+    const juce::int64 currentTime = juce::Time::currentTimeMillis();
+    loggedLaunches = usageTable.loadUsage();
+    if (loggedLaunches > 0 && usageTable.compact(currentTime))
+    {
+        loggedLaunches = 0;
+    }
+    sessionScores = usageTable.getAllScores(currentTime);
+}
+
+
+// Records that a launch command was used.
+void Process::UsageStats::recordLaunch(const juce::String& command)
+{
+    const juce::int64 currentTime = juce::Time::currentTimeMillis();
+    if (usageTable.recordLaunch(command, currentTime))
+    {
+        loggedLaunches++;
+    }
+    if (loggedLaunches >= maxLoggedLaunches && usageTable.compact(currentTime))
+    {
+        loggedLaunches = 0;
+    }
+}
+
+
+// Gets a command's launch score as it was when usage data was loaded.
+double Process::UsageStats::getSessionScore(const juce::String& command) const
+{
+    auto searchIter = sessionScores.find(command);
+    if (searchIter == sessionScores.end())
+    {
+        return 0;
+    }
+    return searchIter->second;
+}
+
+
+// Gets the commands with the highest session launch scores.
+juce::StringArray Process::UsageStats::getMostUsed(const int maxCount) const
+{
+    std::vector<std::pair<double, juce::String>> rankedCommands;
+    for (const auto& scoreIter : sessionScores)
+    {
+        rankedCommands.push_back(std::make_pair(scoreIter.second,
+                    scoreIter.first));
+    }
+    const size_t resultCount = std::min(rankedCommands.size(),
+            (size_t) std::max(0, maxCount));
+    std::partial_sort(rankedCommands.begin(),
+            rankedCommands.begin() + resultCount, rankedCommands.end(),
+            [](const std::pair<double, juce::String>& first,
+                const std::pair<double, juce::String>& second)
+    {
+        return first.first > second.first;
+    });
+    juce::StringArray mostUsed;
+    for (size_t i = 0; i < resultCount; i++)
+    {
+        mostUsed.add(rankedCommands[i].second);
+    }
+    return mostUsed;
+}
@@ -0,0 +1,87 @@
+#pragma once
+/**
+ * @file  Process_UsageStats.h
+ *
+ * @brief  Loads, records, and saves application launch statistics shared by
+ *         the entire application.
+ */
+
+#include "Process_UsageTable.h"
+#include "SharedResource_Resource.h"
+#include "JuceHeader.h"
+#include <map>
+
+namespace Process { class UsageStats; }
+
+/**
+ * @brief  Holds the Process::UsageTable used to track which application launch
+ *         commands are used most often.
+ *
+ *  UsageStats loads all saved usage data when it is created, and saves each new
+ * launch to the usage log as it is recorded. The usage table file is compacted
+ * whenever the usage log holds launches from an earlier session, and again
+ * whenever enough new launches are logged.
+ *
+ *  Launch scores are also calculated once when the usage data is loaded. These
+ * session scores are used to order applications, so that menus and searches
+ * keep a consistent order while the application is running, and only change
+ * their order to reflect new launches after the application restarts.
+ *
+ *  The UsageStats resource should only be accessed through
+ * Process::UsageTracker objects.
+ */
+class Process::UsageStats : public SharedResource::Resource
+{
+public:
+    // SharedResource object key:
+    static const juce::Identifier resourceKey;
+
+    /**
+     * @brief  Loads saved usage data, compacting the usage table if any
+     *         launches were logged since it was last compacted.
+     */
+    UsageStats();
+
+    virtual ~UsageStats() { }
+
+    /**
+     * @brief  Records that a launch command was used.
+     *
+     * @param command  An application launch command that was launched or
+     *                 focused.
+     */
+    void recordLaunch(const juce::String& command);
+
+    /**
+     * @brief  Gets a command's launch score as it was when usage data was
+     *         loaded.
+     *
+     * @param command  An application launch command.
+     *
+     * @return         The command's session launch score, or zero if the
+     *                 command was not used before the session started.
+     */
+    double getSessionScore(const juce::String& command) const;
+
+    /**
+     * @brief  Gets the commands with the highest session launch scores.
+     *
+     * @param maxCount  The maximum number of commands to return.
+     *
+     * @return          Up to maxCount launch commands, ordered from highest to
+     *                  lowest session score.
+     */
+    juce::StringArray getMostUsed(const int maxCount) const;
+
+private:
+    // Holds and saves all usage data:
+    UsageTable usageTable;
+
+    // Launch scores of all commands, calculated when usage data was loaded:
+    std::map<juce::String, double> sessionScores;
+
+    // Number of launches logged since the usage table was last compacted:
+    int loggedLaunches = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UsageStats)
+};
@@ -0,0 +1,283 @@
+#include "Process_UsageTable.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#ifdef JUCE_DEBUG
+// Print the full class name before all debug output:
+static const constexpr char* dbgPrefix = "Process::UsageTable::";
+#endif
+
+// Value written at the start of every usage table file:
+static const constexpr juce::int32 tableMagic = 0x55534850; // "PHSU"
+
+// Table format version, to be incremented whenever the format changes:
+static const constexpr juce::int32 tableVersion = 1;
+
+// Milliseconds needed for a launch score to decay to half its value:
+static const constexpr double scoreHalfLife = 14.0 * 24 * 60 * 60 * 1000;
+
+// Commands with lower scores are discarded when the table is compacted:
+static const constexpr double minSavedScore = 0.01;
+
+// Size in bytes of the score and launch time saved with each command:
+static const constexpr int recordDataSize = 16;
+
+// Maximum number of commands saved to the table file:
+static const constexpr int maxSavedRecords = 256;
+
+/**
+ * @brief  Finds how much a score should decay over a period of time.
+ *
+ * @param elapsedTime  A duration in milliseconds.
+ *
+ * @return             The factor to multiply scores by after that duration
+ *                     has passed.
+ */
+static double getDecayFactor(const juce::int64 elapsedTime)
+{
+    if (elapsedTime <= 0)
+    {
+        return 1.0;
+    }
+    return std::exp2(-(double) elapsedTime / scoreHalfLife);
+}
+
+
+// Creates an empty table without loading any usage files.
+Process::UsageTable::UsageTable
+(const juce::File& tableFile, const juce::File& logFile) :
+tableFile(tableFile), logFile(logFile) { }
+
+
+// Loads all usage data from the table and log files, replacing any data
+// currently held in the table.
+int Process::UsageTable::loadUsage()
+{
+    records.clear();
+    if (tableFile.existsAsFile())
+    {
+        juce::MemoryMappedFile mappedTable(tableFile,
+                juce::MemoryMappedFile::readOnly);
+        if (mappedTable.getData() != nullptr)
+        {
+            juce::MemoryInputStream tableStream(mappedTable.getData(),
+                    mappedTable.getSize(), false);
+            if (tableStream.readInt() == tableMagic
+                    && tableStream.readInt() == tableVersion)
+            {
+                const int recordCount = tableStream.readCompressedInt();
+                for (int i = 0; i < recordCount; i++)
+                {
+                    const juce::String command = tableStream.readString();
+                    if (tableStream.getNumBytesRemaining() < recordDataSize)
+                    {
+                        DBG(dbgPrefix << __func__
+                                << ": Usage table is truncated.");
+                        break;
+                    }
+                    Record record;
+                    record.score = tableStream.readDouble();
+                    record.lastLaunch = tableStream.readInt64();
+                    records[command] = record;
+                }
+            }
+            else
+            {
+                DBG(dbgPrefix << __func__
+                        << ": Discarding outdated usage table.");
+            }
+        }
+    }
+
+    // Apply logged launches. The final line is ignored if it isn't complete,
+    // as it may still be in the process of being written:
+    int loggedLaunches = 0;
+    if (logFile.existsAsFile())
+    {
+        const juce::String logText = logFile.loadFileAsString();
+        juce::StringArray logLines
+                = juce::StringArray::fromLines(logText);
+        if (!logText.endsWithChar('\n'))
+        {
+            logLines.remove(logLines.size() - 1);
+        }
+        for (const juce::String& line : logLines)
+        {
+            const juce::String timeString = line.upToFirstOccurrenceOf(" ",
+                    false, false);
+            const juce::String command = line.fromFirstOccurrenceOf(" ",
+                    false, false);
+            if (!timeString.containsOnly("0123456789") || command.isEmpty())
+            {
+                continue;
+            }
+            applyLaunch(command, timeString.getLargeIntValue());
+            loggedLaunches++;
+        }
+    }
+    DBG(dbgPrefix << __func__ << ": Loaded usage data for "
+            << (int) records.size() << " commands, " << loggedLaunches
+            << " from the usage log.");
+    return loggedLaunches;
+}
+
+
+// Records a new launch, appending it to the usage log file.
+bool Process::UsageTable::recordLaunch(const juce::String& command,
+        const juce::int64 launchTime)
+{
+    if (command.isEmpty() || command.containsAnyOf("\r\n"))
+    {
+        return false;
+    }
+    applyLaunch(command, launchTime);
+    if (!logFile.getParentDirectory().createDirectory())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to create log directory.");
+        return false;
+    }
+    // FileOutputStream always appends to existing files:
+    juce::FileOutputStream logStream(logFile);
+    if (logStream.failedToOpen())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to open usage log.");
+        return false;
+    }
+    logStream << juce::String(launchTime) << " " << command << "\n";
+    logStream.flush();
+    return !logStream.getStatus().failed();
+}
+
+
+// Saves all usage data to the table file and clears the log file.
+bool Process::UsageTable::compact(const juce::int64 currentTime)
+{
+    // Drop insignificant records, and keep only the highest scores if there
+    // are too many records to save:
+    std::vector<std::pair<double, juce::String>> savedScores;
+    for (auto recordIter = records.begin(); recordIter != records.end();)
+    {
+        const double score = getScore(recordIter->first, currentTime);
+        if (score < minSavedScore)
+        {
+            recordIter = records.erase(recordIter);
+        }
+        else
+        {
+            savedScores.push_back(std::make_pair(score, recordIter->first));
+            ++recordIter;
+        }
+    }
+    if (savedScores.size() > (size_t) maxSavedRecords)
+    {
+        std::nth_element(savedScores.begin(),
+                savedScores.begin() + maxSavedRecords, savedScores.end(),
+                std::greater<std::pair<double, juce::String>>());
+        for (size_t i = maxSavedRecords; i < savedScores.size(); i++)
+        {
+            records.erase(savedScores[i].second);
+        }
+    }
+
+    if (!tableFile.getParentDirectory().createDirectory())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to create table directory.");
+        return false;
+    }
+    juce::TemporaryFile tempFile(tableFile);
+    {
+        juce::FileOutputStream tableStream(tempFile.getFile());
+        if (tableStream.failedToOpen())
+        {
+            DBG(dbgPrefix << __func__ << ": Failed to open temporary file.");
+            return false;
+        }
+        tableStream.writeInt(tableMagic);
+        tableStream.writeInt(tableVersion);
+        tableStream.writeCompressedInt((int) records.size());
+        for (const auto& recordIter : records)
+        {
+            tableStream.writeString(recordIter.first);
+            tableStream.writeDouble(recordIter.second.score);
+            tableStream.writeInt64(recordIter.second.lastLaunch);
+        }
+        tableStream.flush();
+        if (tableStream.getStatus().failed())
+        {
+            DBG(dbgPrefix << __func__ << ": Failed to write table: "
+                    << tableStream.getStatus().getErrorMessage());
+            return false;
+        }
+    }
+    if (!tempFile.overwriteTargetFileWithTemporary())
+    {
+        DBG(dbgPrefix << __func__ << ": Failed to replace table file.");
+        return false;
+    }
+    // All logged launches are now saved in the table:
+    logFile.deleteFile();
+    DBG(dbgPrefix << __func__ << ": Saved usage data for "
+            << (int) records.size() << " commands.");
+    return true;
+}
+
+
+// Gets the decayed launch score of a command.
+double Process::UsageTable::getScore(const juce::String& command,
+        const juce::int64 currentTime) const
+{
+    auto searchIter = records.find(command);
+    if (searchIter == records.end())
+    {
+        return 0;
+    }
+    const Record& record = searchIter->second;
+    return record.score * getDecayFactor(currentTime - record.lastLaunch);
+}
+
+
+// Gets the last time a command was launched.
+juce::int64 Process::UsageTable::getLastLaunchTime
+(const juce::String& command) const
+{
+    auto searchIter = records.find(command);
+    if (searchIter == records.end())
+    {
+        return 0;
+    }
+    return searchIter->second.lastLaunch;
+}
+
+
+// Gets the decayed launch scores of all recorded commands.
+std::map<juce::String, double> Process::UsageTable::getAllScores
+(const juce::int64 currentTime) const
+{
+    std::map<juce::String, double> scores;
+    for (const auto& recordIter : records)
+    {
+        scores[recordIter.first] = getScore(recordIter.first, currentTime);
+    }
+    return scores;
+}
+
+
+// Applies a single launch to the table without saving it.
+void Process::UsageTable::applyLaunch(const juce::String& command,
+        const juce::int64 launchTime)
+{
+    Record& record = records[command];
+    if (launchTime >= record.lastLaunch)
+    {
+        record.score = record.score
+                * getDecayFactor(launchTime - record.lastLaunch) + 1.0;
+        record.lastLaunch = launchTime;
+    }
+    else
+    {
+        // Launches recorded out of order are decayed to the last launch time:
+        record.score += getDecayFactor(record.lastLaunch - launchTime);
+    }
+}
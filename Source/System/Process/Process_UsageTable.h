@@ -0,0 +1,146 @@
+#pragma once
+/**
+ * @file  Process_UsageTable.h
+ *
+ * @brief  Records and ranks application launches, saving them to a compact
+ *         usage table file and an append-only usage log file.
+ */
+
+#include "JuceHeader.h"
+#include <map>
+
+namespace Process { class UsageTable; }
+
+/**
+ * @brief  Tracks how often and how recently each application launch command
+ *         is used.
+ *
+ *  Each command is given a launch score that increases by one every time the
+ * command is used, and decays by half over every score half-life period. Scores
+ * measure both how often and how recently an application is used, so
+ * applications that are no longer used gradually lose their ranking.
+ *
+ *  Usage data is saved in two files. Each new launch is appended as a single
+ * line to a usage log file, so recording a launch never rewrites existing
+ * data. When loading, the usage table file is memory-mapped and read, and any
+ * launches in the log are applied to the loaded scores. Compacting the table
+ * applies all logged launches to the table file, discards commands with
+ * negligible scores, and then clears the log. The table file is replaced
+ * atomically, so an interrupted save never loses existing usage data.
+ *
+ *  UsageTable objects are not thread-safe.
+ */
+class Process::UsageTable
+{
+public:
+    /**
+     * @brief  Creates an empty table without loading any usage files.
+     *
+     * @param tableFile  The file where compacted usage data is saved.
+     *
+     * @param logFile    The file where new launches are appended.
+     */
+    UsageTable(const juce::File& tableFile, const juce::File& logFile);
+
+    virtual ~UsageTable() { }
+
+    /**
+     * @brief  Loads all usage data from the table and log files, replacing any
+     *         data currently held in the table.
+     *
+     * @return  The number of logged launches that have not yet been
+     *          compacted into the table file.
+     */
+    int loadUsage();
+
+    /**
+     * @brief  Records a new launch, appending it to the usage log file.
+     *
+     * @param command     The command that was launched.
+     *
+     * @param launchTime  The time of the launch, in milliseconds since the
+     *                    epoch.
+     *
+     * @return            Whether the launch was saved to the log file.
+     */
+    bool recordLaunch(const juce::String& command,
+            const juce::int64 launchTime);
+
+    /**
+     * @brief  Saves all usage data to the table file and clears the log file.
+     *
+     * @param currentTime  The current time, in milliseconds since the epoch,
+     *                     used to find which commands no longer have
+     *                     significant scores.
+     *
+     * @return             Whether the table file was written.
+     */
+    bool compact(const juce::int64 currentTime);
+
+    /**
+     * @brief  Gets the decayed launch score of a command.
+     *
+     * @param command      A launch command.
+     *
+     * @param currentTime  The time to use when calculating score decay, in
+     *                     milliseconds since the epoch.
+     *
+     * @return             The command's launch score, or zero if the command
+     *                     was never recorded.
+     */
+    double getScore(const juce::String& command,
+            const juce::int64 currentTime) const;
+
+    /**
+     * @brief  Gets the last time a command was launched.
+     *
+     * @param command  A launch command.
+     *
+     * @return         The command's last launch time, in milliseconds since
+     *                 the epoch, or zero if the command was never recorded.
+     */
+    juce::int64 getLastLaunchTime(const juce::String& command) const;
+
+    /**
+     * @brief  Gets the decayed launch scores of all recorded commands.
+     *
+     * @param currentTime  The time to use when calculating score decay, in
+     *                     milliseconds since the epoch.
+     *
+     * @return             All recorded commands mapped to their scores.
+     */
+    std::map<juce::String, double> getAllScores(const juce::int64 currentTime)
+        const;
+
+private:
+    /**
+     * @brief  Applies a single launch to the table without saving it.
+     *
+     * @param command     The launched command.
+     *
+     * @param launchTime  The time of the launch, in milliseconds since the
+     *                    epoch.
+     */
+    void applyLaunch(const juce::String& command,
+            const juce::int64 launchTime);
+
+    // Stores usage data for a single command:
+    struct Record
+    {
+        // The launch score, calculated at the last launch time:
+        double score = 0;
+        // The last launch time, in milliseconds since the epoch:
+        juce::int64 lastLaunch = 0;
+    };
+
+    // Maps launch commands to their usage records:
+    std::map<juce::String, Record> records;
+
+    // The file where compacted usage data is saved:
+    const juce::File tableFile;
+
+    // The file where new launches are appended:
+    const juce::File logFile;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UsageTable)
+};
@@ -0,0 +1,32 @@
+#include "Process_UsageTracker.h"
+#include "Process_UsageStats.h"
+
+Process::UsageTracker::UsageTracker() { }
+
+
+// Records that a launch command was used.
+void Process::UsageTracker::recordLaunch(const juce::String& command)
+{
+    SharedResource::LockedPtr<UsageStats> usageStats
+            = getWriteLockedResource();
+    usageStats->recordLaunch(command);
+}
+
+
+// Gets a command's launch score.
+double Process::UsageTracker::getLaunchScore(const juce::String& command)
+    const
+{
+    SharedResource::LockedPtr<const UsageStats> usageStats
+            = getReadLockedResource();
+    return usageStats->getSessionScore(command);
+}
+
+
+// Gets the most frequently used launch commands.
+juce::StringArray Process::UsageTracker::getMostUsed(const int maxCount) const
+{
+    SharedResource::LockedPtr<const UsageStats> usageStats
+            = getReadLockedResource();
+    return usageStats->getMostUsed(maxCount);
+}
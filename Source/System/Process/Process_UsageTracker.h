@@ -0,0 +1,59 @@
+#pragma once
+/**
+ * @file  Process_UsageTracker.h
+ *
+ * @brief  Records and reads application launch statistics using the shared
+ *         Process::UsageStats resource.
+ */
+
+#include "SharedResource_Handler.h"
+#include "JuceHeader.h"
+
+namespace Process { class UsageTracker; }
+namespace Process { class UsageStats; }
+
+/**
+ * @brief  Records application launches, and finds which applications are used
+ *         most often.
+ *
+ *  Applications are identified by their full launch commands. Launch scores
+ * count each launch, decaying over time so that recent launches count more
+ * than older ones. All scores read through the UsageTracker are calculated
+ * when usage data is first loaded, so they don't change while the application
+ * runs.
+ */
+class Process::UsageTracker : public SharedResource::Handler<UsageStats>
+{
+public:
+    UsageTracker();
+
+    virtual ~UsageTracker() { }
+
+    /**
+     * @brief  Records that a launch command was used.
+     *
+     * @param command  An application launch command that was launched or
+     *                 focused.
+     */
+    void recordLaunch(const juce::String& command);
+
+    /**
+     * @brief  Gets a command's launch score.
+     *
+     * @param command  An application launch command.
+     *
+     * @return         The command's launch score when usage data was loaded,
+     *                 or zero if the command had never been used.
+     */
+    double getLaunchScore(const juce::String& command) const;
+
+    /**
+     * @brief  Gets the most frequently used launch commands.
+     *
+     * @param maxCount  The maximum number of commands to return.
+     *
+     * @return          Up to maxCount launch commands, ordered from highest to
+     *                  lowest launch score.
+     */
+    juce::StringArray getMostUsed(const int maxCount) const;
+};
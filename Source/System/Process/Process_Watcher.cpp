@@ -0,0 +1,40 @@
+#include "Process_Watcher.h"
+#include "Process_Supervisor.h"
+
+Process::Watcher::Watcher() { }
+
+
+// Starts watching a child process.
+void Process::Watcher::watchProcess(const int processId)
+{
+    SharedResource::LockedPtr<Supervisor> supervisor
+            = getWriteLockedResource();
+    supervisor->watchProcess(processId);
+}
+
+
+// Stops watching a child process.
+void Process::Watcher::forgetProcess(const int processId)
+{
+    SharedResource::LockedPtr<Supervisor> supervisor
+            = getWriteLockedResource();
+    supervisor->forgetProcess(processId);
+}
+
+
+// Checks if a watched process is still running.
+bool Process::Watcher::isProcessRunning(const int processId)
+{
+    SharedResource::LockedPtr<Supervisor> supervisor
+            = getWriteLockedResource();
+    return supervisor->updateProcessState(processId);
+}
+
+
+// Gets the exit code of a watched process.
+int Process::Watcher::getExitCode(const int processId) const
+{
+    SharedResource::LockedPtr<const Supervisor> supervisor
+            = getReadLockedResource();
+    return supervisor->getExitCode(processId);
+}
@@ -0,0 +1,80 @@
+#pragma once
+/**
+ * @file  Process_Watcher.h
+ *
+ * @brief  Tracks launched child processes through the shared
+ *         Process::Supervisor.
+ */
+
+#include "SharedResource_Handler.h"
+
+namespace Process { class Watcher; }
+namespace Process { class Supervisor; }
+
+/**
+ * @brief  Accesses the Process::Supervisor to watch child processes, and
+ *         receives notifications when watched processes exit.
+ *
+ *  Every Watcher receives exit notifications for all watched processes, so
+ * Watcher subclasses should ignore notifications for processes they didn't
+ * start.
+ */
+class Process::Watcher : public SharedResource::Handler<Supervisor>
+{
+public:
+    // Allow the Supervisor to send exit notifications:
+    friend class Supervisor;
+
+    Watcher();
+
+    virtual ~Watcher() { }
+
+    /**
+     * @brief  Starts watching a child process.
+     *
+     * @param processId  The ID of a child process of this application.
+     */
+    void watchProcess(const int processId);
+
+    /**
+     * @brief  Stops watching a child process.
+     *
+     *  The Supervisor will still reap the process once it exits.
+     *
+     * @param processId  The ID of a watched process.
+     */
+    void forgetProcess(const int processId);
+
+    /**
+     * @brief  Checks if a watched process is still running.
+     *
+     * @param processId  The ID of a watched process.
+     *
+     * @return           Whether the process is still running.
+     */
+    bool isProcessRunning(const int processId);
+
+    /**
+     * @brief  Gets the exit code of a watched process.
+     *
+     * @param processId  The ID of a watched process.
+     *
+     * @return           The process exit code, or -1 if the process is still
+     *                   running or isn't watched.
+     */
+    int getExitCode(const int processId) const;
+
+private:
+    /**
+     * @brief  Called on the message thread whenever a watched process exits.
+     *
+     *  By default, this takes no action. Override this function to handle
+     * process exit events.
+     *
+     * @param processId  The ID of the process that exited.
+     *
+     * @param exitCode   The process exit code. If the process was stopped by a
+     *                   signal, this will be 128 plus the signal number.
+     */
+    virtual void processExited(const int processId, const int exitCode) { }
+};
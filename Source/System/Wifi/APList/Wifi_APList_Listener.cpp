@@ -17,6 +17,24 @@ juce::Array<Wifi::AccessPoint> Wifi::APList::Listener::getVisibleAPs() const
 }
 
 
+// Signals that the list of visible access points has changed, passing each
+// added and removed access point to accessPointAdded or accessPointRemoved.
+void Wifi::APList::Listener::accessPointsUpdated
+(const juce::Array<AccessPoint>& addedAPs,
+        const juce::Array<AccessPoint>& removedAPs,
+        const juce::Array<AccessPoint>& updatedAPs)
+{
+    for (const AccessPoint& addedAP : addedAPs)
+    {
+        accessPointAdded(addedAP);
+    }
+    for (const AccessPoint& removedAP : removedAPs)
+    {
+        accessPointRemoved(removedAP);
+    }
+}
+
+
 // Signals that a new access point was discovered.
 void Wifi::APList::Listener::accessPointAdded(const AccessPoint newAP) { }
 
@@ -25,8 +25,12 @@ namespace Wifi { class Resource; }
  * @brief  Tracks the list of visible Wifi access points.
  *
  *  Listener objects are automatically connected to the APList::Module object
- * on construction. Listener subclasses should override Listener's abstract
- * signal functions to handle APList change updates.
+ * on construction. Listener subclasses should override Listener's signal
+ * functions to handle APList change updates. Changes are received in batches,
+ * and by default each batch is passed on to the accessPointAdded and
+ * accessPointRemoved functions one access point at a time. Subclasses that
+ * need to handle all changes at once, or that need to track signal strength
+ * changes, should override accessPointsUpdated instead.
  */
 class Wifi::APList::Listener : public UpdateInterface,
     public SharedResource::Modular::Handler<Resource, Module>
@@ -45,6 +49,23 @@ public:
     juce::Array<AccessPoint> getVisibleAPs() const;
 
 private:
+    /**
+     * @brief  Signals that the list of visible access points has changed,
+     *         passing each added and removed access point to accessPointAdded
+     *         or accessPointRemoved.
+     *
+     * @param addedAPs    All newly discovered access points.
+     *
+     * @param removedAPs  All tracked access points that are no longer
+     *                    visible.
+     *
+     * @param updatedAPs  All visible access points with significant signal
+     *                    strength changes.
+     */
+    virtual void accessPointsUpdated(const juce::Array<AccessPoint>& addedAPs,
+            const juce::Array<AccessPoint>& removedAPs,
+            const juce::Array<AccessPoint>& updatedAPs) override;
+
     /**
      * @brief  Signals that a new access point was discovered.
      *
@@ -52,7 +73,7 @@ private:
      *
      * @param newAP  The new Wifi::AccessPoint object.
      */
-    virtual void accessPointAdded(const AccessPoint newAP) override;
+    virtual void accessPointAdded(const AccessPoint newAP);
 
     /**
      * @brief  Signals that a tracked access point was lost.
@@ -61,5 +82,5 @@ private:
      *
      * @param removedAP  The Wifi::AccessPoint that is no longer visible.
      */
-    virtual void accessPointRemoved(const AccessPoint removedAP) override;
+    virtual void accessPointRemoved(const AccessPoint removedAP);
 };
@@ -6,17 +6,18 @@
 #include "Wifi_AP_UpdateInterface.h"
 #include "Wifi_APList_UpdateInterface.h"
 #include "Wifi_LibNM_APHash.h"
+#include "Wifi_LibNM_APHashMap.h"
 #include "Wifi_LibNM_AccessPoint.h"
 #include "Wifi_LibNM_DeviceWifi.h"
 #include "Wifi_LibNM_ContextTest.h"
 #include "Wifi_LibNM_Thread_Module.h"
-#include <map>
+#include "Config_MainFile.h"
 
 // All visible AccessPoint objects, mapped by hash value.
-static std::map<Wifi::LibNM::APHash, Wifi::AccessPoint> wifiAccessPoints;
+static Wifi::LibNM::APHashMap<Wifi::AccessPoint> wifiAccessPoints;
 
 // All visible LibNM::AccessPoint objects, mapped by hash value.
-static std::map<Wifi::LibNM::APHash, juce::Array<Wifi::LibNM::AccessPoint>>
+static Wifi::LibNM::APHashMap<juce::Array<Wifi::LibNM::AccessPoint>>
         nmAccessPoints;
 
 #ifdef JUCE_DEBUG
@@ -28,12 +29,15 @@ static const constexpr char* dbgPrefix = "Wifi::APList::Module::";
  */
 void printAPList()
 {
-    DBG(dbgPrefix << __func__ << ": " << (int) wifiAccessPoints.size()
+    DBG(dbgPrefix << __func__ << ": " << wifiAccessPoints.size()
             << " access points found.");
     for (auto& iter : wifiAccessPoints)
     {
+        const juce::Array<Wifi::LibNM::AccessPoint>* nmAPs
+                = nmAccessPoints.find(iter.first);
         DBG("  [" << iter.first.toString() << "] ("
-                << nmAccessPoints[iter.first].size() <<  " LibNM AP)");
+                << ((nmAPs == nullptr) ? 0 : nmAPs->size())
+                <<  " LibNM AP)");
         DBG("   = " << iter.second.toString());
     }
 }
@@ -43,7 +47,8 @@ void printAPList()
 // should be initialized with the updateAllAccessPoints function from within the
 // LibNM thread.
 Wifi::APList::Module::Module(Resource& wifiResource) :
-    Wifi::Module(wifiResource)
+    Wifi::Module(wifiResource),
+    updateInterval(Config::MainFile().getWifiUpdateInterval())
 {
     DBG(dbgPrefix << __func__ << ": Creating Wifi::APList module.");
 }
@@ -52,8 +57,10 @@ Wifi::APList::Module::Module(Resource& wifiResource) :
 // Clears all access point data on destruction.
 Wifi::APList::Module::~Module()
 {
+    stopTimer();
     wifiAccessPoints.clear();
     nmAccessPoints.clear();
+    updateQueue.clear();
     DBG(dbgPrefix << __func__ << ": Finished destroying Wifi::APList module.");
 }
 
@@ -80,18 +87,9 @@ Wifi::APList::Module::getAccessPoints() const
 Wifi::AccessPoint Wifi::APList::Module::getAccessPoint
 (LibNM::APHash apHash) const
 {
-    try
-    {
-        jassert(!apHash.isNull());
-        AccessPoint matchingAP = wifiAccessPoints.at(apHash);
-        // Ignore access points with no signal strength, they are not currently
-        // visible or valid.
-        if (matchingAP.getSignalStrength() > 0)
-        {
-            return matchingAP;
-        }
-    }
-    catch(std::out_of_range e)
+    jassert(!apHash.isNull());
+    const AccessPoint* matchingAP = wifiAccessPoints.find(apHash);
+    if (matchingAP == nullptr)
     {
         DBG(dbgPrefix << __func__ << ": Failed to find hash value \""
                 << apHash.toString() << "\"");
@@ -100,6 +98,12 @@ Wifi::AccessPoint Wifi::APList::Module::getAccessPoint
         printAPList();
         #endif
     }
+    // Ignore access points with no signal strength, they are not currently
+    // visible or valid.
+    else if (matchingAP->getSignalStrength() > 0)
+    {
+        return *matchingAP;
+    }
     return AccessPoint();
 }
 
@@ -110,16 +114,20 @@ Wifi::LibNM::AccessPoint Wifi::APList::Module::getStrongestNMAccessPoint
 (const AccessPoint accessPoint) const
 {
     ASSERT_NM_CONTEXT;
-    juce::Array<LibNM::AccessPoint>& apList
-            = nmAccessPoints[accessPoint.getHashValue()];
-    apList.removeIf([](LibNM::AccessPoint ap)
+    LibNM::AccessPoint strongestAP;
+    juce::Array<LibNM::AccessPoint>* apList
+            = nmAccessPoints.find(accessPoint.getHashValue());
+    if (apList == nullptr)
+    {
+        return strongestAP;
+    }
+    apList->removeIf([](LibNM::AccessPoint ap)
     {
         return ap.isNull();
     });
 
-    LibNM::AccessPoint strongestAP;
     int bestSignalStrength = 0;
-    for (LibNM::AccessPoint& nmAccessPoint : apList)
+    for (LibNM::AccessPoint& nmAccessPoint : *apList)
     {
         const int apStrength = nmAccessPoint.getSignalStrength();
         if (apStrength > bestSignalStrength)
@@ -152,14 +160,18 @@ juce::Array<Wifi::LibNM::AccessPoint> Wifi::APList::Module::getNMAccessPoints
 (const AccessPoint accessPoint) const
 {
     ASSERT_NM_CONTEXT;
-    juce::Array<LibNM::AccessPoint>& matchingAPs
-            = nmAccessPoints[accessPoint.getHashValue()];
-    matchingAPs.removeIf([](LibNM::AccessPoint ap)
+    juce::Array<LibNM::AccessPoint>* matchingAPs
+            = nmAccessPoints.find(accessPoint.getHashValue());
+    if (matchingAPs == nullptr)
+    {
+        return juce::Array<LibNM::AccessPoint>();
+    }
+    matchingAPs->removeIf([](LibNM::AccessPoint ap)
     {
         return ap.isNull();
     });
 
-    return matchingAPs;
+    return *matchingAPs;
 }
 
 
@@ -172,53 +184,42 @@ void Wifi::APList::Module::addAccessPoint(const LibNM::AccessPoint addedAP)
     const LibNM::APHash apHash = addedAP.generateHash();
     jassert(!apHash.isNull());
 
-    const bool newConnectionVisible = nmAccessPoints[apHash].isEmpty();
-    nmAccessPoints[apHash].addIfNotAlreadyThere(addedAP);
+    juce::Array<LibNM::AccessPoint>& apList = nmAccessPoints[apHash];
+    const bool newConnectionVisible = apList.isEmpty();
+    apList.addIfNotAlreadyThere(addedAP);
 
     // Create a matching AccessPoint object if one doesn't already exist:
-    if (wifiAccessPoints.count(apHash) == 0)
+    AccessPoint* wifiAP = wifiAccessPoints.find(apHash);
+    if (wifiAP == nullptr)
     {
         Connection::Saved::Module* savedConnections
                 = getSiblingModule<Connection::Saved::Module>();
         AccessPoint newWifiAP(addedAP.getSSID(),
-                addedAP.generateHash(),
+                apHash,
                 addedAP.getSecurityType(),
                 addedAP.getSignalStrength());
         savedConnections->updateSavedAPData(newWifiAP);
         jassert(!newWifiAP.isNull());
         jassert(newWifiAP.getHashValue() == apHash);
-        wifiAccessPoints[apHash] = newWifiAP;
+        wifiAP = &wifiAccessPoints[apHash];
+        *wifiAP = newWifiAP;
     }
 
     // Update signal strength if necessary:
-    AccessPoint& wifiAP = wifiAccessPoints[apHash];
     const unsigned int newSignalStrength = addedAP.getSignalStrength();
     const bool signalStrengthChanged
-            = (newSignalStrength > wifiAP.getSignalStrength());
-    if (newSignalStrength > wifiAP.getSignalStrength())
+            = (newSignalStrength > wifiAP->getSignalStrength());
+    if (signalStrengthChanged)
     {
-        static_cast<APInterface::SignalStrength*>(&wifiAP)->setSignalStrength
+        static_cast<APInterface::SignalStrength*>(wifiAP)->setSignalStrength
                 (newSignalStrength);
     }
 
-    // If relevant updates were made, share those updates with the appropriate
-    // Listener objects:
-    AccessPoint updatedAP = wifiAccessPoints[apHash];
-    if (newConnectionVisible)
+    // If relevant updates were made, queue them to be shared with the
+    // appropriate Listener objects:
+    if (newConnectionVisible || signalStrengthChanged)
     {
-        foreachModuleHandler<UpdateInterface>([updatedAP]
-                (UpdateInterface* updateHandler)
-        {
-            updateHandler->accessPointAdded(updatedAP);
-        });
-    }
-    else if (signalStrengthChanged)
-    {
-        foreachModuleHandler<AP::UpdateInterface>([updatedAP]
-                (AP::UpdateInterface* updateHandler)
-        {
-            updateHandler->signalStrengthChanged(updatedAP);
-        });
+        queueUpdate(*wifiAP);
     }
 }
 
@@ -229,8 +230,16 @@ void Wifi::APList::Module::removeAccessPoint
 {
     ASSERT_NM_CONTEXT;
     const LibNM::APHash apHash = removedAP.generateHash();
-    nmAccessPoints[apHash].removeAllInstancesOf(removedAP);
-    updateAPIfLost(wifiAccessPoints[apHash]);
+    juce::Array<LibNM::AccessPoint>* apList = nmAccessPoints.find(apHash);
+    if (apList != nullptr)
+    {
+        apList->removeAllInstancesOf(removedAP);
+    }
+    const AccessPoint* wifiAP = wifiAccessPoints.find(apHash);
+    if (wifiAP != nullptr)
+    {
+        updateAPIfLost(*wifiAP);
+    }
 }
 
 
@@ -240,23 +249,25 @@ void Wifi::APList::Module::updateSignalStrength(AccessPoint toUpdate)
 {
     ASSERT_NM_CONTEXT;
     const LibNM::APHash apHash = toUpdate.getHashValue();
+    const AccessPoint* savedAP = wifiAccessPoints.find(apHash);
     const unsigned int oldSignalStrength
-            = wifiAccessPoints[apHash].getSignalStrength();
+            = (savedAP == nullptr) ? 0 : savedAP->getSignalStrength();
     unsigned int bestSignalStrength = 0;
-    for (LibNM::AccessPoint accessPoint : nmAccessPoints[apHash])
+    const juce::Array<LibNM::AccessPoint>* apList
+            = nmAccessPoints.find(apHash);
+    if (apList != nullptr)
     {
-        bestSignalStrength = std::max(bestSignalStrength,
-                accessPoint.getSignalStrength());
+        for (LibNM::AccessPoint accessPoint : *apList)
+        {
+            bestSignalStrength = std::max(bestSignalStrength,
+                    accessPoint.getSignalStrength());
+        }
     }
     if (bestSignalStrength != oldSignalStrength)
     {
         static_cast<APInterface::SignalStrength*>
                 (&toUpdate)->setSignalStrength(bestSignalStrength);
-        foreachModuleHandler<AP::UpdateInterface>([toUpdate]
-                (AP::UpdateInterface* updateHandler)
-        {
-            updateHandler->signalStrengthChanged(toUpdate);
-        });
+        queueUpdate(toUpdate);
     }
 }
 
@@ -264,10 +275,11 @@ void Wifi::APList::Module::updateSignalStrength(AccessPoint toUpdate)
 // Clears the list of saved AccessPoint and LibNM::AccessPoint objects.
 void Wifi::APList::Module::clearAccessPoints()
 {
-    getSiblingModule<LibNM::Thread::Module>()->call([]()
+    getSiblingModule<LibNM::Thread::Module>()->call([this]()
     {
         wifiAccessPoints.clear();
         nmAccessPoints.clear();
+        updateQueue.clear();
     });
 }
 
@@ -293,8 +305,8 @@ void Wifi::APList::Module::updateAllAccessPoints()
         }
     });
     DBG(dbgPrefix << __func__ << ": List contains "
-            << (int) wifiAccessPoints.size() << " AP objects representing "
-            << (int) nmAccessPoints.size() << " LibNM AP objects");
+            << wifiAccessPoints.size() << " AP objects representing "
+            << nmAccessPoints.size() << " LibNM AP objects");
 }
 
 
@@ -316,20 +328,86 @@ void Wifi::APList::Module::removeInvalidatedAccessPoints()
 }
 
 
-// Sets an AccessPoint object's signal strength to zero and notifies all
-// listeners that it has been removed, if and only if all LibNM::AccessPoint
-// objects represented by the access point have been removed.
+// Sets an AccessPoint object's signal strength to zero and schedules an update
+// to notify listeners that it has been removed, if and only if all
+// LibNM::AccessPoint objects represented by the access point have been removed.
 void Wifi::APList::Module::updateAPIfLost(AccessPoint toCheck)
 {
-    LibNM::APHash apHash = toCheck.getHashValue();
-    if (nmAccessPoints[apHash].isEmpty())
+    const juce::Array<LibNM::AccessPoint>* apList
+            = nmAccessPoints.find(toCheck.getHashValue());
+    if (apList == nullptr || apList->isEmpty())
     {
         static_cast<APInterface::SignalStrength*>(&toCheck)
                 ->setSignalStrength(0);
-        foreachModuleHandler<UpdateInterface>([toCheck]
+        queueUpdate(toCheck);
+    }
+}
+
+
+// Marks an access point as changed, so that its changes will be sent to
+// listeners when the current update interval ends.
+void Wifi::APList::Module::queueUpdate(const AccessPoint changedAP)
+{
+    ASSERT_NM_CONTEXT;
+    const juce::Array<LibNM::AccessPoint>* apList
+            = nmAccessPoints.find(changedAP.getHashValue());
+    updateQueue.queue(changedAP, apList != nullptr && !apList->isEmpty());
+    if (updateInterval <= 0)
+    {
+        sendQueuedUpdates();
+    }
+    else if (!isTimerRunning())
+    {
+        startTimer(updateInterval);
+    }
+}
+
+
+// Sends all access point changes queued since the last update to all
+// listeners.
+void Wifi::APList::Module::sendQueuedUpdates()
+{
+    ASSERT_NM_CONTEXT;
+    const UpdateQueue::Changes changes = updateQueue.takeChanges();
+    const juce::Array<AccessPoint>& addedAPs = changes.addedAPs;
+    const juce::Array<AccessPoint>& removedAPs = changes.removedAPs;
+    const juce::Array<AccessPoint>& updatedAPs = changes.updatedAPs;
+    if (!changes.isEmpty())
+    {
+        foreachModuleHandler<UpdateInterface>(
+                [addedAPs, removedAPs, updatedAPs]
                 (UpdateInterface* updateHandler)
         {
-            updateHandler->accessPointRemoved(toCheck);
+            updateHandler->accessPointsUpdated(addedAPs, removedAPs,
+                    updatedAPs);
+        });
+    }
+    if (!updatedAPs.isEmpty())
+    {
+        foreachModuleHandler<AP::UpdateInterface>([updatedAPs]
+                (AP::UpdateInterface* updateHandler)
+        {
+            for (const AccessPoint& updatedAP : updatedAPs)
+            {
+                updateHandler->signalStrengthChanged(updatedAP);
+            }
         });
     }
 }
+
+
+// Sends queued updates within the LibNM thread when the update interval ends.
+void Wifi::APList::Module::timerCallback()
+{
+    stopTimer();
+    LibNM::Thread::Module* nmThread
+            = getSiblingModule<LibNM::Thread::Module>();
+    nmThread->callAsync([this, nmThread]()
+    {
+        nmThread->lockForAsyncCallback(SharedResource::LockType::write,
+                [this]()
+        {
+            sendQueuedUpdates();
+        });
+    });
+}
@@ -9,6 +9,7 @@
  */
 
 #include "Wifi_Module.h"
+#include "Wifi_APList_UpdateQueue.h"
 
 namespace Wifi
 {
@@ -47,12 +48,21 @@ namespace Wifi
  * directly update the saved signal strength of all equivalent AccessPoint
  * objects whenever that objects list of LibNM::AccessPoint objects changes.
  *
+ *  Access point updates are not sent as soon as they occur. Instead, the
+ * module collects changes within the LibNM thread over a configurable update
+ * interval, and then sends all listeners a single batch of changes. Only the
+ * final state of each access point is sent, so an access point that is lost
+ * and found again within the same interval is not reported at all. Signal
+ * strength changes are only sent when they differ significantly from the
+ * last signal strength sent for that access point, so that small fluctuations
+ * in signal strength don't constantly update listeners.
+ *
  *  Other modules that interact with LibNM may need access to the GLib object
  * pointers used to create the AccessPoint list. The APList module can provide
  * these object pointers, wrapped in LibNM::AccessPoint objects. These should
  * only be requested and used within the LibNM::Thread::Module thread.
  */
-class Wifi::APList::Module : public Wifi::Module
+class Wifi::APList::Module : public Wifi::Module, private juce::Timer
 {
 public:
     /**
@@ -187,9 +197,9 @@ public:
 private:
     /**
      * @brief  Sets an AccessPoint object's signal strength to zero and
-     *         notifies all listeners that it has been removed, if and only if
-     *         all LibNM::AccessPoint objects represented by the access point
-     *         have been removed.
+     *         schedules an update to notify listeners that it has been removed,
+     *         if and only if all LibNM::AccessPoint objects represented by the
+     *         access point have been removed.
      *
      *  This function should only be called on the thread created by the
      * Wifi::LibNM::Thread::Module object.
@@ -197,4 +207,37 @@ private:
      * @param toCheck  The AccessPoint object to check and potentially update.
      */
     void updateAPIfLost(AccessPoint toCheck);
+
+    /**
+     * @brief  Marks an access point as changed, so that its changes will be
+     *         sent to listeners when the current update interval ends.
+     *
+     *  This function should only be called on the thread created by the
+     * Wifi::LibNM::Thread::Module object.
+     *
+     * @param changedAP  An access point that was added, removed, or given a
+     *                   new signal strength.
+     */
+    void queueUpdate(const AccessPoint changedAP);
+
+    /**
+     * @brief  Sends all access point changes queued since the last update to
+     *         all listeners.
+     *
+     *  This function should only be called on the thread created by the
+     * Wifi::LibNM::Thread::Module object.
+     */
+    void sendQueuedUpdates();
+
+    /**
+     * @brief  Sends queued updates within the LibNM thread when the update
+     *         interval ends.
+     */
+    virtual void timerCallback() override;
+
+    // Milliseconds to collect access point changes before sending them:
+    const int updateInterval;
+
+    // Collects access point changes until the update interval ends:
+    UpdateQueue updateQueue;
 };
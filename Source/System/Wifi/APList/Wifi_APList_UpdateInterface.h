@@ -6,10 +6,12 @@
  * @file  Wifi_APList_UpdateInterface.h
  *
  * @brief  The interface used by the Wifi::APList::Module to update all
- *         Wifi::APList::Listener objects when access points are added or
- *         removed.
+ *         Wifi::APList::Listener objects when access points are added,
+ *         removed, or updated.
  */
 
+#include "JuceHeader.h"
+
 namespace Wifi
 {
     namespace APList { class UpdateInterface; }
@@ -18,6 +20,10 @@ namespace Wifi
 
 /**
  * @brief  An abstract interface used for sending access point list updates.
+ *
+ *  Access point list changes are collected by the APList::Module and sent in
+ * batches, so that listeners receive at most one update for each update
+ * interval no matter how frequently access points change.
  */
 class Wifi::APList::UpdateInterface
 {
@@ -27,16 +33,17 @@ public:
     virtual ~UpdateInterface() { }
 
     /**
-     * @brief  Signals that a new access point was discovered.
+     * @brief  Signals that the list of visible access points has changed.
      *
-     * @param newAP  The new Wifi::AccessPoint object.
-     */
-    virtual void accessPointAdded(const AccessPoint newAP) = 0;
-
-    /**
-     * @brief  Signals that a tracked access point was lost.
+     * @param addedAPs    All newly discovered access points.
+     *
+     * @param removedAPs  All tracked access points that are no longer
+     *                    visible.
      *
-     * @param removedAP  The Wifi::AccessPoint that is no longer visible.
+     * @param updatedAPs  All visible access points with significant signal
+     *                    strength changes.
      */
-    virtual void accessPointRemoved(const AccessPoint removedAP) = 0;
+    virtual void accessPointsUpdated(const juce::Array<AccessPoint>& addedAPs,
+            const juce::Array<AccessPoint>& removedAPs,
+            const juce::Array<AccessPoint>& updatedAPs) = 0;
 };
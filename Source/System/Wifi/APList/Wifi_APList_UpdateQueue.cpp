@@ -0,0 +1,69 @@
+#define WIFI_IMPLEMENTATION
+#include "Wifi_APList_UpdateQueue.h"
+
+// Checks if there are no changes to send.
+bool Wifi::APList::UpdateQueue::Changes::isEmpty() const
+{
+    return addedAPs.isEmpty() && removedAPs.isEmpty() && updatedAPs.isEmpty();
+}
+
+
+// Adds an access point change to the queue, replacing any change already
+// queued for that access point.
+void Wifi::APList::UpdateQueue::queue
+(const AccessPoint changedAP, const bool isVisible)
+{
+    jassert(!changedAP.isNull());
+    QueuedAP& queuedAP = queuedAPs[changedAP.getHashValue()];
+    queuedAP.accessPoint = changedAP;
+    queuedAP.isVisible = isVisible;
+}
+
+
+// Checks if any changes are waiting in the queue.
+bool Wifi::APList::UpdateQueue::isEmpty() const
+{
+    return queuedAPs.isEmpty();
+}
+
+
+// Removes all queued changes, returning the changes that should be sent to
+// listeners.
+Wifi::APList::UpdateQueue::Changes Wifi::APList::UpdateQueue::takeChanges()
+{
+    Changes changes;
+    for (auto& iter : queuedAPs)
+    {
+        const LibNM::APHash& apHash = iter.first;
+        const AccessPoint& changedAP = iter.second.accessPoint;
+        const bool isVisible = iter.second.isVisible;
+        const unsigned int* sentStrength = sentStrengths.find(apHash);
+        const unsigned int signalStrength = changedAP.getSignalStrength();
+        if (isVisible && sentStrength == nullptr)
+        {
+            changes.addedAPs.add(changedAP);
+            sentStrengths[apHash] = signalStrength;
+        }
+        else if (!isVisible && sentStrength != nullptr)
+        {
+            changes.removedAPs.add(changedAP);
+            sentStrengths.erase(apHash);
+        }
+        else if (isVisible && std::abs((int) signalStrength
+                    - (int) *sentStrength) >= (int) minStrengthChange)
+        {
+            changes.updatedAPs.add(changedAP);
+            sentStrengths[apHash] = signalStrength;
+        }
+    }
+    queuedAPs.clear();
+    return changes;
+}
+
+
+// Discards all queued changes, and forgets all reported access points.
+void Wifi::APList::UpdateQueue::clear()
+{
+    queuedAPs.clear();
+    sentStrengths.clear();
+}
@@ -0,0 +1,116 @@
+#ifndef WIFI_IMPLEMENTATION
+    #error File included directly outside of Wifi module implementation.
+#endif
+#pragma once
+/**
+ * @file  Wifi_APList_UpdateQueue.h
+ *
+ * @brief  Collects access point changes and decides which of them should be
+ *         sent to APList listeners.
+ */
+
+#include "Wifi_AccessPoint.h"
+#include "Wifi_LibNM_APHash.h"
+#include "Wifi_LibNM_APHashMap.h"
+#include "JuceHeader.h"
+
+namespace Wifi { namespace APList { class UpdateQueue; } }
+
+/**
+ * @brief  Holds access point changes until the APList::Module is ready to send
+ *         them, then sorts them into added, removed, and updated access points.
+ *
+ *  Only the final state of each queued access point is used when changes are
+ * taken from the queue. Access points that are lost and found again, or found
+ * and lost again, before changes are taken are not reported at all. Visible
+ * access points are only reported as updated if their signal strength differs
+ * from the last strength reported for them by at least minStrengthChange.
+ *
+ *  The UpdateQueue doesn't lock its data or send updates itself. The
+ * APList::Module only uses it within the LibNM thread.
+ */
+class Wifi::APList::UpdateQueue
+{
+public:
+    // Smallest signal strength change that will be reported as an update:
+    static const constexpr unsigned int minStrengthChange = 5;
+
+    /**
+     * @brief  Access point changes that should be sent to listeners.
+     */
+    struct Changes
+    {
+        // All newly discovered access points:
+        juce::Array<AccessPoint> addedAPs;
+        // All previously reported access points that are no longer visible:
+        juce::Array<AccessPoint> removedAPs;
+        // All visible access points with significant signal strength changes:
+        juce::Array<AccessPoint> updatedAPs;
+
+        /**
+         * @brief  Checks if there are no changes to send.
+         *
+         * @return  Whether all change lists are empty.
+         */
+        bool isEmpty() const;
+    };
+
+    UpdateQueue() { }
+
+    virtual ~UpdateQueue() { }
+
+    /**
+     * @brief  Adds an access point change to the queue, replacing any change
+     *         already queued for that access point.
+     *
+     * @param changedAP  An access point that was added, removed, or given a
+     *                   new signal strength. Its signal strength is read when
+     *                   changes are taken from the queue.
+     *
+     * @param isVisible  Whether the access point is currently visible.
+     */
+    void queue(const AccessPoint changedAP, const bool isVisible);
+
+    /**
+     * @brief  Checks if any changes are waiting in the queue.
+     *
+     * @return  Whether the queue is empty.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief  Removes all queued changes, returning the changes that should be
+     *         sent to listeners.
+     *
+     * @return  All queued access points that were found, lost, or had
+     *          significant signal strength changes since the last changes were
+     *          taken.
+     */
+    Changes takeChanges();
+
+    /**
+     * @brief  Discards all queued changes, and forgets all reported access
+     *         points.
+     */
+    void clear();
+
+private:
+    /**
+     * @brief  Holds a queued access point, along with its visibility.
+     */
+    struct QueuedAP
+    {
+        AccessPoint accessPoint;
+        bool isVisible = false;
+    };
+
+    // All access points changed since changes were last taken, mapped by hash
+    // value:
+    LibNM::APHashMap<QueuedAP> queuedAPs;
+
+    // The last signal strength reported for each access point that was
+    // reported as visible, mapped by hash value:
+    LibNM::APHashMap<unsigned int> sentStrengths;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UpdateQueue)
+};
@@ -3,6 +3,52 @@
 #include "Wifi_LibNM_SecurityType.h"
 #include "Wifi_LibNM_ContextTest.h"
 
+// FNV-1a initial hash value:
+static const constexpr juce::uint64 fnvOffsetBasis = 0xcbf29ce484222325ULL;
+
+// FNV-1a hash multiplier:
+static const constexpr juce::uint64 fnvPrime = 0x100000001b3ULL;
+
+// Number of hexadecimal characters in a hash value string:
+static const constexpr int hashStringLength = 16;
+
+/**
+ * @brief  Adds a byte to an FNV-1a hash value.
+ *
+ * @param hash  The current hash value.
+ *
+ * @param byte  The next byte of hashed data.
+ *
+ * @return      The updated hash value.
+ */
+static inline juce::uint64 fnvHashByte(const juce::uint64 hash,
+        const juce::uint8 byte)
+{
+    return (hash ^ byte) * fnvPrime;
+}
+
+/**
+ * @brief  Mixes the bits of a hash value, so that every bit of the input
+ *         affects the lowest bits of the result.
+ *
+ *  FNV-1a alone distributes short inputs poorly across the low bits, which
+ * hash tables use to select buckets.
+ *
+ * @param hash  An FNV-1a hash value.
+ *
+ * @return      The mixed hash value.
+ */
+static inline juce::uint64 finalizeHash(juce::uint64 hash)
+{
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+
 // Generates a Wifi access point identifier using the access point's SSID,
 // mode, and security settings.
 Wifi::LibNM::APHash::APHash(const GByteArray* ssid,
@@ -11,33 +57,33 @@ Wifi::LibNM::APHash::APHash(const GByteArray* ssid,
 {
     if (ssid == nullptr)
     {
-        hashValue = juce::String();
         jassertfalse;
         return;
     }
 
-    unsigned char input[66] = {0};
-    memcpy(input, ssid->data, ssid->len);
-    // Use mode and securityType as bitflags
-    input[32] |= (unsigned char) mode;
-    input[32] |= (unsigned char) securityType;
-    // duplicate it
-    memcpy(&input[33], &input[0], 32);
-    juce::String inputStr;
-    for (int i = 0; i < 66; i++)
+    juce::uint64 hash = fnvOffsetBasis;
+    for (guint i = 0; i < ssid->len; i++)
     {
-        inputStr += input[i];
+        hash = fnvHashByte(hash, ssid->data[i]);
     }
-    char* hashString = g_compute_checksum_for_data
-            (G_CHECKSUM_MD5, input, sizeof(input));
-    hashValue = hashString;
-    g_free(hashString);
+    // Mode and security type values are distinct bit flags, so they can be
+    // hashed together as a single byte:
+    const juce::uint8 flags = (juce::uint8) mode | (juce::uint8) securityType;
+    hash = finalizeHash(fnvHashByte(hash, flags));
+    // Zero is reserved for null hash values:
+    hashValue = (hash == 0) ? 1 : hash;
 }
 
 
 // Creates an APHash from a saved hash value string.
-Wifi::LibNM::APHash::APHash(const juce::String hashString) :
-        hashValue(hashString) { }
+Wifi::LibNM::APHash::APHash(const juce::String hashString)
+{
+    if (hashString.length() == hashStringLength
+            && hashString.containsOnly("0123456789abcdefABCDEF"))
+    {
+        hashValue = (juce::uint64) hashString.getHexValue64();
+    }
+}
 
 
 // Checks if another APHash is equivalent to this one.
@@ -64,12 +110,24 @@ bool Wifi::LibNM::APHash::operator< (const APHash& rhs) const
 // Checks if this hash object is invalid.
 bool Wifi::LibNM::APHash::isNull() const
 {
-    return hashValue.isEmpty();
+    return hashValue == 0;
+}
+
+
+// Gets the integer hash value.
+juce::uint64 Wifi::LibNM::APHash::getValue() const
+{
+    return hashValue;
 }
 
 
 // Gets a string representation of the hash value.
 juce::String Wifi::LibNM::APHash::toString() const
 {
-    return hashValue;
+    if (isNull())
+    {
+        return juce::String();
+    }
+    return juce::String::toHexString((juce::int64) hashValue)
+            .paddedLeft('0', hashStringLength);
 }
@@ -29,6 +29,12 @@ namespace Wifi { namespace LibNM
  * connected to a network with multiple Wifi routers. However, it is possible
  * for two access points to exist with the same APHash but different passwords,
  * so this should be considered when handling connection failures.
+ *
+ *  Hash values are 64-bit integers generated with a fast non-cryptographic
+ * hash function, so they can be cheaply generated for every scanned access
+ * point and compared or used as hash table keys without any string handling.
+ * The zero value is reserved for null hashes. Hash values only need to be
+ * converted to strings when they are saved or printed.
  */
 class Wifi::LibNM::APHash
 {
@@ -52,7 +58,9 @@ public:
     /**
      * @brief  Creates an APHash from a saved hash value string.
      *
-     * @param hashString  The string representation of a hash value.
+     * @param hashString  The string representation of a hash value, as
+     *                    returned by toString. If this is not a valid hash
+     *                    string, a null hash will be created.
      */
     APHash(const juce::String hashString);
 
@@ -84,8 +92,7 @@ public:
      *
      * @param rhs  Another hash value to compare with this APHash.
      *
-     * @return     True if and only if this hash value comes before rhs when
-     *             sorted alphabetically.
+     * @return     True if and only if this hash value is less than rhs.
      */
     bool operator< (const APHash& rhs) const;
 
@@ -97,13 +104,22 @@ public:
      */
     bool isNull() const;
 
+    /**
+     * @brief  Gets the integer hash value.
+     *
+     * @return  The hash value, or zero if the hash is null.
+     */
+    juce::uint64 getValue() const;
+
     /**
      * @brief  Gets a string representation of the hash value.
      *
-     * @return  The hash value as a printable string.
+     * @return  The hash value as a sixteen character hexadecimal string, or
+     *          the empty string if the hash is null.
      */
     juce::String toString() const;
 
 private:
-    juce::String hashValue;
+    // The hash value, or zero for null hashes:
+    juce::uint64 hashValue = 0;
 };
@@ -0,0 +1,356 @@
+#pragma once
+/**
+ * @file  Wifi_LibNM_APHashMap.h
+ *
+ * @brief  An open-addressing hash table that maps access point hash values to
+ *         stored values.
+ */
+
+#include "Wifi_LibNM_APHash.h"
+#include "JuceHeader.h"
+#include <utility>
+#include <vector>
+
+namespace Wifi { namespace LibNM { template<class ValueType>
+        class APHashMap; } }
+
+/**
+ * @brief  Maps APHash keys to values, using a linear probing hash table.
+ *
+ *  APHash values are already well distributed integers, so the lowest bits of
+ * each hash value are used directly to select its table slot. All entries are
+ * stored in a single contiguous array, and null APHash keys are used to mark
+ * empty slots, so null hash values may never be used as keys. Entries are
+ * removed with backward shift deletion, so lookups never need to skip over
+ * deleted entry markers.
+ *
+ *  APHashMap iterators access each stored key and value as a std::pair, in no
+ * particular order. Keys must not be changed through iterators, and adding or
+ * removing entries invalidates all iterators and value references.
+ *
+ * @tparam ValueType  The type of value stored in the map. This must be default
+ *                    constructible and movable.
+ */
+template<class ValueType>
+class Wifi::LibNM::APHashMap
+{
+private:
+    // Table entries, holding null keys if empty:
+    typedef std::pair<APHash, ValueType> Entry;
+
+    /**
+     * @brief  Iterates through all non-empty entries in the table.
+     *
+     * @tparam EntryType  Entry or const Entry.
+     */
+    template<class EntryType>
+    class Iterator
+    {
+    public:
+        /**
+         * @brief  Creates an iterator pointing to the first non-empty entry at
+         *         or after a table position.
+         *
+         * @param entry     The initial table position.
+         *
+         * @param tableEnd  The end of the table array.
+         */
+        Iterator(EntryType* entry, EntryType* tableEnd) :
+            entry(entry), tableEnd(tableEnd)
+        {
+            skipEmptyEntries();
+        }
+
+        EntryType& operator*() const { return *entry; }
+
+        EntryType* operator->() const { return entry; }
+
+        Iterator& operator++()
+        {
+            ++entry;
+            skipEmptyEntries();
+            return *this;
+        }
+
+        bool operator== (const Iterator& rhs) const
+        {
+            return entry == rhs.entry;
+        }
+
+        bool operator!= (const Iterator& rhs) const
+        {
+            return entry != rhs.entry;
+        }
+
+    private:
+        /**
+         * @brief  Advances the iterator until it reaches a non-empty entry or
+         *         the end of the table.
+         */
+        void skipEmptyEntries()
+        {
+            while (entry != tableEnd && entry->first.isNull())
+            {
+                ++entry;
+            }
+        }
+
+        EntryType* entry;
+        EntryType* tableEnd;
+    };
+
+public:
+    typedef Iterator<Entry> iterator;
+    typedef Iterator<const Entry> const_iterator;
+
+    /**
+     * @brief  Creates an empty map.
+     */
+    APHashMap() { }
+
+    /**
+     * @brief  Gets the number of entries saved in the map.
+     *
+     * @return  The number of stored values.
+     */
+    int size() const
+    {
+        return numEntries;
+    }
+
+    /**
+     * @brief  Checks if the map contains no entries.
+     *
+     * @return  Whether the map is empty.
+     */
+    bool isEmpty() const
+    {
+        return numEntries == 0;
+    }
+
+    /**
+     * @brief  Checks if the map contains a value for a hash key.
+     *
+     * @param hash  The key to search for.
+     *
+     * @return      Whether a value is mapped to the hash value.
+     */
+    bool contains(const APHash& hash) const
+    {
+        return find(hash) != nullptr;
+    }
+
+    /**
+     * @brief  Finds the value mapped to a hash key.
+     *
+     * @param hash  The key to search for.
+     *
+     * @return      The mapped value, or nullptr if the key is not in the map.
+     */
+    ValueType* find(const APHash& hash)
+    {
+        const int index = findIndex(hash);
+        return (index < 0) ? nullptr : &table[index].second;
+    }
+
+    /**
+     * @brief  Finds the value mapped to a hash key.
+     *
+     * @param hash  The key to search for.
+     *
+     * @return      The mapped value, or nullptr if the key is not in the map.
+     */
+    const ValueType* find(const APHash& hash) const
+    {
+        const int index = findIndex(hash);
+        return (index < 0) ? nullptr : &table[index].second;
+    }
+
+    /**
+     * @brief  Gets the value mapped to a hash key, adding a default value to
+     *         the map if the key isn't already present.
+     *
+     * @param hash  A non-null APHash key.
+     *
+     * @return      A reference to the mapped value.
+     */
+    ValueType& operator[] (const APHash& hash)
+    {
+        if (hash.isNull())
+        {
+            // Null hash values mark empty entries, so they can't be used as
+            // keys:
+            jassertfalse;
+            nullKeyValue = ValueType();
+            return nullKeyValue;
+        }
+        const int index = findIndex(hash);
+        if (index >= 0)
+        {
+            return table[index].second;
+        }
+        // Keep the table at most half full, so that probe sequences stay
+        // short:
+        if (table.empty())
+        {
+            resizeTable(minTableSize);
+        }
+        else if ((numEntries + 1) * 2 > (int) table.size())
+        {
+            resizeTable(table.size() * 2);
+        }
+        size_t insertIndex = getHomeIndex(hash);
+        while (!table[insertIndex].first.isNull())
+        {
+            insertIndex = (insertIndex + 1) & indexMask;
+        }
+        table[insertIndex].first = hash;
+        numEntries++;
+        return table[insertIndex].second;
+    }
+
+    /**
+     * @brief  Removes a hash key and its value from the map.
+     *
+     * @param hash  The key to remove.
+     *
+     * @return      Whether the key was found and removed.
+     */
+    bool erase(const APHash& hash)
+    {
+        const int index = findIndex(hash);
+        if (index < 0)
+        {
+            return false;
+        }
+        // Move later entries in the same probe sequence back into the emptied
+        // slot whenever they would otherwise become unreachable:
+        size_t emptyIndex = index;
+        size_t nextIndex = (emptyIndex + 1) & indexMask;
+        while (!table[nextIndex].first.isNull())
+        {
+            const size_t homeIndex = getHomeIndex(table[nextIndex].first);
+            if (((nextIndex - homeIndex) & indexMask)
+                    >= ((nextIndex - emptyIndex) & indexMask))
+            {
+                table[emptyIndex] = std::move(table[nextIndex]);
+                emptyIndex = nextIndex;
+            }
+            nextIndex = (nextIndex + 1) & indexMask;
+        }
+        table[emptyIndex] = Entry();
+        numEntries--;
+        return true;
+    }
+
+    /**
+     * @brief  Removes all entries from the map.
+     */
+    void clear()
+    {
+        table.clear();
+        indexMask = 0;
+        numEntries = 0;
+    }
+
+    iterator begin()
+    {
+        return iterator(table.data(), table.data() + table.size());
+    }
+
+    iterator end()
+    {
+        return iterator(table.data() + table.size(),
+                table.data() + table.size());
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(table.data(), table.data() + table.size());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(table.data() + table.size(),
+                table.data() + table.size());
+    }
+
+private:
+    /**
+     * @brief  Gets the first table index where a hash key may be stored.
+     *
+     * @param hash  A non-null hash key.
+     *
+     * @return      The key's preferred table index.
+     */
+    size_t getHomeIndex(const APHash& hash) const
+    {
+        return (size_t) hash.getValue() & indexMask;
+    }
+
+    /**
+     * @brief  Finds the table index of a hash key.
+     *
+     * @param hash  The key to search for.
+     *
+     * @return      The key's index, or -1 if the key is not in the map.
+     */
+    int findIndex(const APHash& hash) const
+    {
+        if (hash.isNull() || table.empty())
+        {
+            return -1;
+        }
+        for (size_t index = getHomeIndex(hash);
+                !table[index].first.isNull();
+                index = (index + 1) & indexMask)
+        {
+            if (table[index].first == hash)
+            {
+                return (int) index;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief  Moves all entries into a new table.
+     *
+     * @param newSize  The new table size, which must be a power of two.
+     */
+    void resizeTable(const size_t newSize)
+    {
+        std::vector<Entry> oldTable;
+        oldTable.swap(table);
+        table.resize(newSize);
+        indexMask = newSize - 1;
+        for (Entry& entry : oldTable)
+        {
+            if (!entry.first.isNull())
+            {
+                size_t index = getHomeIndex(entry.first);
+                while (!table[index].first.isNull())
+                {
+                    index = (index + 1) & indexMask;
+                }
+                table[index] = std::move(entry);
+            }
+        }
+    }
+
+    // Initial table size, large enough to hold a typical scan without
+    // resizing:
+    static const constexpr size_t minTableSize = 64;
+
+    // All table entries:
+    std::vector<Entry> table;
+
+    // Table size minus one, used to wrap table indices:
+    size_t indexMask = 0;
+
+    // Number of non-empty table entries:
+    int numEntries = 0;
+
+    // Returned when a null key is used in release builds:
+    ValueType nullKeyValue;
+};
@@ -0,0 +1,91 @@
+#include "Assets_SVGLoader.h"
+#include "Testing_Benchmark.h"
+#include "JuceHeader.h"
+
+namespace Assets { class SVGTest; }
+
+// Simple test SVG, filled with a single colour:
+static const constexpr char* testSVG =
+    "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"64\" height=\"64\""
+    " viewBox=\"0 0 64 64\">"
+    "<rect x=\"0\" y=\"0\" width=\"64\" height=\"64\" fill=\"#ff0000\"/>"
+    "</svg>";
+
+// Number of times each image is loaded when measuring load speed:
+static const constexpr int loadRepetitions = 100;
+
+/**
+ * @brief  Tests that Assets::SVGLoader draws SVG images at the requested size,
+ *         reuses cached images, and applies colour substitutions.
+ */
+class Assets::SVGTest : public juce::UnitTest
+{
+public:
+    SVGTest() : juce::UnitTest("Assets::SVGLoader Testing", "Assets") {}
+
+    void runTest() override
+    {
+        using juce::Image;
+        using juce::Colour;
+        juce::TemporaryFile tempFile(".svg");
+        const juce::File svgFile = tempFile.getFile();
+        svgFile.replaceWithText(testSVG);
+        SVGLoader svgLoader;
+
+        beginTest("Exact image size");
+        Image svgImage = svgLoader.loadImage(svgFile, 48, 32);
+        expect(svgImage.isValid(), "SVG image wasn't loaded.");
+        expectEquals(svgImage.getWidth(), 48, "Wrong image width.");
+        expectEquals(svgImage.getHeight(), 32, "Wrong image height.");
+        expect(svgImage.getPixelAt(24, 16) == Colour(0xffff0000),
+                "Wrong image colour.");
+
+        beginTest("Cached images");
+        expect(svgLoader.loadImage(svgFile, 48, 32) == svgImage,
+                "Image wasn't loaded from the cache.");
+        expect(svgLoader.loadImage(svgFile, 32, 32) != svgImage,
+                "Image with a different size was loaded from the cache.");
+
+        beginTest("Colour substitutions");
+        const SVGLoader::ColourSubstitutions colours =
+        {
+            { Colour(0xffff0000), Colour(0xff0000ff) }
+        };
+        Image blueImage = svgLoader.loadImage(svgFile, 48, 32, colours);
+        expect(blueImage != svgImage,
+                "Recoloured image was loaded from the cache.");
+        expect(blueImage.getPixelAt(24, 16) == Colour(0xff0000ff),
+                "Colour substitution wasn't applied.");
+
+        beginTest("Changed files");
+        svgFile.setLastModificationTime(svgFile.getLastModificationTime()
+                + juce::RelativeTime::seconds(10));
+        expect(svgLoader.loadImage(svgFile, 48, 32) != svgImage,
+                "Cached image was used after the file changed.");
+
+        beginTest("SVG load speed");
+        const double parseTime = Testing::Benchmark::averageMicroseconds(
+                loadRepetitions, [&svgFile](const int)
+        {
+            std::unique_ptr<juce::XmlElement> svgElement
+                    (juce::XmlDocument::parse(svgFile));
+            std::unique_ptr<juce::Drawable> drawable
+                    = juce::Drawable::createFromSVG(*svgElement);
+            Image uncachedImage(Image::ARGB, 48, 32, true);
+            juce::Graphics g(uncachedImage);
+            drawable->drawWithin(g, uncachedImage.getBounds().toFloat(),
+                    juce::RectanglePlacement::centred, 1.0f);
+        });
+        const double cachedTime = Testing::Benchmark::averageMicroseconds(
+                loadRepetitions, [&svgLoader, &svgFile](const int)
+        {
+            svgLoader.loadImage(svgFile, 48, 32);
+        });
+        logMessage(juce::String("Parsing and drawing SVG: ")
+                + juce::String(parseTime, 1) + " us");
+        logMessage(juce::String("Loading cached SVG image: ")
+                + juce::String(cachedTime, 1) + " us");
+    }
+};
+
+static Assets::SVGTest test;
@@ -1,6 +1,7 @@
 #include "Assets_XPMLoader.h"
 #include "Assets.h"
 #include "Testing_Window.h"
+#include "Testing_Benchmark.h"
 #include "Widgets_DrawableImage.h"
 #include "JuceHeader.h"
 #include <X11/xpm.h>
@@ -19,8 +20,65 @@ static const juce::StringArray testFiles =
     "testing/XPM/test3.xpm"
 };
 
+// Number of times each image is loaded when measuring loading speed:
+static const constexpr int loadRepetitions = 20;
+
 namespace Assets { class XpmTest; }
 
+/**
+ * @brief  Loads a xpm image file the way XPMLoader used to, using libXpm and a
+ *         new X display connection for each image.
+ *
+ * @param xpmFile  A xpm file object.
+ *
+ * @return         The loaded image, or a null image if loading failed.
+ */
+static juce::Image loadWithLibXpm(const juce::File xpmFile)
+{
+    using juce::Image;
+    XpmImage imageData;
+    if (XpmReadFileToXpmImage(xpmFile.getFullPathName().toRawUTF8(),
+            &imageData, nullptr) != XpmSuccess)
+    {
+        return Image();
+    }
+    Display * display = XOpenDisplay(nullptr);
+    if (display == nullptr)
+    {
+        XpmFreeXpmImage(&imageData);
+        return Image();
+    }
+    Image xpmImage(Image::PixelFormat::RGB, imageData.width,
+            imageData.height, true);
+    juce::Array<juce::Colour> imageColours;
+    for (unsigned int i = 0; i < imageData.ncolors; i++)
+    {
+        XColor colorValue;
+        char* c_color = imageData.colorTable[i].c_color;
+        if (c_color == nullptr || XParseColor(display,
+                    XDefaultColormap(display, 0), c_color, &colorValue) == 0)
+        {
+            imageColours.add(juce::Colours::transparentBlack);
+            continue;
+        }
+        imageColours.add(juce::Colour(
+                    juce::uint8(colorValue.red / 256),
+                    juce::uint8(colorValue.green / 256),
+                    juce::uint8(colorValue.blue / 256)));
+    }
+    XCloseDisplay(display);
+    for (unsigned int y = 0; y < imageData.height; y++)
+    {
+        for (unsigned int x = 0; x < imageData.width; x++)
+        {
+            const int colourIndex = imageData.data[x + y * imageData.width];
+            xpmImage.setPixelAt(x, y, imageColours[colourIndex]);
+        }
+    }
+    XpmFreeXpmImage(&imageData);
+    return xpmImage;
+}
+
 /**
  * @brief  Tests loading images with the .xpm image format using
  *         Assets::xpmImage.
@@ -51,6 +109,48 @@ public:
             juce::MessageManager::getInstance()->runDispatchLoopUntil(5000);
         }
 
+        beginTest("Loading speed");
+        for (const juce::String& assetPath : testFiles)
+        {
+            juce::File assetFile(findAssetFile(assetPath, false));
+            const juce::Image xpmImage
+                    = Assets::XPMLoader::loadXPMImage(assetFile);
+            const juce::Image libXpmImage = loadWithLibXpm(assetFile);
+            if (!xpmImage.isValid() || !libXpmImage.isValid())
+            {
+                continue;
+            }
+            expect(xpmImage.getBounds() == libXpmImage.getBounds(),
+                    assetPath + " size doesn't match the libXpm image.");
+            for (int y = 0; y < xpmImage.getHeight(); y++)
+            {
+                for (int x = 0; x < xpmImage.getWidth(); x++)
+                {
+                    const juce::Colour pixel = xpmImage.getPixelAt(x, y);
+                    if (pixel.isOpaque()
+                            && pixel != libXpmImage.getPixelAt(x, y))
+                    {
+                        expect(false, assetPath + " pixel colours don't "
+                                + "match the libXpm image.");
+                        y = xpmImage.getHeight();
+                        break;
+                    }
+                }
+            }
+
+            const double loaderTime = Testing::Benchmark::averageMicroseconds(
+                    loadRepetitions, [&assetFile](const int)
+            {
+                Assets::XPMLoader::loadXPMImage(assetFile);
+            });
+            const double libXpmTime = Testing::Benchmark::averageMicroseconds(
+                    loadRepetitions, [&assetFile](const int)
+            {
+                loadWithLibXpm(assetFile);
+            });
+            logMessage(assetPath + ": XPMLoader " + juce::String(loaderTime, 1)
+                    + " us, libXpm " + juce::String(libXpmTime, 1) + " us");
+        }
     }
 };
 
@@ -7,9 +7,19 @@
 #include "Config_Test_FileHandler.h"
 #include "Config_Test_Listener.h"
 #include "Config_Test_JSONKeys.h"
+#include "Testing_Benchmark.h"
 
 namespace Config { namespace Test { class FileTest; } }
 
+// Number of rapid value changes used to test write coalescing:
+static const constexpr int coalescedChanges = 20;
+
+// Milliseconds to wait for coalesced changes to be written to the file:
+static const constexpr int coalescedWriteWait = 2000;
+
+// Number of value reads used to measure config value read speed:
+static const constexpr int readRepetitions = 100000;
+
 class Config::Test::FileTest : public juce::UnitTest
 {
 public:
@@ -109,6 +119,42 @@ public:
                 ((juce::Identifier&) JSONKeys::testBool).toString(),
                 "TestListener should have only registered the boolean update.");
 
+        beginTest("Coalescing value writes");
+        const auto initialStats = handler->getWriteStatistics();
+        for (int i = 1; i <= coalescedChanges; i++)
+        {
+            handler->setTestInt(newInt + i);
+        }
+        juce::Thread::sleep(coalescedWriteWait);
+        const auto coalescedStats = handler->getWriteStatistics();
+        expectEquals<int64>(coalescedStats.fileWrites
+                - initialStats.fileWrites, 1,
+                "Rapid changes should have been saved in a single write.");
+        expectEquals<int64>(coalescedStats.changesSaved
+                - initialStats.changesSaved, coalescedChanges,
+                "Failed to save all rapid changes.");
+        expectEquals<int64>(coalescedStats.writesAvoided
+                - initialStats.writesAvoided, coalescedChanges - 1,
+                "Incorrect number of avoided writes.");
+        logMessage(String("Coalesced write latency: ")
+                + String(coalescedStats.lastFlushLatency, 1)
+                + "ms, write time: "
+                + String(coalescedStats.lastWriteDuration, 2) + "ms");
+
+        beginTest("Config value read speed");
+        int64 readSum = 0;
+        const double readTime = Testing::Benchmark::averageMicroseconds(
+                readRepetitions, [&handler, &readSum](const int)
+        {
+            readSum += handler->getTestInt();
+            readSum += handler->getTestString().length();
+        });
+        expectEquals<int64>(readSum, (int64) readRepetitions
+                * (handler->getTestInt() + handler->getTestString().length()),
+                "Config values changed while reading.");
+        logMessage(String("Average config value read time: ")
+                + String(readTime / 2, 3) + " us");
+
         beginTest("Restoring default values");
         testListener.removeTrackedKey(JSONKeys::testBool);
         testListener.addTrackedKey(JSONKeys::testString);
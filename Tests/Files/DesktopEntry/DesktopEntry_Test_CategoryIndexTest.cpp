@@ -0,0 +1,113 @@
+#include "DesktopEntry_CategoryIndex.h"
+#include "DesktopEntry_EntryFile.h"
+#include "JuceHeader.h"
+
+namespace DesktopEntry { namespace Test { class CategoryIndexTest; } }
+
+/**
+ * @brief  Tests that the DesktopEntry::CategoryIndex finds the correct entries
+ *         within one or more categories.
+ */
+class DesktopEntry::Test::CategoryIndexTest : public juce::UnitTest
+{
+public:
+    CategoryIndexTest() : juce::UnitTest("DesktopEntry::CategoryIndex testing",
+            "DesktopEntry") {}
+
+    /**
+     * @brief  Creates a desktop entry object with a list of categories.
+     *
+     * @param entryID     The entry's desktop file ID.
+     *
+     * @param categories  The categories to assign to the entry, separated by
+     *                    semicolons.
+     *
+     * @return            The new desktop entry.
+     */
+    static EntryFile createEntry(const juce::String& entryID,
+            const juce::String& categories)
+    {
+        EntryFile entry(entryID, entryID, EntryFile::Type::application);
+        entry.setCategories(juce::StringArray::fromTokens(categories, ";",
+                    ""));
+        return entry;
+    }
+
+    /**
+     * @brief  Checks that a list of entry numbers holds the expected entries.
+     *
+     * @param entryNumbers  Entry numbers returned by the category index.
+     *
+     * @param expected      The expected entry numbers, in order.
+     *
+     * @param description   A description of the checked entry list.
+     */
+    void expectEntries(const std::vector<int>& entryNumbers,
+            const std::vector<int>& expected, const juce::String& description)
+    {
+        expect(entryNumbers == expected, description + " had "
+                + juce::String((int) entryNumbers.size())
+                + " entries, expected "
+                + juce::String((int) expected.size()) + ".");
+    }
+
+    void runTest() override
+    {
+        juce::Array<EntryFile> entries;
+        entries.add(createEntry("zero.desktop", "Game;Utility"));
+        entries.add(createEntry("one.desktop", "Utility"));
+        entries.add(createEntry("two.desktop", ""));
+        entries.add(createEntry("three.desktop", "Game;Network"));
+        entries.add(createEntry("four.desktop", "Network;Network"));
+        entries.add(createEntry("one.desktop", "Office;Game"));
+        CategoryIndex categoryIndex(entries);
+
+        beginTest("Single category test");
+        expectEntries(categoryIndex.getCategoryEntries("Game"), { 0, 3 },
+                "Game category");
+        expectEntries(categoryIndex.getCategoryEntries("Network"), { 3, 4 },
+                "Network category, with a repeated category,");
+        expectEntries(categoryIndex.getCategoryEntries("Missing"), { },
+                "Missing category");
+
+        beginTest("Overlapping category test");
+        expectEntries(categoryIndex.findEntriesInAny({ "Game", "Utility" }),
+                { 0, 1, 3 }, "Game or Utility categories");
+        expectEntries(categoryIndex.findEntriesInAny(
+                    { "Network", "Game", "Utility" }), { 0, 1, 3, 4 },
+                "Network, Game, or Utility categories");
+
+        beginTest("Missing and empty category test");
+        expectEntries(categoryIndex.findEntriesInAny({ }), { },
+                "Empty category list");
+        expectEntries(categoryIndex.findEntriesInAny({ "Missing" }), { },
+                "Missing category list");
+        expectEntries(categoryIndex.findEntriesInAny({ "", "Missing",
+                    "Network" }), { 3, 4 },
+                "Network category with missing categories");
+
+        beginTest("Duplicate entry ID test");
+        expectEquals(categoryIndex.getEntryNumber("one.desktop"), 1,
+                "Duplicate entry replaced the first entry with its ID.");
+        expectEntries(categoryIndex.findEntriesInAny({ "Office" }), { },
+                "Duplicate entry Office category");
+        expect(categoryIndex.getEntryID(5).isEmpty(),
+                "Duplicate entry was assigned its own entry number.");
+
+        beginTest("Changed entry test");
+        categoryIndex.removeEntry("zero.desktop");
+        expectEntries(categoryIndex.findEntriesInAny({ "Game", "Utility" }),
+                { 1, 3 }, "Game or Utility categories after removal");
+        categoryIndex.addEntry("two.desktop", { "Utility" });
+        expectEntries(categoryIndex.getCategoryEntries("Utility"), { 1, 2 },
+                "Utility category after updating an entry");
+        const int newNumber = categoryIndex.addEntry("five.desktop",
+                { "Office" });
+        expectEquals(categoryIndex.getEntryID(newNumber),
+                juce::String("five.desktop"));
+        expectEntries(categoryIndex.getCategoryEntries("Office"),
+                { newNumber }, "Office category after adding an entry");
+    }
+};
+
+static DesktopEntry::Test::CategoryIndexTest test;
@@ -0,0 +1,153 @@
+#define DESKTOP_ENTRY_IMPLEMENTATION
+#include "DesktopEntry_EntryIndex.h"
+#include "DesktopEntry_EntryFile.h"
+#include "JuceHeader.h"
+
+namespace DesktopEntry { namespace Test { class EntryIndexTest; } }
+
+// Desktop entry data shared by all test entry files:
+static const constexpr char* testEntryData =
+    "[Desktop Entry]\n"
+    "Type=Application\n"
+    "Exec=testCommand --option\n"
+    "Categories=Utility;Development;\n";
+
+// Number of bytes removed from the end of the index file when testing a
+// truncated index:
+static const constexpr int truncatedBytes = 10;
+
+/**
+ * @brief  Tests that the DesktopEntry::EntryIndex saves and reloads entry
+ *         data, detects changed entry files, and safely handles damaged index
+ *         files.
+ */
+class DesktopEntry::Test::EntryIndexTest : public juce::UnitTest
+{
+public:
+    EntryIndexTest() : juce::UnitTest("DesktopEntry::EntryIndex testing",
+            "DesktopEntry") {}
+
+    /**
+     * @brief  Creates a test desktop entry file.
+     *
+     * @param directory  The directory where the file will be created.
+     *
+     * @param entryID    The entry's desktop file ID.
+     *
+     * @param name       The entry's displayed name.
+     *
+     * @return           The new .desktop file.
+     */
+    static juce::File createEntryFile(const juce::File& directory,
+            const juce::String& entryID, const juce::String& name)
+    {
+        const juce::File entryFile = directory.getChildFile(entryID);
+        entryFile.replaceWithText(juce::String(testEntryData) + "Name="
+                + name + "\n");
+        return entryFile;
+    }
+
+    void runTest() override
+    {
+        using juce::File;
+        using juce::String;
+        const File testDir = File::getSpecialLocation(File::tempDirectory)
+                .getNonexistentChildFile("EntryIndexTest", "", false);
+        expect(testDir.createDirectory(), "Failed to create test directory.");
+        const File indexFile = testDir.getChildFile("test.index");
+        const String firstID = "firstEntry.desktop";
+        const String secondID = "secondEntry.desktop";
+        const File firstFile = createEntryFile(testDir, firstID, "First");
+        const File secondFile = createEntryFile(testDir, secondID, "Second");
+
+        beginTest("Index write test");
+        {
+            EntryIndex entryIndex(indexFile);
+            expect(!entryIndex.loadIndex(),
+                    "Missing index file should not load entries.");
+            entryIndex.updateEntry(firstID, firstFile,
+                    EntryFile(firstFile, firstID));
+            entryIndex.updateEntry(secondID, secondFile,
+                    EntryFile(secondFile, secondID));
+            expect(entryIndex.saveIndex(), "Failed to save index file.");
+            expect(!entryIndex.saveIndex(),
+                    "Unchanged index should not be saved again.");
+        }
+
+        beginTest("Index read test");
+        {
+            EntryIndex entryIndex(indexFile);
+            expect(entryIndex.loadIndex(), "Failed to load index file.");
+            expectEquals((int) entryIndex.getIndexedFiles().size(), 2,
+                    "Wrong number of indexed files loaded.");
+            expect(entryIndex.isEntryCurrent(firstID, firstFile),
+                    "Unchanged entry was not current.");
+            expect(!entryIndex.isEntryCurrent(firstID, secondFile),
+                    "Entry was current for the wrong file.");
+            const EntryFile firstEntry = entryIndex.getEntry(firstID);
+            expectEquals(firstEntry.getName(), String("First"));
+            expectEquals(firstEntry.getExec(), String("testCommand --option"));
+            expectEquals(firstEntry.getDesktopFileID(), firstID);
+            expectEquals(entryIndex.getDisplayedEntries().size(), 2,
+                    "Wrong number of displayed entries.");
+            expect(entryIndex.getEntry("missing.desktop").getDesktopFileID()
+                    .isEmpty(), "Found an entry that was never indexed.");
+
+            // Unchanged saved data must be copied correctly when other
+            // entries change:
+            entryIndex.removeEntry(secondID);
+            expect(entryIndex.saveIndex(), "Failed to save changed index.");
+            EntryIndex reloadedIndex(indexFile);
+            expect(reloadedIndex.loadIndex(), "Failed to reload index.");
+            expectEquals(reloadedIndex.getEntry(firstID).getName(),
+                    String("First"), "Copied entry data was damaged.");
+            expect(!reloadedIndex.isEntryCurrent(secondID, secondFile),
+                    "Removed entry was still indexed.");
+            reloadedIndex.updateEntry(secondID, secondFile,
+                    EntryFile(secondFile, secondID));
+            expect(reloadedIndex.saveIndex(), "Failed to restore entry.");
+        }
+
+        beginTest("Stale file stamp test");
+        {
+            firstFile.setLastModificationTime(
+                    firstFile.getLastModificationTime()
+                    - juce::RelativeTime::hours(1));
+            EntryIndex entryIndex(indexFile);
+            expect(entryIndex.loadIndex(), "Failed to load index file.");
+            expect(!entryIndex.isEntryCurrent(firstID, firstFile),
+                    "Entry with a changed modification time was current.");
+            expect(entryIndex.isEntryCurrent(secondID, secondFile),
+                    "Unchanged entry was not current.");
+        }
+
+        beginTest("Truncated index test");
+        {
+            juce::MemoryBlock indexData;
+            expect(indexFile.loadFileAsData(indexData),
+                    "Failed to read index file.");
+            indexFile.replaceWithData(indexData.getData(),
+                    indexData.getSize() - truncatedBytes);
+            EntryIndex entryIndex(indexFile);
+            expect(entryIndex.loadIndex(),
+                    "Complete records before the truncated record were lost.");
+            expectEquals((int) entryIndex.getIndexedFiles().size(), 1,
+                    "Truncated record should not be loaded.");
+            expectEquals(entryIndex.getEntry(firstID).getName(),
+                    String("First"));
+
+            indexFile.replaceWithData(indexData.getData(), 6);
+            expect(!entryIndex.loadIndex(),
+                    "Loaded entries from an incomplete index header.");
+            expect(entryIndex.getIndexedFiles().empty(),
+                    "Old entries were kept after a failed load.");
+            indexFile.deleteFile();
+            expect(indexFile.create().wasOk(), "Failed to create empty file.");
+            expect(!entryIndex.loadIndex(),
+                    "Loaded entries from an empty index file.");
+        }
+        testDir.deleteRecursively();
+    }
+};
+
+static DesktopEntry::Test::EntryIndexTest test;
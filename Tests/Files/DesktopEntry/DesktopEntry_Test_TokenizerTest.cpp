@@ -0,0 +1,214 @@
+#define DESKTOP_ENTRY_IMPLEMENTATION
+#include "DesktopEntry_Tokenizer.h"
+#include "DesktopEntry_EntryFile.h"
+#include "DesktopEntry_FileUtils.h"
+#include "DesktopEntry_FileError.h"
+#include "DesktopEntry_FormatError.h"
+#include "Assets_XDGDirectories.h"
+#include "Testing_Benchmark.h"
+#include "JuceHeader.h"
+#include <cstring>
+
+namespace DesktopEntry { namespace Test { class TokenizerTest; } }
+
+// Sample desktop entry data used to check tokenizer output:
+static const constexpr char* sampleEntry =
+    "# Comment line\n"
+    "[Desktop Entry]\r\n"
+    "Type=Application\n"
+    "\n"
+    "Name[en_US] = Sample App\n"
+    "Exec=sample --option=value\n"
+    "X-Custom-Key=custom\n"
+    "   \n"
+    "invalid line";
+
+// Number of times each corpus file is read when measuring parsing speed:
+static const constexpr int benchmarkRepetitions = 20;
+
+/**
+ * @brief  Tests that the DesktopEntry::Tokenizer correctly splits desktop entry
+ *         data, and compares its speed with line-based parsing using a corpus
+ *         of installed desktop entry files.
+ */
+class DesktopEntry::Test::TokenizerTest : public juce::UnitTest
+{
+public:
+    TokenizerTest() : juce::UnitTest("DesktopEntry::Tokenizer testing",
+            "DesktopEntry") {}
+
+    void runTest() override
+    {
+        beginTest("Standard key lookup");
+        for (int i = 0; i < Tokenizer::getKeyCount(); i++)
+        {
+            Tokenizer::TextRange key;
+            key.start = Tokenizer::getKeyName(i);
+            key.length = std::strlen(key.start);
+            expectEquals(Tokenizer::findKeyIndex(key), i,
+                    juce::String("Failed to find key ") + key.start);
+        }
+        Tokenizer::TextRange unknownKey;
+        unknownKey.start = "X-Unknown";
+        unknownKey.length = std::strlen(unknownKey.start);
+        expectEquals(Tokenizer::findKeyIndex(unknownKey), -1,
+                "Nonstandard key was found in the standard key list!");
+
+        beginTest("Line tokenizing");
+        Tokenizer tokenizer(sampleEntry, std::strlen(sampleEntry));
+        Tokenizer::Line line;
+        expect(tokenizer.nextLine(line), "Failed to read header line!");
+        expect(line.type == Tokenizer::LineType::header,
+                "Header line had the wrong type!");
+        expectEquals(line.header.toString(), juce::String("Desktop Entry"));
+
+        expect(tokenizer.nextLine(line), "Failed to read type line!");
+        expect(line.type == Tokenizer::LineType::keyValue,
+                "Key/value line had the wrong type!");
+        expectEquals(line.key.toString(), juce::String("Type"));
+        expectEquals(line.value.toString(), juce::String("Application"));
+        expect(line.locale.isEmpty(), "Unlocalized line had a locale!");
+
+        expect(tokenizer.nextLine(line), "Failed to read localized line!");
+        expectEquals(line.key.toString(), juce::String("Name"));
+        expectEquals(line.locale.toString(), juce::String("en_US"));
+        expectEquals(line.value.toString(), juce::String("Sample App"));
+
+        expect(tokenizer.nextLine(line), "Failed to read exec line!");
+        expectEquals(line.value.toString(),
+                juce::String("sample --option=value"));
+
+        expect(tokenizer.nextLine(line), "Failed to read custom line!");
+        expectEquals(line.keyIndex, -1);
+
+        expect(tokenizer.nextLine(line), "Failed to read invalid line!");
+        expect(line.type == Tokenizer::LineType::invalid,
+                "Invalid line was not marked as invalid!");
+        expect(!tokenizer.nextLine(line), "Read past the end of the buffer!");
+
+        beginTest("Desktop entry parsing benchmark");
+        juce::Array<juce::File> corpus = findEntryFiles();
+        if (corpus.isEmpty())
+        {
+            logMessage("No desktop entry files found, skipping benchmark.");
+            return;
+        }
+        const int readCount = corpus.size() * benchmarkRepetitions;
+        const double lineParseTime = Testing::Benchmark::averageMicroseconds(
+                readCount, [this, &corpus](const int readNum)
+        {
+            readWithLineParsing(corpus[readNum % corpus.size()]);
+        });
+        const double tokenizeTime = Testing::Benchmark::averageMicroseconds(
+                readCount, [this, &corpus](const int readNum)
+        {
+            readWithTokenizer(corpus[readNum % corpus.size()]);
+        });
+        const double entryParseTime = Testing::Benchmark::averageMicroseconds(
+                corpus.size(), [&corpus](const int fileNum)
+        {
+            const juce::File& entryFile = corpus.getReference(fileNum);
+            try
+            {
+                EntryFile entry(entryFile, entryFile.getFileName());
+            }
+            catch(FileError e) { }
+            catch(FormatError e) { }
+        });
+        logMessage(juce::String("Corpus: ") + juce::String(corpus.size())
+                + " desktop entry files.");
+        logMessage(juce::String("Line-based parsing: ")
+                + juce::String(lineParseTime, 2)
+                + " microseconds per file.");
+        logMessage(juce::String("Tokenizer: ")
+                + juce::String(tokenizeTime, 2)
+                + " microseconds per file.");
+        logMessage(juce::String("Complete EntryFile parsing: ")
+                + juce::String(entryParseTime, 2)
+                + " microseconds per file.");
+    }
+
+private:
+    /**
+     * @brief  Finds all desktop entry files in the application data
+     *         directories.
+     *
+     * @return  All .desktop files found.
+     */
+    juce::Array<juce::File> findEntryFiles()
+    {
+        juce::Array<juce::File> entryFiles;
+        for (const juce::String& dir
+                : Assets::XDGDirectories::getDataSearchPaths())
+        {
+            const juce::File entryDir(dir + "/applications/");
+            if (entryDir.isDirectory())
+            {
+                entryFiles.addArray(entryDir.findChildFiles
+                        (juce::File::findFiles, true, "*.desktop"));
+            }
+        }
+        return entryFiles;
+    }
+
+    /**
+     * @brief  Splits a desktop entry file into lines, and parses each line
+     *         into key, locale, and value strings.
+     *
+     * @param entryFile  A desktop entry file.
+     *
+     * @return           The number of key/value lines found.
+     */
+    int readWithLineParsing(const juce::File& entryFile)
+    {
+        juce::StringArray lines;
+        entryFile.readLines(lines);
+        int keyValueCount = 0;
+        for (const juce::String& line : lines)
+        {
+            if (line.isEmpty() || line.startsWithChar('#')
+                    || FileUtils::isHeaderLine(line))
+            {
+                continue;
+            }
+            try
+            {
+                const juce::String locale = FileUtils::parseLocale(line);
+                const juce::Identifier& key = FileUtils::parseKey(line);
+                const juce::String value = FileUtils::parseValue(line);
+                keyValueCount++;
+            }
+            catch(FormatError e) { }
+        }
+        return keyValueCount;
+    }
+
+    /**
+     * @brief  Reads a memory-mapped desktop entry file with the Tokenizer,
+     *         copying the value of each standard key into a string.
+     *
+     * @param entryFile  A desktop entry file.
+     *
+     * @return           The number of key/value lines found.
+     */
+    int readWithTokenizer(const juce::File& entryFile)
+    {
+        const juce::MemoryMappedFile mappedFile(entryFile,
+                juce::MemoryMappedFile::readOnly);
+        Tokenizer tokenizer(static_cast<const char*>(mappedFile.getData()),
+                mappedFile.getSize());
+        Tokenizer::Line line;
+        int keyValueCount = 0;
+        while (tokenizer.nextLine(line))
+        {
+            if (line.keyIndex >= 0)
+            {
+                const juce::String value = line.value.toString();
+                keyValueCount++;
+            }
+        }
+        return keyValueCount;
+    }
+};
+
+static DesktopEntry::Test::TokenizerTest test;
@@ -0,0 +1,123 @@
+#include "Icon_ImageCache.h"
+#include "JuceHeader.h"
+
+namespace Icon { namespace Test { class ImageCacheTest; } }
+
+// Width and height of the square images used to fill the cache:
+static const constexpr int imageSize = 8;
+
+// Number of images that fit within the cache's byte budget:
+static const constexpr int budgetImageCount = 4;
+
+/**
+ * @brief  Tests that the Icon::ImageCache keeps accurate byte counts, and
+ *         discards the least recently used images first.
+ */
+class Icon::Test::ImageCacheTest : public juce::UnitTest
+{
+public:
+    ImageCacheTest() : juce::UnitTest("Icon::ImageCache testing", "Icon") {}
+
+    /**
+     * @brief  Creates an image cache key.
+     *
+     * @param name  The icon name stored in the key.
+     *
+     * @return      A key with the given name and default size, scale, and
+     *              context values.
+     */
+    static ImageCache::Key createKey(const juce::String& name)
+    {
+        return { name, imageSize, 1, Context::unknown };
+    }
+
+    /**
+     * @brief  Creates a cleared ARGB test image.
+     *
+     * @param size  The width and height of the image.
+     *
+     * @return      The new image.
+     */
+    static juce::Image createImage(const int size)
+    {
+        return juce::Image(juce::Image::ARGB, size, size, true);
+    }
+
+    void runTest() override
+    {
+        const size_t imageBytes = ImageCache::getImageBytes(
+                createImage(imageSize));
+        ImageCache imageCache(imageBytes * budgetImageCount);
+
+        beginTest("Eviction order test");
+        for (int i = 0; i < budgetImageCount; i++)
+        {
+            imageCache.addImage(createKey(juce::String(i)),
+                    createImage(imageSize));
+        }
+        expectEquals(imageCache.getStatistics().imageCount, budgetImageCount);
+        // Mark the first image as recently used, so the second image is the
+        // least recently used:
+        expect(imageCache.findImage(createKey("0")).isValid(),
+                "Cached image was not found.");
+        imageCache.addImage(createKey("new"), createImage(imageSize));
+        expect(!imageCache.findImage(createKey("1")).isValid(),
+                "Least recently used image was not evicted.");
+        expect(imageCache.findImage(createKey("0")).isValid(),
+                "Recently used image was evicted.");
+        expect(imageCache.findImage(createKey("new")).isValid(),
+                "New image was not cached.");
+        ImageCache::Statistics stats = imageCache.getStatistics();
+        expectEquals(stats.imageCount, budgetImageCount);
+        expectEquals((int) stats.evictions, 1);
+        expectEquals((int) stats.cachedBytes,
+                (int) (imageBytes * budgetImageCount));
+
+        beginTest("Replaced image byte count test");
+        const int smallSize = imageSize / 2;
+        imageCache.addImage(createKey("0"), createImage(smallSize));
+        stats = imageCache.getStatistics();
+        expectEquals(stats.imageCount, budgetImageCount,
+                "Replacing an image changed the image count.");
+        expectEquals((int) stats.cachedBytes, (int) (imageBytes
+                    * (budgetImageCount - 1)
+                    + ImageCache::getImageBytes(createImage(smallSize))),
+                "Replaced image bytes were not removed.");
+        expectEquals(imageCache.findImage(createKey("0")).getWidth(),
+                smallSize, "Image was not replaced.");
+        expectEquals((int) stats.evictions, 1,
+                "Replacing an image evicted other images.");
+
+        beginTest("Oversized image test");
+        const ImageCache::Statistics initialStats
+                = imageCache.getStatistics();
+        imageCache.addImage(createKey("huge"), createImage(imageSize * 3));
+        stats = imageCache.getStatistics();
+        expect(!imageCache.findImage(createKey("huge")).isValid(),
+                "Image larger than the byte budget was cached.");
+        expectEquals(stats.imageCount, initialStats.imageCount,
+                "Oversized image changed the image count.");
+        expectEquals((int) stats.evictions, (int) initialStats.evictions,
+                "Oversized image evicted other images.");
+        imageCache.addImage(createKey("0"), createImage(imageSize * 3));
+        stats = imageCache.getStatistics();
+        expect(!imageCache.findImage(createKey("0")).isValid(),
+                "Oversized image did not remove the image it replaced.");
+        expectEquals(stats.imageCount, initialStats.imageCount - 1);
+        expect(stats.cachedBytes <= stats.byteBudget,
+                "Cache exceeded its byte budget.");
+
+        beginTest("Byte budget change test");
+        imageCache.setByteBudget(imageBytes);
+        stats = imageCache.getStatistics();
+        expectEquals(stats.imageCount, 1);
+        expect(imageCache.findImage(createKey("new")).isValid(),
+                "Most recently used image was evicted.");
+        imageCache.clear();
+        stats = imageCache.getStatistics();
+        expectEquals(stats.imageCount, 0);
+        expectEquals((int) stats.cachedBytes, 0);
+    }
+};
+
+static Icon::Test::ImageCacheTest test;
@@ -0,0 +1,177 @@
+#include "SharedResource_Resource.h"
+#include "SharedResource_Handler.h"
+#include "Testing_Benchmark.h"
+#include "JuceHeader.h"
+
+namespace SharedResource { namespace Test { class HandlerNotificationTest; } }
+
+// Number of listening and non-listening handlers used for benchmarking:
+static const constexpr int handlerCount = 500;
+
+// Number of times all listeners are notified when measuring notification
+// speed:
+static const constexpr int notificationRepetitions = 200;
+
+/**
+ * @brief  The interface notified by the NotifyingResource.
+ */
+class NotificationInterface
+{
+public:
+    virtual ~NotificationInterface() { }
+
+    int notificationCount = 0;
+};
+
+/**
+ * @brief  A minimal resource that notifies its NotificationInterface
+ *         handlers.
+ */
+class NotifyingResource : public SharedResource::Resource
+{
+public:
+    static const juce::Identifier resourceKey;
+
+    NotifyingResource() : SharedResource::Resource(resourceKey) { }
+
+    virtual ~NotifyingResource() { }
+
+    int notifyAll()
+    {
+        int notified = 0;
+        foreachHandler<NotificationInterface>([&notified]
+                (NotificationInterface* listener)
+        {
+            listener->notificationCount++;
+            notified++;
+        });
+        return notified;
+    }
+};
+
+const juce::Identifier NotifyingResource::resourceKey
+        = "Test_Handler_Notification_Resource";
+
+/**
+ * @brief  A NotifyingResource handler that doesn't receive notifications.
+ */
+class PlainHandler : public SharedResource::Handler<NotifyingResource>
+{
+public:
+    PlainHandler() { }
+
+    virtual ~PlainHandler() { }
+
+    int notifyAll()
+    {
+        SharedResource::LockedPtr<NotifyingResource> resource
+                = getWriteLockedResource();
+        return resource->notifyAll();
+    }
+};
+
+/**
+ * @brief  A NotifyingResource handler that receives notifications.
+ */
+class ListeningHandler : public NotificationInterface, public PlainHandler
+{
+public:
+    ListeningHandler() { }
+
+    virtual ~ListeningHandler() { }
+};
+
+/**
+ * @brief  A second NotifyingResource handler class.
+ */
+class OtherHandler : public SharedResource::Handler<NotifyingResource>
+{
+public:
+    OtherHandler() { }
+
+    virtual ~OtherHandler() { }
+};
+
+/**
+ * @brief  A listener that inherits from two separate handler classes.
+ */
+class DoubleHandler : public ListeningHandler, public OtherHandler
+{
+public:
+    DoubleHandler() { }
+
+    virtual ~DoubleHandler() { }
+};
+
+/**
+ * @brief  Tests that resources notify the correct handlers exactly once, and
+ *         measures how long it takes to notify hundreds of handlers.
+ */
+class SharedResource::Test::HandlerNotificationTest : public juce::UnitTest
+{
+public:
+    HandlerNotificationTest() : juce::UnitTest(
+            "SharedResource handler notification", "SharedResource") {}
+
+    void runTest() override
+    {
+        beginTest("Handler type filtering");
+        PlainHandler notifier;
+        juce::OwnedArray<ListeningHandler> listeners;
+        juce::OwnedArray<PlainHandler> plainHandlers;
+        for (int i = 0; i < handlerCount; i++)
+        {
+            listeners.add(new ListeningHandler);
+            plainHandlers.add(new PlainHandler);
+        }
+        expectEquals(notifier.notifyAll(), handlerCount,
+                "Notified the wrong number of handlers.");
+
+        beginTest("Handler list updates");
+        listeners.removeLast(handlerCount / 2);
+        expectEquals(notifier.notifyAll(), handlerCount / 2,
+                "Notified removed handlers.");
+        while (listeners.size() < handlerCount)
+        {
+            listeners.add(new ListeningHandler);
+        }
+        expectEquals(notifier.notifyAll(), handlerCount,
+                "Failed to notify new handlers.");
+        {
+            DoubleHandler doubleHandler;
+            expectEquals(notifier.notifyAll(), handlerCount + 1,
+                    "Notified handlers with multiple References incorrectly.");
+            expectEquals(doubleHandler.notificationCount, 1,
+                    "Notified one handler more than once.");
+        }
+        expectEquals(notifier.notifyAll(), handlerCount,
+                "Notified destroyed handlers.");
+
+        beginTest("Handler notification benchmark");
+        plainHandlers.clear();
+        listeners.clear();
+        for (int i = 0; i < handlerCount; i++)
+        {
+            listeners.add(new ListeningHandler);
+            plainHandlers.add(new PlainHandler);
+        }
+        const double firstNotifyTime = Testing::Benchmark::averageMicroseconds(
+                1, [&notifier](const int)
+        {
+            notifier.notifyAll();
+        });
+        const double notifyTime = Testing::Benchmark::averageMicroseconds(
+                notificationRepetitions, [&notifier](const int)
+        {
+            notifier.notifyAll();
+        });
+        logMessage(juce::String(handlerCount) + " listeners, "
+                + juce::String(handlerCount) + " other handlers:");
+        logMessage(juce::String("First notification, checking all handlers: ")
+                + juce::String(firstNotifyTime, 1) + " us");
+        logMessage(juce::String("Repeated notification: ")
+                + juce::String(notifyTime, 1) + " us");
+    }
+};
+
+static SharedResource::Test::HandlerNotificationTest test;
@@ -0,0 +1,137 @@
+#include "SharedResource_Resource.h"
+#include "SharedResource_Handler.h"
+#include "Testing_Benchmark.h"
+#include "JuceHeader.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace SharedResource { namespace Test { class LockContentionTest; } }
+
+// Number of read locks each thread claims when measuring lock throughput:
+static const constexpr int readIterations = 200000;
+
+// Maximum number of threads used when measuring lock throughput:
+static const constexpr int maxThreadCount = 8;
+
+// Initial value held by the test resource:
+static const constexpr int initialValue = 1;
+
+/**
+ * @brief  A minimal resource holding a single value.
+ */
+class ContentionResource : public SharedResource::Resource
+{
+public:
+    static const juce::Identifier resourceKey;
+
+    ContentionResource() : SharedResource::Resource(resourceKey) { }
+
+    virtual ~ContentionResource() { }
+
+    int value = initialValue;
+};
+
+const juce::Identifier ContentionResource::resourceKey
+        = "Test_Lock_Contention_Resource";
+
+/**
+ * @brief  Reads and writes the ContentionResource value.
+ */
+class ContentionHandler : public SharedResource::Handler<ContentionResource>
+{
+public:
+    ContentionHandler() { }
+
+    virtual ~ContentionHandler() { }
+
+    int getValue() const
+    {
+        SharedResource::LockedPtr<const ContentionResource> resource
+                = getReadLockedResource();
+        return resource->value;
+    }
+
+    void setValue(const int newValue)
+    {
+        SharedResource::LockedPtr<ContentionResource> resource
+                = getWriteLockedResource();
+        resource->value = newValue;
+    }
+};
+
+/**
+ * @brief  Tests that resources remain accessible as they are created and
+ *         destroyed, and measures how read lock throughput scales as more
+ *         threads read from the same resource.
+ */
+class SharedResource::Test::LockContentionTest : public juce::UnitTest
+{
+public:
+    LockContentionTest() : juce::UnitTest("SharedResource lock contention",
+            "SharedResource") {}
+
+    void runTest() override
+    {
+        beginTest("Resource recreation");
+        {
+            ContentionHandler handler;
+            handler.setValue(initialValue + 1);
+            expectEquals(handler.getValue(), initialValue + 1,
+                    "Failed to write resource value.");
+        }
+        {
+            ContentionHandler handler;
+            expectEquals(handler.getValue(), initialValue,
+                    "Resource was not destroyed with its last Handler.");
+        }
+
+        beginTest("Concurrent read lock throughput");
+        ContentionHandler handler;
+        double singleThreadRate = 0;
+        for (int threadCount = 1; threadCount <= maxThreadCount;
+                threadCount *= 2)
+        {
+            std::atomic<juce::int64> valueSum(0);
+            const double elapsedUS = Testing::Benchmark::averageMicroseconds(
+                    1, [threadCount, &valueSum](const int)
+            {
+                std::vector<std::thread> readThreads;
+                for (int i = 0; i < threadCount; i++)
+                {
+                    readThreads.emplace_back([&valueSum]()
+                    {
+                        // Each thread uses its own Handler, as the
+                        // application's threads would:
+                        ContentionHandler threadHandler;
+                        juce::int64 threadSum = 0;
+                        for (int read = 0; read < readIterations; read++)
+                        {
+                            threadSum += threadHandler.getValue();
+                        }
+                        valueSum += threadSum;
+                    });
+                }
+                for (std::thread& readThread : readThreads)
+                {
+                    readThread.join();
+                }
+            });
+            expectEquals<juce::int64>(valueSum.load(),
+                    (juce::int64) threadCount * readIterations * initialValue,
+                    "Read locked values were incorrect.");
+            const double readsPerMS = (double) threadCount * readIterations
+                    * 1000.0 / juce::jmax(elapsedUS, 1.0);
+            if (threadCount == 1)
+            {
+                singleThreadRate = readsPerMS;
+            }
+            logMessage(juce::String(threadCount) + " thread(s): "
+                    + juce::String(readsPerMS, 0) + " reads/ms, "
+                    + juce::String(readsPerMS / singleThreadRate, 2)
+                    + "x single thread throughput");
+        }
+    }
+};
+
+static SharedResource::Test::LockContentionTest test;
@@ -0,0 +1,224 @@
+#define APPMENU_IMPLEMENTATION
+#include "AppMenu_Scrolling_FolderComponent.h"
+#include "AppMenu_MenuButton.h"
+#include "AppMenu_ItemData.h"
+#include "JuceHeader.h"
+#include <set>
+
+namespace AppMenu { namespace Test { class FolderComponentTest; } }
+
+// Number of menu items in the test folder:
+static const constexpr int folderSize = 100;
+
+// Height in pixels of each test folder menu button:
+static const constexpr int buttonHeight = 10;
+
+// Height in pixels of the test folder's visible area:
+static const constexpr int visibleHeight = 100;
+
+/**
+ * @brief  Tests that AppMenu::FolderComponent only binds buttons to menu items
+ *         near the visible part of the folder, reusing pooled buttons as the
+ *         folder scrolls.
+ */
+class AppMenu::Test::FolderComponentTest : public juce::UnitTest
+{
+public:
+    FolderComponentTest() : juce::UnitTest("AppMenu::FolderComponent testing")
+    {}
+
+    /**
+     * @brief  Minimal menu item data, holding only a title.
+     */
+    class TestItemData : public ItemData
+    {
+    public:
+        TestItemData(const juce::String title, const bool isFolder) :
+            title(title), command(isFolder ? "" : title.toLowerCase()) { }
+
+        virtual ~TestItemData() { }
+
+        juce::String getTitle() const override { return title; }
+        juce::String getIconName() const override { return juce::String(); }
+        juce::String getCommand() const override { return command; }
+        bool getLaunchedInTerm() const override { return false; }
+        juce::StringArray getCategories() const override
+        {
+            return juce::StringArray();
+        }
+        void setTitle(const juce::String& newTitle) override
+        {
+            title = newTitle;
+        }
+        void setIconName(const juce::String& iconName) override { }
+        void setCommand(const juce::String& newCommand) override
+        {
+            command = newCommand;
+        }
+        void setLaunchedInTerm(const bool launchInTerm) override { }
+        void setCategories(const juce::StringArray& categories) override { }
+        int getMovableChildCount() const override { return getFolderSize(); }
+        bool isMovable() const override { return true; }
+        void saveChanges() override { }
+        juce::String getConfirmDeleteTitle() const override
+        {
+            return juce::String();
+        }
+        juce::String getConfirmDeleteMessage() const override
+        {
+            return juce::String();
+        }
+        juce::String getEditorTitle() const override { return juce::String(); }
+        bool isEditable(const DataField dataField) const override
+        {
+            return false;
+        }
+
+    private:
+        void deleteFromSource() override { }
+
+        juce::String title;
+        juce::String command;
+    };
+
+    /**
+     * @brief  A scrolling folder component that allows access to its bound
+     *         button components.
+     */
+    class TestFolder : public Scrolling::FolderComponent
+    {
+    public:
+        TestFolder(MenuItem folderItem) :
+            Scrolling::FolderComponent(folderItem) { }
+
+        virtual ~TestFolder() { }
+
+        using AppMenu::FolderComponent::getButtonComponent;
+    };
+
+    /**
+     * @brief  Finds the range of menu item indices with button components.
+     *
+     * @param folder  The tested folder component.
+     *
+     * @return        The range from the first to the last bound menu item, or
+     *                an empty range if no menu items are bound.
+     */
+    static juce::Range<int> findBoundRange(const TestFolder& folder)
+    {
+        int start = -1;
+        int end = -1;
+        for (int i = 0; i < folder.getFolderSize(); i++)
+        {
+            if (folder.getButtonComponent(i) != nullptr)
+            {
+                if (start < 0)
+                {
+                    start = i;
+                }
+                end = i + 1;
+            }
+        }
+        return start < 0 ? juce::Range<int>() : juce::Range<int>(start, end);
+    }
+
+    /**
+     * @brief  Checks that every bound button shows the menu item at its index.
+     *
+     * @param folder  The tested folder component.
+     *
+     * @return        Whether all bound buttons show the correct menu items.
+     */
+    static bool boundItemsMatch(const TestFolder& folder)
+    {
+        const MenuItem folderItem = folder.getFolderMenuItem();
+        for (int i = 0; i < folder.getFolderSize(); i++)
+        {
+            MenuButton* button = folder.getButtonComponent(i);
+            if (button != nullptr && button->getMenuItem().getTitle()
+                    != folderItem.getFolderItem(i).getTitle())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void runTest() override
+    {
+        ItemData::Ptr folderData = new TestItemData("Folder", true);
+        for (int i = 0; i < folderSize; i++)
+        {
+            folderData->insertChild(new TestItemData(
+                        "Item " + juce::String(i), false), i);
+        }
+        juce::Component parent;
+        parent.setBounds(0, 0, 100, visibleHeight);
+        TestFolder folder((MenuItem(folderData)));
+        parent.addAndMakeVisible(folder);
+        folder.setBounds(0, 0, 100, folderSize * buttonHeight);
+
+        beginTest("Uninitialized folder test");
+        expect(findBoundRange(folder).isEmpty(),
+                "Buttons were bound before initMenuItems was called!");
+
+        beginTest("Initial binding test");
+        folder.initMenuItems();
+        expect(findBoundRange(folder) == juce::Range<int>(0, 12),
+                "Visible rows plus overscan rows should be bound!");
+        expectEquals(folder.getNumChildComponents(), 12);
+        expect(boundItemsMatch(folder),
+                "Buttons were bound to the wrong menu items!");
+        std::set<MenuButton*> initialButtons;
+        for (int i = 0; i < 12; i++)
+        {
+            initialButtons.insert(folder.getButtonComponent(i));
+        }
+
+        beginTest("Scrolled binding test");
+        folder.setTopLeftPosition(0, -500);
+        expect(findBoundRange(folder) == juce::Range<int>(48, 62),
+                "Bound range didn't follow the visible rows!");
+        expect(boundItemsMatch(folder),
+                "Buttons were bound to the wrong menu items after scrolling!");
+        expectEquals(folder.getButtonComponent(48)->getMenuItem().getTitle(),
+                juce::String("Item 48"));
+
+        beginTest("Button reuse test");
+        expectEquals(folder.getNumChildComponents(), 14,
+                "Only buttons beyond the pool size should be created!");
+        int reusedCount = 0;
+        for (int i = 48; i < 62; i++)
+        {
+            reusedCount += (int) initialButtons.count(
+                    folder.getButtonComponent(i));
+        }
+        expectEquals(reusedCount, 12, "Pooled buttons were not reused!");
+
+        beginTest("Folder end binding test");
+        folder.setTopLeftPosition(0, visibleHeight
+                - folderSize * buttonHeight);
+        expect(findBoundRange(folder) == juce::Range<int>(88, 100),
+                "Overscan rows past the folder end should be ignored!");
+        expect(folder.getButtonComponent(87) == nullptr,
+                "Menu items above the overscan rows were still bound!");
+        expectEquals(folder.getNumChildComponents(), 14,
+                "Buttons were created with unused buttons available!");
+        expect(boundItemsMatch(folder));
+
+        beginTest("Title width test");
+        const int initialWidth = folder.getMinimumWidth();
+        folderData->insertChild(new TestItemData(
+                    "A menu item with a much longer title", false), 0);
+        expect(folder.getMinimumWidth() > initialWidth,
+                "Minimum width didn't grow to fit a longer title!");
+        expect(boundItemsMatch(folder),
+                "Buttons weren't rebound after inserting a menu item!");
+        folderData->getChild(0)->remove(false);
+        expectEquals(folder.getMinimumWidth(), initialWidth,
+                "Minimum width didn't shrink after removing the widest "
+                "title!");
+    }
+};
+
+static AppMenu::Test::FolderComponentTest test;
@@ -0,0 +1,115 @@
+#define APPMENU_IMPLEMENTATION
+#include "AppMenu_SearchIndex.h"
+#include "JuceHeader.h"
+
+namespace AppMenu { namespace Test { class SearchIndexTest; } }
+
+/**
+ * @brief  Tests that the AppMenu::SearchIndex finds, ranks, replaces, and
+ *         removes indexed application items.
+ */
+class AppMenu::Test::SearchIndexTest : public juce::UnitTest
+{
+public:
+    SearchIndexTest() : juce::UnitTest("AppMenu::SearchIndex testing") {}
+
+    /**
+     * @brief  Creates a search index item.
+     *
+     * @param title        The item title.
+     *
+     * @param genericName  The item's generic application name.
+     *
+     * @param keywords     The item's search keywords.
+     *
+     * @return             The new item.
+     */
+    static SearchIndex::Item createItem(const juce::String title,
+            const juce::String genericName, const juce::String keywords)
+    {
+        SearchIndex::Item item;
+        item.title = title;
+        item.command = title.toLowerCase();
+        item.executable = item.command;
+        item.genericName = genericName;
+        item.keywords = juce::StringArray::fromTokens(keywords, false);
+        return item;
+    }
+
+    /**
+     * @brief  Gets the titles of all items matching search text.
+     *
+     * @param index       The search index to search.
+     *
+     * @param searchText  The text to search for.
+     *
+     * @return            All matching item titles, with the best match first.
+     */
+    static juce::StringArray getMatchTitles(const SearchIndex& index,
+            const juce::String searchText)
+    {
+        juce::StringArray titles;
+        for (const SearchIndex::Item& item : index.findMatches(searchText, 10))
+        {
+            titles.add(item.title);
+        }
+        return titles;
+    }
+
+    void runTest() override
+    {
+        SearchIndex index;
+        index.addItem("firefox", createItem("Firefox", "Web Browser",
+                    "internet www"));
+        index.addItem("terminal", createItem("Terminal", "Terminal Emulator",
+                    "shell command prompt"));
+        index.addItem("files", createItem("Files", "File Manager",
+                    "folder browser"));
+        index.addItem("fbreader", createItem("FBReader", "E-book Reader",
+                    "library"));
+
+        beginTest("Prefix search test");
+        juce::StringArray titles = getMatchTitles(index, "fi");
+        expect(titles.contains("Firefox") && titles.contains("Files"),
+                "Prefix search missed matching items: "
+                + titles.joinIntoString(", "));
+        expect(!titles.contains("Terminal"),
+                "Prefix search matched the middle of a word!");
+
+        beginTest("Misspelled search test");
+        titles = getMatchTitles(index, "firefx");
+        expectEquals(titles[0], juce::String("Firefox"),
+                "Misspelled search failed to find the right item!");
+
+        beginTest("Multiple word search test");
+        titles = getMatchTitles(index, "browser file");
+        expectEquals(titles.size(), 1,
+                "Multiple word search should only match items with all words!");
+        expectEquals(titles[0], juce::String("Files"));
+
+        beginTest("Search ranking test");
+        titles = getMatchTitles(index, "browser");
+        expectEquals(titles.size(), 2);
+        expectEquals(titles[0], juce::String("Firefox"),
+                "Generic name match should rank above keyword match!");
+
+        beginTest("Item replacement test");
+        index.addItem("firefox", createItem("Iceweasel", "Web Browser", ""));
+        expectEquals(index.getItemCount(), 4);
+        expect(getMatchTitles(index, "firefox").isEmpty(),
+                "Replaced item text was still indexed!");
+        expectEquals(getMatchTitles(index, "icew")[0],
+                juce::String("Iceweasel"));
+
+        beginTest("Item removal test");
+        index.removeItem("firefox");
+        expect(!index.containsItem("firefox"), "Removed item still indexed!");
+        expectEquals(index.getItemCount(), 3);
+        expect(getMatchTitles(index, "iceweasel").isEmpty(),
+                "Removed item was still found!");
+        expectEquals(getMatchTitles(index, "reader")[0],
+                juce::String("FBReader"));
+    }
+};
+
+static AppMenu::Test::SearchIndexTest test;
@@ -0,0 +1,124 @@
+#include "Theme_LookAndFeel.h"
+#include "Layout_Component_ConfigFile.h"
+#include "Testing_Benchmark.h"
+#include "JuceHeader.h"
+
+namespace Theme { namespace Test { class LookAndFeelTest; } }
+
+// Number of buttons and labels drawn on the test page:
+static const constexpr int componentCount = 40;
+
+// Number of times the test page is painted when measuring paint speed:
+static const constexpr int paintRepetitions = 50;
+
+// Test page dimensions:
+static const constexpr int pageWidth = 480;
+static const constexpr int pageHeight = 272;
+
+/**
+ * @brief  A page crowded with buttons, labels, and combo boxes.
+ */
+class BusyPage : public juce::Component
+{
+public:
+    BusyPage()
+    {
+        const int rowHeight = pageHeight * 2 / componentCount;
+        for (int i = 0; i < componentCount; i++)
+        {
+            juce::TextButton* button = buttons.add(new juce::TextButton(
+                        "Button " + juce::String(i)));
+            juce::Label* label = labels.add(new juce::Label(juce::String(),
+                        "Label " + juce::String(i)));
+            addAndMakeVisible(button);
+            addAndMakeVisible(label);
+            const int y = (i / 2) * rowHeight;
+            const int x = (i % 2) * pageWidth / 2;
+            button->setBounds(x, y, pageWidth / 4, rowHeight);
+            label->setBounds(x + pageWidth / 4, y, pageWidth / 4, rowHeight);
+        }
+        setSize(pageWidth, pageHeight);
+    }
+
+    virtual ~BusyPage() { }
+
+    /**
+     * @brief  Paints the page and all of its child components into an image.
+     */
+    void paintPage()
+    {
+        juce::Image pageImage(juce::Image::ARGB, pageWidth, pageHeight, true);
+        juce::Graphics g(pageImage);
+        paintEntireComponent(g, false);
+    }
+
+    juce::OwnedArray<juce::TextButton> buttons;
+    juce::OwnedArray<juce::Label> labels;
+};
+
+/**
+ * @brief  Tests that Theme::LookAndFeel fonts match the component layout
+ *         configuration, and compares drawing speed with and without saved
+ *         font heights.
+ */
+class Theme::Test::LookAndFeelTest : public juce::UnitTest
+{
+public:
+    LookAndFeelTest() : juce::UnitTest("Theme::LookAndFeel Testing",
+            "Theme") {}
+
+    void runTest() override
+    {
+        using TextSize = Layout::Component::TextSize;
+        beginTest("Saved font heights");
+        LookAndFeel lookAndFeel;
+        Layout::Component::ConfigFile layoutConfig;
+        expectEquals((int) lookAndFeel.getAlertWindowTitleFont().getHeight(),
+                layoutConfig.getFontHeight(TextSize::largeText),
+                "Large font height doesn't match layout config.");
+        expectEquals((int) lookAndFeel.getPopupMenuFont().getHeight(),
+                layoutConfig.getFontHeight(TextSize::mediumText),
+                "Medium font height doesn't match layout config.");
+
+        beginTest("Busy page paint speed");
+        BusyPage page;
+        page.setLookAndFeel(&lookAndFeel);
+        // Paint once first, so font and glyph caches are already loaded:
+        page.paintPage();
+        const double paintTime = Testing::Benchmark::averageMicroseconds(
+                paintRepetitions, [&page](const int)
+        {
+            page.paintPage();
+        });
+
+        // Repeat the layout config lookups each paint used to make before
+        // font heights were saved:
+        const double lookupTime = Testing::Benchmark::averageMicroseconds(
+                paintRepetitions, [&page](const int)
+        {
+            for (juce::TextButton* button : page.buttons)
+            {
+                Layout::Component::ConfigFile buttonConfig;
+                buttonConfig.getFontHeight(button->getLocalBounds(),
+                        button->getButtonText());
+            }
+            for (juce::Label* label : page.labels)
+            {
+                Layout::Component::ConfigFile labelConfig;
+                juce::jmin(labelConfig.getFontHeight(TextSize::smallText),
+                        labelConfig.getFontHeight(label->getLocalBounds(),
+                            label->getText()));
+            }
+        });
+        page.setLookAndFeel(nullptr);
+
+        logMessage(juce::String(componentCount) + " buttons, "
+                + juce::String(componentCount) + " labels:");
+        logMessage(juce::String("Page paint with saved fonts: ")
+                + juce::String(paintTime, 1) + " us");
+        logMessage(juce::String("Config lookups removed from each paint: ")
+                + juce::String(lookupTime, 1) + " us");
+    }
+};
+
+static Theme::Test::LookAndFeelTest test;
@@ -119,6 +119,25 @@ public:
         expectEquals(String(bad.getExitCode()), String("0"),
             "Bad process error code should have been 0.");
 
+        beginTest("Exit notification test");
+        if (Launcher::testCommand("true"))
+        {
+            Launched exitingProcess("true");
+            expect(exitingProcess.getProcessId() > 0,
+                    "Launched process ID should be known immediately.");
+            bool exitNotified = false;
+            exitingProcess.setExitCallback([&exitNotified]()
+            {
+                exitNotified = true;
+            });
+            expect(Testing::DelayUtils::idleUntil([&exitNotified]()
+            {
+                return exitNotified;
+            }, 100, 2000), "Process exit callback never ran.");
+            expect(!exitingProcess.isRunning(),
+                    "Process still running after exit notification.");
+        }
+
         FocusChecker focusChecker;
         beginTest("Windowed launch and activation test");
         for (const String& command : windowedApps)
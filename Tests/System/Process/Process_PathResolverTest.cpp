@@ -0,0 +1,83 @@
+#include "Process_PathResolver.h"
+#include "JuceHeader.h"
+#include <cstdlib>
+
+namespace Process { class PathResolverTest; }
+
+/**
+ * @brief  Tests that Process::PathResolver finds executables in PATH
+ *         directories, caches search results, and notices when those
+ *         directories change.
+ */
+class Process::PathResolverTest : public juce::UnitTest
+{
+public:
+    PathResolverTest() :
+        juce::UnitTest("Process::PathResolver testing", "Process") {}
+
+    void runTest() override
+    {
+        using juce::String;
+        using juce::File;
+        PathResolver pathResolver;
+
+        beginTest("System command test");
+        expect(pathResolver.findExecutable("sh").isNotEmpty(),
+                "Failed to find sh executable.");
+        expect(pathResolver.isValidCommand("sh -c \"exit 0\""),
+                "Command with arguments should have been valid.");
+        expect(!pathResolver.isValidCommand("DefinitelyNotAValidCommand"),
+                "Invalid command should not have been found.");
+        expect(!pathResolver.isValidCommand(""),
+                "Empty command should not have been valid.");
+
+        beginTest("Cached search test");
+        const String shPath = pathResolver.findExecutable("sh");
+        expect(pathResolver.isCached("sh"),
+                "Search result was not cached.");
+        {
+            PathResolver secondResolver;
+            expect(secondResolver.isCached("sh"),
+                    "Cached results were not shared between resolvers.");
+            expectEquals(secondResolver.findExecutable("sh"), shPath,
+                    "Cached search result changed.");
+        }
+        expect(pathResolver.isCached("sh"),
+                "Cached results were lost when a resolver was destroyed.");
+
+        beginTest("PATH directory change test");
+        const String oldPath = String::fromUTF8(getenv("PATH"));
+        const File testDir = File::getSpecialLocation(
+                File::tempDirectory).getNonexistentChildFile(
+                "PathResolverTest", "", false);
+        expect(testDir.createDirectory(), "Failed to create test directory.");
+        setenv("PATH", (testDir.getFullPathName() + ":" + oldPath)
+                .toRawUTF8(), 1);
+        const String commandName = "pathResolverTestCommand";
+        expect(pathResolver.findExecutable(commandName).isEmpty(),
+                "Test command found before it was created.");
+
+        const File testCommand = testDir.getChildFile(commandName);
+        testCommand.replaceWithText("#!/bin/sh\n");
+        expect(!pathResolver.isCached(commandName),
+                "Creating a file didn't clear cached results.");
+        expect(pathResolver.findExecutable(commandName).isEmpty(),
+                "Test command found before it was executable.");
+        testCommand.setExecutePermission(true);
+        expectEquals(pathResolver.findExecutable(commandName),
+                testCommand.getFullPathName(),
+                "New executable was not found.");
+        expect(pathResolver.isCached(commandName),
+                "Search result was not cached.");
+        testCommand.deleteFile();
+        expect(pathResolver.findExecutable(commandName).isEmpty(),
+                "Deleted executable was still found.");
+
+        setenv("PATH", oldPath.toRawUTF8(), 1);
+        testDir.deleteRecursively();
+        expect(pathResolver.findExecutable("sh").isNotEmpty(),
+                "Failed to find sh after restoring PATH.");
+    }
+};
+
+static Process::PathResolverTest test;
@@ -0,0 +1,84 @@
+#include "Process_UsageTable.h"
+#include "JuceHeader.h"
+
+namespace Process { class UsageTableTest; }
+
+/**
+ * @brief  Tests that Process::UsageTable ranks launch commands by decayed
+ *         launch counts, and saves and reloads usage data.
+ */
+class Process::UsageTableTest : public juce::UnitTest
+{
+public:
+    UsageTableTest() :
+        juce::UnitTest("Process::UsageTable testing", "Process") {}
+
+    void runTest() override
+    {
+        using juce::File;
+        using juce::int64;
+        const File testDir = File::getSpecialLocation(
+                File::tempDirectory).getNonexistentChildFile(
+                "UsageTableTest", "", false);
+        const File tableFile = testDir.getChildFile("usage.table");
+        const File logFile = testDir.getChildFile("usage.log");
+        // Launch score half-life, in milliseconds:
+        const int64 halfLife = (int64) 14 * 24 * 60 * 60 * 1000;
+        const int64 startTime = (int64) 1000 * halfLife;
+
+        beginTest("Launch score test");
+        UsageTable usageTable(tableFile, logFile);
+        expectEquals(usageTable.loadUsage(), 0,
+                "Empty table should have no logged launches.");
+        expect(usageTable.recordLaunch("firefox", startTime),
+                "Failed to log launch.");
+        expect(usageTable.recordLaunch("firefox", startTime),
+                "Failed to log launch.");
+        expect(usageTable.recordLaunch("vlc", startTime + halfLife),
+                "Failed to log launch.");
+        expect(!usageTable.recordLaunch("bad\ncommand", startTime),
+                "Commands with line breaks should not be logged.");
+        expectWithinAbsoluteError(usageTable.getScore("firefox", startTime),
+                2.0, 0.0001);
+        expectWithinAbsoluteError(usageTable.getScore("firefox",
+                    startTime + halfLife), 1.0, 0.0001,
+                "Score didn't decay by half over one half-life.");
+        expectWithinAbsoluteError(usageTable.getScore("vlc",
+                    startTime + halfLife), 1.0, 0.0001);
+        expectEquals(usageTable.getScore("unknown", startTime), 0.0);
+        expectEquals(usageTable.getLastLaunchTime("vlc"),
+                startTime + halfLife);
+
+        beginTest("Usage log test");
+        UsageTable loggedTable(tableFile, logFile);
+        expectEquals(loggedTable.loadUsage(), 3,
+                "Logged launches weren't reloaded.");
+        expectWithinAbsoluteError(loggedTable.getScore("firefox",
+                    startTime + halfLife), 1.0, 0.0001);
+
+        beginTest("Table compaction test");
+        expect(loggedTable.compact(startTime + halfLife),
+                "Failed to compact usage table.");
+        expect(!logFile.exists(), "Usage log wasn't cleared.");
+        expect(loggedTable.recordLaunch("vlc", startTime + halfLife),
+                "Failed to log launch.");
+        UsageTable compactedTable(tableFile, logFile);
+        expectEquals(compactedTable.loadUsage(), 1,
+                "Only launches after compaction should be logged.");
+        expectWithinAbsoluteError(compactedTable.getScore("vlc",
+                    startTime + halfLife), 2.0, 0.0001);
+        expectWithinAbsoluteError(compactedTable.getScore("firefox",
+                    startTime + halfLife), 1.0, 0.0001);
+
+        beginTest("Score pruning test");
+        const int64 distantTime = startTime + 20 * halfLife;
+        expect(compactedTable.compact(distantTime),
+                "Failed to compact usage table.");
+        expect(compactedTable.getAllScores(distantTime).empty(),
+                "Insignificant scores weren't discarded.");
+
+        testDir.deleteRecursively();
+    }
+};
+
+static Process::UsageTableTest test;
@@ -0,0 +1,158 @@
+/**
+ * @file  Wifi_APList_UpdateQueueTest.cpp
+ *
+ * @brief  Tests how the APList module decides which access point changes are
+ *         sent to listeners.
+ */
+
+#define WIFI_IMPLEMENTATION
+#include "Wifi_APList_UpdateQueue.h"
+#include "Wifi_AccessPoint.h"
+#include "Wifi_LibNM_APHash.h"
+#include "Wifi_LibNM_APMode.h"
+#include "Wifi_LibNM_SSID.h"
+#include "Wifi_LibNM_SecurityType.h"
+#include "JuceHeader.h"
+
+namespace Wifi { namespace APList { class UpdateQueueTest; } }
+
+// Signal strength given to each simulated access point when it is created:
+static const constexpr unsigned int initialStrength = 50;
+
+/**
+ * @brief  Tests that Wifi::APList::UpdateQueue batches changes, ignores access
+ *         points that are lost and found within one batch, and only reports
+ *         significant signal strength changes.
+ */
+class Wifi::APList::UpdateQueueTest : public juce::UnitTest
+{
+public:
+    UpdateQueueTest() : juce::UnitTest("Wifi::APList::UpdateQueue testing",
+            "Wifi") {}
+
+    /**
+     * @brief  Creates a simulated access point.
+     *
+     * @param apNum  A number used to give each access point a unique SSID.
+     *
+     * @return       A new access point with the initial signal strength.
+     */
+    static AccessPoint createAP(const int apNum)
+    {
+        const juce::String ssidText = "Network-" + juce::String(apNum);
+        GByteArray* ssidBytes = g_byte_array_new();
+        g_byte_array_append(ssidBytes, (const guint8*) ssidText.toRawUTF8(),
+                ssidText.getNumBytesAsUTF8());
+        const LibNM::APHash apHash(ssidBytes, LibNM::APMode::infrastructure,
+                LibNM::SecurityType::securedWPA);
+        AccessPoint accessPoint(LibNM::SSID(ssidBytes), apHash,
+                LibNM::SecurityType::securedWPA, initialStrength);
+        g_byte_array_unref(ssidBytes);
+        return accessPoint;
+    }
+
+    /**
+     * @brief  Changes a simulated access point's signal strength, in the same
+     *         way as the APList module.
+     *
+     * @param accessPoint  The access point to update.
+     *
+     * @param strength     The new signal strength.
+     */
+    static void setStrength(AccessPoint accessPoint,
+            const unsigned int strength)
+    {
+        static_cast<APInterface::SignalStrength*>(&accessPoint)
+                ->setSignalStrength(strength);
+    }
+
+    void runTest() override
+    {
+        UpdateQueue updateQueue;
+        const AccessPoint firstAP = createAP(0);
+        const AccessPoint secondAP = createAP(1);
+        const AccessPoint thirdAP = createAP(2);
+
+        beginTest("Batched change test");
+        expect(updateQueue.isEmpty(), "New queue should be empty.");
+        expect(updateQueue.takeChanges().isEmpty(),
+                "Empty queue should not have changes.");
+        updateQueue.queue(firstAP, true);
+        updateQueue.queue(secondAP, true);
+        updateQueue.queue(firstAP, true);
+        expect(!updateQueue.isEmpty(), "Queued changes are missing.");
+        UpdateQueue::Changes changes = updateQueue.takeChanges();
+        expectEquals(changes.addedAPs.size(), 2,
+                "Each new access point should be added once.");
+        expect(changes.addedAPs.contains(firstAP)
+                && changes.addedAPs.contains(secondAP),
+                "Added access points are missing.");
+        expect(changes.removedAPs.isEmpty() && changes.updatedAPs.isEmpty(),
+                "New access points should only be added.");
+        expect(updateQueue.isEmpty(), "Taking changes didn't clear the queue.");
+        expect(updateQueue.takeChanges().isEmpty(),
+                "Changes were sent more than once.");
+
+        beginTest("Lost and found test");
+        setStrength(firstAP, 0);
+        updateQueue.queue(firstAP, false);
+        setStrength(firstAP, initialStrength + 1);
+        updateQueue.queue(firstAP, true);
+        updateQueue.queue(thirdAP, true);
+        updateQueue.queue(thirdAP, false);
+        expect(updateQueue.takeChanges().isEmpty(),
+                "Access points lost and found in one batch were reported.");
+
+        beginTest("Signal strength change test");
+        setStrength(secondAP, initialStrength + 4);
+        updateQueue.queue(secondAP, true);
+        expect(updateQueue.takeChanges().isEmpty(),
+                "Small signal strength change was reported.");
+        setStrength(secondAP, initialStrength + 8);
+        updateQueue.queue(secondAP, true);
+        changes = updateQueue.takeChanges();
+        expect(changes.updatedAPs.size() == 1
+                && changes.updatedAPs.contains(secondAP),
+                "Small changes adding up to a large change were not reported.");
+        expect(changes.addedAPs.isEmpty() && changes.removedAPs.isEmpty(),
+                "Signal strength changes should only update access points.");
+        setStrength(secondAP, initialStrength + 4);
+        updateQueue.queue(secondAP, true);
+        expect(updateQueue.takeChanges().isEmpty(),
+                "Change from the last reported strength was too small.");
+        setStrength(secondAP, initialStrength + 3);
+        updateQueue.queue(secondAP, true);
+        changes = updateQueue.takeChanges();
+        expect(changes.updatedAPs.contains(secondAP),
+                "Minimum signal strength change was not reported.");
+
+        beginTest("Removed access point test");
+        setStrength(firstAP, 0);
+        updateQueue.queue(firstAP, false);
+        changes = updateQueue.takeChanges();
+        expect(changes.removedAPs.size() == 1
+                && changes.removedAPs.contains(firstAP),
+                "Lost access point was not removed.");
+        updateQueue.queue(firstAP, false);
+        expect(updateQueue.takeChanges().isEmpty(),
+                "Access point was removed more than once.");
+        setStrength(firstAP, initialStrength);
+        updateQueue.queue(firstAP, true);
+        changes = updateQueue.takeChanges();
+        expect(changes.addedAPs.contains(firstAP),
+                "Found access point was not added again.");
+
+        beginTest("Clear test");
+        setStrength(secondAP, 0);
+        updateQueue.queue(secondAP, false);
+        updateQueue.clear();
+        expect(updateQueue.isEmpty(), "Clearing didn't empty the queue.");
+        setStrength(secondAP, initialStrength);
+        updateQueue.queue(secondAP, true);
+        changes = updateQueue.takeChanges();
+        expect(changes.addedAPs.contains(secondAP),
+                "Cleared queue should report visible access points as new.");
+    }
+};
+
+static Wifi::APList::UpdateQueueTest test;
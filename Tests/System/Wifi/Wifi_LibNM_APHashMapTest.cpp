@@ -0,0 +1,233 @@
+/**
+ * @file  Wifi_LibNM_APHashMapTest.cpp
+ *
+ * @brief  Tests access point hash generation and the APHashMap container, and
+ *         measures their performance when replaying a dense Wifi scan.
+ */
+
+#include "Wifi_LibNM_APHash.h"
+#include "Wifi_LibNM_APHashMap.h"
+#include "Wifi_LibNM_APMode.h"
+#include "Wifi_LibNM_SecurityType.h"
+#include "Testing_Benchmark.h"
+#include "JuceHeader.h"
+#include <map>
+#include <vector>
+
+namespace Wifi { namespace LibNM { class APHashMapTest; } }
+
+// Number of access points in the simulated scan:
+static const constexpr int scanSize = 200;
+
+// Number of distinct networks shared by the simulated access points:
+static const constexpr int networkCount = 120;
+
+// Number of times the simulated scan is replayed when measuring performance:
+static const constexpr int scanRepetitions = 500;
+
+/**
+ * @brief  Tests that APHash values are stable and persist correctly, that the
+ *         APHashMap behaves like a std::map, and compares the speed of each
+ *         when processing many scanned access points.
+ */
+class Wifi::LibNM::APHashMapTest : public juce::UnitTest
+{
+public:
+    APHashMapTest() : juce::UnitTest("Wifi::LibNM::APHashMap testing",
+            "Wifi") {}
+
+    // Simulated scanned access point data:
+    struct ScannedAP
+    {
+        GByteArray* ssid;
+        APMode mode;
+        SecurityType security;
+        // Identifies each scanned AP, like a BSSID:
+        int id;
+    };
+
+    /**
+     * @brief  Creates a dense list of simulated access points, where many
+     *         access points share networks.
+     *
+     * @return  The list of access points. Each access point's SSID must be
+     *          freed with g_byte_array_unref.
+     */
+    static std::vector<ScannedAP> createScan()
+    {
+        const SecurityType securityTypes[] =
+        {
+            SecurityType::unsecured,
+            SecurityType::securedWEP,
+            SecurityType::securedWPA,
+            SecurityType::securedRSN
+        };
+        std::vector<ScannedAP> scan;
+        for (int i = 0; i < scanSize; i++)
+        {
+            const int network = i % networkCount;
+            const juce::String ssidText = "Network-" + juce::String(network);
+            ScannedAP scannedAP;
+            scannedAP.ssid = g_byte_array_new();
+            g_byte_array_append(scannedAP.ssid,
+                    (const guint8*) ssidText.toRawUTF8(),
+                    ssidText.getNumBytesAsUTF8());
+            scannedAP.mode = APMode::infrastructure;
+            scannedAP.security = securityTypes[network % 4];
+            scannedAP.id = i;
+            scan.push_back(scannedAP);
+        }
+        return scan;
+    }
+
+    /**
+     * @brief  Replays a scan through a map, adding and then removing every
+     *         access point in the same way as the APList module.
+     *
+     * @tparam MapType  The type of map holding access point ID lists.
+     *
+     * @param scan      The simulated access point scan.
+     *
+     * @param apMap     The map to update.
+     *
+     * @return          The number of networks stored in the map after adding
+     *                  every access point.
+     */
+    template<class MapType>
+    static int replayScan(const std::vector<ScannedAP>& scan, MapType& apMap)
+    {
+        for (const ScannedAP& scannedAP : scan)
+        {
+            const APHash hash(scannedAP.ssid, scannedAP.mode,
+                    scannedAP.security);
+            apMap[hash].addIfNotAlreadyThere(scannedAP.id);
+        }
+        const int networksFound = (int) apMap.size();
+        for (const ScannedAP& scannedAP : scan)
+        {
+            const APHash hash(scannedAP.ssid, scannedAP.mode,
+                    scannedAP.security);
+            // Every hash was added above, so this never inserts new values:
+            apMap[hash].removeAllInstancesOf(scannedAP.id);
+        }
+        return networksFound;
+    }
+
+    /**
+     * @brief  Measures how long it takes to repeatedly replay a scan through
+     *         a map, then checks that the last replay found every network.
+     *
+     * @tparam MapType  The type of map holding access point ID lists.
+     *
+     * @param scan      The simulated access point scan.
+     *
+     * @return          The average time in microseconds needed to process
+     *                  each scan.
+     */
+    template<class MapType>
+    double measureScanTime(const std::vector<ScannedAP>& scan)
+    {
+        MapType apMap;
+        int networksFound = 0;
+        const double scanTime = Testing::Benchmark::averageMicroseconds(
+                scanRepetitions, [&scan, &apMap, &networksFound](const int)
+        {
+            networksFound = replayScan(scan, apMap);
+        });
+        expectEquals(networksFound, networkCount,
+                "Wrong number of networks found.");
+        return scanTime;
+    }
+
+    void runTest() override
+    {
+        std::vector<ScannedAP> scan = createScan();
+
+        beginTest("APHash generation test");
+        const ScannedAP& firstAP = scan[0];
+        const APHash firstHash(firstAP.ssid, firstAP.mode, firstAP.security);
+        expect(!firstHash.isNull(), "Failed to generate hash value!");
+        expect(firstHash == APHash(firstAP.ssid, firstAP.mode,
+                    firstAP.security), "Hash values are not consistent!");
+        expect(firstHash != APHash(firstAP.ssid, APMode::adhoc,
+                    firstAP.security), "Mode didn't change the hash value!");
+        expect(firstHash != APHash(firstAP.ssid, firstAP.mode,
+                    SecurityType::securedRSN),
+                "Security type didn't change the hash value!");
+        expect(firstHash == APHash(scan[networkCount].ssid, firstAP.mode,
+                    firstAP.security),
+                "Matching networks have different hash values!");
+
+        beginTest("APHash string conversion test");
+        const juce::String hashString = firstHash.toString();
+        expectEquals(hashString.length(), 16);
+        expect(APHash(hashString) == firstHash,
+                "Hash value changed when loaded from a string!");
+        expect(APHash(hashString.toUpperCase()) == firstHash,
+                "Hash strings should not be case sensitive!");
+        expect(APHash("not a hash value").isNull(),
+                "Invalid hash string should create a null hash!");
+        expect(APHash().toString().isEmpty(),
+                "Null hash should have an empty string value!");
+
+        beginTest("APHashMap update test");
+        APHashMap<juce::Array<int>> hashMap;
+        std::map<APHash, juce::Array<int>> treeMap;
+        for (const ScannedAP& scannedAP : scan)
+        {
+            const APHash hash(scannedAP.ssid, scannedAP.mode,
+                    scannedAP.security);
+            hashMap[hash].add(scannedAP.id);
+            treeMap[hash].add(scannedAP.id);
+        }
+        expectEquals(hashMap.size(), (int) treeMap.size());
+        for (const auto& iter : treeMap)
+        {
+            const juce::Array<int>* apList = hashMap.find(iter.first);
+            expect(apList != nullptr && *apList == iter.second,
+                    "APHashMap is missing a value!");
+        }
+        int erased = 0;
+        for (const auto& iter : treeMap)
+        {
+            if (erased++ % 2 == 0)
+            {
+                expect(hashMap.erase(iter.first), "Failed to erase value!");
+            }
+        }
+        expectEquals(hashMap.size(), networkCount / 2);
+        erased = 0;
+        for (const auto& iter : treeMap)
+        {
+            expectEquals(hashMap.contains(iter.first), erased++ % 2 != 0,
+                    "Erasing values removed the wrong entries!");
+        }
+        int iteratedCount = 0;
+        for (const auto& iter : hashMap)
+        {
+            expect(!iter.first.isNull(), "Iterated over an empty entry!");
+            iteratedCount++;
+        }
+        expectEquals(iteratedCount, hashMap.size());
+        hashMap.clear();
+        expect(hashMap.isEmpty(), "Map wasn't cleared!");
+        expect(!hashMap.contains(firstHash), "Map wasn't cleared!");
+
+        beginTest("Dense scan performance test");
+        const double treeMapTime
+                = measureScanTime<std::map<APHash, juce::Array<int>>>(scan);
+        const double hashMapTime
+                = measureScanTime<APHashMap<juce::Array<int>>>(scan);
+        logMessage(juce::String(scanSize) + " AP scan: std::map "
+                + juce::String(treeMapTime, 1) + "us, APHashMap "
+                + juce::String(hashMapTime, 1) + "us, "
+                + juce::String(treeMapTime / hashMapTime, 2) + "x speedup");
+
+        for (ScannedAP& scannedAP : scan)
+        {
+            g_byte_array_unref(scannedAP.ssid);
+        }
+    }
+};
+
+static Wifi::LibNM::APHashMapTest test;
@@ -4,6 +4,7 @@ APPMENU_COMPONENT_DIR := $(APPMENU_DIR)/Components
 APPMENU_EDITOR_DIR := $(APPMENU_COMPONENT_DIR)/Editors
 APPMENU_CONTROL_DIR := $(APPMENU_DIR)/Control
 APPMENU_DATA_DIR := $(APPMENU_DIR)/Data
+APPMENU_SEARCH_DIR := $(APPMENU_DIR)/Search
 APPMENU_TEST_DIR = Tests/GUI/AppMenu
 
 APPMENU_PREFIX = AppMenu_
@@ -31,6 +32,12 @@ OBJECTS_APPMENU_CONTROL := \
   $(APPMENU_OBJ)Controller.o \
   $(APPMENU_OBJ)InputHandler.o
 
+OBJECTS_APPMENU_SEARCH := \
+  $(APPMENU_OBJ)SearchIndex.o \
+  $(APPMENU_OBJ)SearchThread.o \
+  $(APPMENU_OBJ)Searcher.o \
+  $(APPMENU_OBJ)SearchComponent.o
+
 OBJECTS_APPMENU_EDITOR := \
   $(APPMENU_OBJ)NewConfigItemEditor.o \
   $(APPMENU_OBJ)NewDesktopAppEditor.o \
@@ -66,6 +73,7 @@ OBJECTS_APPMENU := \
   $(OBJECTS_APPMENU_COMPONENT) \
   $(OBJECTS_APPMENU_CONTROL) \
   $(OBJECTS_APPMENU_EDITOR) \
+  $(OBJECTS_APPMENU_SEARCH) \
   $(OBJECTS_APPMENU_SCROLLING) \
   $(OBJECTS_APPMENU_PAGED)
 
@@ -73,7 +81,9 @@ APPMENU_TEST_PREFIX := $(APPMENU_PREFIX)Test_
 APPMENU_TEST_OBJ := $(APPMENU_OBJ)Test_
 OBJECTS_APPMENU_TEST := \
   $(APPMENU_TEST_OBJ)MenuTest.o \
-  $(APPMENU_TEST_OBJ)MenuFileTest.o
+  $(APPMENU_TEST_OBJ)MenuFileTest.o \
+  $(APPMENU_TEST_OBJ)SearchIndexTest.o \
+  $(APPMENU_TEST_OBJ)FolderComponentTest.o
 
 ifeq ($(BUILD_TESTS), 1)
     OBJECTS_APPMENU := $(OBJECTS_APPMENU) $(OBJECTS_APPMENU_TEST)
@@ -122,6 +132,15 @@ $(APPMENU_OBJ)Controller.o: \
 $(APPMENU_OBJ)InputHandler.o: \
     $(APPMENU_CONTROL_DIR)/$(APPMENU_PREFIX)InputHandler.cpp
 
+$(APPMENU_OBJ)SearchIndex.o: \
+    $(APPMENU_SEARCH_DIR)/$(APPMENU_PREFIX)SearchIndex.cpp
+$(APPMENU_OBJ)SearchThread.o: \
+    $(APPMENU_SEARCH_DIR)/$(APPMENU_PREFIX)SearchThread.cpp
+$(APPMENU_OBJ)Searcher.o: \
+    $(APPMENU_SEARCH_DIR)/$(APPMENU_PREFIX)Searcher.cpp
+$(APPMENU_OBJ)SearchComponent.o: \
+    $(APPMENU_SEARCH_DIR)/$(APPMENU_PREFIX)SearchComponent.cpp
+
 $(APPMENU_OBJ)NewConfigItemEditor.o: \
     $(APPMENU_EDITOR_DIR)/$(APPMENU_PREFIX)NewConfigItemEditor.cpp
 $(APPMENU_OBJ)NewDesktopAppEditor.o: \
@@ -168,3 +187,7 @@ $(APPMENU_TEST_OBJ)MenuTest.o: \
     $(APPMENU_TEST_DIR)/$(APPMENU_TEST_PREFIX)MenuTest.cpp
 $(APPMENU_TEST_OBJ)MenuFileTest.o: \
     $(APPMENU_TEST_DIR)/$(APPMENU_TEST_PREFIX)MenuFileTest.cpp
+$(APPMENU_TEST_OBJ)SearchIndexTest.o: \
+    $(APPMENU_TEST_DIR)/$(APPMENU_TEST_PREFIX)SearchIndexTest.cpp
+$(APPMENU_TEST_OBJ)FolderComponentTest.o: \
+    $(APPMENU_TEST_DIR)/$(APPMENU_TEST_PREFIX)FolderComponentTest.cpp
@@ -8,12 +8,17 @@ ASSETS_OBJ := $(JUCE_OBJDIR)/$(ASSETS_PREFIX)
 OBJECTS_ASSETS := \
   $(ASSETS_OBJ)Assets.o \
   $(ASSETS_OBJ)JSONFile.o \
+  $(ASSETS_OBJ)SVGCache.o \
+  $(ASSETS_OBJ)SVGLoader.o \
+  $(ASSETS_OBJ)X11Colours.o \
   $(ASSETS_OBJ)XDGDirectories.o \
   $(ASSETS_OBJ)XPMLoader.o
 
 ASSETS_TEST_PREFIX := $(ASSETS_PREFIX)Test_
 ASSETS_TEST_OBJ := $(ASSETS_OBJ)Test_
-OBJECTS_ASSETS_TEST := $(ASSETS_OBJ)XpmTest.o
+OBJECTS_ASSETS_TEST := \
+  $(ASSETS_OBJ)XpmTest.o \
+  $(ASSETS_OBJ)SVGTest.o
 
 ifeq ($(BUILD_TESTS), 1)
     OBJECTS_ASSETS := $(OBJECTS_ASSETS) $(OBJECTS_ASSETS_TEST)
@@ -30,6 +35,12 @@ $(ASSETS_OBJ)Assets.o : \
     $(ASSETS_DIR)/Assets.cpp
 $(ASSETS_OBJ)JSONFile.o : \
     $(ASSETS_DIR)/$(ASSETS_PREFIX)JSONFile.cpp
+$(ASSETS_OBJ)SVGCache.o : \
+    $(ASSETS_DIR)/$(ASSETS_PREFIX)SVGCache.cpp
+$(ASSETS_OBJ)SVGLoader.o : \
+    $(ASSETS_DIR)/$(ASSETS_PREFIX)SVGLoader.cpp
+$(ASSETS_OBJ)X11Colours.o : \
+    $(ASSETS_DIR)/$(ASSETS_PREFIX)X11Colours.cpp
 $(ASSETS_OBJ)XDGDirectories.o : \
     $(ASSETS_DIR)/$(ASSETS_PREFIX)XDGDirectories.cpp
 $(ASSETS_OBJ)XPMLoader.o : \
@@ -37,3 +48,5 @@ $(ASSETS_OBJ)XPMLoader.o : \
 
 $(ASSETS_OBJ)XpmTest.o: \
 	$(ASSETS_TEST_DIR)/$(ASSETS_PREFIX)XpmTest.cpp
+$(ASSETS_OBJ)SVGTest.o: \
+	$(ASSETS_TEST_DIR)/$(ASSETS_PREFIX)SVGTest.cpp
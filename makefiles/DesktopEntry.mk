@@ -7,12 +7,22 @@ DESKTOP_ENTRY_OBJ := $(JUCE_OBJDIR)/$(DESKTOP_ENTRY_PREFIX)
 
 OBJECTS_DESKTOP_ENTRY := \
   $(DESKTOP_ENTRY_OBJ)FileUtils.o \
+  $(DESKTOP_ENTRY_OBJ)Tokenizer.o \
   $(DESKTOP_ENTRY_OBJ)EntryFile.o \
+  $(DESKTOP_ENTRY_OBJ)EntryIndex.o \
+  $(DESKTOP_ENTRY_OBJ)CategoryIndex.o \
+  $(DESKTOP_ENTRY_OBJ)ParsingPool.o \
+  $(DESKTOP_ENTRY_OBJ)DirectoryWatcher.o \
   $(DESKTOP_ENTRY_OBJ)LoadingThread.o \
   $(DESKTOP_ENTRY_OBJ)UpdateListener.o \
   $(DESKTOP_ENTRY_OBJ)Loader.o
 
-OBJECTS_DESKTOP_ENTRY_TEST :=
+DESKTOP_ENTRY_TEST_PREFIX := $(DESKTOP_ENTRY_PREFIX)Test_
+DESKTOP_ENTRY_TEST_OBJ := $(DESKTOP_ENTRY_OBJ)Test_
+OBJECTS_DESKTOP_ENTRY_TEST := \
+  $(DESKTOP_ENTRY_TEST_OBJ)TokenizerTest.o \
+  $(DESKTOP_ENTRY_TEST_OBJ)EntryIndexTest.o \
+  $(DESKTOP_ENTRY_TEST_OBJ)CategoryIndexTest.o
 
 ifeq ($(BUILD_TESTS), 1)
     OBJECTS_DESKTOP_ENTRY := $(OBJECTS_DESKTOP_ENTRY) \
@@ -28,11 +38,28 @@ desktopEntry : $(OBJECTS_DESKTOP_ENTRY)
 
 $(DESKTOP_ENTRY_OBJ)FileUtils.o: \
     $(DESKTOP_ENTRY_DIR)/$(DESKTOP_ENTRY_PREFIX)FileUtils.cpp
+$(DESKTOP_ENTRY_OBJ)Tokenizer.o: \
+	$(DESKTOP_ENTRY_DIR)/$(DESKTOP_ENTRY_PREFIX)Tokenizer.cpp
 $(DESKTOP_ENTRY_OBJ)EntryFile.o: \
 	$(DESKTOP_ENTRY_DIR)/$(DESKTOP_ENTRY_PREFIX)EntryFile.cpp
+$(DESKTOP_ENTRY_OBJ)EntryIndex.o: \
+	$(DESKTOP_ENTRY_DIR)/$(DESKTOP_ENTRY_PREFIX)EntryIndex.cpp
+$(DESKTOP_ENTRY_OBJ)CategoryIndex.o: \
+	$(DESKTOP_ENTRY_DIR)/$(DESKTOP_ENTRY_PREFIX)CategoryIndex.cpp
+$(DESKTOP_ENTRY_OBJ)ParsingPool.o: \
+	$(DESKTOP_ENTRY_DIR)/$(DESKTOP_ENTRY_PREFIX)ParsingPool.cpp
+$(DESKTOP_ENTRY_OBJ)DirectoryWatcher.o: \
+	$(DESKTOP_ENTRY_DIR)/$(DESKTOP_ENTRY_PREFIX)DirectoryWatcher.cpp
 $(DESKTOP_ENTRY_OBJ)LoadingThread.o: \
 	$(DESKTOP_ENTRY_DIR)/$(DESKTOP_ENTRY_PREFIX)LoadingThread.cpp
 $(DESKTOP_ENTRY_OBJ)UpdateListener.o : \
 	$(DESKTOP_ENTRY_DIR)/$(DESKTOP_ENTRY_PREFIX)UpdateListener.cpp
 $(DESKTOP_ENTRY_OBJ)Loader.o: \
 	$(DESKTOP_ENTRY_DIR)/$(DESKTOP_ENTRY_PREFIX)Loader.cpp
+
+$(DESKTOP_ENTRY_TEST_OBJ)TokenizerTest.o: \
+    $(DESKTOP_ENTRY_TEST_DIR)/$(DESKTOP_ENTRY_TEST_PREFIX)TokenizerTest.cpp
+$(DESKTOP_ENTRY_TEST_OBJ)EntryIndexTest.o: \
+    $(DESKTOP_ENTRY_TEST_DIR)/$(DESKTOP_ENTRY_TEST_PREFIX)EntryIndexTest.cpp
+$(DESKTOP_ENTRY_TEST_OBJ)CategoryIndexTest.o: \
+    $(DESKTOP_ENTRY_TEST_DIR)/$(DESKTOP_ENTRY_TEST_PREFIX)CategoryIndexTest.cpp
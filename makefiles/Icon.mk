@@ -7,11 +7,17 @@ ICON_OBJ := $(JUCE_OBJDIR)/$(ICON_PREFIX)
 
 OBJECTS_ICON := \
   $(ICON_OBJ)Cache.o \
+  $(ICON_OBJ)CacheWriter.o \
+  $(ICON_OBJ)DirectoryIndex.o \
+  $(ICON_OBJ)ImageCache.o \
   $(ICON_OBJ)Loader.o \
   $(ICON_OBJ)ThemeIndex.o \
   $(ICON_OBJ)ThreadResource.o
 
-OBJECTS_ICON_TEST :=
+ICON_TEST_PREFIX := $(ICON_PREFIX)Test_
+ICON_TEST_OBJ := $(ICON_OBJ)Test_
+OBJECTS_ICON_TEST := \
+  $(ICON_TEST_OBJ)ImageCacheTest.o
 
 ifeq ($(BUILD_TESTS), 1)
     OBJECTS_ICON := $(OBJECTS_ICON) $(OBJECTS_ICON_TEST)
@@ -26,9 +32,18 @@ icon : $(OBJECTS_ICON)
 
 $(ICON_OBJ)Cache.o: \
 	$(ICON_DIR)/$(ICON_PREFIX)Cache.cpp
+$(ICON_OBJ)CacheWriter.o: \
+	$(ICON_DIR)/$(ICON_PREFIX)CacheWriter.cpp
+$(ICON_OBJ)DirectoryIndex.o: \
+	$(ICON_DIR)/$(ICON_PREFIX)DirectoryIndex.cpp
+$(ICON_OBJ)ImageCache.o: \
+	$(ICON_DIR)/$(ICON_PREFIX)ImageCache.cpp
 $(ICON_OBJ)Loader.o: \
 	$(ICON_DIR)/$(ICON_PREFIX)Loader.cpp
 $(ICON_OBJ)ThemeIndex.o: \
 	$(ICON_DIR)/$(ICON_PREFIX)ThemeIndex.cpp
 $(ICON_OBJ)ThreadResource.o: \
 	$(ICON_DIR)/$(ICON_PREFIX)ThreadResource.cpp
+
+$(ICON_TEST_OBJ)ImageCacheTest.o: \
+	$(ICON_TEST_DIR)/$(ICON_TEST_PREFIX)ImageCacheTest.cpp
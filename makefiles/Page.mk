@@ -6,6 +6,7 @@ PAGE_OBJ := $(JUCE_OBJDIR)/$(PAGE_PREFIX)
 
 PAGE_TYPES_DIR := $(PAGE_DIR)/PageTypes
 OBJECTS_PAGE_TYPES := \
+  $(PAGE_OBJ)AppSearch.o \
   $(PAGE_OBJ)HomeSettings.o \
   $(PAGE_OBJ)InputSettings.o \
   $(PAGE_OBJ)PasswordEditor.o \
@@ -45,6 +46,8 @@ OBJECTS_APP := $(OBJECTS_APP) $(OBJECTS_PAGE)
 page : $(OBJECTS_PAGE)
 	@echo "    Built Page module"
 
+$(PAGE_OBJ)AppSearch.o : \
+    $(PAGE_TYPES_DIR)/$(PAGE_PREFIX)AppSearch.cpp
 $(PAGE_OBJ)Fel.o : \
     $(PAGE_TYPES_DIR)/$(PAGE_PREFIX)Fel.cpp
 $(PAGE_OBJ)HomeSettings.o : \
@@ -8,11 +8,21 @@ PROCESS_OBJ := $(JUCE_OBJDIR)/$(PROCESS_PREFIX)
 OBJECTS_PROCESS := \
   $(PROCESS_OBJ)State.o \
   $(PROCESS_OBJ)Data.o \
+  $(PROCESS_OBJ)Supervisor.o \
+  $(PROCESS_OBJ)Watcher.o \
+  $(PROCESS_OBJ)PathCache.o \
+  $(PROCESS_OBJ)PathResolver.o \
   $(PROCESS_OBJ)Launched.o \
-  $(PROCESS_OBJ)Launcher.o
+  $(PROCESS_OBJ)LaunchThread.o \
+  $(PROCESS_OBJ)Launcher.o \
+  $(PROCESS_OBJ)UsageTable.o \
+  $(PROCESS_OBJ)UsageStats.o \
+  $(PROCESS_OBJ)UsageTracker.o
 
 OBJECTS_PROCESS_TEST := \
-  $(PROCESS_OBJ)LaunchedTest.o
+  $(PROCESS_OBJ)LaunchedTest.o \
+  $(PROCESS_OBJ)PathResolverTest.o \
+  $(PROCESS_OBJ)UsageTableTest.o
 
 ifeq ($(BUILD_TESTS), 1)
     OBJECTS_PROCESS := $(OBJECTS_PROCESS) $(OBJECTS_PROCESS_TEST)
@@ -29,11 +39,31 @@ $(PROCESS_OBJ)State.o : \
     $(PROCESS_DIR)/$(PROCESS_PREFIX)State.cpp
 $(PROCESS_OBJ)Data.o : \
     $(PROCESS_DIR)/$(PROCESS_PREFIX)Data.cpp
+$(PROCESS_OBJ)Supervisor.o : \
+    $(PROCESS_DIR)/$(PROCESS_PREFIX)Supervisor.cpp
+$(PROCESS_OBJ)Watcher.o : \
+    $(PROCESS_DIR)/$(PROCESS_PREFIX)Watcher.cpp
+$(PROCESS_OBJ)PathCache.o : \
+    $(PROCESS_DIR)/$(PROCESS_PREFIX)PathCache.cpp
+$(PROCESS_OBJ)PathResolver.o : \
+    $(PROCESS_DIR)/$(PROCESS_PREFIX)PathResolver.cpp
 $(PROCESS_OBJ)Launched.o : \
     $(PROCESS_DIR)/$(PROCESS_PREFIX)Launched.cpp
+$(PROCESS_OBJ)LaunchThread.o : \
+    $(PROCESS_DIR)/$(PROCESS_PREFIX)LaunchThread.cpp
 $(PROCESS_OBJ)Launcher.o : \
     $(PROCESS_DIR)/$(PROCESS_PREFIX)Launcher.cpp
+$(PROCESS_OBJ)UsageTable.o : \
+    $(PROCESS_DIR)/$(PROCESS_PREFIX)UsageTable.cpp
+$(PROCESS_OBJ)UsageStats.o : \
+    $(PROCESS_DIR)/$(PROCESS_PREFIX)UsageStats.cpp
+$(PROCESS_OBJ)UsageTracker.o : \
+    $(PROCESS_DIR)/$(PROCESS_PREFIX)UsageTracker.cpp
 
 # Tests:
 $(PROCESS_OBJ)LaunchedTest.o : \
     $(PROCESS_TEST_DIR)/$(PROCESS_PREFIX)LaunchedTest.cpp
+$(PROCESS_OBJ)PathResolverTest.o : \
+    $(PROCESS_TEST_DIR)/$(PROCESS_PREFIX)PathResolverTest.cpp
+$(PROCESS_OBJ)UsageTableTest.o : \
+    $(PROCESS_TEST_DIR)/$(PROCESS_PREFIX)UsageTableTest.cpp
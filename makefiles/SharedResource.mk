@@ -9,6 +9,7 @@ SHARED_OBJ := $(JUCE_OBJDIR)/$(SHARED_PREFIX)
 
 OBJECTS_SHARED_IMPL := \
   $(SHARED_OBJ)Holder.o \
+  $(SHARED_OBJ)HandlerRegistry.o \
   $(SHARED_OBJ)ReferenceInterface.o \
   $(SHARED_OBJ)Instance.o \
   $(SHARED_OBJ)Reference.o \
@@ -32,7 +33,9 @@ SHARED_TEST_PREFIX := $(SHARED_PREFIX)Test_
 SHARED_TEST_OBJ := $(SHARED_OBJ)Test_
 OBJECTS_SHARED_TEST := \
   $(SHARED_TEST_OBJ)ModuleTest.o \
-  $(SHARED_TEST_OBJ)ModuleTestClasses.o
+  $(SHARED_TEST_OBJ)ModuleTestClasses.o \
+  $(SHARED_TEST_OBJ)LockContentionTest.o \
+  $(SHARED_TEST_OBJ)HandlerNotificationTest.o
 
 ifeq ($(BUILD_TESTS), 1)
     OBJECTS_SHARED_RESOURCE := $(OBJECTS_SHARED_RESOURCE) \
@@ -48,6 +51,8 @@ sharedResource : $(OBJECTS_SHARED_RESOURCE)
 
 $(SHARED_OBJ)Holder.o : \
     $(SHARED_IMPL_DIR)/$(SHARED_PREFIX)Holder.cpp
+$(SHARED_OBJ)HandlerRegistry.o : \
+    $(SHARED_IMPL_DIR)/$(SHARED_PREFIX)HandlerRegistry.cpp
 $(SHARED_OBJ)ReferenceInterface.o : \
     $(SHARED_IMPL_DIR)/$(SHARED_PREFIX)ReferenceInterface.cpp
 $(SHARED_OBJ)Instance.o : \
@@ -74,3 +79,7 @@ $(SHARED_TEST_OBJ)ModuleTest.o : \
     $(SHARED_TEST_DIR)/$(SHARED_TEST_PREFIX)ModuleTest.cpp
 $(SHARED_TEST_OBJ)ModuleTestClasses.o : \
     $(SHARED_TEST_DIR)/$(SHARED_TEST_PREFIX)ModuleTestClasses.cpp
+$(SHARED_TEST_OBJ)LockContentionTest.o : \
+    $(SHARED_TEST_DIR)/$(SHARED_TEST_PREFIX)LockContentionTest.cpp
+$(SHARED_TEST_OBJ)HandlerNotificationTest.o : \
+    $(SHARED_TEST_DIR)/$(SHARED_TEST_PREFIX)HandlerNotificationTest.cpp
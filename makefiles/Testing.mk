@@ -7,7 +7,8 @@ TEST_OBJ := $(JUCE_OBJDIR)/$(TEST_PREFIX)
 OBJECTS_TEST := \
   $(TEST_OBJ)StressTest.o \
   $(TEST_OBJ)Window.o \
-  $(TEST_OBJ)DelayUtils.o
+  $(TEST_OBJ)DelayUtils.o \
+  $(TEST_OBJ)Benchmark.o
 
 
 ifeq ($(BUILD_TESTS), 1)
@@ -24,3 +25,5 @@ $(TEST_OBJ)Window.o: \
 	$(TEST_DIR)/$(TEST_PREFIX)Window.cpp
 $(TEST_OBJ)DelayUtils.o: \
 	$(TEST_DIR)/$(TEST_PREFIX)DelayUtils.cpp
+$(TEST_OBJ)Benchmark.o: \
+	$(TEST_DIR)/$(TEST_PREFIX)Benchmark.cpp
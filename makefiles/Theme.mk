@@ -2,6 +2,7 @@
 THEME_DIR    = Source/GUI/Theme
 THEME_COLOUR_DIR   := $(THEME_DIR)/Colour
 THEME_IMAGE_DIR   := $(THEME_DIR)/Image
+THEME_TEST_DIR = Tests/GUI/Theme
 
 THEME_PREFIX  = Theme_
 THEME_OBJ    := $(JUCE_OBJDIR)/$(THEME_PREFIX)
@@ -29,7 +30,10 @@ OBJECTS_THEME := \
   $(OBJECTS_THEME_IMAGE) \
   $(THEME_OBJ)LookAndFeel.o
 
-OBJECTS_THEME_TEST :=
+THEME_TEST_PREFIX := $(THEME_PREFIX)Test_
+THEME_TEST_OBJ := $(THEME_OBJ)Test_
+OBJECTS_THEME_TEST := \
+  $(THEME_TEST_OBJ)LookAndFeelTest.o
 
 ifeq ($(BUILD_TESTS), 1)
     OBJECTS_THEME := $(OBJECTS_THEME) $(OBJECTS_THEME_TEST)
@@ -66,3 +70,6 @@ $(THEME_IMAGE_OBJ)ConfigListener.o : \
 
 $(THEME_OBJ)LookAndFeel.o : \
     $(THEME_DIR)/Theme_LookAndFeel.cpp
+
+$(THEME_TEST_OBJ)LookAndFeelTest.o : \
+    $(THEME_TEST_DIR)/$(THEME_TEST_PREFIX)LookAndFeelTest.cpp
@@ -9,7 +9,9 @@ OBJECTS_UTIL := \
   $(UTIL_OBJ)Commands.o \
   $(UTIL_OBJ)TempTimer.o \
   $(UTIL_OBJ)ShutdownListener.o \
-  $(UTIL_OBJ)ConditionChecker.o
+  $(UTIL_OBJ)ConditionChecker.o \
+  $(UTIL_OBJ)InotifyWatcher.o \
+  $(UTIL_OBJ)WorkerPool.o
 
 UTIL_TEST_PREFIX := $(UTIL_PREFIX)Test_
 UTIL_TEST_OBJ := $(UTIL_OBJ)Test_
@@ -36,6 +38,10 @@ $(UTIL_OBJ)ShutdownListener.o : \
     $(UTIL_DIR)/$(UTIL_PREFIX)ShutdownListener.cpp
 $(UTIL_OBJ)ConditionChecker.o : \
     $(UTIL_DIR)/$(UTIL_PREFIX)ConditionChecker.cpp
+$(UTIL_OBJ)InotifyWatcher.o : \
+    $(UTIL_DIR)/$(UTIL_PREFIX)InotifyWatcher.cpp
+$(UTIL_OBJ)WorkerPool.o : \
+    $(UTIL_DIR)/$(UTIL_PREFIX)WorkerPool.cpp
 
 $(UTIL_TEST_OBJ)ShutdownListenerTest.o : \
     $(UTIL_TEST_DIR)/$(UTIL_TEST_PREFIX)ShutdownListenerTest.cpp
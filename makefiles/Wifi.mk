@@ -85,7 +85,8 @@ WIFI_AP_LIST_OBJ := $(WIFI_OBJ)APList_
 OBJECTS_WIFI_ACCESS_POINT_LIST := \
   $(WIFI_AP_LIST_OBJ)Module.o \
   $(WIFI_AP_LIST_OBJ)Listener.o \
-  $(WIFI_AP_LIST_OBJ)Reader.o
+  $(WIFI_AP_LIST_OBJ)Reader.o \
+  $(WIFI_AP_LIST_OBJ)UpdateQueue.o
 
 ################ Connection Submodules ################
 
@@ -171,7 +172,9 @@ OBJECTS_WIFI_TESTUTILS := \
 
 OBJECTS_WIFI_TEST := \
   $(OBJECTS_WIFI_TESTUTILS) \
+  $(WIFI_OBJ)LibNM_APHashMapTest.o \
   $(WIFI_OBJ)APList_ListTest.o \
+  $(WIFI_OBJ)APList_UpdateQueueTest.o \
   $(WIFI_OBJ)Connection_Control_ControlTest.o
 
 ifeq ($(BUILD_TESTS), 1)
@@ -239,6 +242,8 @@ $(WIFI_AP_LIST_OBJ)Listener.o : \
     $(WIFI_AP_LIST_DIR)/$(WIFI_AP_LIST_PREFIX)Listener.cpp
 $(WIFI_AP_LIST_OBJ)Reader.o : \
     $(WIFI_AP_LIST_DIR)/$(WIFI_AP_LIST_PREFIX)Reader.cpp
+$(WIFI_AP_LIST_OBJ)UpdateQueue.o : \
+    $(WIFI_AP_LIST_DIR)/$(WIFI_AP_LIST_PREFIX)UpdateQueue.cpp
 $(WIFI_AP_LIST_OBJ)NMReader.o : \
     $(WIFI_AP_LIST_DIR)/$(WIFI_AP_LIST_PREFIX)NMReader.cpp
 $(WIFI_AP_LIST_OBJ)Writer.o : \
@@ -289,8 +294,12 @@ $(WIFI_TESTUTILS_OBJ)ConnectionListener.o : \
 $(WIFI_TESTUTILS_OBJ)Waiting.o : \
     $(WIFI_TESTUTILS_DIR)/$(WIFI_TESTUTILS_PREFIX)Waiting.cpp
 
+$(WIFI_OBJ)LibNM_APHashMapTest.o : \
+    $(WIFI_TEST_DIR)/$(WIFI_PREFIX)LibNM_APHashMapTest.cpp
 $(WIFI_OBJ)APList_ListTest.o : \
     $(WIFI_TEST_DIR)/$(WIFI_PREFIX)APList_ListTest.cpp
+$(WIFI_OBJ)APList_UpdateQueueTest.o : \
+    $(WIFI_TEST_DIR)/$(WIFI_PREFIX)APList_UpdateQueueTest.cpp
 $(WIFI_OBJ)Connection_Control_ControlTest.o : \
     $(WIFI_TEST_DIR)/$(WIFI_PREFIX)Connection_Control_ControlTest.cpp
 